@@ -0,0 +1,1498 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApiTrace.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+
+// HAPI functions going through the trace layer.
+// The queries are what is needed to translate the outputs of a cooked node, the state changing calls
+// are the ones used to create and update the nodes and input geometry before cooking.
+// New functions must be added at the end of the list, as the trace files store their index.
+#define HOUDINI_API_TRACE_FUNCTIONS(X) \
+	X(IsInitialized) \
+	X(IsSessionValid) \
+	X(GetStatus) \
+	X(GetStatusStringBufLength) \
+	X(GetStatusString) \
+	X(GetStringBufLength) \
+	X(GetString) \
+	X(GetStringBatchSize) \
+	X(GetStringBatch) \
+	X(CookNode) \
+	X(GetTotalCookCount) \
+	X(GetNodeInfo) \
+	X(GetAssetInfo) \
+	X(GetObjectInfo) \
+	X(ComposeObjectList) \
+	X(GetComposedObjectList) \
+	X(GetComposedObjectTransforms) \
+	X(GetObjectTransform) \
+	X(ComposeChildNodeList) \
+	X(GetComposedChildNodeList) \
+	X(GetNodePath) \
+	X(GetOutputGeoCount) \
+	X(GetOutputGeoInfos) \
+	X(GetDisplayGeoInfo) \
+	X(GetGeoInfo) \
+	X(GetPartInfo) \
+	X(GetAttributeInfo) \
+	X(GetAttributeNames) \
+	X(GetAttributeFloatData) \
+	X(GetAttributeFloat64Data) \
+	X(GetAttributeIntData) \
+	X(GetAttributeInt64Data) \
+	X(GetAttributeInt8Data) \
+	X(GetAttributeInt16Data) \
+	X(GetAttributeUInt8Data) \
+	X(GetAttributeStringData) \
+	X(GetAttributeDictionaryData) \
+	X(GetAttributeFloatArrayData) \
+	X(GetAttributeIntArrayData) \
+	X(GetAttributeStringArrayData) \
+	X(GetFaceCounts) \
+	X(GetVertexList) \
+	X(GetGroupNames) \
+	X(GetGroupMembership) \
+	X(GetGroupCountOnPackedInstancePart) \
+	X(GetGroupNamesOnPackedInstancePart) \
+	X(GetGroupMembershipOnPackedInstancePart) \
+	X(GetEdgeCountOfEdgeGroup) \
+	X(GetInstancedPartIds) \
+	X(GetInstancerPartTransforms) \
+	X(GetInstancedObjectIds) \
+	X(GetInstanceTransformsOnPart) \
+	X(GetCurveInfo) \
+	X(GetCurveCounts) \
+	X(GetCurveOrders) \
+	X(GetCurveKnots) \
+	X(GetVolumeInfo) \
+	X(GetVolumeBounds) \
+	X(GetHeightFieldData) \
+	X(GetBoxInfo) \
+	X(GetSphereInfo) \
+	X(GetMaterialNodeIdsOnFaces) \
+	X(GetMaterialInfo) \
+	X(CreateNode) \
+	X(CreateInputNode) \
+	X(DeleteNode) \
+	X(ConnectNodeInput) \
+	X(DisconnectNodeInput) \
+	X(SetParmIntValue) \
+	X(SetParmIntValues) \
+	X(SetParmFloatValue) \
+	X(SetParmFloatValues) \
+	X(SetParmStringValue) \
+	X(SetObjectTransform) \
+	X(SetPartInfo) \
+	X(AddAttribute) \
+	X(SetAttributeFloatData) \
+	X(SetAttributeIntData) \
+	X(SetAttributeStringData) \
+	X(SetVertexList) \
+	X(SetFaceCounts) \
+	X(AddGroup) \
+	X(SetGroupMembership) \
+	X(SetCurveInfo) \
+	X(SetCurveCounts) \
+	X(SetCurveOrders) \
+	X(SetCurveKnots) \
+	X(SetVolumeInfo) \
+	X(SetHeightFieldData) \
+	X(CommitGeo) \
+	X(RevertGeo)
+
+// Struct initializers that are replaced when replaying without libHAPI.
+#define HOUDINI_API_TRACE_INIT_FUNCTIONS(X) \
+	X(AssetInfo_Init, HAPI_AssetInfo) \
+	X(AttributeInfo_Init, HAPI_AttributeInfo) \
+	X(CookOptions_Init, HAPI_CookOptions) \
+	X(CurveInfo_Init, HAPI_CurveInfo) \
+	X(GeoInfo_Init, HAPI_GeoInfo) \
+	X(MaterialInfo_Init, HAPI_MaterialInfo) \
+	X(NodeInfo_Init, HAPI_NodeInfo) \
+	X(ObjectInfo_Init, HAPI_ObjectInfo) \
+	X(PartInfo_Init, HAPI_PartInfo) \
+	X(TransformEuler_Init, HAPI_TransformEuler) \
+	X(Transform_Init, HAPI_Transform) \
+	X(VolumeInfo_Init, HAPI_VolumeInfo)
+
+namespace HoudiniApiTrace
+{
+	enum class EFunction : uint16
+	{
+#define HOUDINI_API_TRACE_ENUM(Name) Name,
+		HOUDINI_API_TRACE_FUNCTIONS(HOUDINI_API_TRACE_ENUM)
+#undef HOUDINI_API_TRACE_ENUM
+		Count
+	};
+
+	static const TCHAR* FunctionNames[] =
+	{
+#define HOUDINI_API_TRACE_NAME(Name) TEXT(#Name),
+		HOUDINI_API_TRACE_FUNCTIONS(HOUDINI_API_TRACE_NAME)
+#undef HOUDINI_API_TRACE_NAME
+	};
+
+	// Function pointers replaced by the trace layer, restored when stopping.
+	namespace Original
+	{
+#define HOUDINI_API_TRACE_ORIGINAL(Name) static FHoudiniApi::Name##FuncPtr Name = nullptr;
+		HOUDINI_API_TRACE_FUNCTIONS(HOUDINI_API_TRACE_ORIGINAL)
+#undef HOUDINI_API_TRACE_ORIGINAL
+
+#define HOUDINI_API_TRACE_ORIGINAL_INIT(Name, Type) static FHoudiniApi::Name##FuncPtr Name = nullptr;
+		HOUDINI_API_TRACE_INIT_FUNCTIONS(HOUDINI_API_TRACE_ORIGINAL_INIT)
+#undef HOUDINI_API_TRACE_ORIGINAL_INIT
+	}
+
+	// Trace file layout:
+	//   uint32 Magic, uint32 Version
+	//   then for each call:
+	//   uint16 Function, uint32 ArgsHash, int32 Result, float Seconds,
+	//   uint8 BufferCount, BufferCount x (int32 Size, Size bytes)
+	static const uint32 TraceMagic = 0x54504148; // "HAPT"
+	static const uint32 TraceVersion = 1;
+
+	enum class EMode : uint8
+	{
+		None,
+		Record,
+		Replay
+	};
+
+	struct FRecord
+	{
+		int32 Result = HAPI_RESULT_FAILURE;
+		float Seconds = 0.0f;
+		TArray<TArray<uint8>> Buffers;
+	};
+
+	static EMode Mode = EMode::None;
+	static FCriticalSection TraceLock;
+
+	// Recording
+	static TUniquePtr<FArchive> Writer;
+
+	// Replay: handed out by FHoudiniEngine::GetSession() when there is no session, the traced calls ignore it.
+	static HAPI_Session ReplaySession = { HAPI_SESSION_INPROCESS, 0 };
+
+	// Replay: recorded calls per function / arguments key, and the index of the next one to serve.
+	static TMap<uint64, TArray<FRecord>> Records;
+	static TMap<uint64, int32> RecordCursors;
+
+	static FHoudiniApiTraceTiming Timings[(int32)EFunction::Count];
+
+	static uint64
+	MakeKey(const EFunction InFunction, const uint32 InArgsHash)
+	{
+		return ((uint64)InFunction << 32) | (uint64)InArgsHash;
+	}
+
+	static uint32
+	HashArg(const char* InString)
+	{
+		return InString ? FCrc::StrCrc32(InString) : 0;
+	}
+
+	template<typename T>
+	static uint32
+	HashArg(const T InValue)
+	{
+		return GetTypeHash(static_cast<int64>(InValue));
+	}
+
+	static uint32
+	HashArgs()
+	{
+		return 0;
+	}
+
+	template<typename T, typename... TRest>
+	static uint32
+	HashArgs(const T& InFirst, const TRest&... InRest)
+	{
+		return HashCombine(HashArg(InFirst), HashArgs(InRest...));
+	}
+
+	template<typename T>
+	static uint32
+	HashBuffer(const T* InData, const int32 InCount)
+	{
+		return (InData && InCount > 0) ? FCrc::MemCrc32(InData, InCount * sizeof(T)) : 0;
+	}
+
+	template<typename T>
+	static void
+	ZeroInit(T* In)
+	{
+		if (In)
+			FMemory::Memzero(*In);
+	}
+
+	// One traced call.
+	// When recording, the wrapper calls the original function, declares its output buffers and
+	// finishes the call, which appends it to the trace.
+	// When replaying, the recorded call is looked up on construction, and declaring
+	// the output buffers fills them with the recorded data.
+	class FCall
+	{
+	public:
+
+		FCall(const EFunction InFunction, const uint32 InArgsHash)
+			: Function(InFunction)
+			, ArgsHash(InArgsHash)
+			, StartTime(FPlatformTime::Seconds())
+			, bReplaying(Mode == EMode::Replay)
+			, Record(nullptr)
+			, BufferIndex(0)
+		{
+			if (!bReplaying)
+				return;
+
+			const uint64 Key = MakeKey(Function, ArgsHash);
+			FScopeLock ScopeLock(&TraceLock);
+			const TArray<FRecord>* FoundRecords = Records.Find(Key);
+			if (!FoundRecords || FoundRecords->Num() <= 0)
+				return;
+
+			// Serve identical calls in recording order, then keep serving the last one.
+			int32& Cursor = RecordCursors.FindOrAdd(Key);
+			Record = &(*FoundRecords)[FMath::Min(Cursor, FoundRecords->Num() - 1)];
+			Cursor++;
+		}
+
+		bool IsReplaying() const { return bReplaying; }
+
+		// Declares an output buffer of InCount elements.
+		template<typename T>
+		void Buffer(T* InData, const int32 InCount)
+		{
+			AddBuffer(InData, (InData && InCount > 0) ? InCount * sizeof(T) : 0);
+		}
+
+		HAPI_Result Finish(const HAPI_Result InResult)
+		{
+			const double Seconds = FPlatformTime::Seconds() - StartTime;
+			int64 ReturnedBytes = 0;
+
+			FScopeLock ScopeLock(&TraceLock);
+			FHoudiniApiTraceTiming& Timing = Timings[(int32)Function];
+			Timing.CallCount++;
+			Timing.TotalSeconds += Seconds;
+
+			if (bReplaying)
+			{
+				if (!Record)
+				{
+					if (Timing.MissCount++ == 0)
+						HOUDINI_LOG_WARNING(TEXT("HAPI trace replay: no recorded call matching %s."), FunctionNames[(int32)Function]);
+					return HAPI_RESULT_FAILURE;
+				}
+
+				for (int32 Idx = 0; Idx < Record->Buffers.Num(); Idx++)
+					ReturnedBytes += Record->Buffers[Idx].Num();
+
+				Timing.RecordedSeconds += Record->Seconds;
+				Timing.ReturnedBytes += ReturnedBytes;
+				return (HAPI_Result)Record->Result;
+			}
+
+			if (Writer.IsValid())
+			{
+				FArchive& Ar = *Writer;
+				uint16 FunctionId = (uint16)Function;
+				int32 Result = (int32)InResult;
+				float RecordedSeconds = (float)Seconds;
+				uint8 BufferCount = (uint8)PendingBuffers.Num();
+				Ar << FunctionId;
+				Ar << ArgsHash;
+				Ar << Result;
+				Ar << RecordedSeconds;
+				Ar << BufferCount;
+				for (const TPair<void*, int32>& Pending : PendingBuffers)
+				{
+					// The content of the output buffers is undefined when the call failed
+					int32 Size = InResult == HAPI_RESULT_SUCCESS ? Pending.Value : 0;
+					Ar << Size;
+					if (Size > 0)
+						Ar.Serialize(Pending.Key, Size);
+
+					ReturnedBytes += Size;
+				}
+			}
+
+			Timing.RecordedSeconds += Seconds;
+			Timing.ReturnedBytes += ReturnedBytes;
+			return InResult;
+		}
+
+	private:
+
+		void AddBuffer(void* InData, const int32 InSize)
+		{
+			if (!bReplaying)
+			{
+				// Buffers are only serialized when finishing, to keep them out of the call timing.
+				PendingBuffers.Add(TPair<void*, int32>(InData, InSize));
+				return;
+			}
+
+			if (Record && Record->Buffers.IsValidIndex(BufferIndex) && InData)
+			{
+				const TArray<uint8>& Recorded = Record->Buffers[BufferIndex];
+				FMemory::Memcpy(InData, Recorded.GetData(), FMath::Min(InSize, Recorded.Num()));
+			}
+			BufferIndex++;
+		}
+
+		EFunction Function;
+		uint32 ArgsHash;
+		double StartTime;
+		bool bReplaying;
+		const FRecord* Record;
+		int32 BufferIndex;
+		TArray<TPair<void*, int32>, TInlineAllocator<4>> PendingBuffers;
+	};
+
+	// Calls the original function when recording, pretends it succeeded when replaying.
+	#define HOUDINI_API_TRACE_FORWARD(Name, ...) \
+		(Call.IsReplaying() ? HAPI_RESULT_SUCCESS : Original::Name(__VA_ARGS__))
+
+	// Shared implementations for the functions with identical layouts.
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	GetNodeStruct(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, T* info)
+	{
+		FCall Call(InFunction, HashArgs(node_id));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, info);
+		Call.Buffer(info, 1);
+		return Call.Finish(Result);
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	GetPartStruct(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, T* info)
+	{
+		FCall Call(InFunction, HashArgs(node_id, part_id));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, info);
+		Call.Buffer(info, 1);
+		return Call.Finish(Result);
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	GetPartArray(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, T* data_array, int start, int length)
+	{
+		FCall Call(InFunction, HashArgs(node_id, part_id, start, length));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, data_array, start, length);
+		Call.Buffer(data_array, length);
+		return Call.Finish(Result);
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	GetPartTransforms(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, T* transforms_array, int start, int length)
+	{
+		FCall Call(InFunction, HashArgs(node_id, part_id, rst_order, start, length));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, rst_order, transforms_array, start, length);
+		Call.Buffer(transforms_array, length);
+		return Call.Finish(Result);
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	GetAttributeData(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name,
+		HAPI_AttributeInfo* attr_info, int stride, T* data_array, int start, int length)
+	{
+		const int32 Owner = attr_info ? (int32)attr_info->owner : -1;
+		const int32 TupleSize = stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1);
+		FCall Call(InFunction, HashArgs(node_id, part_id, name, Owner, stride, start, length));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Buffer(attr_info, 1);
+		Call.Buffer(data_array, length * TupleSize);
+		return Call.Finish(Result);
+	}
+
+	template<typename TFuncPtr>
+	static HAPI_Result
+	GetAttributeHandleData(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name,
+		HAPI_AttributeInfo* attr_info, HAPI_StringHandle* data_array, int start, int length)
+	{
+		const int32 Owner = attr_info ? (int32)attr_info->owner : -1;
+		const int32 TupleSize = attr_info ? attr_info->tupleSize : 1;
+		FCall Call(InFunction, HashArgs(node_id, part_id, name, Owner, start, length));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, name, attr_info, data_array, start, length);
+		Call.Buffer(attr_info, 1);
+		Call.Buffer(data_array, length * TupleSize);
+		return Call.Finish(Result);
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	GetAttributeArrayData(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name,
+		HAPI_AttributeInfo* attr_info, T* data_fixed_array, int data_fixed_length, int* sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		const int32 Owner = attr_info ? (int32)attr_info->owner : -1;
+		FCall Call(InFunction, HashArgs(node_id, part_id, name, Owner, data_fixed_length, start, sizes_fixed_length));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(
+			session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Buffer(attr_info, 1);
+		Call.Buffer(data_fixed_array, data_fixed_length);
+		Call.Buffer(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	// Set*Data(session, node_id, part_id, data_array, start, length) calls.
+	// The data is not hashed: replaying only needs to return the recorded result.
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	SetPartArray(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const T* data_array, int start, int length)
+	{
+		FCall Call(InFunction, HashArgs(node_id, part_id, start, length));
+		return Call.Finish(Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, data_array, start, length));
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	SetPartStruct(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const T* info)
+	{
+		FCall Call(InFunction, HashArgs(node_id, part_id));
+		return Call.Finish(Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, info));
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	SetAttributeData(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name,
+		const HAPI_AttributeInfo* attr_info, T data_array, int start, int length)
+	{
+		const int32 Owner = attr_info ? (int32)attr_info->owner : -1;
+		FCall Call(InFunction, HashArgs(node_id, part_id, name, Owner, start, length));
+		return Call.Finish(Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, part_id, name, attr_info, data_array, start, length));
+	}
+
+	template<typename T, typename TFuncPtr>
+	static HAPI_Result
+	SetParmValues(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, const T* values_array, int start, int length)
+	{
+		FCall Call(InFunction, HashArgs(node_id, start, length));
+		return Call.Finish(Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id, values_array, start, length));
+	}
+
+	template<typename TFuncPtr>
+	static HAPI_Result
+	NodeCall(const EFunction InFunction, TFuncPtr InOriginal, const HAPI_Session* session, HAPI_NodeId node_id)
+	{
+		FCall Call(InFunction, HashArgs(node_id));
+		return Call.Finish(Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(session, node_id));
+	}
+
+	template<typename TFuncPtr>
+	static HAPI_Result
+	GetGroupMembershipData(
+		const EFunction InFunction, TFuncPtr InOriginal,
+		const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char* group_name,
+		HAPI_Bool* membership_array_all_equal, int* membership_array, int start, int length)
+	{
+		FCall Call(InFunction, HashArgs(node_id, part_id, group_type, group_name, start, length));
+		const HAPI_Result Result = Call.IsReplaying() ? HAPI_RESULT_SUCCESS : InOriginal(
+			session, node_id, part_id, group_type, group_name, membership_array_all_equal, membership_array, start, length);
+		Call.Buffer(membership_array_all_equal, 1);
+		Call.Buffer(membership_array, length);
+		return Call.Finish(Result);
+	}
+
+	// Wrappers installed in the FHoudiniApi function table.
+	namespace Wrapper
+	{
+		static HAPI_Result
+		IsInitialized(const HAPI_Session* session)
+		{
+			FCall Call(EFunction::IsInitialized, 0);
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(IsInitialized, session));
+		}
+
+		static HAPI_Result
+		IsSessionValid(const HAPI_Session* session)
+		{
+			FCall Call(EFunction::IsSessionValid, 0);
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(IsSessionValid, session));
+		}
+
+		static HAPI_Result
+		GetStatus(const HAPI_Session* session, HAPI_StatusType status_type, int* status)
+		{
+			FCall Call(EFunction::GetStatus, HashArgs(status_type));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetStatus, session, status_type, status);
+			Call.Buffer(status, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetStatusStringBufLength(const HAPI_Session* session, HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, int* buffer_length)
+		{
+			FCall Call(EFunction::GetStatusStringBufLength, HashArgs(status_type, verbosity));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetStatusStringBufLength, session, status_type, verbosity, buffer_length);
+			Call.Buffer(buffer_length, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetStatusString(const HAPI_Session* session, HAPI_StatusType status_type, char* string_value, int length)
+		{
+			FCall Call(EFunction::GetStatusString, HashArgs(status_type, length));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetStatusString, session, status_type, string_value, length);
+			Call.Buffer(string_value, length);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetStringBufLength(const HAPI_Session* session, HAPI_StringHandle string_handle, int* buffer_length)
+		{
+			FCall Call(EFunction::GetStringBufLength, HashArgs(string_handle));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetStringBufLength, session, string_handle, buffer_length);
+			Call.Buffer(buffer_length, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetString(const HAPI_Session* session, HAPI_StringHandle string_handle, char* string_value, int length)
+		{
+			FCall Call(EFunction::GetString, HashArgs(string_handle, length));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetString, session, string_handle, string_value, length);
+			Call.Buffer(string_value, length);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetStringBatchSize(const HAPI_Session* session, const int* string_handle_array, int string_handle_count, int* string_buffer_size)
+		{
+			FCall Call(EFunction::GetStringBatchSize, HashCombine(HashBuffer(string_handle_array, string_handle_count), HashArgs(string_handle_count)));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetStringBatchSize, session, string_handle_array, string_handle_count, string_buffer_size);
+			Call.Buffer(string_buffer_size, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetStringBatch(const HAPI_Session* session, char* char_buffer, int char_array_length)
+		{
+			FCall Call(EFunction::GetStringBatch, HashArgs(char_array_length));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetStringBatch, session, char_buffer, char_array_length);
+			Call.Buffer(char_buffer, char_array_length);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		CookNode(const HAPI_Session* session, HAPI_NodeId node_id, const HAPI_CookOptions* cook_options)
+		{
+			FCall Call(EFunction::CookNode, HashArgs(node_id));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(CookNode, session, node_id, cook_options));
+		}
+
+		static HAPI_Result
+		GetTotalCookCount(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_NodeTypeBits node_type_filter, HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int* count)
+		{
+			FCall Call(EFunction::GetTotalCookCount, HashArgs(node_id, node_type_filter, node_flags_filter, recursive));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetTotalCookCount, session, node_id, node_type_filter, node_flags_filter, recursive, count);
+			Call.Buffer(count, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetNodeInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_NodeInfo* node_info)
+		{
+			return GetNodeStruct(EFunction::GetNodeInfo, Original::GetNodeInfo, session, node_id, node_info);
+		}
+
+		static HAPI_Result
+		GetAssetInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_AssetInfo* asset_info)
+		{
+			return GetNodeStruct(EFunction::GetAssetInfo, Original::GetAssetInfo, session, node_id, asset_info);
+		}
+
+		static HAPI_Result
+		GetObjectInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_ObjectInfo* object_info)
+		{
+			return GetNodeStruct(EFunction::GetObjectInfo, Original::GetObjectInfo, session, node_id, object_info);
+		}
+
+		static HAPI_Result
+		ComposeObjectList(const HAPI_Session* session, HAPI_NodeId parent_node_id, const char* categories, int* object_count)
+		{
+			FCall Call(EFunction::ComposeObjectList, HashArgs(parent_node_id, categories));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(ComposeObjectList, session, parent_node_id, categories, object_count);
+			Call.Buffer(object_count, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetComposedObjectList(const HAPI_Session* session, HAPI_NodeId parent_node_id, HAPI_ObjectInfo* object_infos_array, int start, int length)
+		{
+			FCall Call(EFunction::GetComposedObjectList, HashArgs(parent_node_id, start, length));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetComposedObjectList, session, parent_node_id, object_infos_array, start, length);
+			Call.Buffer(object_infos_array, length);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetComposedObjectTransforms(const HAPI_Session* session, HAPI_NodeId parent_node_id, HAPI_RSTOrder rst_order, HAPI_Transform* transform_array, int start, int length)
+		{
+			FCall Call(EFunction::GetComposedObjectTransforms, HashArgs(parent_node_id, rst_order, start, length));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetComposedObjectTransforms, session, parent_node_id, rst_order, transform_array, start, length);
+			Call.Buffer(transform_array, length);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetObjectTransform(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_RSTOrder rst_order, HAPI_Transform* transform)
+		{
+			FCall Call(EFunction::GetObjectTransform, HashArgs(node_id, relative_to_node_id, rst_order));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetObjectTransform, session, node_id, relative_to_node_id, rst_order, transform);
+			Call.Buffer(transform, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		ComposeChildNodeList(const HAPI_Session* session, HAPI_NodeId parent_node_id, HAPI_NodeTypeBits node_type_filter, HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int* count)
+		{
+			FCall Call(EFunction::ComposeChildNodeList, HashArgs(parent_node_id, node_type_filter, node_flags_filter, recursive));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(ComposeChildNodeList, session, parent_node_id, node_type_filter, node_flags_filter, recursive, count);
+			Call.Buffer(count, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetComposedChildNodeList(const HAPI_Session* session, HAPI_NodeId parent_node_id, HAPI_NodeId* child_node_ids_array, int count)
+		{
+			FCall Call(EFunction::GetComposedChildNodeList, HashArgs(parent_node_id, count));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetComposedChildNodeList, session, parent_node_id, child_node_ids_array, count);
+			Call.Buffer(child_node_ids_array, count);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetNodePath(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_StringHandle* path)
+		{
+			FCall Call(EFunction::GetNodePath, HashArgs(node_id, relative_to_node_id));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetNodePath, session, node_id, relative_to_node_id, path);
+			Call.Buffer(path, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetOutputGeoCount(const HAPI_Session* session, HAPI_NodeId node_id, int* count)
+		{
+			FCall Call(EFunction::GetOutputGeoCount, HashArgs(node_id));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetOutputGeoCount, session, node_id, count);
+			Call.Buffer(count, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetOutputGeoInfos(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_GeoInfo* geo_infos_array, int count)
+		{
+			FCall Call(EFunction::GetOutputGeoInfos, HashArgs(node_id, count));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetOutputGeoInfos, session, node_id, geo_infos_array, count);
+			Call.Buffer(geo_infos_array, count);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetDisplayGeoInfo(const HAPI_Session* session, HAPI_NodeId object_node_id, HAPI_GeoInfo* geo_info)
+		{
+			return GetNodeStruct(EFunction::GetDisplayGeoInfo, Original::GetDisplayGeoInfo, session, object_node_id, geo_info);
+		}
+
+		static HAPI_Result
+		GetGeoInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_GeoInfo* geo_info)
+		{
+			return GetNodeStruct(EFunction::GetGeoInfo, Original::GetGeoInfo, session, node_id, geo_info);
+		}
+
+		static HAPI_Result
+		GetPartInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartInfo* part_info)
+		{
+			return GetPartStruct(EFunction::GetPartInfo, Original::GetPartInfo, session, node_id, part_id, part_info);
+		}
+
+		static HAPI_Result
+		GetAttributeInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeOwner owner, HAPI_AttributeInfo* attr_info)
+		{
+			FCall Call(EFunction::GetAttributeInfo, HashArgs(node_id, part_id, name, owner));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetAttributeInfo, session, node_id, part_id, name, owner, attr_info);
+			Call.Buffer(attr_info, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetAttributeNames(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_AttributeOwner owner, HAPI_StringHandle* attribute_names_array, int count)
+		{
+			FCall Call(EFunction::GetAttributeNames, HashArgs(node_id, part_id, owner, count));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetAttributeNames, session, node_id, part_id, owner, attribute_names_array, count);
+			Call.Buffer(attribute_names_array, count);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetAttributeFloatData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int stride, float* data_array, int start, int length)
+		{
+			return GetAttributeData(EFunction::GetAttributeFloatData, Original::GetAttributeFloatData, session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeFloat64Data(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int stride, double* data_array, int start, int length)
+		{
+			return GetAttributeData(EFunction::GetAttributeFloat64Data, Original::GetAttributeFloat64Data, session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeIntData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int stride, int* data_array, int start, int length)
+		{
+			return GetAttributeData(EFunction::GetAttributeIntData, Original::GetAttributeIntData, session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeInt64Data(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int stride, HAPI_Int64* data_array, int start, int length)
+		{
+			return GetAttributeData(EFunction::GetAttributeInt64Data, Original::GetAttributeInt64Data, session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeInt8Data(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int stride, HAPI_Int8* data_array, int start, int length)
+		{
+			return GetAttributeData(EFunction::GetAttributeInt8Data, Original::GetAttributeInt8Data, session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeInt16Data(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int stride, HAPI_Int16* data_array, int start, int length)
+		{
+			return GetAttributeData(EFunction::GetAttributeInt16Data, Original::GetAttributeInt16Data, session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeUInt8Data(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int stride, HAPI_UInt8* data_array, int start, int length)
+		{
+			return GetAttributeData(EFunction::GetAttributeUInt8Data, Original::GetAttributeUInt8Data, session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeStringData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, HAPI_StringHandle* data_array, int start, int length)
+		{
+			return GetAttributeHandleData(EFunction::GetAttributeStringData, Original::GetAttributeStringData, session, node_id, part_id, name, attr_info, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeDictionaryData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, HAPI_StringHandle* data_array, int start, int length)
+		{
+			return GetAttributeHandleData(EFunction::GetAttributeDictionaryData, Original::GetAttributeDictionaryData, session, node_id, part_id, name, attr_info, data_array, start, length);
+		}
+
+		static HAPI_Result
+		GetAttributeFloatArrayData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, float* data_fixed_array, int data_fixed_length, int* sizes_fixed_array, int start, int sizes_fixed_length)
+		{
+			return GetAttributeArrayData(EFunction::GetAttributeFloatArrayData, Original::GetAttributeFloatArrayData, session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		}
+
+		static HAPI_Result
+		GetAttributeIntArrayData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, int* data_fixed_array, int data_fixed_length, int* sizes_fixed_array, int start, int sizes_fixed_length)
+		{
+			return GetAttributeArrayData(EFunction::GetAttributeIntArrayData, Original::GetAttributeIntArrayData, session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		}
+
+		static HAPI_Result
+		GetAttributeStringArrayData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, HAPI_AttributeInfo* attr_info, HAPI_StringHandle* data_fixed_array, int data_fixed_length, int* sizes_fixed_array, int start, int sizes_fixed_length)
+		{
+			return GetAttributeArrayData(EFunction::GetAttributeStringArrayData, Original::GetAttributeStringArrayData, session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		}
+
+		static HAPI_Result
+		GetFaceCounts(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, int* face_counts_array, int start, int length)
+		{
+			return GetPartArray(EFunction::GetFaceCounts, Original::GetFaceCounts, session, node_id, part_id, face_counts_array, start, length);
+		}
+
+		static HAPI_Result
+		GetVertexList(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, int* vertex_list_array, int start, int length)
+		{
+			return GetPartArray(EFunction::GetVertexList, Original::GetVertexList, session, node_id, part_id, vertex_list_array, start, length);
+		}
+
+		static HAPI_Result
+		GetGroupNames(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_GroupType group_type, HAPI_StringHandle* group_names_array, int group_count)
+		{
+			FCall Call(EFunction::GetGroupNames, HashArgs(node_id, group_type, group_count));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetGroupNames, session, node_id, group_type, group_names_array, group_count);
+			Call.Buffer(group_names_array, group_count);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetGroupMembership(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char* group_name, HAPI_Bool* membership_array_all_equal, int* membership_array, int start, int length)
+		{
+			return GetGroupMembershipData(EFunction::GetGroupMembership, Original::GetGroupMembership, session, node_id, part_id, group_type, group_name, membership_array_all_equal, membership_array, start, length);
+		}
+
+		static HAPI_Result
+		GetGroupCountOnPackedInstancePart(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, int* pointGroupCount, int* primitiveGroupCount)
+		{
+			FCall Call(EFunction::GetGroupCountOnPackedInstancePart, HashArgs(node_id, part_id));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetGroupCountOnPackedInstancePart, session, node_id, part_id, pointGroupCount, primitiveGroupCount);
+			Call.Buffer(pointGroupCount, 1);
+			Call.Buffer(primitiveGroupCount, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetGroupNamesOnPackedInstancePart(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, HAPI_StringHandle* group_names_array, int group_count)
+		{
+			FCall Call(EFunction::GetGroupNamesOnPackedInstancePart, HashArgs(node_id, part_id, group_type, group_count));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetGroupNamesOnPackedInstancePart, session, node_id, part_id, group_type, group_names_array, group_count);
+			Call.Buffer(group_names_array, group_count);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetGroupMembershipOnPackedInstancePart(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char* group_name, HAPI_Bool* membership_array_all_equal, int* membership_array, int start, int length)
+		{
+			return GetGroupMembershipData(EFunction::GetGroupMembershipOnPackedInstancePart, Original::GetGroupMembershipOnPackedInstancePart, session, node_id, part_id, group_type, group_name, membership_array_all_equal, membership_array, start, length);
+		}
+
+		static HAPI_Result
+		GetEdgeCountOfEdgeGroup(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* group_name, int* edge_count)
+		{
+			FCall Call(EFunction::GetEdgeCountOfEdgeGroup, HashArgs(node_id, part_id, group_name));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetEdgeCountOfEdgeGroup, session, node_id, part_id, group_name, edge_count);
+			Call.Buffer(edge_count, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetInstancedPartIds(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartId* instanced_parts_array, int start, int length)
+		{
+			return GetPartArray(EFunction::GetInstancedPartIds, Original::GetInstancedPartIds, session, node_id, part_id, instanced_parts_array, start, length);
+		}
+
+		static HAPI_Result
+		GetInstancerPartTransforms(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform* transforms_array, int start, int length)
+		{
+			return GetPartTransforms(EFunction::GetInstancerPartTransforms, Original::GetInstancerPartTransforms, session, node_id, part_id, rst_order, transforms_array, start, length);
+		}
+
+		static HAPI_Result
+		GetInstancedObjectIds(const HAPI_Session* session, HAPI_NodeId object_node_id, HAPI_NodeId* instanced_node_id_array, int start, int length)
+		{
+			FCall Call(EFunction::GetInstancedObjectIds, HashArgs(object_node_id, start, length));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetInstancedObjectIds, session, object_node_id, instanced_node_id_array, start, length);
+			Call.Buffer(instanced_node_id_array, length);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetInstanceTransformsOnPart(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform* transforms_array, int start, int length)
+		{
+			return GetPartTransforms(EFunction::GetInstanceTransformsOnPart, Original::GetInstanceTransformsOnPart, session, node_id, part_id, rst_order, transforms_array, start, length);
+		}
+
+		static HAPI_Result
+		GetCurveInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_CurveInfo* info)
+		{
+			return GetPartStruct(EFunction::GetCurveInfo, Original::GetCurveInfo, session, node_id, part_id, info);
+		}
+
+		static HAPI_Result
+		GetCurveCounts(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, int* counts_array, int start, int length)
+		{
+			return GetPartArray(EFunction::GetCurveCounts, Original::GetCurveCounts, session, node_id, part_id, counts_array, start, length);
+		}
+
+		static HAPI_Result
+		GetCurveOrders(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, int* orders_array, int start, int length)
+		{
+			return GetPartArray(EFunction::GetCurveOrders, Original::GetCurveOrders, session, node_id, part_id, orders_array, start, length);
+		}
+
+		static HAPI_Result
+		GetCurveKnots(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, float* knots_array, int start, int length)
+		{
+			return GetPartArray(EFunction::GetCurveKnots, Original::GetCurveKnots, session, node_id, part_id, knots_array, start, length);
+		}
+
+		static HAPI_Result
+		GetVolumeInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeInfo* volume_info)
+		{
+			return GetPartStruct(EFunction::GetVolumeInfo, Original::GetVolumeInfo, session, node_id, part_id, volume_info);
+		}
+
+		static HAPI_Result
+		GetVolumeBounds(
+			const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id,
+			float* x_min, float* y_min, float* z_min, float* x_max, float* y_max, float* z_max, float* x_center, float* y_center, float* z_center)
+		{
+			FCall Call(EFunction::GetVolumeBounds, HashArgs(node_id, part_id));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetVolumeBounds, session, node_id, part_id, x_min, y_min, z_min, x_max, y_max, z_max, x_center, y_center, z_center);
+			float* Bounds[] = { x_min, y_min, z_min, x_max, y_max, z_max, x_center, y_center, z_center };
+			for (float* Bound : Bounds)
+				Call.Buffer(Bound, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetHeightFieldData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, float* values_array, int start, int length)
+		{
+			return GetPartArray(EFunction::GetHeightFieldData, Original::GetHeightFieldData, session, node_id, part_id, values_array, start, length);
+		}
+
+		static HAPI_Result
+		GetBoxInfo(const HAPI_Session* session, HAPI_NodeId geo_node_id, HAPI_PartId part_id, HAPI_BoxInfo* box_info)
+		{
+			return GetPartStruct(EFunction::GetBoxInfo, Original::GetBoxInfo, session, geo_node_id, part_id, box_info);
+		}
+
+		static HAPI_Result
+		GetSphereInfo(const HAPI_Session* session, HAPI_NodeId geo_node_id, HAPI_PartId part_id, HAPI_SphereInfo* sphere_info)
+		{
+			return GetPartStruct(EFunction::GetSphereInfo, Original::GetSphereInfo, session, geo_node_id, part_id, sphere_info);
+		}
+
+		static HAPI_Result
+		GetMaterialNodeIdsOnFaces(const HAPI_Session* session, HAPI_NodeId geometry_node_id, HAPI_PartId part_id, HAPI_Bool* are_all_the_same, HAPI_NodeId* material_ids_array, int start, int length)
+		{
+			FCall Call(EFunction::GetMaterialNodeIdsOnFaces, HashArgs(geometry_node_id, part_id, start, length));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(GetMaterialNodeIdsOnFaces, session, geometry_node_id, part_id, are_all_the_same, material_ids_array, start, length);
+			Call.Buffer(are_all_the_same, 1);
+			Call.Buffer(material_ids_array, length);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		GetMaterialInfo(const HAPI_Session* session, HAPI_NodeId material_node_id, HAPI_MaterialInfo* material_info)
+		{
+			return GetNodeStruct(EFunction::GetMaterialInfo, Original::GetMaterialInfo, session, material_node_id, material_info);
+		}
+
+		static HAPI_Result
+		CreateNode(const HAPI_Session* session, HAPI_NodeId parent_node_id, const char* operator_name, const char* node_label, HAPI_Bool cook_on_creation, HAPI_NodeId* new_node_id)
+		{
+			FCall Call(EFunction::CreateNode, HashArgs(parent_node_id, operator_name, node_label, cook_on_creation));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(CreateNode, session, parent_node_id, operator_name, node_label, cook_on_creation, new_node_id);
+			Call.Buffer(new_node_id, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		CreateInputNode(const HAPI_Session* session, HAPI_NodeId* node_id, const char* name)
+		{
+			FCall Call(EFunction::CreateInputNode, HashArgs(name));
+			const HAPI_Result Result = HOUDINI_API_TRACE_FORWARD(CreateInputNode, session, node_id, name);
+			Call.Buffer(node_id, 1);
+			return Call.Finish(Result);
+		}
+
+		static HAPI_Result
+		DeleteNode(const HAPI_Session* session, HAPI_NodeId node_id)
+		{
+			return NodeCall(EFunction::DeleteNode, Original::DeleteNode, session, node_id);
+		}
+
+		static HAPI_Result
+		ConnectNodeInput(const HAPI_Session* session, HAPI_NodeId node_id, int input_index, HAPI_NodeId node_id_to_connect, int output_index)
+		{
+			FCall Call(EFunction::ConnectNodeInput, HashArgs(node_id, input_index, node_id_to_connect, output_index));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(ConnectNodeInput, session, node_id, input_index, node_id_to_connect, output_index));
+		}
+
+		static HAPI_Result
+		DisconnectNodeInput(const HAPI_Session* session, HAPI_NodeId node_id, int input_index)
+		{
+			FCall Call(EFunction::DisconnectNodeInput, HashArgs(node_id, input_index));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(DisconnectNodeInput, session, node_id, input_index));
+		}
+
+		static HAPI_Result
+		SetParmIntValue(const HAPI_Session* session, HAPI_NodeId node_id, const char* parm_name, int index, int value)
+		{
+			FCall Call(EFunction::SetParmIntValue, HashArgs(node_id, parm_name, index));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(SetParmIntValue, session, node_id, parm_name, index, value));
+		}
+
+		static HAPI_Result
+		SetParmIntValues(const HAPI_Session* session, HAPI_NodeId node_id, const int* values_array, int start, int length)
+		{
+			return SetParmValues(EFunction::SetParmIntValues, Original::SetParmIntValues, session, node_id, values_array, start, length);
+		}
+
+		static HAPI_Result
+		SetParmFloatValue(const HAPI_Session* session, HAPI_NodeId node_id, const char* parm_name, int index, float value)
+		{
+			FCall Call(EFunction::SetParmFloatValue, HashArgs(node_id, parm_name, index));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(SetParmFloatValue, session, node_id, parm_name, index, value));
+		}
+
+		static HAPI_Result
+		SetParmFloatValues(const HAPI_Session* session, HAPI_NodeId node_id, const float* values_array, int start, int length)
+		{
+			return SetParmValues(EFunction::SetParmFloatValues, Original::SetParmFloatValues, session, node_id, values_array, start, length);
+		}
+
+		static HAPI_Result
+		SetParmStringValue(const HAPI_Session* session, HAPI_NodeId node_id, const char* value, HAPI_ParmId parm_id, int index)
+		{
+			FCall Call(EFunction::SetParmStringValue, HashArgs(node_id, parm_id, index));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(SetParmStringValue, session, node_id, value, parm_id, index));
+		}
+
+		static HAPI_Result
+		SetObjectTransform(const HAPI_Session* session, HAPI_NodeId node_id, const HAPI_TransformEuler* trans)
+		{
+			FCall Call(EFunction::SetObjectTransform, HashArgs(node_id));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(SetObjectTransform, session, node_id, trans));
+		}
+
+		static HAPI_Result
+		SetPartInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_PartInfo* part_info)
+		{
+			return SetPartStruct(EFunction::SetPartInfo, Original::SetPartInfo, session, node_id, part_id, part_info);
+		}
+
+		static HAPI_Result
+		AddAttribute(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info)
+		{
+			const int32 Owner = attr_info ? (int32)attr_info->owner : -1;
+			FCall Call(EFunction::AddAttribute, HashArgs(node_id, part_id, name, Owner));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(AddAttribute, session, node_id, part_id, name, attr_info));
+		}
+
+		static HAPI_Result
+		SetAttributeFloatData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const float* data_array, int start, int length)
+		{
+			return SetAttributeData(EFunction::SetAttributeFloatData, Original::SetAttributeFloatData, session, node_id, part_id, name, attr_info, data_array, start, length);
+		}
+
+		static HAPI_Result
+		SetAttributeIntData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const int* data_array, int start, int length)
+		{
+			return SetAttributeData(EFunction::SetAttributeIntData, Original::SetAttributeIntData, session, node_id, part_id, name, attr_info, data_array, start, length);
+		}
+
+		static HAPI_Result
+		SetAttributeStringData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const HAPI_AttributeInfo* attr_info, const char** data_array, int start, int length)
+		{
+			return SetAttributeData(EFunction::SetAttributeStringData, Original::SetAttributeStringData, session, node_id, part_id, name, attr_info, data_array, start, length);
+		}
+
+		static HAPI_Result
+		SetVertexList(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const int* vertex_list_array, int start, int length)
+		{
+			return SetPartArray(EFunction::SetVertexList, Original::SetVertexList, session, node_id, part_id, vertex_list_array, start, length);
+		}
+
+		static HAPI_Result
+		SetFaceCounts(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const int* face_counts_array, int start, int length)
+		{
+			return SetPartArray(EFunction::SetFaceCounts, Original::SetFaceCounts, session, node_id, part_id, face_counts_array, start, length);
+		}
+
+		static HAPI_Result
+		AddGroup(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char* group_name)
+		{
+			FCall Call(EFunction::AddGroup, HashArgs(node_id, part_id, group_type, group_name));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(AddGroup, session, node_id, part_id, group_type, group_name));
+		}
+
+		static HAPI_Result
+		SetGroupMembership(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char* group_name, const int* membership_array, int start, int length)
+		{
+			FCall Call(EFunction::SetGroupMembership, HashArgs(node_id, part_id, group_type, group_name, start, length));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(SetGroupMembership, session, node_id, part_id, group_type, group_name, membership_array, start, length));
+		}
+
+		static HAPI_Result
+		SetCurveInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_CurveInfo* info)
+		{
+			return SetPartStruct(EFunction::SetCurveInfo, Original::SetCurveInfo, session, node_id, part_id, info);
+		}
+
+		static HAPI_Result
+		SetCurveCounts(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const int* counts_array, int start, int length)
+		{
+			return SetPartArray(EFunction::SetCurveCounts, Original::SetCurveCounts, session, node_id, part_id, counts_array, start, length);
+		}
+
+		static HAPI_Result
+		SetCurveOrders(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const int* orders_array, int start, int length)
+		{
+			return SetPartArray(EFunction::SetCurveOrders, Original::SetCurveOrders, session, node_id, part_id, orders_array, start, length);
+		}
+
+		static HAPI_Result
+		SetCurveKnots(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const float* knots_array, int start, int length)
+		{
+			return SetPartArray(EFunction::SetCurveKnots, Original::SetCurveKnots, session, node_id, part_id, knots_array, start, length);
+		}
+
+		static HAPI_Result
+		SetVolumeInfo(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeInfo* volume_info)
+		{
+			return SetPartStruct(EFunction::SetVolumeInfo, Original::SetVolumeInfo, session, node_id, part_id, volume_info);
+		}
+
+		static HAPI_Result
+		SetHeightFieldData(const HAPI_Session* session, HAPI_NodeId node_id, HAPI_PartId part_id, const char* name, const float* values_array, int start, int length)
+		{
+			FCall Call(EFunction::SetHeightFieldData, HashArgs(node_id, part_id, name, start, length));
+			return Call.Finish(HOUDINI_API_TRACE_FORWARD(SetHeightFieldData, session, node_id, part_id, name, values_array, start, length));
+		}
+
+		static HAPI_Result
+		CommitGeo(const HAPI_Session* session, HAPI_NodeId node_id)
+		{
+			return NodeCall(EFunction::CommitGeo, Original::CommitGeo, session, node_id);
+		}
+
+		static HAPI_Result
+		RevertGeo(const HAPI_Session* session, HAPI_NodeId node_id)
+		{
+			return NodeCall(EFunction::RevertGeo, Original::RevertGeo, session, node_id);
+		}
+	}
+
+	#undef HOUDINI_API_TRACE_FORWARD
+
+	static void
+	InstallWrappers()
+	{
+#define HOUDINI_API_TRACE_INSTALL(Name) \
+		Original::Name = FHoudiniApi::Name; \
+		FHoudiniApi::Name = &Wrapper::Name;
+		HOUDINI_API_TRACE_FUNCTIONS(HOUDINI_API_TRACE_INSTALL)
+#undef HOUDINI_API_TRACE_INSTALL
+
+		if (Mode != EMode::Replay)
+			return;
+
+		// Without libHAPI, the struct initializers are empty stubs that would leave the structs uninitialized.
+#define HOUDINI_API_TRACE_INSTALL_INIT(Name, Type) \
+		Original::Name = FHoudiniApi::Name; \
+		if (FHoudiniApi::Name == &FHoudiniApi::Name##EmptyStub) \
+			FHoudiniApi::Name = &ZeroInit<Type>;
+		HOUDINI_API_TRACE_INIT_FUNCTIONS(HOUDINI_API_TRACE_INSTALL_INIT)
+#undef HOUDINI_API_TRACE_INSTALL_INIT
+	}
+
+	static void
+	RestoreOriginals()
+	{
+#define HOUDINI_API_TRACE_RESTORE(Name) \
+		if (Original::Name) \
+			FHoudiniApi::Name = Original::Name; \
+		Original::Name = nullptr;
+		HOUDINI_API_TRACE_FUNCTIONS(HOUDINI_API_TRACE_RESTORE)
+#undef HOUDINI_API_TRACE_RESTORE
+
+#define HOUDINI_API_TRACE_RESTORE_INIT(Name, Type) \
+		if (Original::Name) \
+			FHoudiniApi::Name = Original::Name; \
+		Original::Name = nullptr;
+		HOUDINI_API_TRACE_INIT_FUNCTIONS(HOUDINI_API_TRACE_RESTORE_INIT)
+#undef HOUDINI_API_TRACE_RESTORE_INIT
+	}
+
+	static bool
+	LoadTrace(const FString& InFilePath)
+	{
+		TArray<uint8> FileData;
+		if (!FFileHelper::LoadFileToArray(FileData, *InFilePath))
+		{
+			HOUDINI_LOG_ERROR(TEXT("HAPI trace: unable to read %s."), *InFilePath);
+			return false;
+		}
+
+		FMemoryReader Ar(FileData);
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Ar << Magic;
+		Ar << Version;
+		if (Magic != TraceMagic || Version != TraceVersion)
+		{
+			HOUDINI_LOG_ERROR(TEXT("HAPI trace: %s is not a valid trace file (version %d expected)."), *InFilePath, TraceVersion);
+			return false;
+		}
+
+		int32 RecordCount = 0;
+		while (!Ar.AtEnd() && !Ar.IsError())
+		{
+			uint16 FunctionId = 0;
+			uint32 ArgsHash = 0;
+			uint8 BufferCount = 0;
+			FRecord Record;
+			Ar << FunctionId;
+			Ar << ArgsHash;
+			Ar << Record.Result;
+			Ar << Record.Seconds;
+			Ar << BufferCount;
+
+			Record.Buffers.SetNum(BufferCount);
+			for (TArray<uint8>& Buffer : Record.Buffers)
+			{
+				int32 Size = 0;
+				Ar << Size;
+				if (Size < 0 || Size > Ar.TotalSize() - Ar.Tell())
+				{
+					Ar.SetError();
+					break;
+				}
+				Buffer.SetNumUninitialized(Size);
+				Ar.Serialize(Buffer.GetData(), Size);
+			}
+
+			if (Ar.IsError() || FunctionId >= (uint16)EFunction::Count)
+			{
+				HOUDINI_LOG_ERROR(TEXT("HAPI trace: %s is truncated or corrupted."), *InFilePath);
+				Records.Empty();
+				return false;
+			}
+
+			Records.FindOrAdd(MakeKey((EFunction)FunctionId, ArgsHash)).Add(MoveTemp(Record));
+			RecordCount++;
+		}
+
+		HOUDINI_LOG_MESSAGE(TEXT("HAPI trace: loaded %d calls from %s."), RecordCount, *InFilePath);
+		return true;
+	}
+}
+
+bool
+FHoudiniApiTrace::StartRecording(const FString& InFilePath)
+{
+	using namespace HoudiniApiTrace;
+
+	if (Mode != EMode::None)
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI trace: already recording or replaying."));
+		return false;
+	}
+
+	if (!FHoudiniApi::IsHAPIInitialized())
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI trace: cannot record, libHAPI is not loaded."));
+		return false;
+	}
+
+	Writer = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*InFilePath));
+	if (!Writer.IsValid())
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI trace: unable to create %s."), *InFilePath);
+		return false;
+	}
+
+	uint32 Magic = TraceMagic;
+	uint32 Version = TraceVersion;
+	*Writer << Magic;
+	*Writer << Version;
+
+	ResetTimings();
+	Mode = EMode::Record;
+	InstallWrappers();
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI trace: recording to %s."), *InFilePath);
+	return true;
+}
+
+bool
+FHoudiniApiTrace::StartReplay(const FString& InFilePath)
+{
+	using namespace HoudiniApiTrace;
+
+	if (Mode != EMode::None)
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI trace: already recording or replaying."));
+		return false;
+	}
+
+	if (!LoadTrace(InFilePath))
+		return false;
+
+	ResetTimings();
+	RecordCursors.Empty();
+	Mode = EMode::Replay;
+	InstallWrappers();
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI trace: replaying %s."), *InFilePath);
+	return true;
+}
+
+void
+FHoudiniApiTrace::Stop()
+{
+	using namespace HoudiniApiTrace;
+
+	if (Mode == EMode::None)
+		return;
+
+	RestoreOriginals();
+	LogTimings();
+
+	FScopeLock ScopeLock(&TraceLock);
+	if (Writer.IsValid())
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+
+	Records.Empty();
+	RecordCursors.Empty();
+	Mode = EMode::None;
+}
+
+bool
+FHoudiniApiTrace::IsRecording()
+{
+	return HoudiniApiTrace::Mode == HoudiniApiTrace::EMode::Record;
+}
+
+bool
+FHoudiniApiTrace::IsReplaying()
+{
+	return HoudiniApiTrace::Mode == HoudiniApiTrace::EMode::Replay;
+}
+
+const HAPI_Session*
+FHoudiniApiTrace::GetReplaySession()
+{
+	return IsReplaying() ? &HoudiniApiTrace::ReplaySession : nullptr;
+}
+
+TArray<FHoudiniApiTraceTiming>
+FHoudiniApiTrace::GetTimings()
+{
+	using namespace HoudiniApiTrace;
+
+	TArray<FHoudiniApiTraceTiming> OutTimings;
+	{
+		FScopeLock ScopeLock(&TraceLock);
+		for (int32 Idx = 0; Idx < (int32)EFunction::Count; Idx++)
+		{
+			if (Timings[Idx].CallCount <= 0)
+				continue;
+
+			FHoudiniApiTraceTiming& Timing = OutTimings.Add_GetRef(Timings[Idx]);
+			Timing.FunctionName = FunctionNames[Idx];
+		}
+	}
+
+	OutTimings.Sort([](const FHoudiniApiTraceTiming& A, const FHoudiniApiTraceTiming& B)
+	{
+		return A.TotalSeconds > B.TotalSeconds;
+	});
+
+	return OutTimings;
+}
+
+void
+FHoudiniApiTrace::LogTimings()
+{
+	const TArray<FHoudiniApiTraceTiming> AllTimings = GetTimings();
+	if (AllTimings.Num() <= 0)
+		return;
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI trace timings (%s):"), IsReplaying() ? TEXT("replay") : TEXT("record"));
+	HOUDINI_LOG_MESSAGE(TEXT("%-40s %8s %12s %12s %12s %8s"), TEXT("Function"), TEXT("Calls"), TEXT("Total (ms)"), TEXT("HAPI (ms)"), TEXT("KBytes"), TEXT("Misses"));
+	for (const FHoudiniApiTraceTiming& Timing : AllTimings)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("%-40s %8d %12.3f %12.3f %12.1f %8d"),
+			*Timing.FunctionName, Timing.CallCount,
+			Timing.TotalSeconds * 1000.0, Timing.RecordedSeconds * 1000.0,
+			Timing.ReturnedBytes / 1024.0, Timing.MissCount);
+	}
+}
+
+void
+FHoudiniApiTrace::ResetTimings()
+{
+	using namespace HoudiniApiTrace;
+
+	FScopeLock ScopeLock(&TraceLock);
+	for (int32 Idx = 0; Idx < (int32)EFunction::Count; Idx++)
+		Timings[Idx] = FHoudiniApiTraceTiming();
+}
+
+static FAutoConsoleCommand CCmdHoudiniApiTraceRecord(
+	TEXT("HoudiniEngine.ApiTrace.Record"),
+	TEXT("Records the HAPI calls used to build outputs to a trace file.\nUsage: HoudiniEngine.ApiTrace.Record <FilePath>"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0)
+			FHoudiniApiTrace::StartRecording(Args[0]);
+	}));
+
+static FAutoConsoleCommand CCmdHoudiniApiTraceReplay(
+	TEXT("HoudiniEngine.ApiTrace.Replay"),
+	TEXT("Serves the HAPI calls used to build outputs from a trace file.\nUsage: HoudiniEngine.ApiTrace.Replay <FilePath>"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0)
+			FHoudiniApiTrace::StartReplay(Args[0]);
+	}));
+
+static FAutoConsoleCommand CCmdHoudiniApiTraceStop(
+	TEXT("HoudiniEngine.ApiTrace.Stop"),
+	TEXT("Stops recording or replaying a HAPI trace and logs the per-call timings."),
+	FConsoleCommandDelegate::CreateStatic(&FHoudiniApiTrace::Stop));
+
+static FAutoConsoleCommand CCmdHoudiniApiTraceTimings(
+	TEXT("HoudiniEngine.ApiTrace.Timings"),
+	TEXT("Logs the per-call timings of the current HAPI trace."),
+	FConsoleCommandDelegate::CreateStatic(&FHoudiniApiTrace::LogTimings));
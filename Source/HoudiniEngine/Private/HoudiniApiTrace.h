@@ -0,0 +1,92 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAPI/HAPI_Common.h"
+
+// Per HAPI function call count and timings gathered while recording or replaying.
+struct HOUDINIENGINE_API FHoudiniApiTraceTiming
+{
+	FString FunctionName;
+
+	// Number of calls that went through the trace layer.
+	int32 CallCount = 0;
+
+	// Time spent in the calls: the HAPI round-trip when recording, serving the trace when replaying.
+	double TotalSeconds = 0.0;
+
+	// HAPI round-trip time stored in the trace for the replayed calls.
+	double RecordedSeconds = 0.0;
+
+	// Size of the buffers returned to the plugin.
+	int64 ReturnedBytes = 0;
+
+	// Replayed calls that had no matching entry in the trace.
+	int32 MissCount = 0;
+};
+
+// Recording / replay layer over the FHoudiniApi function pointer table.
+//
+// When recording, the HAPI functions used when building outputs (node, geo, part,
+// attribute, group, instancer, curve, volume and string queries) and the ones creating and
+// updating nodes, parameters and input geometry are swapped for wrappers that call the real
+// function, time it, and append its result and returned buffers to a binary trace.
+// When replaying, the same functions are swapped for wrappers serving the trace,
+// so output translation can run without a Houdini install or a valid session.
+// Replayed calls are matched on the function and a hash of their arguments (not of the data
+// sent), calls with identical arguments are served in recording order.
+// The calls that are not traced (asset library, parameter queries, PDG...) are still forwarded
+// to libHAPI: cooking an HDA from scratch is not replayable, translating its outputs is.
+class HOUDINIENGINE_API FHoudiniApiTrace
+{
+public:
+
+	// Starts recording the traced HAPI calls to the given file.
+	static bool StartRecording(const FString& InFilePath);
+
+	// Loads the given trace and starts serving the traced HAPI calls from it.
+	static bool StartReplay(const FString& InFilePath);
+
+	// Stops recording or replaying and restores the previous function pointers.
+	static void Stop();
+
+	static bool IsRecording();
+	static bool IsReplaying();
+
+	// Placeholder session used when replaying without a Houdini Engine session, null otherwise.
+	static const HAPI_Session* GetReplaySession();
+
+	// Returns the timings of the traced functions that have been called, sorted by total time.
+	static TArray<FHoudiniApiTraceTiming> GetTimings();
+
+	// Logs the timings of the traced functions.
+	static void LogTimings();
+
+	static void ResetTimings();
+};
@@ -0,0 +1,407 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniAssetLibraryCache.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniAsset.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineTask.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/ObjectKey.h"
+
+#if WITH_EDITORONLY_DATA
+	#include "EditorFramework/AssetImportData.h"
+#endif
+
+#include <string>
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCacheAssetLibraries(
+	TEXT("HoudiniEngine.CacheAssetLibraries"),
+	1,
+	TEXT("When enabled, the asset library loaded for a Houdini asset is reused by its next instantiations, until its source changes or it is reimported.\n")
+	TEXT("0: Load the asset library for every instantiation.\n")
+	TEXT("1: Reuse the loaded asset libraries (default).\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInstantiationPoolSize(
+	TEXT("HoudiniEngine.InstantiationPoolSize"),
+	0,
+	TEXT("Number of nodes instantiated and cooked ahead of time, while the scheduler is idle, for each frequently instantiated Houdini asset.\n")
+	TEXT("0: Disabled (default).\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInstantiationPoolMinUses(
+	TEXT("HoudiniEngine.InstantiationPoolMinUses"),
+	2,
+	TEXT("Number of times a Houdini asset has to be instantiated in a session before nodes are pooled for it.\n")
+	TEXT("2: Default\n")
+);
+
+namespace
+{
+	struct FCachedAssetLibrary
+	{
+		FString SourceKey;
+		HAPI_AssetLibraryId AssetLibraryId = -1;
+	};
+
+	struct FPooledNode
+	{
+		// Node returned to the instantiation task
+		HAPI_NodeId AssetId = -1;
+		// Node to delete to release it, the OBJ node created for SOP assets
+		HAPI_NodeId DeleteId = -1;
+	};
+
+	struct FInstantiationPool
+	{
+		int32 SessionIndex = 0;
+		HAPI_AssetLibraryId AssetLibraryId = -1;
+		FString AssetName;
+		int32 NumInstantiations = 0;
+		TArray<FPooledNode> Nodes;
+	};
+
+	// Protects the libraries and pools, used by the game thread and the schedulers
+	FCriticalSection AssetLibraryCacheLock;
+
+	// Libraries loaded per asset and session index
+	TMap<TPair<FObjectKey, int32>, FCachedAssetLibrary> CachedAssetLibraries;
+
+	TArray<FInstantiationPool> InstantiationPools;
+
+	// Queues the deletion of pooled nodes on the scheduler of their session
+	void
+	DeletePooledNodes(const int32& InSessionIndex, const TArray<FPooledNode>& InNodes)
+	{
+		for (const FPooledNode& Node : InNodes)
+		{
+			FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetDeletion, FGuid::NewGuid());
+			Task.AssetId = Node.DeleteId;
+			Task.SessionIndex = InSessionIndex;
+			FHoudiniEngine::Get().AddTask(Task);
+		}
+	}
+}
+
+FString
+FHoudiniAssetLibraryCache::GetSourceKey(
+	const UHoudiniAsset* InHoudiniAsset,
+	const FString& InAssetFileName,
+	const bool& bInCanLoadFromFile,
+	const bool& bInMemoryCopyFirst)
+{
+	if (!IsValid(InHoudiniAsset) || CVarHoudiniEngineCacheAssetLibraries.GetValueOnAnyThread() == 0)
+		return FString();
+
+	// Expanded HDAs are edited in place, their time stamp doesn't reflect their content
+	if (InHoudiniAsset->IsExpandedHDA())
+		return FString();
+
+	FString ImportHash;
+#if WITH_EDITORONLY_DATA
+	if (InHoudiniAsset->AssetImportData && InHoudiniAsset->AssetImportData->SourceData.SourceFiles.Num() > 0)
+		ImportHash = LexToString(InHoudiniAsset->AssetImportData->SourceData.SourceFiles[0].FileHash);
+#endif
+
+	int64 FileSize = -1;
+	int64 FileTicks = 0;
+	if (bInCanLoadFromFile)
+	{
+		FileSize = IFileManager::Get().FileSize(*InAssetFileName);
+		FileTicks = IFileManager::Get().GetTimeStamp(*InAssetFileName).GetTicks();
+	}
+
+	return FString::Printf(
+		TEXT("%s|%lld|%lld|%s|%u|%d"),
+		*InAssetFileName, FileSize, FileTicks, *ImportHash,
+		InHoudiniAsset->GetAssetBytesCount(), bInMemoryCopyFirst ? 1 : 0);
+}
+
+bool
+FHoudiniAssetLibraryCache::FindLibrary(
+	const UHoudiniAsset* InHoudiniAsset,
+	const FString& InSourceKey,
+	HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	OutAssetLibraryId = -1;
+	if (InSourceKey.IsEmpty() || !IsValid(InHoudiniAsset))
+		return false;
+
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	const TPair<FObjectKey, int32> Key(FObjectKey(InHoudiniAsset), SessionIndex);
+
+	TArray<FPooledNode> StaleNodes;
+	{
+		FScopeLock ScopeLock(&AssetLibraryCacheLock);
+
+		const FCachedAssetLibrary* CachedLibrary = CachedAssetLibraries.Find(Key);
+		if (!CachedLibrary)
+			return false;
+
+		if (CachedLibrary->SourceKey.Equals(InSourceKey, ESearchCase::CaseSensitive))
+		{
+			OutAssetLibraryId = CachedLibrary->AssetLibraryId;
+		}
+		else
+		{
+			// The source has changed, the pooled nodes use the previous definition
+			const HAPI_AssetLibraryId StaleLibraryId = CachedLibrary->AssetLibraryId;
+			for (int32 PoolIdx = InstantiationPools.Num() - 1; PoolIdx >= 0; PoolIdx--)
+			{
+				if (InstantiationPools[PoolIdx].SessionIndex != SessionIndex || InstantiationPools[PoolIdx].AssetLibraryId != StaleLibraryId)
+					continue;
+
+				StaleNodes.Append(InstantiationPools[PoolIdx].Nodes);
+				InstantiationPools.RemoveAtSwap(PoolIdx);
+			}
+
+			CachedAssetLibraries.Remove(Key);
+		}
+	}
+
+	if (StaleNodes.Num() > 0)
+		DeletePooledNodes(SessionIndex, StaleNodes);
+
+	if (OutAssetLibraryId < 0)
+		return false;
+
+	// Make sure the library is still loaded in the session
+	int32 AssetCount = 0;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAvailableAssetCount(
+		FHoudiniEngine::Get().GetSession(), OutAssetLibraryId, &AssetCount) || AssetCount <= 0)
+	{
+		FScopeLock ScopeLock(&AssetLibraryCacheLock);
+		CachedAssetLibraries.Remove(Key);
+		OutAssetLibraryId = -1;
+		return false;
+	}
+
+	return true;
+}
+
+void
+FHoudiniAssetLibraryCache::AddLibrary(
+	const UHoudiniAsset* InHoudiniAsset,
+	const FString& InSourceKey,
+	const HAPI_AssetLibraryId& InAssetLibraryId)
+{
+	if (InSourceKey.IsEmpty() || !IsValid(InHoudiniAsset) || InAssetLibraryId < 0)
+		return;
+
+	FCachedAssetLibrary CachedLibrary;
+	CachedLibrary.SourceKey = InSourceKey;
+	CachedLibrary.AssetLibraryId = InAssetLibraryId;
+
+	FScopeLock ScopeLock(&AssetLibraryCacheLock);
+	CachedAssetLibraries.Add(TPair<FObjectKey, int32>(FObjectKey(InHoudiniAsset), FHoudiniEngine::GetCurrentSessionIndex()), MoveTemp(CachedLibrary));
+}
+
+void
+FHoudiniAssetLibraryCache::InvalidateAsset(const UHoudiniAsset* InHoudiniAsset)
+{
+	if (!InHoudiniAsset)
+		return;
+
+	const FObjectKey AssetKey(InHoudiniAsset);
+	TMap<int32, TArray<FPooledNode>> StaleNodes;
+	{
+		FScopeLock ScopeLock(&AssetLibraryCacheLock);
+		for (auto It = CachedAssetLibraries.CreateIterator(); It; ++It)
+		{
+			if (It.Key().Key != AssetKey)
+				continue;
+
+			const int32 SessionIndex = It.Key().Value;
+			const HAPI_AssetLibraryId StaleLibraryId = It.Value().AssetLibraryId;
+			for (int32 PoolIdx = InstantiationPools.Num() - 1; PoolIdx >= 0; PoolIdx--)
+			{
+				if (InstantiationPools[PoolIdx].SessionIndex != SessionIndex || InstantiationPools[PoolIdx].AssetLibraryId != StaleLibraryId)
+					continue;
+
+				StaleNodes.FindOrAdd(SessionIndex).Append(InstantiationPools[PoolIdx].Nodes);
+				InstantiationPools.RemoveAtSwap(PoolIdx);
+			}
+
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const auto& SessionNodes : StaleNodes)
+		DeletePooledNodes(SessionNodes.Key, SessionNodes.Value);
+}
+
+void
+FHoudiniAssetLibraryCache::Reset()
+{
+	FScopeLock ScopeLock(&AssetLibraryCacheLock);
+	CachedAssetLibraries.Empty();
+	InstantiationPools.Empty();
+}
+
+HAPI_NodeId
+FHoudiniAssetLibraryCache::ClaimPooledNode(const HAPI_AssetLibraryId& InAssetLibraryId, const FString& InAssetName)
+{
+	if (InAssetLibraryId < 0)
+		return -1;
+
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	const bool bPoolingEnabled = CVarHoudiniEngineInstantiationPoolSize.GetValueOnAnyThread() > 0;
+
+	bool bCounted = false;
+	while (true)
+	{
+		FPooledNode ClaimedNode;
+		{
+			FScopeLock ScopeLock(&AssetLibraryCacheLock);
+
+			FInstantiationPool* Pool = InstantiationPools.FindByPredicate([&](const FInstantiationPool& InPool)
+			{
+				return InPool.SessionIndex == SessionIndex
+					&& InPool.AssetLibraryId == InAssetLibraryId
+					&& InPool.AssetName.Equals(InAssetName, ESearchCase::CaseSensitive);
+			});
+
+			if (!Pool)
+			{
+				if (!bPoolingEnabled)
+					return -1;
+
+				Pool = &InstantiationPools.AddDefaulted_GetRef();
+				Pool->SessionIndex = SessionIndex;
+				Pool->AssetLibraryId = InAssetLibraryId;
+				Pool->AssetName = InAssetName;
+			}
+
+			if (!bCounted)
+			{
+				Pool->NumInstantiations++;
+				bCounted = true;
+			}
+
+			if (Pool->Nodes.Num() <= 0)
+				return -1;
+
+			ClaimedNode = Pool->Nodes.Pop();
+		}
+
+		// Pooled nodes can have been deleted by the user in the session
+		if (FHoudiniEngineUtils::IsHoudiniNodeValid(ClaimedNode.AssetId))
+			return ClaimedNode.AssetId;
+	}
+}
+
+bool
+FHoudiniAssetLibraryCache::RefillPool(const int32& InSessionIndex)
+{
+	const int32 PoolSize = CVarHoudiniEngineInstantiationPoolSize.GetValueOnAnyThread();
+	if (PoolSize <= 0)
+		return false;
+
+	const int32 MinUses = CVarHoudiniEngineInstantiationPoolMinUses.GetValueOnAnyThread();
+
+	HAPI_AssetLibraryId AssetLibraryId = -1;
+	FString AssetName;
+	{
+		FScopeLock ScopeLock(&AssetLibraryCacheLock);
+		const FInstantiationPool* Pool = InstantiationPools.FindByPredicate([&](const FInstantiationPool& InPool)
+		{
+			return InPool.SessionIndex == InSessionIndex
+				&& InPool.NumInstantiations >= MinUses
+				&& InPool.Nodes.Num() < PoolSize;
+		});
+
+		if (!Pool)
+			return false;
+
+		AssetLibraryId = Pool->AssetLibraryId;
+		AssetName = Pool->AssetName;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniAssetLibraryCache::RefillPool);
+
+	std::string AssetNameString;
+	FHoudiniEngineUtils::ConvertUnrealString(AssetName, AssetNameString);
+
+	// Instantiate and cook the node with its default parameters
+	FPooledNode NewNode;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::CreateNode(
+		FHoudiniEngine::Get().GetSession(), -1, AssetNameString.c_str(), nullptr, true, &NewNode.AssetId))
+	{
+		// Stop pooling this asset
+		HOUDINI_LOG_WARNING(TEXT("Unable to instantiate a pooled node for %s: %s"), *AssetName, *FHoudiniEngineUtils::GetErrorDescription());
+
+		FScopeLock ScopeLock(&AssetLibraryCacheLock);
+		InstantiationPools.RemoveAll([&](const FInstantiationPool& InPool)
+		{
+			return InPool.SessionIndex == InSessionIndex && InPool.AssetLibraryId == AssetLibraryId && InPool.AssetName.Equals(AssetName, ESearchCase::CaseSensitive);
+		});
+
+		return false;
+	}
+
+	int32 Status = HAPI_STATE_STARTING_COOK;
+	while (HAPI_RESULT_SUCCESS == FHoudiniApi::GetStatus(FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status)
+		&& Status > HAPI_STATE_MAX_READY_STATE)
+	{
+		FPlatformProcess::SleepNoStats(0.02f);
+	}
+
+	// For SOP assets, the OBJ node created to hold the asset has to be deleted
+	NewNode.DeleteId = NewNode.AssetId;
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), NewNode.AssetId, &NodeInfo)
+		&& NodeInfo.type == HAPI_NODETYPE_SOP && NodeInfo.parentId >= 0)
+	{
+		NewNode.DeleteId = NodeInfo.parentId;
+	}
+
+	{
+		FScopeLock ScopeLock(&AssetLibraryCacheLock);
+		FInstantiationPool* Pool = InstantiationPools.FindByPredicate([&](const FInstantiationPool& InPool)
+		{
+			return InPool.SessionIndex == InSessionIndex && InPool.AssetLibraryId == AssetLibraryId && InPool.AssetName.Equals(AssetName, ESearchCase::CaseSensitive);
+		});
+
+		if (Pool)
+		{
+			Pool->Nodes.Add(NewNode);
+			return true;
+		}
+	}
+
+	// The pool has been invalidated while we were cooking
+	FHoudiniEngineUtils::DeleteHoudiniNode(NewNode.DeleteId);
+	return false;
+}
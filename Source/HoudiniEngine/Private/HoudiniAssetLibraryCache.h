@@ -0,0 +1,87 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+
+class UHoudiniAsset;
+
+// Keeps track of the asset libraries loaded for the Houdini assets, and of a pool of nodes
+// instantiated ahead of time for the assets that are instantiated frequently.
+//
+// Libraries are cached per asset and per session, keyed by a source key describing the data that
+// was loaded (file name, time stamp and size, import hash, byte count), so loading the same asset
+// again only reloads the library if its source has changed. Cached libraries are forgotten when
+// the asset is reimported and when the sessions are stopped.
+//
+// When HoudiniEngine.InstantiationPoolSize is above 0, the schedulers use their idle time to
+// instantiate and cook, with their default parameters, nodes of the assets that have been
+// instantiated at least HoudiniEngine.InstantiationPoolMinUses times. New instantiations of
+// these assets claim a pooled node instead of instantiating one.
+class HOUDINIENGINE_API FHoudiniAssetLibraryCache
+{
+public:
+
+	// Returns the key describing the source that will be loaded for the asset,
+	// or an empty string if the asset's library should not be cached.
+	static FString GetSourceKey(
+		const UHoudiniAsset* InHoudiniAsset,
+		const FString& InAssetFileName,
+		const bool& bInCanLoadFromFile,
+		const bool& bInMemoryCopyFirst);
+
+	// Returns the library loaded for the asset in the current session, if it was loaded from the same source.
+	static bool FindLibrary(
+		const UHoudiniAsset* InHoudiniAsset,
+		const FString& InSourceKey,
+		HAPI_AssetLibraryId& OutAssetLibraryId);
+
+	// Stores the library that has been loaded for the asset in the current session.
+	static void AddLibrary(
+		const UHoudiniAsset* InHoudiniAsset,
+		const FString& InSourceKey,
+		const HAPI_AssetLibraryId& InAssetLibraryId);
+
+	// Forgets the libraries loaded for the asset and deletes its pooled nodes.
+	// Called when the asset is reimported.
+	static void InvalidateAsset(const UHoudiniAsset* InHoudiniAsset);
+
+	// Forgets all the libraries and pooled nodes, without deleting the nodes.
+	// Called when the sessions are stopped or lost.
+	static void Reset();
+
+	// Records an instantiation of the given asset in the current session, and returns a pooled
+	// node of that asset if there is one, or -1 if the asset has to be instantiated.
+	// Called by the scheduler.
+	static HAPI_NodeId ClaimPooledNode(const HAPI_AssetLibraryId& InAssetLibraryId, const FString& InAssetName);
+
+	// Instantiates and cooks one node for a pool of the given session that isn't full.
+	// Returns true if a node was added. Called by the scheduler when it has no task to process.
+	static bool RefillPool(const int32& InSessionIndex);
+};
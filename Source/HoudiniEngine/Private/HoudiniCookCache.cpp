@@ -0,0 +1,556 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniCookCache.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+#include "HoudiniNodeSyncComponent.h"
+#include "HoudiniOutput.h"
+#include "HoudiniParameter.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "HAPI/HAPI_Version.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/SecureHash.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCookCache(
+	TEXT("HoudiniEngine.CookCache"),
+	1,
+	TEXT("When enabled, Houdini Asset Components that have not been instantiated keep their saved outputs\n")
+	TEXT("instead of being instantiated and cooked, if their HDA, parameters and inputs still match their last cook.\n")
+	TEXT("0: Always instantiate and cook.\n")
+	TEXT("1: Skip cooks whose results are already saved with the component.\n")
+);
+
+namespace
+{
+	// Hash of the library bytes stored in a Houdini asset
+	struct FCachedAssetHash
+	{
+		uint32 AssetBytesCount = 0;
+		FSHAHash Hash;
+	};
+
+	// Accessed on the game thread only
+	TMap<FObjectKey, FCachedAssetHash> CachedAssetHashes;
+
+	void
+	HashString(FSHA1& Sha, const FString& InString)
+	{
+		// Include the length so that consecutive strings can't collide
+		const int32 Length = InString.Len();
+		Sha.Update(reinterpret_cast<const uint8*>(&Length), sizeof(Length));
+		Sha.UpdateWithString(*InString, Length);
+	}
+
+	template<typename T>
+	void
+	HashValue(FSHA1& Sha, const T& InValue)
+	{
+		Sha.Update(reinterpret_cast<const uint8*>(&InValue), sizeof(T));
+	}
+
+	template<typename T>
+	void
+	HashStruct(FSHA1& Sha, const T& InStruct)
+	{
+		FString Value;
+		T::StaticStruct()->ExportText(Value, &InStruct, nullptr, nullptr, PPF_None, nullptr);
+		HashString(Sha, Value);
+	}
+
+	// Hashes the project settings that may change the cook or the translation of its outputs
+	// (mesh generation and build settings, geometry marshalling, parameters...).
+	// The session, UI, baking and PDG settings are skipped.
+	void
+	HashRuntimeSettings(FSHA1& Sha)
+	{
+		static const TSet<FName> SkippedProperties = {
+			TEXT("SessionType"),
+			TEXT("ServerHost"),
+			TEXT("ServerPort"),
+			TEXT("ServerPipeName"),
+			TEXT("bStartAutomaticServer"),
+			TEXT("AutomaticServerTimeout"),
+			TEXT("SessionPoolSize"),
+			TEXT("bSyncWithHoudiniCook"),
+			TEXT("bCookUsingHoudiniTime"),
+			TEXT("bSyncViewport"),
+			TEXT("bSyncHoudiniViewport"),
+			TEXT("bSyncUnrealViewport"),
+			TEXT("bShowMultiAssetDialog"),
+			TEXT("bPauseCookingOnStart"),
+			TEXT("bDisplaySlateCookingNotifications"),
+			TEXT("DefaultBakeFolder"),
+			TEXT("bShowDefaultMesh"),
+			TEXT("bEnableProxyStaticMeshRefinementByTimer"),
+			TEXT("ProxyMeshAutoRefineTimeoutSeconds"),
+			TEXT("bEnableProxyStaticMeshRefinementOnPreSaveWorld"),
+			TEXT("bEnableProxyStaticMeshRefinementOnPreBeginPIE"),
+			TEXT("bPDGAsyncCommandletImportEnabled"),
+			TEXT("PDGAsyncCommandletWorkerCount"),
+			TEXT("HoudiniToolsSearchPath"),
+			TEXT("CookingThreadStackSize"),
+		};
+
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		for (TFieldIterator<FProperty> It(UHoudiniRuntimeSettings::StaticClass(), EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (Property->HasAnyPropertyFlags(CPF_Transient) || SkippedProperties.Contains(Property->GetFName()))
+				continue;
+
+			FString Value;
+			Property->ExportText_InContainer(0, Value, HoudiniRuntimeSettings, nullptr, nullptr, PPF_None);
+			HashString(Sha, Property->GetName());
+			HashString(Sha, Value);
+		}
+	}
+
+	// Hashes the library bytes of the asset, once per asset
+	void
+	HashAssetBytes(FSHA1& Sha, const UHoudiniAsset* InHoudiniAsset)
+	{
+		const uint32 AssetBytesCount = InHoudiniAsset->GetAssetBytesCount();
+		FCachedAssetHash& CachedHash = CachedAssetHashes.FindOrAdd(FObjectKey(InHoudiniAsset));
+		if (CachedHash.AssetBytesCount != AssetBytesCount)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniCookCache::HashAssetBytes);
+
+			FSHA1 AssetSha;
+			AssetSha.Update(InHoudiniAsset->GetAssetBytes(), AssetBytesCount);
+			AssetSha.Final();
+			AssetSha.GetHash(CachedHash.Hash.Hash);
+			CachedHash.AssetBytesCount = AssetBytesCount;
+		}
+
+		Sha.Update(CachedHash.Hash.Hash, sizeof(CachedHash.Hash.Hash));
+	}
+
+	// Hashes the properties of a parameter that are saved with it.
+	// The changed / update flags and the node / parm ids of the session are skipped,
+	// the subobjects owned by the parameter (ramp points...) are hashed recursively.
+	void
+	HashParameterProperties(FSHA1& Sha, const UObject* InObject, const int32 InDepth)
+	{
+		static const TSet<FName> SkippedProperties = {
+			TEXT("bHasChanged"),
+			TEXT("bNeedsToTriggerUpdate"),
+			TEXT("bIsVisible"),
+			TEXT("bIsParentFolderVisible"),
+			TEXT("bIsDisabled"),
+			TEXT("bIsLabelVisible"),
+			TEXT("bJoinNext"),
+			TEXT("bAutoUpdate"),
+			TEXT("Label"),
+			TEXT("Help"),
+		};
+
+		HashString(Sha, InObject->GetClass()->GetName());
+
+		for (TFieldIterator<FProperty> It(InObject->GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+				continue;
+
+			if (SkippedProperties.Contains(Property->GetFName()))
+				continue;
+
+			HashString(Sha, Property->GetName());
+
+			// Subobjects owned by the parameter
+			TArray<const UObject*> SubObjects;
+			if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				SubObjects.Add(ObjectProperty->GetObjectPropertyValue_InContainer(InObject));
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				if (const FObjectPropertyBase* InnerProperty = CastField<FObjectPropertyBase>(ArrayProperty->Inner))
+				{
+					FScriptArrayHelper_InContainer Helper(ArrayProperty, InObject);
+					for (int32 Idx = 0; Idx < Helper.Num(); ++Idx)
+						SubObjects.Add(InnerProperty->GetObjectPropertyValue(Helper.GetRawPtr(Idx)));
+				}
+			}
+
+			if (SubObjects.Num() > 0 || CastField<FObjectPropertyBase>(Property))
+			{
+				HashValue(Sha, SubObjects.Num());
+				for (const UObject* SubObject : SubObjects)
+				{
+					if (!IsValid(SubObject))
+						HashString(Sha, FString());
+					else if (InDepth < 4 && SubObject->IsIn(InObject))
+						HashParameterProperties(Sha, SubObject, InDepth + 1);
+					else
+						HashString(Sha, SubObject->GetPathName());
+				}
+				continue;
+			}
+
+			FString Value;
+			Property->ExportText_InContainer(0, Value, InObject, nullptr, nullptr, PPF_None);
+			HashString(Sha, Value);
+		}
+	}
+
+	// Hashes the package an input asset is saved in.
+	// Returns false if the asset has unsaved changes or is not saved in a package file.
+	bool
+	HashInputAsset(FSHA1& Sha, const UObject* InAsset)
+	{
+		const UPackage* Package = InAsset->GetOutermost();
+		if (!IsValid(Package) || Package->IsDirty())
+			return false;
+
+		FString PackageFilename;
+		if (!FPackageName::DoesPackageExist(Package->GetName(), &PackageFilename))
+			return false;
+
+		HashString(Sha, InAsset->GetPathName());
+		HashValue(Sha, IFileManager::Get().GetTimeStamp(*PackageFilename).GetTicks());
+		HashValue(Sha, IFileManager::Get().FileSize(*PackageFilename));
+
+		return true;
+	}
+
+	bool
+	HashInput(FSHA1& Sha, const UHoudiniInput* InInput)
+	{
+		const EHoudiniInputType InputType = InInput->GetInputType();
+
+		// World and curve inputs depend on the level's content, which isn't tracked here
+		if (InputType != EHoudiniInputType::Geometry)
+			return false;
+
+		HashString(Sha, InInput->GetName());
+		HashValue(Sha, InputType);
+		HashValue(Sha, InInput->GetPackBeforeMerge());
+
+		FString Settings;
+		FHoudiniInputObjectSettings::StaticStruct()->ExportText(
+			Settings, &InInput->GetInputSettings(), nullptr, nullptr, PPF_None, nullptr);
+		HashString(Sha, Settings);
+
+		const TArray<UHoudiniInputObject*>* InputObjects = InInput->GetHoudiniInputObjectArray(InputType);
+		if (!InputObjects)
+			return true;
+
+		HashValue(Sha, InputObjects->Num());
+		for (UHoudiniInputObject* InputObject : *InputObjects)
+		{
+			if (!IsValid(InputObject))
+			{
+				HashString(Sha, FString());
+				continue;
+			}
+
+			HashValue(Sha, InputObject->Type);
+			const FTransform Transform = InputObject->GetTransform();
+			HashString(Sha, Transform.ToString());
+
+			switch (InputObject->Type)
+			{
+				case EHoudiniInputObjectType::Object:
+				case EHoudiniInputObjectType::StaticMesh:
+				case EHoudiniInputObjectType::SkeletalMesh:
+				case EHoudiniInputObjectType::DataTable:
+				case EHoudiniInputObjectType::FoliageType_InstancedStaticMesh:
+				case EHoudiniInputObjectType::GeometryCollection:
+				case EHoudiniInputObjectType::Animation:
+				{
+					UObject* Asset = InputObject->GetObject();
+					if (!IsValid(Asset) || !HashInputAsset(Sha, Asset))
+						return false;
+					break;
+				}
+
+				case EHoudiniInputObjectType::HoudiniAssetComponent:
+				{
+					// Upstream HDAs contribute the key of their own outputs
+					UHoudiniInputHoudiniAsset* InputHoudiniAsset = Cast<UHoudiniInputHoudiniAsset>(InputObject);
+					UHoudiniAssetComponent* InputHAC = InputHoudiniAsset ? InputHoudiniAsset->GetHoudiniAssetComponent() : nullptr;
+					if (!IsValid(InputHAC) || InputHAC->GetCookCacheKey().IsEmpty())
+						return false;
+
+					// Its outputs are being updated
+					const EHoudiniAssetState InputState = InputHAC->GetAssetState();
+					if (InputState != EHoudiniAssetState::None && InputState != EHoudiniAssetState::NeedInstantiation)
+						return false;
+
+					HashString(Sha, InputHAC->GetCookCacheKey());
+					HashValue(Sha, InputHoudiniAsset->AssetOutputIndex);
+					break;
+				}
+
+				default:
+					// Components and actors depend on the level's content
+					return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+bool
+FHoudiniCookCache::IsEnabled()
+{
+	return CVarHoudiniEngineCookCache.GetValueOnGameThread() != 0;
+}
+
+void
+FHoudiniCookCache::InvalidateAsset(const UHoudiniAsset* InHoudiniAsset)
+{
+	if (InHoudiniAsset)
+		CachedAssetHashes.Remove(FObjectKey(InHoudiniAsset));
+}
+
+bool
+FHoudiniCookCache::ComputeCookKey(UHoudiniAssetComponent* HAC, FString& OutKey)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniCookCache::ComputeCookKey);
+
+	OutKey.Empty();
+
+	if (!IsValid(HAC))
+		return false;
+
+	// Blueprint and node sync components don't own their outputs, PDG outputs aren't tracked
+	if (HAC->IsA<UHoudiniAssetBlueprintComponent>() || HAC->IsA<UHoudiniNodeSyncComponent>())
+		return false;
+
+	if (HAC->GetPDGAssetLink() != nullptr)
+		return false;
+
+	UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
+	if (!IsValid(HoudiniAsset))
+		return false;
+
+	FSHA1 Sha;
+
+	// Plugin and HAPI versions: outputs may be translated differently
+	HashValue(Sha, HAPI_VERSION_HOUDINI_MAJOR);
+	HashValue(Sha, HAPI_VERSION_HOUDINI_MINOR);
+	HashValue(Sha, HAPI_VERSION_HOUDINI_BUILD);
+	HashValue(Sha, HAPI_VERSION_HOUDINI_ENGINE_MAJOR);
+	HashValue(Sha, HAPI_VERSION_HOUDINI_ENGINE_MINOR);
+	HashValue(Sha, HAPI_VERSION_HOUDINI_ENGINE_API);
+
+	TSharedPtr<IPlugin> HoudiniPlugin = IPluginManager::Get().FindPlugin(TEXT("HoudiniEngine"));
+	if (HoudiniPlugin.IsValid())
+		HashString(Sha, HoudiniPlugin->GetDescriptor().VersionName);
+
+	// HDA library: the bytes stored in the asset, or the file it was imported from
+	HashString(Sha, HoudiniAsset->GetAssetFileName());
+	HashString(Sha, HAC->GetHapiAssetName());
+	HashValue(Sha, HoudiniAsset->GetAssetBytesCount());
+	if (HoudiniAsset->GetAssetBytesCount() > 0 && HoudiniAsset->GetAssetBytes())
+	{
+		HashAssetBytes(Sha, HoudiniAsset);
+	}
+	else
+	{
+		const FString AssetFileName = HoudiniAsset->GetAssetFileName();
+		if (IFileManager::Get().DirectoryExists(*AssetFileName))
+		{
+			// Expanded HDAs can't be cheaply hashed
+			return false;
+		}
+
+		const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*AssetFileName);
+		if (TimeStamp == FDateTime::MinValue())
+			return false;
+
+		HashValue(Sha, TimeStamp.GetTicks());
+		HashValue(Sha, IFileManager::Get().FileSize(*AssetFileName));
+	}
+
+	// Cook settings
+	HashValue(Sha, HAC->bUseOutputNodes);
+	HashValue(Sha, HAC->bOutputTemplateGeos);
+	HashValue(Sha, HAC->bUploadTransformsToHoudiniEngine);
+	if (HAC->bUploadTransformsToHoudiniEngine)
+		HashString(Sha, HAC->GetComponentTransform().ToString());
+
+	// Output generation settings
+	HashValue(Sha, HAC->bUseDeprecatedRawMeshSupport);
+	HashValue(Sha, HAC->bSplitMeshSupport);
+	HashValue(Sha, HAC->IsProxyStaticMeshEnabled());
+	HashString(Sha, HAC->TemporaryCookFolder.Path);
+	HashStruct(Sha, HAC->StaticMeshGenerationProperties);
+	HashStruct(Sha, HAC->StaticMeshBuildSettings);
+	HashRuntimeSettings(Sha);
+
+	// Parameters
+	HashValue(Sha, HAC->GetNumParameters());
+	for (int32 Idx = 0; Idx < HAC->GetNumParameters(); ++Idx)
+	{
+		const UHoudiniParameter* Parameter = HAC->GetParameterAt(Idx);
+		if (!IsValid(Parameter))
+			return false;
+
+		HashParameterProperties(Sha, Parameter, 0);
+	}
+
+	// Inputs
+	HashValue(Sha, HAC->GetNumInputs());
+	for (int32 Idx = 0; Idx < HAC->GetNumInputs(); ++Idx)
+	{
+		const UHoudiniInput* Input = HAC->GetInputAt(Idx);
+		if (!IsValid(Input) || !HashInput(Sha, Input))
+			return false;
+	}
+
+	// Editable nodes are modified in Unreal after the cook
+	TArray<UHoudiniOutput*> Outputs;
+	HAC->GetOutputs(Outputs);
+	for (UHoudiniOutput* Output : Outputs)
+	{
+		if (IsValid(Output) && Output->IsEditableNode())
+			return false;
+	}
+
+	Sha.Final();
+
+	FSHAHash Hash;
+	Sha.GetHash(Hash.Hash);
+	OutKey = Hash.ToString();
+
+	return true;
+}
+
+void
+FHoudiniCookCache::OnPreCook(UHoudiniAssetComponent* HAC)
+{
+	if (!IsValid(HAC))
+		return;
+
+	HAC->PendingCookCacheKey.Empty();
+	if (IsEnabled())
+		ComputeCookKey(HAC, HAC->PendingCookCacheKey);
+}
+
+void
+FHoudiniCookCache::OnPostProcess(UHoudiniAssetComponent* HAC, const bool bOutputsUpdated)
+{
+	if (!IsValid(HAC))
+		return;
+
+	// A failed cook may have left partial outputs
+	HAC->CookCacheKey = bOutputsUpdated ? HAC->PendingCookCacheKey : FString();
+	HAC->PendingCookCacheKey.Empty();
+}
+
+bool
+FHoudiniCookCache::TrySkipCook(UHoudiniAssetComponent* HAC)
+{
+	if (!IsValid(HAC) || !IsEnabled())
+		return false;
+
+	if (HAC->CookCacheKey.IsEmpty())
+		return false;
+
+	// Explicit recooks / rebuilds always go through the session
+	if (HAC->HasRecookBeenRequested() || HAC->HasRebuildBeenRequested())
+		return false;
+
+	// Button presses and reverts to default do not change the cook key (the pending revert state is transient),
+	// but they are actions that must reach the session: skipping the cook would drop them
+	for (int32 Idx = 0; Idx < HAC->GetNumParameters(); ++Idx)
+	{
+		const UHoudiniParameter* Parameter = HAC->GetParameterAt(Idx);
+		if (!IsValid(Parameter))
+			continue;
+
+		if (Parameter->IsPendingRevertToDefault())
+			return false;
+
+		const EHoudiniParameterType ParameterType = Parameter->GetParameterType();
+		if ((ParameterType == EHoudiniParameterType::Button || ParameterType == EHoudiniParameterType::ButtonStrip)
+			&& Parameter->HasChanged() && Parameter->NeedsToTriggerUpdate())
+		{
+			return false;
+		}
+	}
+
+	// The saved outputs must still be there
+	bool bHasOutputObjects = false;
+	TArray<UHoudiniOutput*> Outputs;
+	HAC->GetOutputs(Outputs);
+	for (UHoudiniOutput* Output : Outputs)
+	{
+		if (IsValid(Output) && Output->GetOutputObjects().Num() > 0)
+		{
+			bHasOutputObjects = true;
+			break;
+		}
+	}
+
+	if (!bHasOutputObjects)
+		return false;
+
+	FString CookKey;
+	if (!ComputeCookKey(HAC, CookKey) || CookKey != HAC->CookCacheKey)
+		return false;
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("%s: parameters and inputs match the saved outputs, skipping instantiation and cook."),
+		*HAC->GetDisplayName());
+
+	// Clear the triggers, but leave everything marked as changed so that a full upload
+	// happens when the HDA is eventually instantiated.
+	HAC->bForceNeedUpdate = false;
+	HAC->bHasComponentTransformChanged = false;
+
+	for (int32 Idx = 0; Idx < HAC->GetNumParameters(); ++Idx)
+	{
+		UHoudiniParameter* Parameter = HAC->GetParameterAt(Idx);
+		if (IsValid(Parameter))
+			Parameter->SetNeedsToTriggerUpdate(false);
+	}
+
+	for (int32 Idx = 0; Idx < HAC->GetNumInputs(); ++Idx)
+	{
+		UHoudiniInput* Input = HAC->GetInputAt(Idx);
+		if (IsValid(Input))
+			Input->SetNeedsToTriggerUpdate(false);
+	}
+
+	return true;
+}
@@ -0,0 +1,73 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UHoudiniAsset;
+class UHoudiniAssetComponent;
+
+// Cook key of a Houdini Asset Component.
+//
+// The outputs of a HAC are saved along with it, so they already are the cached result of its
+// last successful cook. The cook key hashes everything that cook depended on: the HDA library,
+// the parameter values, the content of the inputs, the cook and mesh generation settings of the HAC,
+// the project settings affecting the outputs and the plugin / HAPI versions.
+// The hash of the HDA library bytes is computed once per asset, and forgotten when it is reimported.
+// It is stored on the HAC after each successful cook, so that a HAC that has not been instantiated
+// yet can keep its saved outputs instead of being instantiated and cooked when an update is
+// triggered with an unchanged key.
+struct HOUDINIENGINE_API FHoudiniCookCache
+{
+public:
+
+	// Returns true if the cook cache is enabled (HoudiniEngine.CookCache).
+	static bool IsEnabled();
+
+	// Forgets the cached hash of the asset's library. Called when the asset is reimported.
+	static void InvalidateAsset(const UHoudiniAsset* InHoudiniAsset);
+
+	// Computes the cook key of the HAC's current state.
+	// Returns false if the HAC cannot be cached: world / actor / curve inputs, editable nodes,
+	// unsaved input assets, upstream HDAs without a cook key...
+	static bool ComputeCookKey(UHoudiniAssetComponent* HAC, FString& OutKey);
+
+	// Called before starting the cook of the HAC: computes the key its outputs will match.
+	static void OnPreCook(UHoudiniAssetComponent* HAC);
+
+	// Called once the results of the cook have been processed (or the cook failed):
+	// stores the pending key on the HAC, or clears it if its outputs were not updated.
+	static void OnPostProcess(UHoudiniAssetComponent* HAC, const bool bOutputsUpdated);
+
+	// Called when a HAC needing instantiation needs to be updated.
+	// If the update was not explicitly requested and the HAC's cook key matches the key of its
+	// saved outputs, the update triggers are cleared so the HAC is not instantiated and cooked.
+	// The parameters and inputs are left marked as changed so they are all uploaded
+	// when the HAC is eventually instantiated.
+	// Returns true if the cook has been skipped.
+	static bool TrySkipCook(UHoudiniAssetComponent* HAC);
+};
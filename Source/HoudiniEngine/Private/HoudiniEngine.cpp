@@ -29,6 +29,9 @@
 #include "HoudiniEnginePrivatePCH.h"
 
 #include "HoudiniApi.h"
+#include "HoudiniApiTrace.h"
+#include "HoudiniAssetLibraryCache.h"
+#include "HoudiniOutputHarvest.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
@@ -39,6 +42,7 @@
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
+#include "UnrealLandscapeTranslator.h"
 #include "UnrealObjectInputManager.h"
 #include "UnrealObjectInputManagerImpl.h"
 #include "HAPI/HAPI_Version.h"
@@ -66,6 +70,9 @@ DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 FHoudiniEngine *
 FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
+// Index of the session (in the session pool) used by the current thread.
+static thread_local int32 HoudiniEngineCurrentSessionIndex = 0;
+
 FHoudiniEngine::FHoudiniEngine()
 	: LicenseType(HAPI_LICENSE_NONE)
 	, HoudiniEngineSchedulerThread(nullptr)
@@ -144,6 +151,16 @@ FHoudiniEngine::StartupModule()
 		}
 	}
 
+	// Record or replay the HAPI calls if requested on the command line.
+	// Replaying does not need libHAPI, which allows profiling output translation without Houdini.
+	{
+		FString ApiTraceFilePath;
+		if (FParse::Value(FCommandLine::Get(), TEXT("HoudiniApiTraceReplay="), ApiTraceFilePath))
+			FHoudiniApiTrace::StartReplay(ApiTraceFilePath);
+		else if (FParse::Value(FCommandLine::Get(), TEXT("HoudiniApiTraceRecord="), ApiTraceFilePath))
+			FHoudiniApiTrace::StartRecording(ApiTraceFilePath);
+	}
+
 	// Create static mesh Houdini logo.
 	HoudiniLogoStaticMesh = LoadObject<UStaticMesh>(
 		nullptr, HAPI_UNREAL_RESOURCE_HOUDINI_LOGO, nullptr, LOAD_None, nullptr);
@@ -253,6 +270,9 @@ FHoudiniEngine::ShutdownModule()
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Shutting down the Houdini Engine module."));
 
+	// Stop tracking the landscapes sent as heightfield inputs
+	FUnrealLandscapeTranslator::ResetHeightfieldUploadStates();
+
 	// We no longer need the Houdini logo static mesh.
 	if (HoudiniLogoStaticMesh.IsValid())
 	{
@@ -306,6 +326,9 @@ FHoudiniEngine::ShutdownModule()
 	// Destroy the Unreal Object Input manager
 	FUnrealObjectInputManager::DestroySingleton();
 
+	// Stop the pooled sessions and their schedulers
+	StopSessionPool();
+
 	// Do scheduler and thread clean up.
 	if (HoudiniEngineScheduler)
 		HoudiniEngineScheduler->Stop();
@@ -327,7 +350,11 @@ FHoudiniEngine::ShutdownModule()
 
 	// Do manager clean up.
 	if (HoudiniEngineManager)
+	{
+		// The PDG event pump uses the main session, stop it even if we're not ticking
+		HoudiniEngineManager->StopPDGEventPump();
 		HoudiniEngineManager->StopHoudiniTicking();
+	}
 
 	if (HoudiniEngineManager)
 	{
@@ -343,6 +370,9 @@ FHoudiniEngine::ShutdownModule()
 		SessionStatus = EHoudiniSessionStatus::Invalid;
 	}
 
+	// Flush the HAPI trace before unloading the function table.
+	FHoudiniApiTrace::Stop();
+
 	FHoudiniApi::FinalizeHAPI();
 
 	FHoudiniEngine::HoudiniEngineInstance = nullptr;
@@ -351,15 +381,30 @@ FHoudiniEngine::ShutdownModule()
 void
 FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 {
-	if ( HoudiniEngineScheduler )
-		HoudiniEngineScheduler->AddTask(InTask);
+	{
+		// Register the task info before handing the task to the scheduler:
+		// the scheduler thread wakes up immediately and could otherwise have
+		// its first response overwritten by this placeholder.
+		FScopeLock ScopeLock(&CriticalSection);
+		FHoudiniEngineTaskInfo TaskInfo;
+		TaskInfo.TaskType = InTask.TaskType;
+		TaskInfo.TaskState = EHoudiniEngineTaskState::Working;
+
+		TaskInfos.Add(InTask.HapiGUID, TaskInfo);
+	}
 
-	FScopeLock ScopeLock(&CriticalSection);
-	FHoudiniEngineTaskInfo TaskInfo;
-	TaskInfo.TaskType = InTask.TaskType;
-	TaskInfo.TaskState = EHoudiniEngineTaskState::Working;
+	// Tasks are executed by the scheduler of the session they target
+	const int32 SessionIndex = InTask.SessionIndex < 0 ? GetCurrentSessionIndex() : InTask.SessionIndex;
+	FHoudiniEngineScheduler* Scheduler = HoudiniEngineScheduler;
+	if (SessionIndex > 0 && PooledSessionSchedulers.IsValidIndex(SessionIndex - 1))
+		Scheduler = PooledSessionSchedulers[SessionIndex - 1];
+
+	if (!Scheduler)
+		return;
 
-	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
+	FHoudiniEngineTask Task = InTask;
+	Task.SessionIndex = SessionIndex;
+	Scheduler->AddTask(Task);
 }
 
 void
@@ -443,7 +488,60 @@ FHoudiniEngine::GetHoudiniExecutable()
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
-	return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
+	return GetSessionAt(HoudiniEngineCurrentSessionIndex);
+}
+
+const HAPI_Session *
+FHoudiniEngine::GetSessionAt(const int32 InSessionIndex) const
+{
+	if (InSessionIndex <= 0)
+	{
+		// Replaying a HAPI trace does not need a session
+		if (Session.type == HAPI_SESSION_MAX)
+			return FHoudiniApiTrace::GetReplaySession();
+
+		return &Session;
+	}
+
+	// Do not fall back to the main session for invalid pooled sessions:
+	// the node ids of a pooled session would refer to unrelated nodes in the main session.
+	if (!PooledSessions.IsValidIndex(InSessionIndex - 1))
+		return nullptr;
+
+	const HAPI_Session& PooledSession = PooledSessions[InSessionIndex - 1];
+	return PooledSession.type == HAPI_SESSION_MAX ? nullptr : &PooledSession;
+}
+
+int32
+FHoudiniEngine::GetSessionPoolSize() const
+{
+	if (Session.type == HAPI_SESSION_MAX)
+		return 0;
+
+	return PooledSessions.Num() + 1;
+}
+
+int32
+FHoudiniEngine::GetCurrentSessionIndex()
+{
+	return HoudiniEngineCurrentSessionIndex;
+}
+
+void
+FHoudiniEngine::SetCurrentSessionIndex(const int32 InSessionIndex)
+{
+	HoudiniEngineCurrentSessionIndex = FMath::Max(InSessionIndex, 0);
+}
+
+FHoudiniEngineScopedSession::FHoudiniEngineScopedSession(const int32 InSessionIndex)
+	: PreviousSessionIndex(FHoudiniEngine::GetCurrentSessionIndex())
+{
+	FHoudiniEngine::SetCurrentSessionIndex(InSessionIndex);
+}
+
+FHoudiniEngineScopedSession::~FHoudiniEngineScopedSession()
+{
+	FHoudiniEngine::SetCurrentSessionIndex(PreviousSessionIndex);
 }
 
 const EHoudiniSessionStatus&
@@ -893,23 +991,7 @@ FHoudiniEngine::InitializeHAPISession()
 			TEXT("This could cause instabilities and crashes when using the Houdini Engine plugin"));
 	}
 
-	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-
-	// Default CookOptions
-	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-
-	bool bUseCookingThread = true;
-	HAPI_Result Result = FHoudiniApi::Initialize(
-		&Session,
-		&CookOptions,
-		bUseCookingThread,
-		HoudiniRuntimeSettings->CookingThreadStackSize,
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->OtlSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->DsoSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->ImageDsoSearchPath),
-		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->AudioDsoSearchPath));
-	
+	HAPI_Result Result = InitializeHAPI(&Session);
 	if (Result == HAPI_RESULT_SUCCESS)
 	{
 		HOUDINI_LOG_MESSAGE(TEXT("Successfully intialized the Houdini Engine module."));
@@ -928,9 +1010,6 @@ FHoudiniEngine::InitializeHAPISession()
 		return false;
 	}
 
-	// Let HAPI know we are running inside UE4
-	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
-
 	if (bEnableSessionSync)
 	{
 		// Set the session sync infos if needed
@@ -945,15 +1024,182 @@ FHoudiniEngine::InitializeHAPISession()
 	return true;
 }
 
+HAPI_Result
+FHoudiniEngine::InitializeHAPI(const HAPI_Session* InSession)
+{
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+	// Default CookOptions
+	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+
+	bool bUseCookingThread = true;
+	HAPI_Result Result = FHoudiniApi::Initialize(
+		InSession,
+		&CookOptions,
+		bUseCookingThread,
+		HoudiniRuntimeSettings->CookingThreadStackSize,
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->OtlSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->DsoSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->ImageDsoSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->AudioDsoSearchPath));
+
+	if (Result == HAPI_RESULT_SUCCESS || Result == HAPI_RESULT_ALREADY_INITIALIZED)
+	{
+		// Let HAPI know we are running inside UE4
+		FHoudiniApi::SetServerEnvString(InSession, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
+	}
+
+	return Result;
+}
+
+bool
+FHoudiniEngine::StartSessionPool(
+	const EHoudiniRuntimeSettingsSessionType& MainSessionType,
+	const FString& MainServerPipeName,
+	const int32& MainServerPort)
+{
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	const int32 NumPooledSessions = FMath::Clamp(HoudiniRuntimeSettings->SessionPoolSize, 1, HAPI_UNREAL_SESSION_POOL_MAX_SIZE) - 1;
+	if (NumPooledSessions <= 0)
+		return true;
+
+	// Make sure we start from a clean pool
+	StopSessionPool();
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(&Session))
+		return false;
+
+	// HDAs created by the user in Houdini must all be visible in the same session
+	if (bEnableSessionSync)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Houdini Engine Session Pool: pooled sessions are not used with Session Sync."));
+		return false;
+	}
+
+	const EHoudiniRuntimeSettingsSessionType SessionType = MainSessionType;
+	if (SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_Socket
+		&& SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Houdini Engine Session Pool: pooled sessions require a Socket or Named Pipe session type."));
+		return false;
+	}
+
+	// StartSession() updates the session sync flag and license type from the session it creates,
+	// but these must keep reflecting the main session.
+	const bool bMainSessionSync = bEnableSessionSync;
+	const HAPI_License MainLicenseType = LicenseType;
+
+	for (int32 PoolIdx = 1; PoolIdx <= NumPooledSessions; PoolIdx++)
+	{
+		HAPI_Session NewSession;
+		NewSession.type = HAPI_SESSION_MAX;
+		NewSession.id = -1;
+		HAPI_Session* NewSessionPtr = &NewSession;
+
+		// Each pooled session gets its own HARS process, on its own pipe / port.
+		// They are derived from the main session's so that sessions using another pipe (commandlets...)
+		// never connect to the pooled servers of another process.
+		const FString PipeName = FString::Printf(TEXT("%s_%d"), *MainServerPipeName, PoolIdx);
+		const int32 Port = MainServerPort + PoolIdx;
+		if (!StartSession(
+			NewSessionPtr,
+			true,
+			HoudiniRuntimeSettings->AutomaticServerTimeout,
+			SessionType,
+			PipeName,
+			Port,
+			HoudiniRuntimeSettings->ServerHost))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Houdini Engine Session Pool: failed to start pooled session %d."), PoolIdx);
+			break;
+		}
+
+		const HAPI_Result Result = InitializeHAPI(NewSessionPtr);
+		if (Result != HAPI_RESULT_SUCCESS && Result != HAPI_RESULT_ALREADY_INITIALIZED)
+		{
+			HOUDINI_LOG_WARNING(
+				TEXT("Houdini Engine Session Pool: failed to initialize pooled session %d: %s"),
+				PoolIdx, *FHoudiniEngineUtils::GetErrorDescription(Result));
+			FHoudiniApi::CloseSession(NewSessionPtr);
+			break;
+		}
+
+		PooledSessions.Add(NewSession);
+
+		FHoudiniEngineScheduler* Scheduler = new FHoudiniEngineScheduler();
+		PooledSessionSchedulers.Add(Scheduler);
+		PooledSessionSchedulerThreads.Add(FRunnableThread::Create(
+			Scheduler, *FString::Printf(TEXT("HoudiniSchedulerThread_%d"), PoolIdx), 0, TPri_Normal));
+	}
+
+	bEnableSessionSync = bMainSessionSync;
+	LicenseType = MainLicenseType;
+
+	HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Session Pool: %d session(s) available."), GetSessionPoolSize());
+
+	return PooledSessions.Num() == NumPooledSessions;
+}
+
+void
+FHoudiniEngine::StopSessionPool()
+{
+	// Stop the schedulers first so no task uses a session that is being closed
+	for (FHoudiniEngineScheduler* Scheduler : PooledSessionSchedulers)
+	{
+		if (Scheduler)
+			Scheduler->Stop();
+	}
+
+	for (FRunnableThread* SchedulerThread : PooledSessionSchedulerThreads)
+	{
+		if (!SchedulerThread)
+			continue;
+
+		SchedulerThread->WaitForCompletion();
+		delete SchedulerThread;
+	}
+	PooledSessionSchedulerThreads.Empty();
+
+	for (FHoudiniEngineScheduler* Scheduler : PooledSessionSchedulers)
+	{
+		delete Scheduler;
+	}
+	PooledSessionSchedulers.Empty();
+
+	if (FHoudiniApi::IsHAPIInitialized())
+	{
+		for (HAPI_Session& PooledSession : PooledSessions)
+		{
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(&PooledSession))
+				continue;
+
+			FHoudiniApi::Cleanup(&PooledSession);
+			FHoudiniApi::CloseSession(&PooledSession);
+		}
+	}
+	PooledSessions.Empty();
+}
 
 void
 FHoudiniEngine::OnSessionLost()
 {
+	// The PDG event pump must not use the session while we invalidate it
+	if (HoudiniEngineManager)
+		HoudiniEngineManager->StopPDGEventPump();
+
 	// Mark the session as invalid
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Lost);
 
+	// The loaded libraries, pooled nodes and harvested geos are gone with the session
+	FHoudiniAssetLibraryCache::Reset();
+	FHoudiniOutputHarvest::Reset();
+
+	// The nodes of the pooled sessions are invalid too, as all HACs get re-instantiated
+	StopSessionPool();
+
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
 
@@ -978,6 +1224,16 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	if (!FHoudiniApi::IsHAPIInitialized())
 		return false;
 
+	// Stopping the main session also stops the PDG event pump and the pooled sessions,
+	// before the main session is cleaned up and closed
+	if (SessionPtr == &Session)
+	{
+		if (HoudiniEngineManager)
+			HoudiniEngineManager->StopPDGEventPump();
+
+		StopSessionPool();
+	}
+
 	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(SessionPtr))
 	{
 		// SessionPtr is valid, clean up and close the session
@@ -988,6 +1244,10 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
+
+	// The loaded libraries, pooled nodes and harvested geos are gone with the session
+	FHoudiniAssetLibraryCache::Reset();
+	FHoudiniOutputHarvest::Reset();
 	bEnableSessionSync = false;
 
 	HoudiniEngineManager->StopHoudiniTicking();
@@ -1038,6 +1298,10 @@ FHoudiniEngine::RestartSession()
 			{
 				bSuccess = true;
 				SetSessionStatus(EHoudiniSessionStatus::Connected);
+				StartSessionPool(
+					HoudiniRuntimeSettings->SessionType,
+					HoudiniRuntimeSettings->ServerPipeName,
+					HoudiniRuntimeSettings->ServerPort);
 			}
 		}
 	}
@@ -1056,7 +1320,7 @@ FHoudiniEngine::RestartSession()
 }
 
 bool
-FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionType, FName OverrideServerPipeName)
+FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionType, FName OverrideServerPipeName, const bool& bStartSessionPool)
 {
 	HAPI_Session* SessionPtr = &Session;
 
@@ -1068,12 +1332,13 @@ FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionT
 
 	// Try to reconnect/start a new session
 	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	const FString ServerPipeName = OverrideServerPipeName == NAME_None ? HoudiniRuntimeSettings->ServerPipeName : OverrideServerPipeName.ToString();
 	if (!StartSession(
 		SessionPtr,
 		true,
 		HoudiniRuntimeSettings->AutomaticServerTimeout,
 		SessionType,
-		OverrideServerPipeName == NAME_None ? HoudiniRuntimeSettings->ServerPipeName : OverrideServerPipeName.ToString(),
+		ServerPipeName,
 		HoudiniRuntimeSettings->ServerPort,
 		HoudiniRuntimeSettings->ServerHost))
 	{
@@ -1092,6 +1357,8 @@ FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionT
 		{
 			bSuccess = true;
 			SetSessionStatus(EHoudiniSessionStatus::Connected);
+			if (bStartSessionPool)
+				StartSessionPool(SessionType, ServerPipeName, HoudiniRuntimeSettings->ServerPort);
 		}
 	}
 
@@ -1145,6 +1412,7 @@ FHoudiniEngine::ConnectSession(const EHoudiniRuntimeSettingsSessionType& Session
 		{
 			bSuccess = true;
 			SetSessionStatus(EHoudiniSessionStatus::Connected);
+			StartSessionPool(SessionType, HoudiniRuntimeSettings->ServerPipeName, HoudiniRuntimeSettings->ServerPort);
 		}
 	}
 
@@ -1397,6 +1665,14 @@ FHoudiniEngine::GetPDGCommandletStatus()
 	return EHoudiniBGEOCommandletStatus::NotStarted;
 }
 
+FHoudiniPDGImportStats
+FHoudiniEngine::GetPDGImportStats() const
+{
+	if (HoudiniEngineManager)
+		return HoudiniEngineManager->GetPDGImportStats();
+	return FHoudiniPDGImportStats();
+}
+
 void
 FHoudiniEngine::UnregisterPostEngineInitCallback()
 {
@@ -43,6 +43,7 @@ class UMaterial;
 struct FSlateDynamicImageBrush;
 
 enum class EHoudiniBGEOCommandletStatus : uint8;
+struct FHoudiniPDGImportStats;
 
 UENUM()
 enum class EHoudiniSessionStatus : int8
@@ -80,8 +81,22 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		static const FString GetHoudiniExecutable();
 
 		// Session accessor
+		// Returns the session used by the calling thread: the main session, unless a pooled session
+		// has been selected with FHoudiniEngineScopedSession.
 		virtual const HAPI_Session* GetSession() const;
 
+		// Returns the session at the given index in the session pool (0 is the main session)
+		const HAPI_Session* GetSessionAt(const int32 InSessionIndex) const;
+
+		// Returns the number of sessions that can be used to cook HDAs (main session included)
+		int32 GetSessionPoolSize() const;
+
+		// Returns the index of the session used by the calling thread
+		static int32 GetCurrentSessionIndex();
+
+		// Sets the index of the session used by the calling thread, prefer FHoudiniEngineScopedSession
+		static void SetCurrentSessionIndex(const int32 InSessionIndex);
+
 		virtual const EHoudiniSessionStatus& GetSessionStatus() const;
 
 		bool GetSessionStatusAndColor(FString& OutStatusString, FLinearColor& OutStatusColor);
@@ -116,7 +131,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Stops, then creates a new session
 		bool RestartSession();
 		// Creates a session, start HARS
-		bool CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionType, FName OverrideServerPipeName=NAME_None);
+		// bStartSessionPool: also start the pooled sessions, on pipes / ports derived from the main session's.
+		bool CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionType, FName OverrideServerPipeName=NAME_None, const bool& bStartSessionPool=true);
 		// Connect to an existing HE session
 		bool ConnectSession(const EHoudiniRuntimeSettingsSessionType& SessionType);
 
@@ -130,6 +146,20 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Initialize HAPI
 		bool InitializeHAPISession();
 
+		// Initialize HAPI on the given session, and let it know we are running inside Unreal
+		static HAPI_Result InitializeHAPI(const HAPI_Session* InSession);
+
+		// Starts the additional pooled sessions (UHoudiniRuntimeSettings::SessionPoolSize - 1)
+		// Requires a valid, non session-sync, main session. The pooled sessions use the main session's type,
+		// on the main session's pipe name suffixed with _N or on its port + N.
+		bool StartSessionPool(
+			const EHoudiniRuntimeSettingsSessionType& MainSessionType,
+			const FString& MainServerPipeName,
+			const int32& MainServerPort);
+
+		// Stops all the pooled sessions and their schedulers
+		void StopSessionPool();
+
 		// Indicate to the plugin that the session is now invalid (HAPI has likely crashed...)
 		void OnSessionLost();
 
@@ -240,6 +270,9 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		EHoudiniBGEOCommandletStatus GetPDGCommandletStatus();
 
+		// Returns the PDG work result loading counters
+		FHoudiniPDGImportStats GetPDGImportStats() const;
+
 		FHoudiniEngineManager* GetHoudiniEngineManager() { return HoudiniEngineManager; }
 
 		const FHoudiniEngineManager* GetHoudiniEngineManager() const { return HoudiniEngineManager; }
@@ -257,6 +290,14 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// The Houdini Engine session. 
 		HAPI_Session Session;
 
+		// Additional sessions used to cook independent HDAs concurrently.
+		// Pooled session N is stored at index N - 1, the main session always has the index 0.
+		TArray<HAPI_Session> PooledSessions;
+
+		// One scheduler (and its thread) per pooled session, so each session cooks independently.
+		TArray<FHoudiniEngineScheduler*> PooledSessionSchedulers;
+		TArray<FRunnableThread*> PooledSessionSchedulerThreads;
+
 		// The Houdini Engine session's status
 		EHoudiniSessionStatus SessionStatus;
 
@@ -345,4 +386,15 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		/** Used to delay notification updates for HAPI asynchronous work. **/
 		double HapiNotificationStarted;
 #endif
-};
\ No newline at end of file
+};
+
+// Makes FHoudiniEngine::GetSession() return the session at the given pool index
+// on the calling thread, for the lifetime of this object.
+struct HOUDINIENGINE_API FHoudiniEngineScopedSession
+{
+	explicit FHoudiniEngineScopedSession(const int32 InSessionIndex);
+	~FHoudiniEngineScopedSession();
+
+private:
+	int32 PreviousSessionIndex;
+};
@@ -22,4 +22,230 @@
 * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
 * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
 * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
\ No newline at end of file
+*/
+
+#include "HoudiniEngineCommandlet.h"
+
+#include "Misc/App.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+#include "Interfaces/ISlateNullRendererModule.h"
+#include "Rendering/SlateRenderer.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/ThreadManager.h"
+
+
+UHoudiniEngineCommandlet::UHoudiniEngineCommandlet()
+{
+	HelpDescription = TEXT("Runs a batch of Houdini Public API jobs (HDA, parameters, inputs, bake settings) from a JSON job file.");
+
+	HelpUsage = TEXT("HoudiniEngine Usage: -run=HoudiniEngine -jobs=jobs.json {options} -unattended -nullrhi");
+
+	HelpParamNames = {
+		"help",
+		"jobs",
+		"report",
+		"concurrency",
+		"timeout",
+		"sessionpool"
+	};
+
+	HelpParamDescriptions = {
+		"Displays this help.",
+		"The JSON job file, see UHoudiniPublicAPIBatchProcessor::LoadJobsFromFile().",
+		"The file the per-job results and timings are streamed to, as JSON lines. Defaults to Saved/HoudiniEngine/BatchReport_<date>.jsonl.",
+		"The maximum number of jobs running at the same time. Defaults to the number of jobs that can cook on different sessions: 1 without -sessionpool.",
+		"Fail the jobs that have not completed after this many seconds. Disabled by default.",
+		"Also start the pooled sessions (Session Pool Size in the plugin settings), on pipes derived from the commandlet's own pipe. Disabled by default."
+	};
+
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowProgress = false;
+	ShowErrorCount = false;
+
+	bBatchDone = false;
+	NumFailedJobs = 0;
+}
+
+void UHoudiniEngineCommandlet::PrintUsage() const
+{
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpDescription);
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpUsage);
+	const int32 NumOptions = HelpParamNames.Num();
+	for (int32 Idx = 0; Idx < NumOptions; ++Idx)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("-%s\t%s"), *HelpParamNames[Idx], *HelpParamDescriptions[Idx]);
+	}
+}
+
+FOnHoudiniEngineCommandletRunBatch& UHoudiniEngineCommandlet::GetRunBatchDelegate()
+{
+	static FOnHoudiniEngineCommandletRunBatch RunBatchDelegate;
+	return RunBatchDelegate;
+}
+
+bool UHoudiniEngineCommandlet::StartHoudiniEngineSession(const bool& bInStartSessionPool)
+{
+	// Start Houdini Engine session
+	HOUDINI_LOG_DISPLAY(TEXT("Starting Houdini Engine session..."));
+	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+	// Several commandlets can run on the same machine, each needs its own pipe
+	const FString PipeName = FString::Printf(TEXT("hapi_cmdlet_%s"), *FGuid::NewGuid().ToString());
+	if (!HoudiniEngine.CreateSession(
+		EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe,
+		FName(*PipeName),
+		bInStartSessionPool))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to start Houdini Engine session."));
+		return false;
+	}
+
+	return true;
+}
+
+void UHoudiniEngineCommandlet::HandleBatchDone(int32 InNumFailedJobs)
+{
+	bBatchDone = true;
+	NumFailedJobs = InNumFailedJobs;
+}
+
+int32 UHoudiniEngineCommandlet::MainLoop()
+{
+	GIsRunning = true;
+
+	// In UnrealEngine 4.25 and older we cannot tick the editor engine without slate being initialized.
+	if (!FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::InitHighDPI(false);
+		FSlateApplication::Create();
+	}
+
+	// If slate is initialized, make sure it has a renderer. If we have to create a renderer, create the null renderer.
+	if (FSlateApplication::IsInitialized() && !FSlateApplication::Get().GetRenderer())
+	{
+		const TSharedPtr<FSlateRenderer> SlateRenderer = FModuleManager::Get().LoadModuleChecked<ISlateNullRendererModule>("SlateNullRenderer").CreateSlateNullRenderer();
+		const TSharedRef<FSlateRenderer> SlateRendererSharedRef = SlateRenderer.ToSharedRef();
+		FSlateApplication::Get().InitializeRenderer(SlateRendererSharedRef);
+	}
+
+	// The batch spawns and deletes an actor per instance, collect them regularly on long runs
+	const double GarbageCollectionIntervalSeconds = 60.0;
+	double LastGarbageCollectionTimeSeconds = FPlatformTime::Seconds();
+
+	// main loop
+	while (!bBatchDone && GIsRunning && !IsEngineExitRequested())
+	{
+		GEngine->UpdateTimeAndHandleMaxTickRate();
+		GEngine->Tick(FApp::GetDeltaTime(), false);
+
+		if (FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().PumpMessages();
+			FSlateApplication::Get().Tick();
+		}
+
+		// Required for FTimerManager to function - as it blocks ticks, if the frame counter doesn't change
+		GFrameCounter++;
+
+		// update task graph
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+		// Ticks the Houdini Engine manager and the batch
+		FTSTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
+		FThreadManager::Get().Tick();
+		GEngine->TickDeferredCommands();
+
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastGarbageCollectionTimeSeconds > GarbageCollectionIntervalSeconds)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			LastGarbageCollectionTimeSeconds = Now;
+		}
+	}
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	if (!bBatchDone)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Exit requested before the batch completed."));
+		return 5;
+	}
+
+	return 0;
+}
+
+int32 UHoudiniEngineCommandlet::Main(const FString& InParams)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*InParams, Tokens, Switches, Params);
+
+	if (Switches.Contains(TEXT("help")) || Switches.Contains(TEXT("?")))
+	{
+		PrintUsage();
+		return 0;
+	}
+
+	const FString* JobsParam = Params.Find(TEXT("jobs"));
+	if (!JobsParam || JobsParam->IsEmpty())
+	{
+		HOUDINI_LOG_ERROR(TEXT("A job file must be specified with -jobs=."));
+		PrintUsage();
+		return 1;
+	}
+
+	FHoudiniEngineCommandletBatchArgs BatchArgs;
+	BatchArgs.JobFilePath = FPaths::ConvertRelativePathToFull(*JobsParam);
+
+	if (const FString* ReportParam = Params.Find(TEXT("report")))
+	{
+		BatchArgs.ReportFilePath = FPaths::ConvertRelativePathToFull(*ReportParam);
+	}
+	else
+	{
+		BatchArgs.ReportFilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(
+			FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), FString::Printf(TEXT("BatchReport_%s.jsonl"), *FDateTime::Now().ToString())));
+	}
+
+	if (const FString* ConcurrencyParam = Params.Find(TEXT("concurrency")))
+		BatchArgs.MaxConcurrentJobs = FCString::Atoi(**ConcurrencyParam);
+
+	if (const FString* TimeoutParam = Params.Find(TEXT("timeout")))
+		BatchArgs.JobTimeoutSeconds = FCString::Atof(**TimeoutParam);
+
+	if (!FApp::IsUnattended())
+		HOUDINI_LOG_WARNING(TEXT("Not running with -unattended: a dialog raised during the batch could block it."));
+
+	if (!GetRunBatchDelegate().IsBound())
+	{
+		HOUDINI_LOG_ERROR(TEXT("The Houdini Engine Editor module is not loaded, cannot run the batch."));
+		return 1;
+	}
+
+	if (!IsHoudiniEngineSessionRunning() && !StartHoudiniEngineSession(Switches.Contains(TEXT("sessionpool"))))
+		return 2;
+
+	HOUDINI_LOG_DISPLAY(TEXT("Running the jobs of %s, report: %s"), *BatchArgs.JobFilePath, *BatchArgs.ReportFilePath);
+
+	bBatchDone = false;
+	NumFailedJobs = 0;
+	if (!GetRunBatchDelegate().Execute(BatchArgs, FOnHoudiniEngineCommandletBatchDone::CreateUObject(this, &UHoudiniEngineCommandlet::HandleBatchDone)))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to start the batch."));
+		return 3;
+	}
+
+	const int32 Result = MainLoop();
+	if (Result != 0)
+		return Result;
+
+	HOUDINI_LOG_DISPLAY(TEXT("Batch completed, %d job(s) failed."), NumFailedJobs);
+
+	return NumFailedJobs > 0 ? 4 : 0;
+}
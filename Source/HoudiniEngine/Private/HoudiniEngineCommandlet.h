@@ -24,4 +24,76 @@
 * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+
+#include "HoudiniEngine.h"
+
+#include "HoudiniEngineCommandlet.generated.h"
+
+// Arguments of a Public API batch run by the commandlet
+struct FHoudiniEngineCommandletBatchArgs
+{
+	// The JSON job file
+	FString JobFilePath;
+
+	// The file the per-job results and timings are streamed to
+	FString ReportFilePath;
+
+	// Maximum number of jobs running at the same time, the session pool size if <= 0
+	int32 MaxConcurrentJobs = 0;
+
+	// Jobs that have not completed after this many seconds fail, disabled if <= 0
+	float JobTimeoutSeconds = 0.0f;
+};
+
+// Called with the number of failed jobs when the batch has completed
+DECLARE_DELEGATE_OneParam(FOnHoudiniEngineCommandletBatchDone, int32);
+
+// Starts the batch, returns true if it is running
+DECLARE_DELEGATE_RetVal_TwoParams(bool, FOnHoudiniEngineCommandletRunBatch, const FHoudiniEngineCommandletBatchArgs&, const FOnHoudiniEngineCommandletBatchDone&);
+
+UCLASS()
+class HOUDINIENGINE_API UHoudiniEngineCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UHoudiniEngineCommandlet();
+
+	void PrintUsage() const;
+
+	/**
+	* Entry point for your commandlet
+	*
+	* @param Params the string containing the parameters for the commandlet
+	*/
+	virtual int32 Main(const FString& Params) override;
+
+	// The batch runner. The Public API lives in the editor module, which binds this on startup.
+	static FOnHoudiniEngineCommandletRunBatch& GetRunBatchDelegate();
+
+protected:
+
+	// The pooled sessions are only started if requested (-sessionpool)
+	bool StartHoudiniEngineSession(const bool& bInStartSessionPool);
+
+	bool IsHoudiniEngineSessionRunning() { return FHoudiniEngine::Get().GetSession() != nullptr; };
+
+	// Ticks the engine until the batch has completed
+	int32 MainLoop();
+
+	void HandleBatchDone(int32 InNumFailedJobs);
+
+private:
+
+	// The batch has completed
+	bool bBatchDone;
+
+	// Number of jobs that failed in the batch
+	int32 NumFailedJobs;
+};
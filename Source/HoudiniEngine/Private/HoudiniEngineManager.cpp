@@ -31,6 +31,9 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniCookCache.h"
+#include "HoudiniInput.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniParameterTranslator.h"
@@ -113,6 +116,9 @@ FHoudiniEngineManager::StopHoudiniTicking()
 			// Reset time for delayed notification.
 			FHoudiniEngine::Get().SetHapiNotificationStartedTime(0.0);
 
+			// Stop draining PDG events from the session
+			PDGManager.StopPDGEventPump();
+
 			bMustStopTicking = false;
 		}
 		else
@@ -303,7 +309,11 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 			AutoStartFirstSessionIfNeeded(CurrentComponent);
 
 			EHoudiniAssetState PrevState = CurrentComponent->GetAssetState();
-			ProcessComponent(CurrentComponent);
+			{
+				// All HAPI calls made for this component must target the session its nodes live in
+				FHoudiniEngineScopedSession SessionScope(CurrentComponent->GetSessionIndex());
+				ProcessComponent(CurrentComponent);
+			}
 			EHoudiniAssetState NewState = CurrentComponent->GetAssetState();
 
 			// In order to process components faster / with less ticks,
@@ -355,13 +365,16 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		for (int32 DeleteIdx = PendingDeleteCount - 1; DeleteIdx >= 0; DeleteIdx--)
 		{
 			HAPI_NodeId NodeIdToDelete = (HAPI_NodeId)FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteAt(DeleteIdx);
+			const int32 SessionIndex = FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteSessionIndexAt(DeleteIdx);
+			FHoudiniEngineScopedSession SessionScope(SessionIndex);
+
 			FGuid HapiDeletionGUID;
-			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete);
+			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete, SessionIndex);
 			if (StartTaskAssetDelete(NodeIdToDelete, HapiDeletionGUID, bShouldDeleteParent))
 			{
 				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
 				if (bShouldDeleteParent)
-					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete);
+					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete, SessionIndex);
 			}
 		}
 	}
@@ -485,12 +498,25 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		return;
 	}
 
+	// HDAs that started sharing nodes with the main session (new inputs, PDG, downstream HDAs...)
+	// need to be rebuilt in it.
+	if (HAC->GetSessionIndex() > 0
+		&& (AssetStateToProcess == EHoudiniAssetState::None || AssetStateToProcess == EHoudiniAssetState::PreCook)
+		&& MustUseMainSession(HAC))
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("%s: moving from pooled session %d to the main session."), *HAC->GetDisplayName(), HAC->GetSessionIndex());
+		HAC->SetAssetState(EHoudiniAssetState::NeedRebuild);
+		return;
+	}
+
 	switch (AssetStateToProcess)
 	{
 		case EHoudiniAssetState::NeedInstantiation:
 		{
 			// Do nothing unless the HAC has been updated
-			if (HAC->NeedUpdate())
+			// and its saved outputs don't already match its parameters and inputs
+			if (HAC->NeedUpdate() && !FHoudiniCookCache::TrySkipCook(HAC))
 			{
 				HAC->OnPrePreInstantiation();
 				HAC->bForceNeedUpdate = false;
@@ -563,6 +589,12 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			}
 			else
 			{
+				// Pick the session the asset will be instantiated in
+				if (HAC->GetSessionIndex() < 0)
+					HAC->SetSessionIndex(AssignSessionIndex(HAC));
+
+				FHoudiniEngineScopedSession SessionScope(HAC->GetSessionIndex());
+
 				FGuid TaskGuid;
 				FString HapiAssetName;
 				UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
@@ -614,6 +646,8 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			HAC->OnPrePreCook();
 			// Update all the HAPI nodes, parameters, inputs etc...
 			PreCook(HAC);
+			// Key the outputs of this cook with the parameters and inputs that have been uploaded
+			FHoudiniCookCache::OnPreCook(HAC);
 			HAC->OnPostPreCook();
 
 			// Create a Cooking task only if necessary
@@ -697,6 +731,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			{
 				// Cook failed, skip output processing
 				NewState = EHoudiniAssetState::None;
+				FHoudiniCookCache::OnPostProcess(HAC, false);
 			}
 			HAC->SetAssetState(NewState);
 			break;
@@ -711,6 +746,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		case EHoudiniAssetState::Processing:
 		{
 			UpdateProcess(HAC);
+			FHoudiniCookCache::OnPostProcess(HAC, true);
 
 			// This is too late to update the cook count, things might have changed since we asked for a cook
 			//int32 CookCount = FHoudiniEngineUtils::HapiGetCookCount(HAC->GetAssetId());
@@ -775,6 +811,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			{
 				// Do not delete nodes for NodeSync components!
 				StartTaskAssetRebuild(HAC->AssetId, HAC->HapiGUID);
+
+				// The node has been deleted from its session, the new one can be created in any session
+				HAC->SetSessionIndex(-1);
 			}
 			HAC->MarkAsNeedCook();
 			HAC->SetAssetState(EHoudiniAssetState::PreInstantiation);
@@ -1356,6 +1395,80 @@ FHoudiniEngineManager::UpdateProcess(UHoudiniAssetComponent* HAC)
 	return true;
 }
 
+bool
+FHoudiniEngineManager::MustUseMainSession(UHoudiniAssetComponent* HAC)
+{
+	if (FHoudiniEngine::Get().GetSessionPoolSize() <= 1)
+		return true;
+
+	if (FHoudiniEngine::Get().IsSessionSyncEnabled())
+		return true;
+
+	if (!IsValid(HAC))
+		return true;
+
+	// Node sync and blueprint components interact with nodes/templates outside of the manager's tick
+	if (HAC->IsA<UHoudiniNodeSyncComponent>() || HAC->IsA<UHoudiniAssetBlueprintComponent>())
+		return true;
+
+	// PDG contexts are only updated on the main session
+	if (HAC->GetPDGAssetLink())
+		return true;
+
+	// Asset inputs connect our node to the downstream HDAs' nodes
+	if (HAC->HasDownstreamHoudiniAssets())
+		return true;
+
+	// Input nodes are shared (via the Unreal Object Input Manager) and deleted from the main session
+	for (UHoudiniInput* CurrentInput : HAC->GetInputs())
+	{
+		if (IsValid(CurrentInput) && CurrentInput->GetNumberOfInputObjects() > 0)
+			return true;
+	}
+
+	return false;
+}
+
+int32
+FHoudiniEngineManager::AssignSessionIndex(UHoudiniAssetComponent* HAC)
+{
+	if (MustUseMainSession(HAC))
+		return 0;
+
+	const int32 PoolSize = FHoudiniEngine::Get().GetSessionPoolSize();
+
+	// Count the HACs currently using each session
+	TArray<int32> SessionLoads;
+	SessionLoads.SetNumZeroed(PoolSize);
+	if (FHoudiniEngineRuntime::IsInitialized())
+	{
+		const int32 NumComponents = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+		for (int32 CompIdx = 0; CompIdx < NumComponents; CompIdx++)
+		{
+			UHoudiniAssetComponent* CurrentHAC = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CompIdx);
+			if (!IsValid(CurrentHAC) || CurrentHAC == HAC)
+				continue;
+
+			const int32 CurrentSessionIndex = CurrentHAC->GetSessionIndex();
+			if (SessionLoads.IsValidIndex(CurrentSessionIndex))
+				SessionLoads[CurrentSessionIndex]++;
+		}
+	}
+
+	// Pick the least loaded session that is still valid
+	int32 BestSessionIndex = 0;
+	for (int32 SessionIdx = 1; SessionIdx < PoolSize; SessionIdx++)
+	{
+		if (!FHoudiniEngine::Get().GetSessionAt(SessionIdx))
+			continue;
+
+		if (SessionLoads[SessionIdx] < SessionLoads[BestSessionIndex])
+			BestSessionIndex = SessionIdx;
+	}
+
+	return BestSessionIndex;
+}
+
 bool
 FHoudiniEngineManager::StartTaskAssetRebuild(const HAPI_NodeId& InAssetId, FGuid& OutTaskGUID)
 {
@@ -83,6 +83,12 @@ public:
 	}
 
 	EHoudiniBGEOCommandletStatus GetPDGCommandletStatus() { return PDGManager.UpdateAndGetBGEOCommandletStatus(); }
+
+	const FHoudiniPDGImportStats& GetPDGImportStats() const { return PDGManager.GetImportStats(); }
+
+	// Stops and joins the PDG event pump thread, must be done before the main session is cleaned up or closed.
+	// Can be called from any thread.
+	void StopPDGEventPump() { PDGManager.StopPDGEventPump(); }
 	
 	
 protected:
@@ -170,6 +176,14 @@ protected:
 	// Automatically try to start the First HE session if needed
 	void AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC);
 
+	// Returns true if the HAC's nodes must live in the main session:
+	// its inputs, PDG asset link or downstream HDAs share nodes that are only created there.
+	bool MustUseMainSession(UHoudiniAssetComponent* HAC);
+
+	// Picks the session a HAC without any instantiated node will be instantiated in.
+	// Returns the least loaded session of the pool, or the main session if the HAC must use it.
+	int32 AssignSessionIndex(UHoudiniAssetComponent* HAC);
+
 private:
 
 	// Ticker handle, used for processing HAC.
@@ -29,6 +29,15 @@
 FHoudiniEngineOutputStats::FHoudiniEngineOutputStats()
 	: NumPackagesCreated(0)
 	, NumPackagesUpdated(0)
+	, LandscapeDataPeakBytes(0)
+	, NumLandscapeTilesStreamed(0)
+	, NumInstancesAdded(0)
+	, NumInstancesRemoved(0)
+	, NumInstancesUpdated(0)
+	, NumInstancesCustomDataUpdated(0)
+	, NumHapiCalls(0)
+	, NumHapiCallsSaved(0)
+	, NumHarvestedGeosReused(0)
 { }
 
 void FHoudiniEngineOutputStats::NotifyPackageCreated(int32 NumCreated)
@@ -41,6 +50,35 @@ void FHoudiniEngineOutputStats::NotifyPackageUpdated(int32 NumUpdated)
 	NumPackagesUpdated += NumUpdated;
 }
 
+void FHoudiniEngineOutputStats::NotifyLandscapeDataPeakBytes(int64 PeakBytes)
+{
+	LandscapeDataPeakBytes = FMath::Max(LandscapeDataPeakBytes, PeakBytes);
+}
+
+void FHoudiniEngineOutputStats::NotifyLandscapeTilesStreamed(int32 NumTiles)
+{
+	NumLandscapeTilesStreamed += NumTiles;
+}
+
+void FHoudiniEngineOutputStats::NotifyInstancesDelta(int32 NumAdded, int32 NumRemoved, int32 NumUpdated)
+{
+	NumInstancesAdded += NumAdded;
+	NumInstancesRemoved += NumRemoved;
+	NumInstancesUpdated += NumUpdated;
+}
+
+void FHoudiniEngineOutputStats::NotifyInstancesCustomDataUpdated(int32 NumUpdated)
+{
+	NumInstancesCustomDataUpdated += NumUpdated;
+}
+
+void FHoudiniEngineOutputStats::NotifyHapiCalls(int32 NumCalls, int32 NumCallsSaved, int32 NumGeosReused)
+{
+	NumHapiCalls += NumCalls;
+	NumHapiCallsSaved += NumCallsSaved;
+	NumHarvestedGeosReused += NumGeosReused;
+}
+
 void FHoudiniEngineOutputStats::NotifyObjectsCreated(const FString& ObjectTypeName, int32 NumCreated)
 {
 	const int32 Count = OutputObjectsCreated.FindOrAdd(ObjectTypeName, 0);
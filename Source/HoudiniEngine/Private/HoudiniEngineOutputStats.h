@@ -42,9 +42,39 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	TMap<FString, int32> OutputObjectsUpdated;
 	TMap<FString, int32> OutputObjectsReplaced;
 
+	// High-water mark of the height field data held in memory while translating landscape outputs
+	int64 LandscapeDataPeakBytes;
+	// Number of height field bands read and written when streaming landscape outputs
+	int32 NumLandscapeTilesStreamed;
+
+	// Instances added, removed and moved/updated when updating instanced static mesh components
+	int32 NumInstancesAdded;
+	int32 NumInstancesRemoved;
+	int32 NumInstancesUpdated;
+	// Instances whose per-instance custom data changed
+	int32 NumInstancesCustomDataUpdated;
+
+	// HAPI calls issued when harvesting the outputs' part infos and attribute names,
+	// and the calls that were answered from the harvested infos instead
+	int32 NumHapiCalls;
+	int32 NumHapiCallsSaved;
+	// Geos whose harvested infos were reused from a previous cook
+	int32 NumHarvestedGeosReused;
+
 	void NotifyPackageCreated(int32 NumCreated);
 	void NotifyPackageUpdated(int32 NumUpdated);
 
+	// Landscape data
+	void NotifyLandscapeDataPeakBytes(int64 PeakBytes);
+	void NotifyLandscapeTilesStreamed(int32 NumTiles);
+
+	// Instance updates
+	void NotifyInstancesDelta(int32 NumAdded, int32 NumRemoved, int32 NumUpdated);
+	void NotifyInstancesCustomDataUpdated(int32 NumUpdated);
+
+	// HAPI calls
+	void NotifyHapiCalls(int32 NumCalls, int32 NumCallsSaved, int32 NumGeosReused);
+
 	// Objects created
 	void NotifyObjectsCreated(const FString& ObjectTypeName, int32 NumCreated);
 	template<typename EnumT>
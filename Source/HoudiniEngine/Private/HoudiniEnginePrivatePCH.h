@@ -207,6 +207,7 @@
 #define HAPI_UNREAL_ATTRIB_INSTANCE_NUM_CUSTOM_FLOATS		"unreal_num_custom_floats"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_CUSTOM_DATA_PREFIX		"unreal_per_instance_custom_data"
 #define HAPI_UNREAL_ATTRIB_FORCE_INSTANCER					"unreal_force_instancer"
+#define HAPI_UNREAL_ATTRIB_INSTANCE_ID						"id"
 
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME				 HAPI_ATTRIB_NAME
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_VERTEX_INDEX		    "unreal_vertex_index"
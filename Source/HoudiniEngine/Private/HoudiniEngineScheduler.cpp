@@ -26,45 +26,45 @@
 
 #include "HoudiniEngineScheduler.h"
 
+#include "HoudiniAssetLibraryCache.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
 
-const float
-FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
+static TAutoConsoleVariable<float> CVarHoudiniEngineSchedulerCookPollInterval(
+	TEXT("HoudiniEngine.SchedulerCookPollInterval"),
+	0.02f,
+	TEXT("Time in seconds between two cook status checks while the scheduler is instantiating or cooking an asset.\n")
+	TEXT("0.02: Default\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineSchedulerPollFallback(
+	TEXT("HoudiniEngine.SchedulerPollFallback"),
+	0.0f,
+	TEXT("When idle, the scheduler thread is woken up as soon as a task is added.\n")
+	TEXT("<= 0.0: Only wake up when a task is added (Default)\n")
+	TEXT("> 0.0: Also wake up after this many seconds, even if no task was added\n")
+);
 
 FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-	: Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
+	: TaskEvent(nullptr)
 	, bStopping(false)
+	, IdleSessionIndex(-1)
 {
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
-
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
+	// Auto-reset event, a single Wait() consumes a Trigger().
+	TaskEvent = FPlatformProcess::GetSynchEventFromPool(false);
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
+	if (TaskEvent)
 	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
+		FPlatformProcess::ReturnSynchEventToPool(TaskEvent);
+		TaskEvent = nullptr;
 	}
 }
 
@@ -98,8 +98,8 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	FHoudiniEngineString(Task.AssetHapiName).ToFString(AssetN);
 
 	HOUDINI_LOG_MESSAGE(
-		TEXT("HAPI Asynchronous Instantiation Started for %s: Asset=%s, HoudiniAsset = 0x%x"),
-		*Task.ActorName, *AssetN, Task.Asset.Get());
+		TEXT("HAPI Asynchronous Instantiation Started for %s: Asset=%s, HoudiniAsset = 0x%x, Scheduler latency = %.3fs"),
+		*Task.ActorName, *AssetN, Task.Asset.Get(), Task.GetSchedulerLatency());
 
 	if (!FHoudiniEngineUtils::IsInitialized())
 	{
@@ -162,6 +162,19 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	// Translate asset name into Unreal string.
 	FString AssetName = ANSI_TO_TCHAR(AssetNameString.c_str());
 
+	// Use a node that has been instantiated and cooked ahead of time if the asset has one
+	const HAPI_NodeId PooledAssetId = FHoudiniAssetLibraryCache::ClaimPooledNode(Task.AssetLibraryId, AssetName);
+	if (PooledAssetId >= 0)
+	{
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS,
+			EHoudiniEngineTaskType::AssetInstantiation,
+			EHoudiniEngineTaskState::Success, PooledAssetId, Task,
+			TEXT("Finished Instantiation (pooled node)."));
+
+		return;
+	}
+
 	// Initialize last update time.
 	LastUpdateTime = FPlatformTime::Seconds();
 
@@ -184,6 +197,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		HAPI_RESULT_SUCCESS, -1, 
 		EHoudiniEngineTaskType::AssetInstantiation,
 		EHoudiniEngineTaskState::Working);
+	TaskInfo.SchedulerLatency = Task.GetSchedulerLatency();
 
 	//TaskInfo.bLoadedComponent = Task.bLoadedComponent;
 	TaskDescription(TaskInfo, Task.ActorName, TEXT("Started Instantiation"));
@@ -243,7 +257,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		}
 
 		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		WaitForCookStatus();
 	}
 }
 
@@ -271,8 +285,8 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 
 	HOUDINI_LOG_MESSAGE(
-		TEXT("HAPI Asynchronous Cooking Started for %s., AssetId = %d"),
-		*Task.ActorName, AssetId);
+		TEXT("HAPI Asynchronous Cooking Started for %s., AssetId = %d, Scheduler latency = %.3fs"),
+		*Task.ActorName, AssetId, Task.GetSchedulerLatency());
 
 	if (AssetId == -1)
 	{
@@ -369,7 +383,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 			}
 
 			// We want to yield.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			WaitForCookStatus();
 		}
 	}	
 
@@ -440,6 +454,7 @@ FHoudiniEngineScheduler::AddResponseTaskInfo(
 	HAPI_NodeId AssetId, const FHoudiniEngineTask & Task)
 {
 	FHoudiniEngineTaskInfo TaskInfo(Result, AssetId, TaskType, TaskState);
+	TaskInfo.SchedulerLatency = Task.GetSchedulerLatency();
 	FString StatusString = FHoudiniEngineUtils::GetErrorDescription();
 
 	//TaskInfo.bLoadedComponent = Task.bLoadedComponent;
@@ -454,6 +469,7 @@ FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
 	HAPI_NodeId AssetId, const FHoudiniEngineTask & Task, const FString & ErrorMessage)
 {
 	FHoudiniEngineTaskInfo TaskInfo(Result, AssetId, TaskType, TaskState);
+	TaskInfo.SchedulerLatency = Task.GetSchedulerLatency();
 
 	//TaskInfo.bLoadedComponent = Task.bLoadedComponent;
 
@@ -466,26 +482,16 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 {
 	while (!bStopping)
 	{
-		while (true)
+		FHoudiniEngineTask Task;
+		while (!bStopping && Tasks.Dequeue(Task))
 		{
-			FHoudiniEngineTask Task;
-
-			{
-				FScopeLock ScopeLock(&CriticalSection);
-
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
-
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
+			PendingTaskCount.Decrement();
 
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
-			}
+			// Keep track of when the task was actually started
+			Task.StartTime = FPlatformTime::Seconds();
 
-			bool bTaskProcessed = true;
+			// HAPI calls made by the task must target the task's session
+			FHoudiniEngineScopedSession SessionScope(Task.SessionIndex);
 
 			switch (Task.TaskType)
 			{
@@ -515,19 +521,26 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 
 				default:
 				{
-					bTaskProcessed = false;
+					HOUDINI_LOG_WARNING(TEXT("Houdini Engine Scheduler: ignoring task with an invalid type."));
 					break;
 				}
 			}
 
-			if (!bTaskProcessed)
-				break;
+			IdleSessionIndex = Task.SessionIndex;
+		}
+
+		// Use the idle time to instantiate nodes for the frequently instantiated assets, one at a time
+		if (!bStopping && IdleSessionIndex >= 0 && Tasks.IsEmpty() && FPlatformProcess::SupportsMultithreading())
+		{
+			FHoudiniEngineScopedSession SessionScope(IdleSessionIndex);
+			if (FHoudiniAssetLibraryCache::RefillPool(IdleSessionIndex))
+				continue;
 		}
 
 		if (FPlatformProcess::SupportsMultithreading())
 		{
-			// We want to yield for a bit.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			// Sleep until a new task is added.
+			WaitForTasks();
 		}
 		else
 		{
@@ -537,6 +550,29 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 	}
 }
 
+void
+FHoudiniEngineScheduler::WaitForTasks()
+{
+	if (!TaskEvent)
+	{
+		FPlatformProcess::SleepNoStats(0.1f);
+		return;
+	}
+
+	const float PollFallback = CVarHoudiniEngineSchedulerPollFallback.GetValueOnAnyThread();
+	if (PollFallback > 0.0f)
+		TaskEvent->Wait(FMath::Max(1u, static_cast<uint32>(PollFallback * 1000.0f)));
+	else
+		TaskEvent->Wait();
+}
+
+void
+FHoudiniEngineScheduler::WaitForCookStatus()
+{
+	const float PollInterval = CVarHoudiniEngineSchedulerCookPollInterval.GetValueOnAnyThread();
+	FPlatformProcess::SleepNoStats(FMath::Max(PollInterval, 0.001f));
+}
+
 void
 FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 {
@@ -591,64 +627,21 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 
 bool FHoudiniEngineScheduler::HasPendingTasks()
 {
-	FScopeLock ScopeLock(&CriticalSection);
-	return (PositionWrite != PositionRead);
+	return PendingTaskCount.GetValue() > 0;
 }
 
 void
 FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 {
-	FScopeLock ScopeLock(&CriticalSection);
+	FHoudiniEngineTask QueuedTask = Task;
+	QueuedTask.EnqueueTime = FPlatformTime::Seconds();
 
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
-	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
-
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (!Buffer)
-			return;
+	PendingTaskCount.Increment();
+	Tasks.Enqueue(MoveTemp(QueuedTask));
 
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
-
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
-		}
-		else
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
-		}
-
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
-
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
-	}
-
-	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
-
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
+	// Wake up the scheduler thread.
+	if (TaskEvent)
+		TaskEvent->Trigger();
 }
 
 uint32
@@ -662,6 +655,10 @@ void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+
+	// Wake up the scheduler thread so it can exit.
+	if (TaskEvent)
+		TaskEvent->Trigger();
 }
 
 void
@@ -28,10 +28,15 @@
 
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "Containers/Queue.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Misc/SingleThreadRunnable.h"
 
+class FEvent;
+
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
 public:
@@ -49,7 +54,8 @@ public:
 
 	bool HasPendingTasks();
 
-	// Adds a task.
+	// Adds a task and wakes up the scheduler thread.
+	// Can be called from any thread.
 	void AddTask(const FHoudiniEngineTask & Task);
 
 	// Adds instantiation response task info.
@@ -93,27 +99,25 @@ protected:
 
 private:
 
-	// Initial number of tasks in our circular queue. 
-	static const uint32 InitialTaskSize;
-
-	// Frequency update (sleep time between each update)
-	static const float UpdateFrequency;
+	// Wait for new tasks, or for the poll fallback interval if one is set.
+	void WaitForTasks();
 
-	// Synchronization primitive. 
-	FCriticalSection CriticalSection;
+	// Sleep between two cook status checks while a task is cooking.
+	static void WaitForCookStatus();
 
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
+	// Lock-free multi-producer / single-consumer queue of scheduled tasks.
+	// Producers are the threads calling AddTask(), the consumer is the scheduler thread.
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> Tasks;
 
-	// Head of the circular queue. 
-	uint32 PositionWrite;
+	// Number of tasks that are queued but not yet dequeued.
+	FThreadSafeCounter PendingTaskCount;
 
-	// Tail of the circular queue. 
-	uint32 PositionRead;
-
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// Event used to wake up the scheduler thread when a task is added or when stopping.
+	FEvent* TaskEvent;
 
 	// Stopping flag. 
-	bool bStopping;
+	FThreadSafeBool bStopping;
+
+	// Session of the last processed task, used to refill the instantiation pools when idle.
+	int32 IdleSessionIndex;
 };
@@ -130,6 +130,16 @@ bool
 FHoudiniEngineString::ToFString(FString& String) const
 {
 	String = TEXT("");
+
+	if (StringId > 0)
+	{
+		if (const FString* CachedString = FHoudiniEngineScopedStringCache::Find(StringId))
+		{
+			String = *CachedString;
+			return true;
+		}
+	}
+
 	std::string NamePlain = "";
 
 	if (ToStdString(NamePlain))
@@ -281,6 +291,61 @@ FHoudiniEngineString::SHArrayToFStringArray_Singles(const TArray<int32>& InStrin
 	return bReturn;
 }
 
+namespace
+{
+	// Innermost scope the string conversions are served from
+	FHoudiniEngineScopedStringCache* ActiveStringCache = nullptr;
+}
+
+FHoudiniEngineScopedStringCache::FHoudiniEngineScopedStringCache(const TArray<int32>& InStringIdArray)
+	: ActiveScope(ActiveStringCache)
+{
+	// The scopes are only used by the game thread
+	if (!IsInGameThread())
+		return;
+
+	// Null / invalid handles are never resolved
+	TSet<int32> UniqueSH;
+	UniqueSH.Reserve(InStringIdArray.Num());
+	for (const int32& CurrentSH : InStringIdArray)
+	{
+		if (CurrentSH > 0 && !Find(CurrentSH))
+			UniqueSH.Add(CurrentSH);
+	}
+
+	if (UniqueSH.Num() > 0)
+	{
+		TArray<int32> UniqueSHArray = UniqueSH.Array();
+		TArray<FString> StringValues;
+		if (FHoudiniEngineString::SHArrayToFStringArray_Batch(UniqueSHArray, StringValues))
+		{
+			Strings.Reserve(UniqueSHArray.Num());
+			for (int32 Idx = 0; Idx < UniqueSHArray.Num(); Idx++)
+				Strings.Add(UniqueSHArray[Idx], StringValues[Idx]);
+		}
+	}
+
+	ActiveScope.Activate(this);
+}
+
+FHoudiniEngineScopedStringCache::~FHoudiniEngineScopedStringCache()
+{
+	ActiveScope.Deactivate();
+}
+
+const FString*
+FHoudiniEngineScopedStringCache::Find(const int32& InStringId)
+{
+	const FHoudiniEngineScopedStringCache* Scope = THoudiniScopedActiveInstance<FHoudiniEngineScopedStringCache>::GetActive(ActiveStringCache);
+	for (; Scope; Scope = Scope->ActiveScope.GetPrevious())
+	{
+		if (const FString* FoundString = Scope->Strings.Find(InStringId))
+			return FoundString;
+	}
+
+	return nullptr;
+}
+
 const FString& FHoudiniEngineIndexedStringMap::GetStringForIndex(int Index) const
 {
     StringId Id = Ids[Index];
@@ -28,6 +28,7 @@
 
 #include <string>
 #include "HoudiniApi.h"
+#include "HoudiniScopedActiveInstance.h"
 #include "Containers/Map.h"
 class FText;
 class FString;
@@ -79,6 +80,32 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		int32 StringId;
 };
 
+// Resolves a set of string handles with a single string batch, and serves them to the
+// FHoudiniEngineString conversions made on the game thread while the scope is alive.
+// Scopes can be nested, handles that are not in the inner scope are looked up in the outer ones.
+class HOUDINIENGINE_API FHoudiniEngineScopedStringCache
+{
+	public:
+
+		FHoudiniEngineScopedStringCache(const TArray<int32>& InStringIdArray);
+		~FHoudiniEngineScopedStringCache();
+
+		FHoudiniEngineScopedStringCache(const FHoudiniEngineScopedStringCache&) = delete;
+		FHoudiniEngineScopedStringCache& operator=(const FHoudiniEngineScopedStringCache&) = delete;
+
+		// Returns the cached value of a string handle, or null if it isn't in any active scope.
+		static const FString* Find(const int32& InStringId);
+
+		int32 Num() const { return Strings.Num(); }
+
+	protected:
+
+		TMap<int32, FString> Strings;
+
+		// Makes this the active scope while it is alive, the previous scope is the outer one.
+		THoudiniScopedActiveInstance<FHoudiniEngineScopedStringCache> ActiveScope;
+};
+
 class FHoudiniEngineRawStrings
 {
 public:
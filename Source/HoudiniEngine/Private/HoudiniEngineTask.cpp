@@ -36,6 +36,9 @@ FHoudiniEngineTask::FHoudiniEngineTask()
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(-1)
+	, EnqueueTime(0.0)
+	, StartTime(0.0)
 {
 	HapiGUID.Invalidate();
 	OtherNodeIds.Empty();
@@ -50,6 +53,18 @@ FHoudiniEngineTask::FHoudiniEngineTask(EHoudiniEngineTaskType InTaskType, FGuid
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(-1)
+	, EnqueueTime(0.0)
+	, StartTime(0.0)
 {
 	OtherNodeIds.Empty();
 }
+
+double
+FHoudiniEngineTask::GetSchedulerLatency() const
+{
+	if (EnqueueTime <= 0.0 || StartTime < EnqueueTime)
+		return 0.0;
+
+	return StartTime - EnqueueTime;
+}
@@ -104,6 +104,19 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// HAPI name of the asset.
 	int32 AssetHapiName;
 
+	// Index of the session (in the session pool) this task runs on.
+	// -1 uses the session of the thread adding the task.
+	int32 SessionIndex;
+
+	// Time (FPlatformTime::Seconds) at which the task was added to the scheduler's queue.
+	double EnqueueTime;
+
+	// Time (FPlatformTime::Seconds) at which the scheduler dequeued and started the task.
+	double StartTime;
+
+	// Returns the time in seconds the task spent waiting in the scheduler's queue.
+	double GetSchedulerLatency() const;
+
 	// Is set to true if component has been loaded.
 	//bool bLoadedComponent;
 };
@@ -33,6 +33,7 @@ FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo()
 	, AssetId(-1)
 	, TaskType(EHoudiniEngineTaskType::None)
 	, TaskState(EHoudiniEngineTaskState::None)
+	, SchedulerLatency(0.0)
 {}
 
 FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo(
@@ -44,4 +45,5 @@ FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo(
 	, AssetId(InAssetId)
 	, TaskType(InTaskType)
 	, TaskState(InTaskState)
+	, SchedulerLatency(0.0)
 {}
\ No newline at end of file
@@ -73,6 +73,9 @@ struct HOUDINIENGINE_API FHoudiniEngineTaskInfo
 	// String used for status / progress bar.
 	FText StatusText;
 
+	// Time in seconds between the task being queued and the scheduler starting it.
+	double SchedulerLatency;
+
 	// Is set to true if corresponding task was issued for loaded component.
 	//bool bLoadedComponent;
 };
@@ -41,6 +41,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetActor.h"
+#include "HoudiniAssetLibraryCache.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineEditorSettings.h"
@@ -53,7 +54,9 @@
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniInput.h"
+#include "HoudiniOutputHarvest.h"
 #include "HoudiniParameter.h"
+#include "HoudiniPartAttributeStore.h"
 #include "HoudiniRuntimeSettings.h"
 
 #if WITH_EDITOR
@@ -958,7 +961,13 @@ bool FHoudiniEngineUtils::RenameObject(UObject* Object, const TCHAR* NewName /*=
 			return false;
 		}
 	}
-	return Object->Rename(NewName, NewOuter, Flags);
+	const bool bRenamed = Object->Rename(NewName, NewOuter, Flags);
+
+	// Keep the world's name index up to date
+	if (bRenamed && Object->IsA<AActor>())
+		FHoudiniWorldActorIndex::NotifyActorChanged(Cast<AActor>(Object));
+
+	return bRenamed;
 }
 
 FName
@@ -1744,6 +1753,11 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 		}
 	}
 
+	// Reuse the library already loaded for this asset in the current session if its source hasn't changed
+	const FString LibrarySourceKey = FHoudiniAssetLibraryCache::GetSourceKey(HoudiniAsset, AssetFileName, bCanLoadFromFile, bMemoryCopyFirst);
+	if (FHoudiniAssetLibraryCache::FindLibrary(HoudiniAsset, LibrarySourceKey, OutAssetLibraryId))
+		return true;
+
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
 
 	// Lambda to detect license issues
@@ -1868,6 +1882,8 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 		return false;
 	}
 
+	FHoudiniAssetLibraryCache::AddLibrary(HoudiniAsset, LibrarySourceKey, OutAssetLibraryId);
+
 	return true;
 }
 
@@ -4390,11 +4406,24 @@ FHoudiniEngineUtils::HapiSetHeightFieldData(
 	const HAPI_PartId& InPartId,
 	const TArray<float>& InFloatValues,
 	const FString& InHeightfieldName)
+{
+	return HapiSetHeightFieldData(InNodeId, InPartId, InFloatValues.GetData(), 0, InFloatValues.Num(), InHeightfieldName);
+}
+
+
+HAPI_Result
+FHoudiniEngineUtils::HapiSetHeightFieldData(
+	const HAPI_NodeId& InNodeId,
+	const HAPI_PartId& InPartId,
+	const float* InFloatValues,
+	const int32& InStart,
+	const int32& InCount,
+	const FString& InHeightfieldName)
 {
     H_SCOPED_FUNCTION_TIMER();
 
-	int32 NumValues = InFloatValues.Num();
-	if (NumValues < 1)
+	int32 NumValues = InCount;
+	if (NumValues < 1 || InStart < 0 || !InFloatValues)
 		return HAPI_RESULT_INVALID_ARGUMENT;
 
 	// Get the volume name as std::string
@@ -4402,7 +4431,7 @@ FHoudiniEngineUtils::HapiSetHeightFieldData(
 	FHoudiniEngineUtils::ConvertUnrealString(InHeightfieldName, NameStr);
 
 	// Get the Heighfield float data
-	const float* HeightData = InFloatValues.GetData();
+	const float* HeightData = InFloatValues;
 
 	int32 ChunkSize = THRIFT_MAX_CHUNKSIZE;
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
@@ -4415,7 +4444,7 @@ FHoudiniEngineUtils::HapiSetHeightFieldData(
 			
 			Result = FHoudiniApi::SetHeightFieldData(
 				FHoudiniEngine::Get().GetSession(),
-				InNodeId, InPartId, NameStr.c_str(), &HeightData[ChunkStart], ChunkStart, CurCount);
+				InNodeId, InPartId, NameStr.c_str(), &HeightData[ChunkStart], InStart + ChunkStart, CurCount);
 
 			if (Result != HAPI_RESULT_SUCCESS)
 				break;
@@ -4425,7 +4454,7 @@ FHoudiniEngineUtils::HapiSetHeightFieldData(
 	{
 		Result = FHoudiniApi::SetHeightFieldData(
 			FHoudiniEngine::Get().GetSession(),
-			InNodeId, InPartId, NameStr.c_str(), HeightData, 0, InFloatValues.Num());
+			InNodeId, InPartId, NameStr.c_str(), HeightData, InStart, NumValues);
 	}
 
 	return Result;
@@ -4437,15 +4466,27 @@ FHoudiniEngineUtils::HapiGetHeightFieldData(
 	const HAPI_NodeId& InNodeId,
 	const HAPI_PartId& InPartId,
 	TArray<float>& OutFloatValues)
+{
+	return HapiGetHeightFieldData(InNodeId, InPartId, OutFloatValues.GetData(), 0, OutFloatValues.Num());
+}
+
+
+HAPI_Result
+FHoudiniEngineUtils::HapiGetHeightFieldData(
+	const HAPI_NodeId& InNodeId,
+	const HAPI_PartId& InPartId,
+	float* OutFloatValues,
+	const int32& InStart,
+	const int32& InCount)
 {
     H_SCOPED_FUNCTION_TIMER();
 
-	int32 NumValues = OutFloatValues.Num();
-	if (NumValues < 1)
+	int32 NumValues = InCount;
+	if (NumValues < 1 || InStart < 0 || !OutFloatValues)
 		return HAPI_RESULT_INVALID_ARGUMENT;
 
 	// float data
-	float* HeightData = OutFloatValues.GetData();
+	float* HeightData = OutFloatValues;
 
 	int32 ChunkSize = THRIFT_MAX_CHUNKSIZE;
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
@@ -4458,7 +4499,7 @@ FHoudiniEngineUtils::HapiGetHeightFieldData(
 
 			Result = FHoudiniApi::GetHeightFieldData(
 				FHoudiniEngine::Get().GetSession(),
-				InNodeId, InPartId, &HeightData[ChunkStart], ChunkStart, CurCount);
+				InNodeId, InPartId, &HeightData[ChunkStart], InStart + ChunkStart, CurCount);
 
 			if (Result != HAPI_RESULT_SUCCESS)
 				break;
@@ -4468,7 +4509,7 @@ FHoudiniEngineUtils::HapiGetHeightFieldData(
 	{
 		Result = FHoudiniApi::GetHeightFieldData(
 			FHoudiniEngine::Get().GetSession(),
-			InNodeId, InPartId, HeightData, 0, NumValues);
+			InNodeId, InPartId, HeightData, InStart, NumValues);
 	}
 
 	return Result;
@@ -4830,9 +4871,17 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 
 	int32 OriginalTupleSize = InTupleSize;
 
+	// When building outputs, the harvested attribute names tell which owner holds the attribute
+	HAPI_AttributeOwner SearchOwner = InOwner;
+	if (FHoudiniOutputHarvest::FindAttributeOwner(InGeoId, InPartId, InAttribName, InOwner, SearchOwner)
+		&& SearchOwner == HAPI_ATTROWNER_INVALID)
+	{
+		return false;
+	}
+
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	if (SearchOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -4850,7 +4899,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
 			FHoudiniEngine::Get().GetSession(), 
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			SearchOwner, &AttributeInfo), false);
 	}
 
 	if (!AttributeInfo.exists)
@@ -5063,9 +5112,17 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 
 	int32 OriginalTupleSize = InTupleSize;
 
+	// When building outputs, the harvested attribute names tell which owner holds the attribute
+	HAPI_AttributeOwner SearchOwner = InOwner;
+	if (FHoudiniOutputHarvest::FindAttributeOwner(InGeoId, InPartId, InAttribName, InOwner, SearchOwner)
+		&& SearchOwner == HAPI_ATTROWNER_INVALID)
+	{
+		return false;
+	}
+
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	if (SearchOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -5083,7 +5140,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
 			FHoudiniEngine::Get().GetSession(),
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			SearchOwner, &AttributeInfo), false);
 	}
 
 	if (!AttributeInfo.exists)
@@ -5248,9 +5305,17 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 
 	int32 OriginalTupleSize = InTupleSize;
 
+	// When building outputs, the harvested attribute names tell which owner holds the attribute
+	HAPI_AttributeOwner SearchOwner = InOwner;
+	if (FHoudiniOutputHarvest::FindAttributeOwner(InGeoId, InPartId, InAttribName, InOwner, SearchOwner)
+		&& SearchOwner == HAPI_ATTROWNER_INVALID)
+	{
+		return false;
+	}
+
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	if (SearchOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -5268,7 +5333,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
 			FHoudiniEngine::Get().GetSession(),
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			SearchOwner, &AttributeInfo), false);
 	}
 
 	if (!AttributeInfo.exists)
@@ -5411,6 +5476,11 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
 	const char * AttribName, HAPI_AttributeOwner Owner)
 {
+	// When building outputs, answer from the harvested attribute names
+	HAPI_AttributeOwner HarvestedOwner = HAPI_ATTROWNER_INVALID;
+	if (FHoudiniOutputHarvest::FindAttributeOwner(GeoId, PartId, AttribName, Owner, HarvestedOwner))
+		return HarvestedOwner != HAPI_ATTROWNER_INVALID;
+
 	if (Owner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
@@ -5465,27 +5535,30 @@ FHoudiniEngineUtils::IsAttributeInstancer(const HAPI_NodeId& GeoId, const HAPI_P
 
 bool FHoudiniEngineUtils::IsValidDataTable(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId)
 {
-	HAPI_PartInfo PartInfo;
-	HAPI_Result Error = FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(),
-		GeoId, PartId, &PartInfo);
-	if (Error != HAPI_RESULT_SUCCESS)
-	{
-		return false;
-	}
-	TArray<HAPI_StringHandle> AttribNameHandles;
-	AttribNameHandles.SetNum(PartInfo.attributeCounts[HAPI_ATTROWNER_POINT]);
-	Error = FHoudiniApi::GetAttributeNames(FHoudiniEngine::Get().GetSession(),
-		GeoId,
-		PartId,
-		HAPI_ATTROWNER_POINT,
-		AttribNameHandles.GetData(),
-		PartInfo.attributeCounts[HAPI_ATTROWNER_POINT]);
-	if (Error != HAPI_RESULT_SUCCESS)
+	TArray<FString> AttribNames;
+	if (!FHoudiniOutputHarvest::GetAttributeNames(GeoId, PartId, HAPI_ATTROWNER_POINT, AttribNames))
 	{
-		return false;
+		HAPI_PartInfo PartInfo;
+		HAPI_Result Error = FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(),
+			GeoId, PartId, &PartInfo);
+		if (Error != HAPI_RESULT_SUCCESS)
+		{
+			return false;
+		}
+		TArray<HAPI_StringHandle> AttribNameHandles;
+		AttribNameHandles.SetNum(PartInfo.attributeCounts[HAPI_ATTROWNER_POINT]);
+		Error = FHoudiniApi::GetAttributeNames(FHoudiniEngine::Get().GetSession(),
+			GeoId,
+			PartId,
+			HAPI_ATTROWNER_POINT,
+			AttribNameHandles.GetData(),
+			PartInfo.attributeCounts[HAPI_ATTROWNER_POINT]);
+		if (Error != HAPI_RESULT_SUCCESS)
+		{
+			return false;
+		}
+		FHoudiniEngineString::SHArrayToFStringArray(AttribNameHandles, AttribNames);
 	}
-	TArray<FString> AttribNames;
-	FHoudiniEngineString::SHArrayToFStringArray(AttribNameHandles, AttribNames);
 	for (const FString & Name : AttribNames)
 	{
 		if (Name.StartsWith(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX) && Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWNAME && Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWSTRUCT)
@@ -6610,25 +6683,31 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 	const int32& InAttribIndex)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::GetGenericAttributeList);
-	
-	// Get the part info to get the attribute counts for the specified owner
-	HAPI_PartInfo PartInfo;
-	FHoudiniApi::PartInfo_Init(&PartInfo);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
-		FHoudiniEngine::Get().GetSession(), InGeoNodeId, InPartId, &PartInfo), false);
-	
-	int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
 
-	// Get all attribute names for that part
-	TArray<HAPI_StringHandle> AttribNameSHArray;
-	AttribNameSHArray.SetNum(nAttribCount);
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
-		FHoudiniEngine::Get().GetSession(),
-		InGeoNodeId, InPartId, AttributeOwner,
-		AttribNameSHArray.GetData(), nAttribCount))
+	// Get all attribute names for that part, from the harvested names when building outputs
+	TArray<FString> AttribNames;
+	if (!FHoudiniOutputHarvest::GetAttributeNames(InGeoNodeId, InPartId, AttributeOwner, AttribNames))
 	{
-		return 0;
-	}	
+		// Get the part info to get the attribute counts for the specified owner
+		HAPI_PartInfo PartInfo;
+		FHoudiniApi::PartInfo_Init(&PartInfo);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
+			FHoudiniEngine::Get().GetSession(), InGeoNodeId, InPartId, &PartInfo), false);
+
+		int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
+
+		TArray<HAPI_StringHandle> AttribNameSHArray;
+		AttribNameSHArray.SetNum(nAttribCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoNodeId, InPartId, AttributeOwner,
+			AttribNameSHArray.GetData(), nAttribCount))
+		{
+			return 0;
+		}
+
+		FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNames);
+	}
 
 	// For everything but detail attribute,
 	// if an attribute index was specified, only extract the attribute value for that specific index
@@ -6643,216 +6722,232 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 	}
 
 	int32 FoundCount = 0;
-	for (int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx)
+	for (const FString& AttribName : AttribNames)
 	{
-		int32 AttribNameSH = (int32)AttribNameSHArray[Idx];
-		FString AttribName = TEXT("");
-		FHoudiniEngineString::ToFString(AttribNameSH, AttribName);
 		if (!AttribName.StartsWith(InGenericAttributePrefix, ESearchCase::IgnoreCase))
 			continue;
 
-		// Get the Attribute Info
-		HAPI_AttributeInfo AttribInfo;
-		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoNodeId, InPartId,
-			TCHAR_TO_UTF8(*AttribName), AttributeOwner, &AttribInfo))
+		FHoudiniGenericAttribute CurrentGenericAttribute;
+		if (!FHoudiniEngineUtils::HapiGetGenericAttribute(
+			InGeoNodeId, InPartId, AttribName, AttributeOwner, HandleSplit ? AttribIndex : -1, CurrentGenericAttribute))
 		{
-			// failed to get that attribute's info
 			continue;
 		}
 
-		int32 AttribStart = 0;
-		int32 AttribCount = AttribInfo.count;
-		if (HandleSplit)
-		{
-			// For split primitives, we need to only get only one value for the proper split prim
-			// Make sure that the split index is valid
-			if (AttribIndex >= 0 && AttribIndex < AttribInfo.count)
-			{
-				AttribStart = AttribIndex;
-				AttribCount = 1;
-			}
-		}
-		
-		//
-		FHoudiniGenericAttribute CurrentGenericAttribute;
 		// Remove the generic attribute prefix
 		CurrentGenericAttribute.AttributeName = AttribName.Right(AttribName.Len() - InGenericAttributePrefix.Len());
 
-		CurrentGenericAttribute.AttributeOwner = (EAttribOwner)AttribInfo.owner;
+		// We can add the UPropertyAttribute to the array
+		OutFoundAttributes.Add(CurrentGenericAttribute);
+		FoundCount++;
+	}
 
-		// Get the attribute type and tuple size
-		CurrentGenericAttribute.AttributeType = (EAttribStorageType)AttribInfo.storage;
-		CurrentGenericAttribute.AttributeCount = AttribInfo.count;
-		CurrentGenericAttribute.AttributeTupleSize = AttribInfo.tupleSize;
+	return FoundCount;
+}
 
-		if (CurrentGenericAttribute.AttributeType == EAttribStorageType::FLOAT64)
-		{
-			// Initialize the value array
-			CurrentGenericAttribute.DoubleValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
 
-			// Get the value(s)
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeFloat64Data(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoNodeId, InPartId,
-				TCHAR_TO_UTF8(*AttribName), &AttribInfo, 0,
-				CurrentGenericAttribute.DoubleValues.GetData(),
-				AttribStart, AttribCount))
-			{
-				// failed to get that attribute's data
-				continue;
-			}
-		}
-		else if (CurrentGenericAttribute.AttributeType == EAttribStorageType::FLOAT)
+bool
+FHoudiniEngineUtils::HapiGetGenericAttribute(
+	const HAPI_NodeId& InGeoNodeId,
+	const HAPI_PartId& InPartId,
+	const FString& InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	const int32& InAttribIndex,
+	FHoudiniGenericAttribute& OutAttribute)
+{
+	// Get the Attribute Info
+	HAPI_AttributeInfo AttribInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttribInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+		FHoudiniEngine::Get().GetSession(),
+		InGeoNodeId, InPartId,
+		TCHAR_TO_UTF8(*InAttribName), InOwner, &AttribInfo))
+	{
+		// failed to get that attribute's info
+		return false;
+	}
+
+	int32 AttribStart = 0;
+	int32 AttribCount = AttribInfo.count;
+	if (InAttribIndex != -1)
+	{
+		// For split primitives, we need to only get only one value for the proper split prim
+		// Make sure that the split index is valid
+		if (InAttribIndex >= 0 && InAttribIndex < AttribInfo.count)
 		{
-			// Initialize the value array
-			TArray<float> FloatValues;
-			FloatValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+			AttribStart = InAttribIndex;
+			AttribCount = 1;
+		}
+	}
+	
+	OutAttribute.AttributeName = InAttribName;
 
-			// Get the value(s)
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoNodeId, InPartId,
-				TCHAR_TO_UTF8(*AttribName), &AttribInfo,
-				0, FloatValues.GetData(),
-				AttribStart, AttribCount))
-			{
-				// failed to get that attribute's data
-				continue;
-			}
+	OutAttribute.AttributeOwner = (EAttribOwner)AttribInfo.owner;
 
-			// Convert them to double
-			CurrentGenericAttribute.DoubleValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
-			for (int32 n = 0; n < FloatValues.Num(); n++)
-				CurrentGenericAttribute.DoubleValues[n] = (double)FloatValues[n];
+	// Get the attribute type and tuple size
+	OutAttribute.AttributeType = (EAttribStorageType)AttribInfo.storage;
+	OutAttribute.AttributeCount = AttribInfo.count;
+	OutAttribute.AttributeTupleSize = AttribInfo.tupleSize;
 
-		}
-		else if (CurrentGenericAttribute.AttributeType == EAttribStorageType::INT64)
+	if (OutAttribute.AttributeType == EAttribStorageType::FLOAT64)
+	{
+		// Initialize the value array
+		OutAttribute.DoubleValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+
+		// Get the value(s)
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeFloat64Data(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoNodeId, InPartId,
+			TCHAR_TO_UTF8(*InAttribName), &AttribInfo, 0,
+			OutAttribute.DoubleValues.GetData(),
+			AttribStart, AttribCount))
 		{
-#if PLATFORM_LINUX
-			// On Linux, we unfortunately cannot guarantee that int64 and HAPI_Int64
-			// are of the same type, to properly read the value, we must first check the 
-			// size, then either cast them (if sizes match) or convert the values (if sizes don't match)
-			if (sizeof(int64) != sizeof(HAPI_Int64))
-			{
-				// int64 and HAPI_Int64 are of different size, we need to cast
-				TArray<HAPI_Int64> HAPIIntValues;
-				HAPIIntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+			// failed to get that attribute's data
+			return false;
+		}
+	}
+	else if (OutAttribute.AttributeType == EAttribStorageType::FLOAT)
+	{
+		// Initialize the value array
+		TArray<float> FloatValues;
+		FloatValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
 
-				// Get the value(s)
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInt64Data(
-					FHoudiniEngine::Get().GetSession(),
-					InGeoNodeId, InPartId,
-					TCHAR_TO_UTF8(*AttribName), &AttribInfo,
-					0, HAPIIntValues.GetData(),
-					AttribStart, AttribCount))
-				{
-					// failed to get that attribute's data
-					continue;
-				}
+		// Get the value(s)
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoNodeId, InPartId,
+			TCHAR_TO_UTF8(*InAttribName), &AttribInfo,
+			0, FloatValues.GetData(),
+			AttribStart, AttribCount))
+		{
+			// failed to get that attribute's data
+			return false;
+		}
 
-				// Convert them to int64
-				CurrentGenericAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
-				for (int32 n = 0; n < HAPIIntValues.Num(); n++)
-					CurrentGenericAttribute.IntValues[n] = (int64)HAPIIntValues[n];
-			}
-			else
-			{
-				// Initialize the value array
-				CurrentGenericAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+		// Convert them to double
+		OutAttribute.DoubleValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+		for (int32 n = 0; n < FloatValues.Num(); n++)
+			OutAttribute.DoubleValues[n] = (double)FloatValues[n];
 
-				// Get the value(s) with a reinterpret_cast since sizes match
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInt64Data(
-					FHoudiniEngine::Get().GetSession(),
-					InGeoNodeId, InPartId,
-					TCHAR_TO_UTF8(*AttribName), &AttribInfo,
-					0, reinterpret_cast<HAPI_Int64*>(CurrentGenericAttribute.IntValues.GetData()),
-					AttribStart, AttribCount))
-				{
-					// failed to get that attribute's data
-					continue;
-				}
-			}
-#else
-			// Initialize the value array
-			CurrentGenericAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+	}
+	else if (OutAttribute.AttributeType == EAttribStorageType::INT64)
+	{
+#if PLATFORM_LINUX
+		// On Linux, we unfortunately cannot guarantee that int64 and HAPI_Int64
+		// are of the same type, to properly read the value, we must first check the 
+		// size, then either cast them (if sizes match) or convert the values (if sizes don't match)
+		if (sizeof(int64) != sizeof(HAPI_Int64))
+		{
+			// int64 and HAPI_Int64 are of different size, we need to cast
+			TArray<HAPI_Int64> HAPIIntValues;
+			HAPIIntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
 
 			// Get the value(s)
 			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInt64Data(
 				FHoudiniEngine::Get().GetSession(),
 				InGeoNodeId, InPartId,
-				TCHAR_TO_UTF8(*AttribName), &AttribInfo,
-				0, CurrentGenericAttribute.IntValues.GetData(),
+				TCHAR_TO_UTF8(*InAttribName), &AttribInfo,
+				0, HAPIIntValues.GetData(),
 				AttribStart, AttribCount))
 			{
 				// failed to get that attribute's data
-				continue;
+				return false;
 			}
-#endif
+
+			// Convert them to int64
+			OutAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+			for (int32 n = 0; n < HAPIIntValues.Num(); n++)
+				OutAttribute.IntValues[n] = (int64)HAPIIntValues[n];
 		}
-		else if (CurrentGenericAttribute.AttributeType == EAttribStorageType::INT)
+		else
 		{
 			// Initialize the value array
-			TArray<int32> IntValues;
-			IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+			OutAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
 
-			// Get the value(s)
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeIntData(
+			// Get the value(s) with a reinterpret_cast since sizes match
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInt64Data(
 				FHoudiniEngine::Get().GetSession(),
 				InGeoNodeId, InPartId,
-				TCHAR_TO_UTF8(*AttribName), &AttribInfo,
-				0, IntValues.GetData(),
+				TCHAR_TO_UTF8(*InAttribName), &AttribInfo,
+				0, reinterpret_cast<HAPI_Int64*>(OutAttribute.IntValues.GetData()),
 				AttribStart, AttribCount))
 			{
 				// failed to get that attribute's data
-				continue;
+				return false;
 			}
+		}
+#else
+		// Initialize the value array
+		OutAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
 
-			// Convert them to int64
-			CurrentGenericAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
-			for (int32 n = 0; n < IntValues.Num(); n++)
-				CurrentGenericAttribute.IntValues[n] = (int64)IntValues[n];
-
+		// Get the value(s)
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInt64Data(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoNodeId, InPartId,
+			TCHAR_TO_UTF8(*InAttribName), &AttribInfo,
+			0, OutAttribute.IntValues.GetData(),
+			AttribStart, AttribCount))
+		{
+			// failed to get that attribute's data
+			return false;
 		}
-		else if (CurrentGenericAttribute.AttributeType == EAttribStorageType::STRING)
+#endif
+	}
+	else if (OutAttribute.AttributeType == EAttribStorageType::INT)
+	{
+		// Initialize the value array
+		TArray<int32> IntValues;
+		IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+
+		// Get the value(s)
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeIntData(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoNodeId, InPartId,
+			TCHAR_TO_UTF8(*InAttribName), &AttribInfo,
+			0, IntValues.GetData(),
+			AttribStart, AttribCount))
 		{
-			// Initialize a string handle array
-			TArray<HAPI_StringHandle> HapiSHArray;
-			HapiSHArray.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+			// failed to get that attribute's data
+			return false;
+		}
 
-			// Get the string handle(s)
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeStringData(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoNodeId, InPartId,
-				TCHAR_TO_UTF8(*AttribName), &AttribInfo,
-				HapiSHArray.GetData(),
-				AttribStart, AttribCount))
-			{
-				// failed to get that attribute's data
-				continue;
-			}
+		// Convert them to int64
+		OutAttribute.IntValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+		for (int32 n = 0; n < IntValues.Num(); n++)
+			OutAttribute.IntValues[n] = (int64)IntValues[n];
 
-			// Convert the String Handles to FStrings
-			// using a map to minimize the number of HAPI calls
-			FHoudiniEngineString::SHArrayToFStringArray(HapiSHArray, CurrentGenericAttribute.StringValues);
-		}
-		else
+	}
+	else if (OutAttribute.AttributeType == EAttribStorageType::STRING)
+	{
+		// Initialize a string handle array
+		TArray<HAPI_StringHandle> HapiSHArray;
+		HapiSHArray.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
+
+		// Get the string handle(s)
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeStringData(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoNodeId, InPartId,
+			TCHAR_TO_UTF8(*InAttribName), &AttribInfo,
+			HapiSHArray.GetData(),
+			AttribStart, AttribCount))
 		{
-			// Unsupported type, skipping!
-			continue;
+			// failed to get that attribute's data
+			return false;
 		}
 
-		// We can add the UPropertyAttribute to the array
-		OutFoundAttributes.Add(CurrentGenericAttribute);
-		FoundCount++;
+		// Convert the String Handles to FStrings
+		// using a map to minimize the number of HAPI calls
+		FHoudiniEngineString::SHArrayToFStringArray(HapiSHArray, OutAttribute.StringValues);
+	}
+	else
+	{
+		// Unsupported type, skipping!
+		return false;
 	}
 
-	return FoundCount;
+	return true;
 }
 
-
 bool
 FHoudiniEngineUtils::GetGenericPropertiesAttributes(const HAPI_NodeId& InGeoNodeId, const HAPI_PartId& InPartId,
 	const bool InbFindDetailAttributes, const int32& InFirstValidPrimIndex, const int32& InFirstValidVertexIndex, const int32& InFirstValidPointIndex,
@@ -6891,6 +6986,35 @@ FHoudiniEngineUtils::GetGenericPropertiesAttributes(const HAPI_NodeId& InGeoNode
 	return FoundCount > 0;
 }
 
+bool
+FHoudiniEngineUtils::UpdateGenericPropertiesAttributesOnObjects(
+	const TArray<UObject*>& InObjects,
+	const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes,
+	const TArray<int32>& InAtIndices)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::UpdateGenericPropertiesAttributesOnObjects);
+
+	if (InObjects.Num() <= 0)
+		return false;
+
+	// Loop on attributes first, so each property is resolved once and written to all the objects
+	int32 NumSuccess = 0;
+	for (const auto& CurrentPropAttribute : InAllPropertyAttributes)
+	{
+		const int32 NumUpdated = FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(InObjects, CurrentPropAttribute, InAtIndices);
+		if (NumUpdated <= 0)
+			continue;
+
+		// Success!
+		NumSuccess++;
+#if defined(HOUDINI_ENGINE_LOGGING)
+		HOUDINI_LOG_MESSAGE(TEXT("Modified UProperty %s on %d objects"), *CurrentPropAttribute.AttributeName, NumUpdated);
+#endif
+	}
+
+	return NumSuccess > 0;
+}
+
 bool
 FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(
 	UObject* InObject,
@@ -8715,7 +8839,8 @@ FHoudiniEngineUtils::UpdateMeshPartUVSets(
 	const int PartId,
 	const bool& bRemoveUnused,
 	TArray<TArray<float>>& OutPartUVSets,
-	TArray<HAPI_AttributeInfo>& OutAttribInfoUVSets)
+	TArray<HAPI_AttributeInfo>& OutAttribInfoUVSets,
+	FHoudiniPartAttributeStore* InAttributeStore)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::UpdateMeshPartUVSets"));
 
@@ -8726,9 +8851,14 @@ FHoudiniEngineUtils::UpdateMeshPartUVSets(
 	OutPartUVSets.SetNum(MAX_STATIC_TEXCOORDS);
 	OutAttribInfoUVSets.SetNum(MAX_STATIC_TEXCOORDS);
 
+	// With a prefetched store, the uv attributes and the attribute names are read from it
+	const bool bUseStore = InAttributeStore && InAttributeStore->IsValid();
+
 	// The second UV set should be called uv2, but we will still check if need to look for a uv1 set.
 	// If uv1 exists, we'll look for uv, uv1, uv2 etc.. if not we'll look for uv, uv2, uv3 etc..
-	bool bUV1Exists = FHoudiniEngineUtils::HapiCheckAttributeExists(GeoId, PartId, "uv1");
+	bool bUV1Exists = bUseStore
+		? InAttributeStore->HasAttribute("uv1")
+		: FHoudiniEngineUtils::HapiCheckAttributeExists(GeoId, PartId, "uv1");
 
 	// Retrieve UVs.
 	for (int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx)
@@ -8737,12 +8867,56 @@ FHoudiniEngineUtils::UpdateMeshPartUVSets(
 		if (TexCoordIdx > 0)
 			UVAttributeName += FString::Printf(TEXT("%d"), bUV1Exists ? TexCoordIdx : TexCoordIdx + 1);
 
-		FHoudiniApi::AttributeInfo_Init(&OutAttribInfoUVSets[TexCoordIdx]);
-		FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-			GeoId, PartId, TCHAR_TO_ANSI(*UVAttributeName),
-			OutAttribInfoUVSets[TexCoordIdx], OutPartUVSets[TexCoordIdx], 2);
+		HAPI_AttributeInfo& UVInfo = OutAttribInfoUVSets[TexCoordIdx];
+		TArray<float>& UVData = OutPartUVSets[TexCoordIdx];
+		FHoudiniApi::AttributeInfo_Init(&UVInfo);
+		if (!bUseStore)
+		{
+			FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				GeoId, PartId, TCHAR_TO_ANSI(*UVAttributeName), UVInfo, UVData, 2);
+			continue;
+		}
+
+		// The data is copied, the uv sets can be requested again for the next split of the part
+		if (!InAttributeStore->GetAttributeDataAsFloat(TCHAR_TO_ANSI(*UVAttributeName), UVInfo, UVData))
+			continue;
+
+		// The store holds the attribute with its own tuple size, keep the first two components of each value
+		const int32 TupleSize = UVInfo.tupleSize;
+		if (TupleSize == 2)
+			continue;
+
+		if (TupleSize < 2 || UVData.Num() < UVInfo.count * TupleSize)
+		{
+			FHoudiniApi::AttributeInfo_Init(&UVInfo);
+			FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				GeoId, PartId, TCHAR_TO_ANSI(*UVAttributeName), UVInfo, UVData, 2);
+			continue;
+		}
+
+		for (int32 ValueIdx = 0; ValueIdx < UVInfo.count; ++ValueIdx)
+		{
+			UVData[ValueIdx * 2] = UVData[ValueIdx * TupleSize];
+			UVData[ValueIdx * 2 + 1] = UVData[ValueIdx * TupleSize + 1];
+		}
+		UVData.SetNum(UVInfo.count * 2);
+		UVInfo.tupleSize = 2;
 	}
 
+	// The old uvs, handled above
+	auto IsUVSetAttributeName = [](const FString& InAttribName)
+	{
+		return InAttribName == TEXT("uv")
+			|| InAttribName == TEXT("uv1")
+			|| InAttribName == TEXT("uv2")
+			|| InAttribName == TEXT("uv3")
+			|| InAttribName == TEXT("uv4")
+			|| InAttribName == TEXT("uv5")
+			|| InAttribName == TEXT("uv6")
+			|| InAttribName == TEXT("uv7")
+			|| InAttribName == TEXT("uv8");
+	};
+
 	// Also look for 16.5 uvs (attributes with a Texture type) 
 	// For that, we'll have to iterate through ALL the attributes and check their types
 	TArray< FString > FoundAttributeNames; 
@@ -8750,9 +8924,35 @@ FHoudiniEngineUtils::UpdateMeshPartUVSets(
 		
 	for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 	{
-		FHoudiniEngineUtils::HapiGetAttributeOfType(
-			GeoId, PartId, (HAPI_AttributeOwner)AttrIdx, 
-			HAPI_ATTRIBUTE_TYPE_TEXTURE, FoundAttributeInfos, FoundAttributeNames);
+		if (!bUseStore)
+		{
+			FHoudiniEngineUtils::HapiGetAttributeOfType(
+				GeoId, PartId, (HAPI_AttributeOwner)AttrIdx,
+				HAPI_ATTRIBUTE_TYPE_TEXTURE, FoundAttributeInfos, FoundAttributeNames);
+			continue;
+		}
+
+		// The type is only known from the attribute info, but the names are already known
+		// and the info of the old uvs doesn't need to be queried
+		for (const FString& AttribName : InAttributeStore->GetAttributeNames((HAPI_AttributeOwner)AttrIdx))
+		{
+			if (IsUVSetAttributeName(AttribName))
+				continue;
+
+			HAPI_AttributeInfo AttrInfo;
+			FHoudiniApi::AttributeInfo_Init(&AttrInfo);
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				GeoId, PartId, TCHAR_TO_UTF8(*AttribName),
+				(HAPI_AttributeOwner)AttrIdx, &AttrInfo))
+				continue;
+
+			if (!AttrInfo.exists || AttrInfo.typeInfo != HAPI_ATTRIBUTE_TYPE_TEXTURE)
+				continue;
+
+			FoundAttributeInfos.Add(AttrInfo);
+			FoundAttributeNames.Add(AttribName);
+		}
 	}
 
 	if (FoundAttributeInfos.Num() <= 0)
@@ -8763,15 +8963,7 @@ FHoudiniEngineUtils::UpdateMeshPartUVSets(
 	for (int32 attrIdx = 0; attrIdx < FoundAttributeInfos.Num(); attrIdx++)
 	{
 		// Ignore the old uvs
-		if (FoundAttributeNames[attrIdx] == TEXT("uv")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv1")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv2")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv3")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv4")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv5")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv6")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv7")
-			|| FoundAttributeNames[attrIdx] == TEXT("uv8"))
+		if (IsUVSetAttributeName(FoundAttributeNames[attrIdx]))
 			continue;
 
 		HAPI_AttributeInfo CurrentAttrInfo = FoundAttributeInfos[attrIdx];
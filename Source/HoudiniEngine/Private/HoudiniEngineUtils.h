@@ -33,6 +33,7 @@
 #include <string>
 
 #include "HoudiniGenericAttribute.h"
+#include "HoudiniWorldActorIndex.h"
 #include "HoudiniOutput.h"
 #include "HoudiniPackageParams.h"
 #include "Containers/UnrealString.h"
@@ -44,6 +45,7 @@ class UHoudiniAsset;
 class UHoudiniAssetComponent;
 
 struct FHoudiniPartInfo;
+class FHoudiniPartAttributeStore;
 struct FHoudiniMeshSocket;
 struct FHoudiniGeoPartObject;
 
@@ -679,6 +681,16 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const TArray<float>& InFloatValues,
 			const FString& InHeightfieldName);
 
+		// Helper function to set a contiguous range of Heightfield data, starting at InStart voxels
+		// in the volume. Used to update part of a heightfield without resending the whole volume.
+		static HAPI_Result HapiSetHeightFieldData(
+			const HAPI_NodeId& InNodeId,
+			const HAPI_PartId& InPartId,
+			const float* InFloatValues,
+			const int32& InStart,
+			const int32& InCount,
+			const FString& InHeightfieldName);
+
 		// Helper function to get Heightfield data
 		// The data will be read in chunks if too large for thrift
 		static HAPI_Result HapiGetHeightFieldData(
@@ -686,6 +698,14 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const HAPI_PartId& InPartId,
 			TArray<float>& OutFloatValues);
 
+		// Helper function to get a contiguous range of Heightfield data, starting at InStart voxels in the volume.
+		static HAPI_Result HapiGetHeightFieldData(
+			const HAPI_NodeId& InNodeId,
+			const HAPI_PartId& InPartId,
+			float* OutFloatValues,
+			const int32& InStart,
+			const int32& InCount);
+
 		static bool HapiGetParameterDataAsString(
 			const HAPI_NodeId& NodeId,
 			const std::string& ParmName,
@@ -713,6 +733,16 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const HAPI_AttributeOwner& AttributeOwner,
 			const int32& InAttribIndex = -1);
 
+		// Fetches a single generic attribute on the given owner.
+		// If InAttribIndex is not -1, only the value(s) at that index are fetched.
+		static bool HapiGetGenericAttribute(
+			const HAPI_NodeId& InGeoNodeId,
+			const HAPI_PartId& InPartId,
+			const FString& InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			const int32& InAttribIndex,
+			FHoudiniGenericAttribute& OutAttribute);
+
 		// Helper functions for generic property attributes
 		static bool GetGenericPropertiesAttributes(
 			const HAPI_NodeId& InGeoNodeId,
@@ -730,6 +760,13 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const bool bInDeferPostEditChangePropertyCalls=false,
 			const FHoudiniGenericAttribute::FFindPropertyFunctionType& InProcessFunction=nullptr);
 
+		// Applies the property attributes to multiple objects, resolving each property once per class.
+		// InAtIndices contains the attribute index to use for each object, if empty index 0 is used for all.
+		static bool UpdateGenericPropertiesAttributesOnObjects(
+			const TArray<UObject*>& InObjects,
+			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes,
+			const TArray<int32>& InAtIndices);
+
 		// Helper function for setting a generic attribute on geo (UE -> HAPI)
 		static bool SetGenericPropertyAttribute(
 			const HAPI_NodeId& InGeoNodeId,
@@ -1053,6 +1090,9 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		template<class T>
 		static T* FindActorInWorldByLabelOrName(UWorld* InWorld, FString ActorLabelOrName, EActorIteratorFlags Flags = EActorIteratorFlags::AllActors)
 		{
+			if (FHoudiniWorldActorIndex* WorldActorIndex = FHoudiniWorldActorIndex::Get(InWorld))
+				return Cast<T>(WorldActorIndex->FindActorByLabelOrName(ActorLabelOrName, T::StaticClass(), Flags));
+
 			T* OutActor = nullptr;
 			for (TActorIterator<T> ActorIt(InWorld, T::StaticClass(), Flags); ActorIt; ++ActorIt)
 			{
@@ -1073,6 +1113,9 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		template<class T>
 		static T* FindActorInWorldByLabel(UWorld* InWorld, FString ActorLabel, EActorIteratorFlags Flags = EActorIteratorFlags::AllActors)
 		{
+			if (FHoudiniWorldActorIndex* WorldActorIndex = FHoudiniWorldActorIndex::Get(InWorld))
+				return Cast<T>(WorldActorIndex->FindActorByLabel(ActorLabel, T::StaticClass(), Flags));
+
 			T* OutActor = nullptr;
 			for (TActorIterator<T> ActorIt(InWorld, T::StaticClass(), Flags); ActorIt; ++ActorIt)
 			{
@@ -1089,6 +1132,9 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		template<class T>
 		static T* FindActorInWorld(UWorld* InWorld, FName ActorName, EActorIteratorFlags Flags = EActorIteratorFlags::AllActors)
 		{
+			if (FHoudiniWorldActorIndex* WorldActorIndex = FHoudiniWorldActorIndex::Get(InWorld))
+				return Cast<T>(WorldActorIndex->FindActorByName(ActorName, T::StaticClass(), Flags));
+
 			T* OutActor = nullptr;
 			for (TActorIterator<T> ActorIt(InWorld, T::StaticClass(), Flags); ActorIt; ++ActorIt)
 			{
@@ -1285,12 +1331,14 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// -------------------------------------------------
 
 		// Retrieve Houdini UV sets from the given Mesh part GeoId/PartId.
+		// If a prefetched attribute store of the part is given, the uv sets are read from it.
 		static bool UpdateMeshPartUVSets(
 			const int GeoId,
 			const int PartId,
 			const bool& bRemoveUnused,
 			TArray<TArray<float>>& OutPartUVSets,
-			TArray<HAPI_AttributeInfo>& OutAttribInfoUVSets);
+			TArray<HAPI_AttributeInfo>& OutAttribInfoUVSets,
+			FHoudiniPartAttributeStore* InAttributeStore = nullptr);
 
 	protected:
 		
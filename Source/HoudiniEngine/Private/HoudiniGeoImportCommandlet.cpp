@@ -374,6 +374,8 @@ UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 	{
 		HOUDINI_LOG_WARNING(TEXT("BGEO import failed."));
 		FHoudiniPDGImportBGEOResultMessage* Reply = new FHoudiniPDGImportBGEOResultMessage();
+		// Identify the work result so the manager can release it
+		(*Reply) = InMessage;
 		Reply->ImportResult = EHoudiniPDGImportBGEOResult::HPIBR_Failed;
 		PDGEndpoint->Send(Reply, InContext->GetSender());
 	}
@@ -427,9 +429,13 @@ bool UHoudiniGeoImportCommandlet::StartHoudiniEngineSession()
 	// Start Houdini Engine session
 	HOUDINI_LOG_DISPLAY(TEXT("Starting Houdini Engine session..."));
 	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+	// The PDG manager can run several commandlets, each needs its own pipe
+	// The imports run on the main session only, no need for pooled sessions
+	const FString PipeName = FString::Printf(TEXT("hapi_bgeo_cmdlet_%s"), *Guid.ToString());
 	if (!HoudiniEngine.CreateSession(
 		EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe,
-		"hapi_bgeo_cmdlet"))
+		FName(*PipeName),
+		false))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to start Houdini Engine session."));
 		return false;
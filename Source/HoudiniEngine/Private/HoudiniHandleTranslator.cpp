@@ -204,16 +204,7 @@ FHoudiniHandleTranslator::BuildAllHandles(
 
 				TArray<UHoudiniHandleParameter*> &XformParms = HandleComponent->XformParms;
 
-				UHoudiniParameter* FoundParam = nullptr;
-
-				for (auto Param : OuterObject->Parameters) 
-				{
-					if (Param->GetParmId() == ParamId)
-					{
-						FoundParam = Param;
-						break;
-					}
-				}
+				UHoudiniParameter* FoundParam = OuterObject->FindParameterByParmId(ParamId);
 				
 				HandleComponent->InitializeHandleParameters();
 
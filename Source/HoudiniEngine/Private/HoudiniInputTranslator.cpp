@@ -43,6 +43,7 @@
 #include "HoudiniParameterOperatorPath.h"
 #include "HoudiniSplineComponent.h"
 #include "HoudiniSplineTranslator.h"
+#include "HoudiniWorldActorIndex.h"
 #include "UnrealAnimationTranslator.h"
 #include "UnrealBrushTranslator.h"
 #include "UnrealDataTableTranslator.h"
@@ -129,7 +130,10 @@ FHoudiniInputTranslator::UpdateInputs(UHoudiniAssetComponent* HAC)
 	if (!IsValid(HAC))
 		return false;
 
-	if (!FHoudiniInputTranslator::BuildAllInputs(HAC->GetAssetId(), HAC, HAC->Inputs, HAC->Parameters))
+	// The inputs may be added, removed or reordered, even if building them fails
+	const bool bInputsBuilt = FHoudiniInputTranslator::BuildAllInputs(HAC->GetAssetId(), HAC, HAC->Inputs, HAC->Parameters);
+	HAC->InvalidateInputIndices();
+	if (!bInputsBuilt)
 	{
 		// Failed to create the inputs
 		return false;
@@ -722,28 +726,56 @@ FHoudiniInputTranslator::SetDefaultAssetFromHDA(UHoudiniInput* Input, bool& bOut
 	int32 WorldIdx = 0;
 	int32 LandscapedIdx = 0;
 	int32 HDAIdx = 0;
-	for (TActorIterator<AActor> ActorIt(Input->GetWorld(), AActor::StaticClass(), EActorIteratorFlags::SkipPendingKill); ActorIt; ++ActorIt)
+	UWorld* InputWorld = Input->GetWorld();
+	if (FHoudiniWorldActorIndex* WorldActorIndex = FHoudiniWorldActorIndex::Get(InputWorld))
 	{
-		AActor* CurActor = *ActorIt;
-		if (!CurActor)
-			continue;
+		// Look the tokens up by name, then by label
+		TSet<AActor*> FoundActors;
+		for (const FString& CurToken : Tokens)
+		{
+			if (CurToken.IsEmpty())
+				continue;
 
-		AActor* FoundActor = nullptr;
-		int32 FoundIdx = Tokens.Find(CurActor->GetFName().ToString());
-		if (FoundIdx == INDEX_NONE)
-			FoundIdx = Tokens.Find(CurActor->GetActorLabel());
+			AActor* FoundActor = nullptr;
+			const FName TokenName(*CurToken, FNAME_Find);
+			if (TokenName != NAME_None)
+				FoundActor = WorldActorIndex->FindActorByName(TokenName, AActor::StaticClass(), EActorIteratorFlags::SkipPendingKill);
+			if (!FoundActor)
+				FoundActor = WorldActorIndex->FindActorByLabel(CurToken, AActor::StaticClass(), EActorIteratorFlags::SkipPendingKill);
 
-		if(FoundIdx != INDEX_NONE)
-			FoundActor = CurActor;
+			if (!FoundActor || FoundActors.Contains(FoundActor))
+				continue;
 
-		if (!FoundActor)
-			continue;
+			// Select the found actor in the world input
+			FoundActors.Add(FoundActor);
+			Input->SetInputObjectAt(EHoudiniInputType::World, WorldIdx++, FoundActor);
+		}
+	}
+	else
+	{
+		for (TActorIterator<AActor> ActorIt(InputWorld, AActor::StaticClass(), EActorIteratorFlags::SkipPendingKill); ActorIt; ++ActorIt)
+		{
+			AActor* CurActor = *ActorIt;
+			if (!CurActor)
+				continue;
 
-		// Select the found actor in the world input
-		Input->SetInputObjectAt(EHoudiniInputType::World, WorldIdx++, FoundActor);
+			AActor* FoundActor = nullptr;
+			int32 FoundIdx = Tokens.Find(CurActor->GetFName().ToString());
+			if (FoundIdx == INDEX_NONE)
+				FoundIdx = Tokens.Find(CurActor->GetActorLabel());
 
-		// Remove the Found Token
-		Tokens.RemoveAt(FoundIdx);
+			if(FoundIdx != INDEX_NONE)
+				FoundActor = CurActor;
+
+			if (!FoundActor)
+				continue;
+
+			// Select the found actor in the world input
+			Input->SetInputObjectAt(EHoudiniInputType::World, WorldIdx++, FoundActor);
+
+			// Remove the Found Token
+			Tokens.RemoveAt(FoundIdx);
+		}
 	}
 
 	// See if we should change the default input type
@@ -3625,6 +3657,14 @@ FHoudiniInputTranslator::HapiCreateInputNodeForHoudiniAssetComponent(
 
 	InputHAC->AddDownstreamHoudiniAsset(OuterHAC);
 
+	// The input HDA's node lives in another session of the session pool: it will move to the main session
+	// now that it has a downstream HDA. Wait for it to be rebuilt there before connecting to it.
+	if (FMath::Max(InputHAC->GetSessionIndex(), 0) != FHoudiniEngine::GetCurrentSessionIndex())
+	{
+		HoudiniInput->MarkChanged(true);
+		return false;
+	}
+
 	//if (HAC->NeedsInitialization())
 	//	HAC->MarkAsNeedInstantiation();
 
@@ -4406,7 +4446,9 @@ FHoudiniInputTranslator::UpdateLoadedInputs(UHoudiniAssetComponent* HAC)
 
 	// We need to call BuildAllInputs here to update all the inputs,
 	// and make sure that the object path parameter inputs' parameter ids are up to date
-	if (!FHoudiniInputTranslator::BuildAllInputs(HAC->GetAssetId(), HAC, HAC->Inputs, HAC->Parameters))
+	const bool bInputsBuilt = FHoudiniInputTranslator::BuildAllInputs(HAC->GetAssetId(), HAC, HAC->Inputs, HAC->Parameters);
+	HAC->InvalidateInputIndices();
+	if (!bInputsBuilt)
 		return false;
 
 	// We need to update the AssetID stored on all the inputs
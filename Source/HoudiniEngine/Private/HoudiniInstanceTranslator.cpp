@@ -39,6 +39,7 @@
 #include "HoudiniStaticMeshComponent.h"
 #include "HoudiniStaticMesh.h"
 #include "HoudiniFoliageTools.h"
+#include "HoudiniEngineOutputStats.h"
 
 //#include "HAPI/HAPI_Common.h"
 
@@ -70,9 +71,25 @@
 	#include "MeshPaintHelpers.h"
 #endif
 #include "HoudiniFoliageUtils.h"
+#include "UObject/ObjectKey.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+namespace
+{
+	// Instances of an ISMC / HISMC as left by the last update
+	struct FHoudiniInstanceSlots
+	{
+		// Stable id of the instance in each slot of the component, empty if the instancer had no ids
+		TArray<int32> SlotIds;
+
+		// Slot of each instance of the instancer, empty if they match
+		TArray<int32> InstanceSlots;
+	};
+
+	TMap<TObjectKey<UInstancedStaticMeshComponent>, FHoudiniInstanceSlots> InstanceSlotsPerComponent;
+}
+
 // Fastrand is a faster alternative to std::rand()
 // and doesn't oscillate when looking for 2 values like Unreal's.
 inline int fastrand(int& nSeed)
@@ -117,6 +134,9 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	// Check for per instance custom data
 	GetPerInstanceCustomData(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData);
 
+	// Check for stable instance ids
+	GetPerInstanceIds(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData);
+
 	//Get the level path attribute on the instancer
 	if (!FHoudiniEngineUtils::GetLevelPathAttribute(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData.AllLevelPaths))
 	{
@@ -185,14 +205,16 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(
 	const TArray<UHoudiniOutput*>& InAllOutputs,
 	UObject* InOuterComponent,
 	const FHoudiniPackageParams& InPackageParms,
-	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData)
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	return CreateAllInstancersFromHoudiniOutputs(
 		InAllOutputs,
 		InAllOutputs,
 		InOuterComponent,
 		InPackageParms,
-		InPreBuiltInstancedOutputPartData);
+		InPreBuiltInstancedOutputPartData,
+		OutStats);
 }
 
 int
@@ -201,7 +223,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(
 	const TArray<UHoudiniOutput*>& InAllOutputs,
 	UObject* InOuterComponent,
 	const FHoudiniPackageParams& InPackageParms,
-	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData)
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	int FoliageTypeCount = 0;
 
@@ -235,7 +258,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(
 			InOuterComponent,
 			InPackageParms,
 			FoliageTypeCount,
-			InPreBuiltInstancedOutputPartData);
+			InPreBuiltInstancedOutputPartData,
+			OutStats);
 
 		if (bSuccess)
 			++InstanceCount;
@@ -256,7 +280,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	UObject* InOuterComponent,
 	const FHoudiniPackageParams& InPackageParms,
 	int & FoliageTypeCount,
-	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData,
+	FHoudiniEngineOutputStats* OutStats
 )
 {
 	if (!IsValid(InOutput))
@@ -444,6 +469,30 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 			UFoliageType* FoliageTypeUsed = nullptr;
 			UWorld * WorldUsed = nullptr;
 
+			// Get the stable ids of this variation's instances, if we have any
+			TArray<int32> VariationInstanceIds;
+			if (InstancedOutputPartData.PerInstanceIds.IsValidIndex(VariationOriginalIndex))
+			{
+				const TArray<int32>& OriginalInstanceIds = InstancedOutputPartData.PerInstanceIds[VariationOriginalIndex];
+				if (FoundInstancedOutput && FoundInstancedOutput->VariationObjects.Num() > 1)
+				{
+					// The instances are split between the variations
+					const TArray<int32>& TransformVariationIndices = FoundInstancedOutput->TransformVariationIndices;
+					for (int32 Idx = 0; Idx < OriginalInstanceIds.Num() && Idx < TransformVariationIndices.Num(); Idx++)
+					{
+						if (TransformVariationIndices[Idx] == VariationIndices[InstanceObjectIdx])
+							VariationInstanceIds.Add(OriginalInstanceIds[Idx]);
+					}
+				}
+				else
+				{
+					VariationInstanceIds = OriginalInstanceIds;
+				}
+
+				if (VariationInstanceIds.Num() != InstancedObjectTransforms.Num())
+					VariationInstanceIds.Empty();
+			}
+
 			if (!CreateOrUpdateInstancer(
 				InstancedObject,
 				InstancedObjectTransforms,
@@ -463,7 +512,9 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 				FoliageTypeUsed,
 				WorldUsed, 
 				InstancedOutputPartData.bForceHISM,
-				InstancedOutputPartData.bForceInstancer))
+				InstancedOutputPartData.bForceInstancer,
+				VariationInstanceIds.Num() > 0 ? &VariationInstanceIds : nullptr,
+				OutStats))
 			{
 				// TODO??
 				continue;
@@ -478,7 +529,7 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 				if (InstancedOutputPartData.PerInstanceCustomData.Num() > 0)
 				{
 				    UpdateChangedPerInstanceCustomData(
-					    InstancedOutputPartData.PerInstanceCustomData[VariationOriginalIndex], NewInstancerComponent);
+					    InstancedOutputPartData.PerInstanceCustomData[VariationOriginalIndex], NewInstancerComponent, OutStats);
 
 				    // See if the HiddenInGame property is overriden
 				    bool bOverridesHiddenInGame = false;
@@ -2092,7 +2143,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancer(
 	UFoliageType*& FoliageTypeUsed,
 	UWorld*& WorldUsed,
 	const bool bForceHISM,
-	const bool bForceInstancer)
+	const bool bForceInstancer,
+	const TArray<int32>* InstanceIds,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	// See if we can reuse the old component
 	InstancerComponentType OldType = GetComponentsType(OldComponents);
@@ -2193,7 +2246,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancer(
 		{
 			// Create an Instanced Static Mesh Component
 			bSuccess = CreateOrUpdateInstancedStaticMeshComponent(
-				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponents[0], InstancerMaterials, bForceHISM, FirstOriginalIndex);
+				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponents[0], InstancerMaterials, bForceHISM, FirstOriginalIndex, InstanceIds, OutStats);
 			bCheckRenderState = true;
 		}
 		break;
@@ -2335,7 +2388,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	USceneComponent*& CreatedInstancedComponent,
 	TArray<UMaterialInterface*> InstancerMaterials,
 	const bool & bForceHISM,
-	const int32& InstancerObjectIdx)
+	const int32& InstancerObjectIdx,
+	const TArray<int32>* InstanceIds,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	if (!InstancedStaticMesh)
 		return false;
@@ -2397,19 +2452,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 		}
 	}
 
-	int32 NumOldInstances = InstancedStaticMeshComponent->GetInstanceCount();
-	int32 NumNewInstances = InstancedObjectTransforms.Num();
-	if (NumOldInstances == NumNewInstances)
-	{
-		// For efficiency, try to reuse the existing buffer.
-		InstancedStaticMeshComponent->BatchUpdateInstancesTransforms(0, InstancedObjectTransforms, false, true);
-	}
-	else
-	{
-		// Clear old instances, add new ones.
-		InstancedStaticMeshComponent->ClearInstances();
-		InstancedStaticMeshComponent->AddInstances(InstancedObjectTransforms, false);
-	}
+	// Only add, remove or update the instances that changed since the previous cook
+	UpdateInstancedStaticMeshComponentInstances(InstancedStaticMeshComponent, InstancedObjectTransforms, InstanceIds, OutStats);
 
 	// Apply generic attributes if we have any
 	FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(InstancedStaticMeshComponent, AllPropertyAttributes, InstancerObjectIdx);
@@ -2421,6 +2465,176 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	return true;
 }
 
+void
+FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentInstances(
+	UInstancedStaticMeshComponent* InISMC,
+	const TArray<FTransform>& InstancedObjectTransforms,
+	const TArray<int32>* InstanceIds,
+	FHoudiniEngineOutputStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentInstances);
+
+	if (!IsValid(InISMC))
+		return;
+
+	const int32 NumOldInstances = InISMC->GetInstanceCount();
+	const int32 NumNewInstances = InstancedObjectTransforms.Num();
+
+	FHoudiniInstanceSlots NewSlots;
+
+	// Ids can only be used if they are unique
+	bool bUseIds = InstanceIds && InstanceIds->Num() == NumNewInstances;
+	if (bUseIds)
+	{
+		TSet<int32> UniqueIds;
+		UniqueIds.Reserve(NumNewInstances);
+		for (const int32 Id : *InstanceIds)
+			UniqueIds.Add(Id);
+
+		bUseIds = UniqueIds.Num() == NumNewInstances;
+	}
+
+	// Instances whose id was already in the component keep their slot, so a few added or removed points
+	// don't shift all the following instances
+	const FHoudiniInstanceSlots* OldSlots = InstanceSlotsPerComponent.Find(InISMC);
+	if (bUseIds && OldSlots && OldSlots->SlotIds.Num() == NumOldInstances && NumOldInstances > 0)
+	{
+		TMap<int32, int32> OldSlotPerId;
+		OldSlotPerId.Reserve(NumOldInstances);
+		for (int32 Slot = 0; Slot < NumOldInstances; Slot++)
+			OldSlotPerId.Add(OldSlots->SlotIds[Slot], Slot);
+
+		TArray<bool> SlotUsed;
+		SlotUsed.SetNumZeroed(NumOldInstances);
+
+		TArray<int32>& InstanceSlots = NewSlots.InstanceSlots;
+		InstanceSlots.Init(INDEX_NONE, NumNewInstances);
+		for (int32 Idx = 0; Idx < NumNewInstances; Idx++)
+		{
+			if (const int32* OldSlot = OldSlotPerId.Find((*InstanceIds)[Idx]))
+			{
+				InstanceSlots[Idx] = *OldSlot;
+				SlotUsed[*OldSlot] = true;
+			}
+		}
+
+		// New instances fill the slots of the removed ones first, then are added after the old ones
+		int32 NextFreeSlot = 0;
+		int32 NextAddedSlot = NumOldInstances;
+		for (int32 Idx = 0; Idx < NumNewInstances; Idx++)
+		{
+			if (InstanceSlots[Idx] != INDEX_NONE)
+				continue;
+
+			while (NextFreeSlot < NumOldInstances && SlotUsed[NextFreeSlot])
+				NextFreeSlot++;
+
+			if (NextFreeSlot < NumOldInstances)
+			{
+				InstanceSlots[Idx] = NextFreeSlot;
+				SlotUsed[NextFreeSlot] = true;
+			}
+			else
+			{
+				InstanceSlots[Idx] = NextAddedSlot++;
+			}
+		}
+
+		// If instances were removed, move the instances that are past the new count into the remaining free slots
+		// so only the last slots have to be removed.
+		if (NumNewInstances < NumOldInstances)
+		{
+			NextFreeSlot = 0;
+			for (int32 Idx = 0; Idx < NumNewInstances; Idx++)
+			{
+				if (InstanceSlots[Idx] < NumNewInstances)
+					continue;
+
+				while (SlotUsed[NextFreeSlot])
+					NextFreeSlot++;
+
+				InstanceSlots[Idx] = NextFreeSlot;
+				SlotUsed[NextFreeSlot] = true;
+			}
+		}
+	}
+
+	// Instance transforms and ids in component slot order
+	TArray<FTransform> SlotTransforms;
+	if (NewSlots.InstanceSlots.Num() > 0)
+	{
+		SlotTransforms.SetNum(NumNewInstances);
+		NewSlots.SlotIds.SetNum(NumNewInstances);
+		for (int32 Idx = 0; Idx < NumNewInstances; Idx++)
+		{
+			SlotTransforms[NewSlots.InstanceSlots[Idx]] = InstancedObjectTransforms[Idx];
+			NewSlots.SlotIds[NewSlots.InstanceSlots[Idx]] = (*InstanceIds)[Idx];
+		}
+	}
+	else if (bUseIds)
+	{
+		NewSlots.SlotIds = *InstanceIds;
+	}
+	const TArray<FTransform>& NewTransforms = NewSlots.InstanceSlots.Num() > 0 ? SlotTransforms : InstancedObjectTransforms;
+
+	// Update the transforms of the kept slots that changed
+	const int32 NumKeptInstances = FMath::Min(NumOldInstances, NumNewInstances);
+	TArray<int32> ChangedSlots;
+	for (int32 Slot = 0; Slot < NumKeptInstances; Slot++)
+	{
+		if (!InISMC->PerInstanceSMData[Slot].Transform.Equals(NewTransforms[Slot].ToMatrixWithScale()))
+			ChangedSlots.Add(Slot);
+	}
+
+	if (ChangedSlots.Num() > NumKeptInstances / 2)
+	{
+		// Most instances changed, update all of them at once
+		TArray<FTransform> KeptTransforms(NewTransforms.GetData(), NumKeptInstances);
+		InISMC->BatchUpdateInstancesTransforms(0, KeptTransforms, false, false, true);
+	}
+	else
+	{
+		for (const int32 Slot : ChangedSlots)
+			InISMC->UpdateInstanceTransform(Slot, NewTransforms[Slot], false, false, true);
+	}
+
+	// Add or remove the instances past the kept ones
+	if (NumNewInstances > NumOldInstances)
+	{
+		TArray<FTransform> AddedTransforms(NewTransforms.GetData() + NumOldInstances, NumNewInstances - NumOldInstances);
+		InISMC->AddInstances(AddedTransforms, false);
+	}
+	else if (NumNewInstances < NumOldInstances)
+	{
+		TArray<int32> RemovedSlots;
+		RemovedSlots.Reserve(NumOldInstances - NumNewInstances);
+		for (int32 Slot = NumOldInstances - 1; Slot >= NumNewInstances; Slot--)
+			RemovedSlots.Add(Slot);
+
+		InISMC->RemoveInstances(RemovedSlots);
+	}
+
+	if (OutStats)
+	{
+		OutStats->NotifyInstancesDelta(
+			FMath::Max(NumNewInstances - NumOldInstances, 0),
+			FMath::Max(NumOldInstances - NumNewInstances, 0),
+			ChangedSlots.Num());
+	}
+
+	// Keep the slots for the next update, forget about the components that were destroyed
+	for (auto It = InstanceSlotsPerComponent.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+			It.RemoveCurrent();
+	}
+
+	if (NewSlots.SlotIds.Num() > 0)
+		InstanceSlotsPerComponent.Add(InISMC, MoveTemp(NewSlots));
+	else
+		InstanceSlotsPerComponent.Remove(InISMC);
+}
+
 bool
 FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	UObject* InstancedObject,
@@ -2479,6 +2693,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	// Set the number of needed instances
 	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num());
 
+	TArray<UObject*> InstancedActors;
+	InstancedActors.Reserve(InstancedObjectTransforms.Num());
+
 	for (int32 Idx = 0; Idx < InstancedObjectTransforms.Num(); Idx++)
 	{
 		// if we already have an actor, we can reuse it
@@ -2501,10 +2718,13 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		// Keep or clear tags on the instanced actor
 		FHoudiniEngineUtils::KeepOrClearActorTags(CurInstance, true, true, InstancerHGPO);
 
-		// Update the generic properties for that instance if any
-		FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(CurInstance, AllPropertyAttributes, OriginalInstancerObjectIndices[Idx]);
+		InstancedActors.Add(CurInstance);
 	}
 
+	// Update the generic properties for the instances if any
+	if (AllPropertyAttributes.Num() > 0)
+		FHoudiniEngineUtils::UpdateGenericPropertiesAttributesOnObjects(InstancedActors, AllPropertyAttributes, OriginalInstancerObjectIndices);
+
 	// Update generic properties for the component managing the instances
 	FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(InstancedActorComponent, AllPropertyAttributes);
 
@@ -2689,20 +2909,25 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
-	// TODO: Optimize
-	// Loop on attributes first, then components,
-	// if failing to find the attrib on a component, skip the rest
+	// Loop on attributes first, then components
 	if (AllPropertyAttributes.Num() > 0)
 	{
 		TArray<class UStaticMeshComponent*>& Instances = MeshSplitComponent->GetInstancesForWrite();
+		TArray<UObject*> ValidInstances;
+		TArray<int32> ValidInstanceIndices;
+		ValidInstances.Reserve(Instances.Num());
+		ValidInstanceIndices.Reserve(Instances.Num());
 		for (int32 InstIndex = 0; InstIndex < Instances.Num(); InstIndex++)
 		{
 			UStaticMeshComponent* CurSMC = Instances[InstIndex];
 			if (!IsValid(CurSMC))
 				continue;
 
-			FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, InstIndex);
+			ValidInstances.Add(CurSMC);
+			ValidInstanceIndices.Add(InstIndex);
 		}
+
+		FHoudiniEngineUtils::UpdateGenericPropertiesAttributesOnObjects(ValidInstances, AllPropertyAttributes, ValidInstanceIndices);
 	}
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
@@ -4048,10 +4273,61 @@ FHoudiniInstanceTranslator::GetPerInstanceCustomData(
 }
 
 
+bool
+FHoudiniInstanceTranslator::GetPerInstanceIds(
+	const int32& InGeoNodeId,
+	const int32& InPartId,
+	FHoudiniInstancedOutputPartData& OutInstancedOutputPartData)
+{
+	OutInstancedOutputPartData.PerInstanceIds.SetNum(0);
+
+	// HAPI_UNREAL_ATTRIB_INSTANCE_ID "id"
+	HAPI_AttributeInfo AttribInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttribInfo);
+
+	TArray<int32> AllIds;
+	if (!FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+		InGeoNodeId, InPartId,
+		HAPI_UNREAL_ATTRIB_INSTANCE_ID,
+		AttribInfo,
+		AllIds,
+		1))
+	{
+		return false;
+	}
+
+	if (AllIds.Num() <= 0)
+		return false;
+
+	OutInstancedOutputPartData.PerInstanceIds.SetNum(OutInstancedOutputPartData.OriginalInstancedObjects.Num());
+	for (int32 ObjIdx = 0; ObjIdx < OutInstancedOutputPartData.OriginalInstancedObjects.Num(); ++ObjIdx)
+	{
+		if (!OutInstancedOutputPartData.OriginalInstancedIndices.IsValidIndex(ObjIdx))
+			continue;
+
+		const TArray<int32>& InstanceIndices = OutInstancedOutputPartData.OriginalInstancedIndices[ObjIdx];
+		TArray<int32>& InstanceIds = OutInstancedOutputPartData.PerInstanceIds[ObjIdx];
+		InstanceIds.Reserve(InstanceIndices.Num());
+		for (int32 InstIdx : InstanceIndices)
+		{
+			if (!AllIds.IsValidIndex(InstIdx))
+			{
+				InstanceIds.Empty();
+				break;
+			}
+
+			InstanceIds.Add(AllIds[InstIdx]);
+		}
+	}
+
+	return true;
+}
+
 bool
 FHoudiniInstanceTranslator::UpdateChangedPerInstanceCustomData(
 	const TArray<float>& InPerInstanceCustomData,
-	USceneComponent* InComponentToUpdate)
+	USceneComponent* InComponentToUpdate,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	// Checks
 	UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(InComponentToUpdate);
@@ -4074,6 +4350,45 @@ FHoudiniInstanceTranslator::UpdateChangedPerInstanceCustomData(
 		return false;
 	}
 
+	// The instances may not be in the same order in the component, see UpdateInstancedStaticMeshComponentInstances()
+	TArray<float> SlotCustomData;
+	const FHoudiniInstanceSlots* Slots = InstanceSlotsPerComponent.Find(ISMC);
+	if (Slots && Slots->InstanceSlots.Num() == InstanceCount && NumCustomFloats > 0)
+	{
+		SlotCustomData.SetNumUninitialized(InPerInstanceCustomData.Num());
+		for (int32 Idx = 0; Idx < InstanceCount; Idx++)
+		{
+			FMemory::Memcpy(
+				&SlotCustomData[Slots->InstanceSlots[Idx] * NumCustomFloats],
+				&InPerInstanceCustomData[Idx * NumCustomFloats],
+				NumCustomFloats * InPerInstanceCustomData.GetTypeSize());
+		}
+	}
+	const TArray<float>& NewCustomData = SlotCustomData.Num() > 0 ? SlotCustomData : InPerInstanceCustomData;
+
+	// Count the instances whose custom data changed, and skip the update if none did
+	int32 NumChangedInstances = InstanceCount;
+	if (ISMC->NumCustomDataFloats == NumCustomFloats && ISMC->PerInstanceSMCustomData.Num() == NewCustomData.Num())
+	{
+		NumChangedInstances = 0;
+		for (int32 Idx = 0; Idx < InstanceCount; Idx++)
+		{
+			if (FMemory::Memcmp(
+				&ISMC->PerInstanceSMCustomData[Idx * NumCustomFloats],
+				&NewCustomData[Idx * NumCustomFloats],
+				NumCustomFloats * NewCustomData.GetTypeSize()) != 0)
+			{
+				NumChangedInstances++;
+			}
+		}
+
+		if (NumChangedInstances == 0)
+			return true;
+	}
+
+	if (OutStats)
+		OutStats->NotifyInstancesCustomDataUpdated(NumChangedInstances);
+
 	ISMC->NumCustomDataFloats = NumCustomFloats;
 
 	// Clear out and reinit to 0 the PerInstanceCustomData array
@@ -4084,10 +4399,10 @@ FHoudiniInstanceTranslator::UpdateChangedPerInstanceCustomData(
 	ISMC->Modify();
 
 	// MemCopy
-	const int32 NumToCopy = FMath::Min(ISMC->PerInstanceSMCustomData.Num(), InPerInstanceCustomData.Num());
+	const int32 NumToCopy = FMath::Min(ISMC->PerInstanceSMCustomData.Num(), NewCustomData.Num());
 	if (NumToCopy > 0)
 	{
-		FMemory::Memcpy(&ISMC->PerInstanceSMCustomData[0], InPerInstanceCustomData.GetData(), NumToCopy * InPerInstanceCustomData.GetTypeSize());
+		FMemory::Memcpy(&ISMC->PerInstanceSMCustomData[0], NewCustomData.GetData(), NumToCopy * NewCustomData.GetTypeSize());
 	}
 
 	// Force recreation of the render data when proxy is created
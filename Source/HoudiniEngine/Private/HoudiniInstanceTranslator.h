@@ -38,7 +38,9 @@ class UStaticMesh;
 class UFoliageType;
 class UHoudiniStaticMesh;
 class UHoudiniInstancedActorComponent;
+class UInstancedStaticMeshComponent;
 struct FHoudiniPackageParams;
+struct FHoudiniEngineOutputStats;
 
 enum InstancerComponentType
 {
@@ -207,6 +209,10 @@ public:
 	UPROPERTY()
 	TArray<float> PerInstanceCustomDataFlat;
 
+	// Stable instance ids (id point attribute) per original instanced object, empty if the instancer has no ids.
+	// Not sent by the message passing system, instancers built from messages update their instances by index.
+	TArray<TArray<int32>> PerInstanceIds;
+
 	void BuildFlatInstancedTransformsAndObjectPaths();
 
 	void BuildOriginalInstancedTransformsAndObjectArrays();
@@ -225,14 +231,16 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<UHoudiniOutput*>& InAllOutputs,
 			UObject* InOuterComponent,
 			const FHoudiniPackageParams& InPackageParms,
-			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData = nullptr);
+			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData = nullptr,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
 
 		static int CreateAllInstancersFromHoudiniOutputs(
 			const TArray<UHoudiniOutput*>& OutputsToUpdate,
 			const TArray<UHoudiniOutput*>& InAllOutputs,
 			UObject* InOuterComponent,
 			const FHoudiniPackageParams& InPackageParms,
-			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData = nullptr);
+			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData = nullptr,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
 
 	private:
 		static bool CreateAllInstancersFromHoudiniOutput(
@@ -241,7 +249,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			UObject* InOuterComponent,
 			const FHoudiniPackageParams& InPackageParms,
 			int & FoliageTypeCount,
-			const TMap<FHoudiniOutputObjectIdentifier,FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData = nullptr);
+			const TMap<FHoudiniOutputObjectIdentifier,FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData = nullptr,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
 
 	public:
 		static bool GetInstancerObjectsAndTransforms(
@@ -336,7 +345,9 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			UFoliageType*& FoliageTypeUsed,
 			UWorld* & WorldUsed,
 			const bool bForceHISM = false,
-			const bool bForceInstancer = false);
+			const bool bForceInstancer = false,
+			const TArray<int32>* InstanceIds = nullptr,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
 
 		// Create or update an ISMC / HISMC
 		static bool CreateOrUpdateInstancedStaticMeshComponent(
@@ -348,7 +359,17 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			USceneComponent*& CreatedInstancedComponent,
 			TArray<UMaterialInterface*> InstancerMaterials,
 			const bool& bForceHISM = false,
-			const int32& InstancerObjectIdx = 0);
+			const int32& InstancerObjectIdx = 0,
+			const TArray<int32>* InstanceIds = nullptr,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
+
+		// Updates the instances of an ISMC / HISMC by only adding, removing and updating the instances that changed.
+		// If InstanceIds are given, instances with the same id keep their previous slot in the component.
+		static void UpdateInstancedStaticMeshComponentInstances(
+			UInstancedStaticMeshComponent* InISMC,
+			const TArray<FTransform>& InstancedObjectTransforms,
+			const TArray<int32>* InstanceIds,
+			FHoudiniEngineOutputStats* OutStats);
 
 		// Create or update an IAC
 		static bool CreateOrUpdateInstancedActorComponent(
@@ -515,8 +536,15 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const int32& InPartId,
 			FHoudiniInstancedOutputPartData& OutInstancedOutputPartData);
 
+		// Reads the stable instance ids (id point attribute) on the instancer part
+		static bool GetPerInstanceIds(
+			const int32& InGeoNodeId,
+			const int32& InPartId,
+			FHoudiniInstancedOutputPartData& OutInstancedOutputPartData);
+
 		// Update PerInstanceCustom data on the given component if possible
 		static bool UpdateChangedPerInstanceCustomData(
 			const TArray<float>& InPerInstanceCustomData,
-			USceneComponent* InComponentToUpdate);
+			USceneComponent* InComponentToUpdate,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
 };
\ No newline at end of file
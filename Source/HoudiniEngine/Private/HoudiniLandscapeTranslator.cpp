@@ -54,6 +54,7 @@
 #include "HAL/IConsoleManager.h"
 #include "Engine/AssetManager.h"
 #include "HoudiniLandscapeRuntimeUtils.h"
+#include "HoudiniEngineOutputStats.h"
 #if WITH_EDITOR
 	#include "EditorLevelUtils.h"
 #endif
@@ -64,6 +65,14 @@ typedef FHoudiniEngineUtils FHUtils;
 
 HOUDINI_LANDSCAPE_DEFINE_LOG_CATEGORY();
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeOutputStreamingMinPoints(
+	TEXT("HoudiniEngine.LandscapeOutputStreamingMinPoints"),
+	16777216,
+	TEXT("Minimum number of points in a height field output for it to be streamed to the landscape in bands of components,\n")
+	TEXT("instead of fetching and converting the whole volume at once.\n")
+	TEXT("0: Never stream height field outputs.\n")
+);
+
 bool
 FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 	UHoudiniOutput* InOutput,
@@ -73,7 +82,8 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 	const FHoudiniPackageParams & InPackageParams,
 	TMap<FString, ALandscape*>& LandscapeMap,
 	FHoudiniClearedEditLayers& ClearedLayers,
-	TArray<UPackage*>& OutCreatedPackages)
+	TArray<UPackage*>& OutCreatedPackages,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	UHoudiniAssetComponent* HAC = FHoudiniEngineUtils::GetOuterHoudiniAssetComponent(InOutput);
 
@@ -121,7 +131,7 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 
 		int Index = LandscapeMapping.HoudiniLayerToUnrealLandscape[&Part];
 		FHoudiniUnrealLandscapeTarget& Landscape = LandscapeMapping.TargetLandscapes[Index];
-		UHoudiniLandscapeTargetLayerOutput* Result = TranslateHeightFieldPart(InOutput, Landscape, Part, *HAC, ClearedLayers, InPackageParams);
+		UHoudiniLandscapeTargetLayerOutput* Result = TranslateHeightFieldPart(InOutput, Landscape, Part, *HAC, ClearedLayers, InPackageParams, OutStats);
 		if (!Result)
 			continue;
 		AllOutputs.Add(Result);
@@ -598,7 +608,8 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 		FHoudiniHeightFieldPartData& Part,
 		UHoudiniAssetComponent& HAC,
 		FHoudiniClearedEditLayers& ClearedLayers,
-		const FHoudiniPackageParams& InPackageParams)
+		const FHoudiniPackageParams& InPackageParams,
+		FHoudiniEngineOutputStats* OutStats)
 {
 	enum TargetLayerType
 	{
@@ -738,18 +749,39 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 	// Fetch the height field data from Houdini into Unreal Space. This data may have already been fetched during landscape
 	// creation, so if it's already present.
 	FHoudiniHeightFieldData HeightFieldData;
-
-	if (!Part.CachedData.IsValid())
+	FHoudiniLandscapeMemoryCounter Memory;
+	int32 NumTilesStreamed = 0;
+
+	// Large height fields are streamed to the landscape in bands of components, so only one band is held in memory at once.
+	// This isn't possible if a new landscape was created with a different size, as the whole layer needs resampling.
+	const FIntPoint VolumeDimensions = FHoudiniLandscapeUtils::GetVolumeDimensionsInUnrealSpace(*Part.HeightField);
+	const int32 StreamingMinPoints = CVarHoudiniEngineLandscapeOutputStreamingMinPoints.GetValueOnAnyThread();
+	const bool bStreamHeightField = StreamingMinPoints > 0
+		&& !Part.CachedData.IsValid()
+		&& (int64)VolumeDimensions.X * VolumeDimensions.Y >= StreamingMinPoints
+		&& !(Landscape.bWasCreated && !Part.TileInfo.IsSet() && Landscape.Dimensions != VolumeDimensions);
+
+	if (bStreamHeightField)
 	{
+		HeightFieldData.Dimensions = VolumeDimensions;
+		HeightFieldData.Transform = FHoudiniLandscapeUtils::GetHeightFieldTransformInUnrealSpace(
+			Part.HeightField->VolumeInfo, Part.SizeInfo.UnrealGridDimensions);
+	}
+	else if (!Part.CachedData.IsValid())
+	{
+		// The fetch holds both the Houdini and Unreal ordered values.
+		Memory.Add(2 * (int64)VolumeDimensions.X * VolumeDimensions.Y * sizeof(float));
 		HeightFieldData = FHoudiniLandscapeUtils::FetchVolumeInUnrealSpace(*Part.HeightField, 
 			Part.SizeInfo.UnrealGridDimensions,
 			LayerType == TargetLayerType::Height);
+		Memory.Remove((int64)VolumeDimensions.X * VolumeDimensions.Y * sizeof(float));
 	}
 	else
 	{
 		// Move the existing data, which has the effect of delete in the input layer's reference to it. Do this
 		// so we don't have all the layer data loaded at once.
 		HeightFieldData = std::move(*Part.CachedData);
+		Memory.Add(HeightFieldData.Values.GetAllocatedSize());
 	}
 
 	// The transform we get from Houdini should be relative to the HDA:
@@ -790,39 +822,51 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 
 		FScopedSetLandscapeEditingLayer Scope(OutputLandscape, LayerGUID, [&] { OutputLandscape->RequestLayersContentUpdate(ELandscapeLayerUpdateMode::Update_All); });
 
-		TArray<uint8> Values;
-		Values.SetNum(HeightFieldData.Values.Num());
-		int XDiff = 1 + Extents.Max.X - Extents.Min.X;
-		int YDiff = 1 + Extents.Max.Y - Extents.Min.Y;
-		int Dest = 0;
+		ULandscapeLayerInfoObject* AlphaLayerInfo = LayerType == TargetLayerType::Visibility ? ALandscapeProxy::VisibilityLayer : TargetLayerInfo;
 
-		bool bExceededRange = FHoudiniLandscapeUtils::NormalizePaintLayers(HeightFieldData.Values, Part.bNormalizePaintLayers);
+		if (bStreamHeightField)
+		{
+			bool bExceededRange = false;
+			FHoudiniLandscapeUtils::StreamHeightFieldToAlphamap(
+				*Part.HeightField,
+				TargetLandscapeInfo,
+				AlphaLayerInfo,
+				Extents,
+				OutputLandscape->ComponentSizeQuads,
+				Part.bNormalizePaintLayers,
+				bExceededRange,
+				Memory,
+				NumTilesStreamed);
+
+			if (bExceededRange)
+				HOUDINI_LOG_WARNING(TEXT("Target layer %s contains values outside the range 0 to 1."), *Part.TargetLayerName);
+		}
+		else
+		{
+			TArray<uint8> Values;
+			Values.SetNum(HeightFieldData.Values.Num());
+			Memory.Add(Values.GetAllocatedSize());
+			int XDiff = 1 + Extents.Max.X - Extents.Min.X;
+			int YDiff = 1 + Extents.Max.Y - Extents.Min.Y;
+			int Dest = 0;
 
-		if (bExceededRange)
-			HOUDINI_LOG_WARNING(TEXT("Target layer %s contains values outside the range 0 to 1."), *Part.TargetLayerName);
+			bool bExceededRange = FHoudiniLandscapeUtils::NormalizePaintLayers(HeightFieldData.Values, Part.bNormalizePaintLayers);
 
-		for (int Y = 0; Y < YDiff; Y++)
-		{
-			for (int X = 0; X < XDiff; X++)
+			if (bExceededRange)
+				HOUDINI_LOG_WARNING(TEXT("Target layer %s contains values outside the range 0 to 1."), *Part.TargetLayerName);
+
+			for (int Y = 0; Y < YDiff; Y++)
 			{
-				int Src = Y + X * YDiff;
+				for (int X = 0; X < XDiff; X++)
+				{
+					int Src = Y + X * YDiff;
 
-				float Value = HeightFieldData.Values[Src];
-				Values[Dest++] = static_cast<uint8>(Value * 255);
+					float Value = HeightFieldData.Values[Src];
+					Values[Dest++] = static_cast<uint8>(Value * 255);
+				}
 			}
-		}
 
-		if (LayerType == TargetLayerType::Visibility)
-		{
-			FAlphamapAccessor<false, false> AlphaAccessor(OutputLandscape->GetLandscapeInfo(), ALandscapeProxy::VisibilityLayer);
-			AlphaAccessor.SetData(
-				Extents.Min.X, Extents.Min.Y, Extents.Max.X, Extents.Max.Y,
-				Values.GetData(),
-				ELandscapeLayerPaintingRestriction::None);
-		}
-		else
-		{
-			FAlphamapAccessor<false, false> AlphaAccessor(OutputLandscape->GetLandscapeInfo(), TargetLayerInfo);
+			FAlphamapAccessor<false, false> AlphaAccessor(OutputLandscape->GetLandscapeInfo(), AlphaLayerInfo);
 			AlphaAccessor.SetData(
 				Extents.Min.X, Extents.Min.Y, Extents.Max.X, Extents.Max.Y,
 				Values.GetData(),
@@ -843,26 +887,56 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 		float Scale = 100.0f; // Scale from Meters to CM.
 		Scale /= Range; // Remap to -1.0f to 1.0 Range
 
-		FHoudiniLandscapeUtils::RealignHeightFieldData(HeightFieldData.Values, 0.5f, Scale * 0.5f);
-		
-		// Explicitly clamp the values, and report if clamped.
-		bool bClamped = FHoudiniLandscapeUtils::ClampHeightFieldData(HeightFieldData.Values, 0.0, 1.0f);
-		if (bClamped)
+		if (bStreamHeightField)
 		{
-			HOUDINI_BAKING_WARNING(TEXT("Landscape layer exceeded max heights so was clamped."));
+			FScopedSetLandscapeEditingLayer Scope(OutputLandscape, UnrealEditLayer->Guid, [&] { OutputLandscape->ForceUpdateLayersContent(); });
+
+			bool bClamped = false;
+			FHoudiniLandscapeUtils::StreamHeightFieldToHeightmap(
+				*Part.HeightField,
+				TargetLandscapeInfo,
+				Extents,
+				OutputLandscape->ComponentSizeQuads,
+				0.5f,
+				Scale * 0.5f,
+				bClamped,
+				Memory,
+				NumTilesStreamed);
+
+			if (bClamped)
+			{
+				HOUDINI_BAKING_WARNING(TEXT("Landscape layer exceeded max heights so was clamped."));
+			}
 		}
+		else
+		{
+			FHoudiniLandscapeUtils::RealignHeightFieldData(HeightFieldData.Values, 0.5f, Scale * 0.5f);
+
+			// Explicitly clamp the values, and report if clamped.
+			bool bClamped = FHoudiniLandscapeUtils::ClampHeightFieldData(HeightFieldData.Values, 0.0, 1.0f);
+			if (bClamped)
+			{
+				HOUDINI_BAKING_WARNING(TEXT("Landscape layer exceeded max heights so was clamped."));
+			}
 
-		// Quantized to 16-bit and set the data.
-		auto QuantizedData = FHoudiniLandscapeUtils::QuantizeNormalizedDataTo16Bit(HeightFieldData.Values);
+			// Quantized to 16-bit and set the data.
+			auto QuantizedData = FHoudiniLandscapeUtils::QuantizeNormalizedDataTo16Bit(HeightFieldData.Values);
+			Memory.Add(QuantizedData.GetAllocatedSize());
 
-		FScopedSetLandscapeEditingLayer Scope(OutputLandscape, UnrealEditLayer->Guid, [&] { OutputLandscape->ForceUpdateLayersContent(); });
+			FScopedSetLandscapeEditingLayer Scope(OutputLandscape, UnrealEditLayer->Guid, [&] { OutputLandscape->ForceUpdateLayersContent(); });
 
-		FLandscapeEditDataInterface LandscapeEdit(TargetLandscapeInfo);
-		FHeightmapAccessor<false> HeightMapAccessor(TargetLandscapeInfo);
-		HeightMapAccessor.SetData(
-			Extents.Min.X, Extents.Min.Y, Extents.Max.X, Extents.Max.Y,
-			QuantizedData.GetData());
+			FLandscapeEditDataInterface LandscapeEdit(TargetLandscapeInfo);
+			FHeightmapAccessor<false> HeightMapAccessor(TargetLandscapeInfo);
+			HeightMapAccessor.SetData(
+				Extents.Min.X, Extents.Min.Y, Extents.Max.X, Extents.Max.Y,
+				QuantizedData.GetData());
+		}
+	}
 
+	if (OutStats)
+	{
+		OutStats->NotifyLandscapeDataPeakBytes(Memory.PeakBytes);
+		OutStats->NotifyLandscapeTilesStreamed(NumTilesStreamed);
 	}
 
 	if (bWasLocked && UnrealEditLayer)
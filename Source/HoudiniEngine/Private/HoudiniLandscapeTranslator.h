@@ -40,6 +40,7 @@ struct FHoudiniGenericAttribute;
 struct FHoudiniPackageParams;
 struct FHoudiniHeightFieldPartData;
 struct FHoudiniUnrealLandscapeTarget;
+struct FHoudiniEngineOutputStats;
 
 struct FHoudiniLandscapeCreationInfo
 {
@@ -63,7 +64,8 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 		const FHoudiniPackageParams& InPackageParams,
 		TMap<FString, ALandscape*> & LandscapeMap,
 		FHoudiniClearedEditLayers & ClearedLayers,
-		TArray<UPackage*>& OutCreatedPackages);
+		TArray<UPackage*>& OutCreatedPackages,
+		FHoudiniEngineOutputStats* OutStats = nullptr);
 
 	static const FHoudiniGeoPartObject* GetHoudiniHeightFieldFromOutput(
 		UHoudiniOutput* InOutput,
@@ -85,7 +87,8 @@ private:
 			FHoudiniHeightFieldPartData& Part,
 			UHoudiniAssetComponent& HAC,
 			FHoudiniClearedEditLayers& ClearedLayers,
-			const FHoudiniPackageParams& InPackageParams);
+			const FHoudiniPackageParams& InPackageParams,
+			FHoudiniEngineOutputStats* OutStats);
 };
 
 
@@ -43,6 +43,7 @@
 #include "PackageTools.h"
 #include "LandscapeSplineControlPoint.h"
 #include "LandscapeSplineSegment.h"
+#include "Async/ParallelFor.h"
 
 TSet<UHoudiniLandscapeTargetLayerOutput *>
 FHoudiniLandscapeUtils::GetEditLayers(UHoudiniOutput& Output)
@@ -1009,6 +1010,184 @@ FHoudiniHeightFieldData FHoudiniLandscapeUtils::FetchVolumeInUnrealSpace(
 	return Result;
 }
 
+// Reads the height field in bands of whole landscape component columns (a band is contiguous in the Houdini volume)
+// and calls ProcessBand on the values of each band, in Houdini order.
+static bool
+ForEachHeightFieldBand(
+	const FHoudiniGeoPartObject& HeightField,
+	const FHoudiniExtents& Extents,
+	int32 ComponentSizeQuads,
+	FHoudiniLandscapeMemoryCounter& InOutMemory,
+	TFunctionRef<bool(int32 BandStartX, int32 BandSizeX, const TArray<float>& BandValues)> ProcessBand)
+{
+	const FIntPoint Dimensions = FHoudiniLandscapeUtils::GetVolumeDimensionsInUnrealSpace(HeightField);
+	const int32 BandAlignment = FMath::Max(ComponentSizeQuads, 1);
+
+	int32 BandStartX = 0;
+	while (BandStartX < Dimensions.X)
+	{
+		// End each band on a component boundary of the target landscape
+		const int32 LandscapeX = Extents.Min.X + BandStartX;
+		const int32 OffsetInComponent = ((LandscapeX % BandAlignment) + BandAlignment) % BandAlignment;
+		const int32 BandSizeX = FMath::Min(BandAlignment - OffsetInComponent, Dimensions.X - BandStartX);
+		const int32 NumBandValues = BandSizeX * Dimensions.Y;
+
+		TArray<float> BandValues;
+		BandValues.SetNumUninitialized(NumBandValues);
+		InOutMemory.Add(BandValues.GetAllocatedSize());
+
+		const HAPI_Result Result = FHoudiniEngineUtils::HapiGetHeightFieldData(
+			HeightField.GeoId, HeightField.PartId, BandValues.GetData(), BandStartX * Dimensions.Y, NumBandValues);
+
+		const bool bSuccess = (Result == HAPI_RESULT_SUCCESS) && ProcessBand(BandStartX, BandSizeX, BandValues);
+
+		InOutMemory.Remove(BandValues.GetAllocatedSize());
+		if (!bSuccess)
+			return false;
+
+		BandStartX += BandSizeX;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniLandscapeUtils::StreamHeightFieldToHeightmap(
+	const FHoudiniGeoPartObject& HeightField,
+	ULandscapeInfo* LandscapeInfo,
+	const FHoudiniExtents& Extents,
+	int32 ComponentSizeQuads,
+	float ZeroPoint,
+	float Scale,
+	bool& bOutClamped,
+	FHoudiniLandscapeMemoryCounter& InOutMemory,
+	int32& OutNumTiles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniLandscapeUtils::StreamHeightFieldToHeightmap);
+
+	bOutClamped = false;
+	OutNumTiles = 0;
+	if (!LandscapeInfo)
+		return false;
+
+	const int32 SizeY = 1 + Extents.Max.Y - Extents.Min.Y;
+	FHeightmapAccessor<false> HeightMapAccessor(LandscapeInfo);
+
+	return ForEachHeightFieldBand(HeightField, Extents, ComponentSizeQuads, InOutMemory,
+		[&](int32 BandStartX, int32 BandSizeX, const TArray<float>& BandValues)
+	{
+		TArray<uint16> QuantizedData;
+		QuantizedData.SetNumUninitialized(BandSizeX * SizeY);
+		InOutMemory.Add(QuantizedData.GetAllocatedSize());
+
+		// Same conversion as RealignHeightFieldData(), ClampHeightFieldData() and QuantizeNormalizedDataTo16Bit(),
+		// transposing the values to Unreal's order, one landscape row per task.
+		TArray<bool> RowClamped;
+		RowClamped.SetNumZeroed(SizeY);
+		ParallelFor(SizeY, [&](int32 Y)
+		{
+			for (int32 X = 0; X < BandSizeX; X++)
+			{
+				const float Value = BandValues[Y + SizeY * X] * Scale + ZeroPoint;
+				const float ClampedValue = FMath::Clamp(Value, 0.0f, 1.0f);
+				RowClamped[Y] |= (ClampedValue != Value);
+				QuantizedData[Y * BandSizeX + X] = FMath::Clamp<int>(static_cast<int>(ClampedValue * 65535), 0, 65535);
+			}
+		});
+
+		bOutClamped |= RowClamped.Contains(true);
+
+		HeightMapAccessor.SetData(
+			Extents.Min.X + BandStartX, Extents.Min.Y, Extents.Min.X + BandStartX + BandSizeX - 1, Extents.Max.Y,
+			QuantizedData.GetData());
+
+		InOutMemory.Remove(QuantizedData.GetAllocatedSize());
+		OutNumTiles++;
+		return true;
+	});
+}
+
+bool
+FHoudiniLandscapeUtils::StreamHeightFieldToAlphamap(
+	const FHoudiniGeoPartObject& HeightField,
+	ULandscapeInfo* LandscapeInfo,
+	ULandscapeLayerInfoObject* LayerInfo,
+	const FHoudiniExtents& Extents,
+	int32 ComponentSizeQuads,
+	bool bNormalize,
+	bool& bOutExceededRange,
+	FHoudiniLandscapeMemoryCounter& InOutMemory,
+	int32& OutNumTiles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniLandscapeUtils::StreamHeightFieldToAlphamap);
+
+	bOutExceededRange = false;
+	OutNumTiles = 0;
+	if (!LandscapeInfo || !LayerInfo)
+		return false;
+
+	const int32 SizeY = 1 + Extents.Max.Y - Extents.Min.Y;
+
+	// Normalizing needs the max value of the whole layer, so read it once before converting.
+	float MaxValue = 1.0f;
+	if (bNormalize)
+	{
+		bool bFirstBand = true;
+		bool bSuccess = ForEachHeightFieldBand(HeightField, Extents, ComponentSizeQuads, InOutMemory,
+			[&](int32 BandStartX, int32 BandSizeX, const TArray<float>& BandValues)
+		{
+			for (const float Value : BandValues)
+			{
+				MaxValue = bFirstBand ? Value : FMath::Max(MaxValue, Value);
+				bFirstBand = false;
+			}
+			return true;
+		});
+
+		if (!bSuccess)
+			return false;
+	}
+
+	FAlphamapAccessor<false, false> AlphaAccessor(LandscapeInfo, LayerInfo);
+
+	return ForEachHeightFieldBand(HeightField, Extents, ComponentSizeQuads, InOutMemory,
+		[&](int32 BandStartX, int32 BandSizeX, const TArray<float>& BandValues)
+	{
+		TArray<uint8> Values;
+		Values.SetNumUninitialized(BandSizeX * SizeY);
+		InOutMemory.Add(Values.GetAllocatedSize());
+
+		// Same conversion as NormalizePaintLayers(), values outside of [0, 1] are normalized or clamped.
+		TArray<bool> RowExceededRange;
+		RowExceededRange.SetNumZeroed(SizeY);
+		ParallelFor(SizeY, [&](int32 Y)
+		{
+			for (int32 X = 0; X < BandSizeX; X++)
+			{
+				float Value = BandValues[Y + SizeY * X];
+				RowExceededRange[Y] |= (Value > 1.0f);
+				if (bNormalize && MaxValue > 1.0f)
+					Value = Value < 0.0f ? 0.0f : Value / MaxValue;
+				else
+					Value = FMath::Clamp(Value, 0.0f, 1.0f);
+
+				Values[Y * BandSizeX + X] = static_cast<uint8>(Value * 255);
+			}
+		});
+
+		bOutExceededRange |= RowExceededRange.Contains(true);
+
+		AlphaAccessor.SetData(
+			Extents.Min.X + BandStartX, Extents.Min.Y, Extents.Min.X + BandStartX + BandSizeX - 1, Extents.Max.Y,
+			Values.GetData(),
+			ELandscapeLayerPaintingRestriction::None);
+
+		InOutMemory.Remove(Values.GetAllocatedSize());
+		OutNumTiles++;
+		return true;
+	});
+}
+
 FHoudiniHeightFieldData
 FHoudiniLandscapeUtils::ReDimensionLandscape(const FHoudiniHeightFieldData & HeightField, FIntPoint NewDimensions)
 {
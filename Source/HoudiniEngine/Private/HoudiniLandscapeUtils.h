@@ -88,6 +88,24 @@ struct FHoudiniHeightFieldData
 
 };
 
+// Keeps track of the height field data held in memory while translating a landscape output
+struct FHoudiniLandscapeMemoryCounter
+{
+    int64 CurrentBytes = 0;
+    int64 PeakBytes = 0;
+
+    void Add(int64 NumBytes)
+    {
+        CurrentBytes += NumBytes;
+        PeakBytes = FMath::Max(PeakBytes, CurrentBytes);
+    }
+
+    void Remove(int64 NumBytes)
+    {
+        CurrentBytes -= NumBytes;
+    }
+};
+
 struct FHoudiniTileInfo
 {
 	FIntPoint TileStart; // Position of this tile
@@ -297,6 +315,31 @@ struct HOUDINIENGINE_API FHoudiniLandscapeUtils
 
     static FIntPoint GetVolumeDimensionsInUnrealSpace(const FHoudiniGeoPartObject& HeightField);
 
+    // Streaming alternatives to FetchVolumeInUnrealSpace() for large height fields: the volume is read in bands aligned
+    // to the landscape's components, each band is converted (in parallel) and written to the landscape before the next
+    // one is read, so only one band is held in memory at a time.
+    static bool StreamHeightFieldToHeightmap(
+            const FHoudiniGeoPartObject& HeightField,
+            ULandscapeInfo* LandscapeInfo,
+            const FHoudiniExtents& Extents,
+            int32 ComponentSizeQuads,
+            float ZeroPoint,
+            float Scale,
+            bool& bOutClamped,
+            FHoudiniLandscapeMemoryCounter& InOutMemory,
+            int32& OutNumTiles);
+
+    static bool StreamHeightFieldToAlphamap(
+            const FHoudiniGeoPartObject& HeightField,
+            ULandscapeInfo* LandscapeInfo,
+            ULandscapeLayerInfoObject* LayerInfo,
+            const FHoudiniExtents& Extents,
+            int32 ComponentSizeQuads,
+            bool bNormalize,
+            bool& bOutExceededRange,
+            FHoudiniLandscapeMemoryCounter& InOutMemory,
+            int32& OutNumTiles);
+
     static FHoudiniHeightFieldData ReDimensionLandscape(const FHoudiniHeightFieldData& HeightField, FIntPoint NewDimensions);
     
     static FHoudiniMinMax GetHeightFieldRange(const FHoudiniHeightFieldData& HeightField);
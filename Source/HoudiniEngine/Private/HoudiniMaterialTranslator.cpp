@@ -60,6 +60,11 @@
 #endif
 #include "Engine/Texture2D.h"
 #include "Serialization/BufferWriter.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/Paths.h"
 
 #if WITH_EDITOR
 	#include "Factories/MaterialFactoryNew.h"
@@ -71,6 +76,26 @@ const int32 FHoudiniMaterialTranslator::MaterialExpressionNodeY = -150;
 const int32 FHoudiniMaterialTranslator::MaterialExpressionNodeStepX = 220;
 const int32 FHoudiniMaterialTranslator::MaterialExpressionNodeStepY = 220;
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCacheMaterialTextures(
+	TEXT("HoudiniEngine.CacheMaterialTextures"),
+	1,
+	TEXT("When enabled, textures generated from unchanged Houdini materials are reused instead of being rendered and extracted again on every cook.\n")
+	TEXT("0: Always render and extract the textures.\n")
+	TEXT("1: Reuse the textures of unchanged materials (default).\n")
+);
+
+namespace
+{
+	struct FHoudiniCachedTexture
+	{
+		uint32 ContentHash = 0;
+		TWeakObjectPtr<UTexture2D> Texture;
+	};
+
+	// Textures generated from material texture parameters, by FHoudiniTextureCacheKey::Id
+	TMap<FString, FHoudiniCachedTexture> HoudiniTextureCache;
+}
+
 
 // Helper to get StaticParameters from UMaterialInterface in <=5.1
 // This copied from 5.3's UMaterialInterface::GetStaticParameterValues() function
@@ -292,6 +317,10 @@ FHoudiniMaterialTranslator::CreateHoudiniMaterials(
 	// Empty returned materials.
 	OutMaterials.Empty();
 
+	// Render and extract all the textures again when forcing a full recook
+	if (bForceRecookAll)
+		FHoudiniMaterialTranslator::InvalidateTextureCache(InAssetId);
+
 	// Update context for generated materials (will trigger when object goes out of scope).
 	FMaterialUpdateContext MaterialUpdateContext;
 
@@ -1008,7 +1037,6 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	uint8 * MipData = Texture->Source.LockMip(0);
 
 	// Create base map.
-	uint8* DestPtr = nullptr;
 	uint32 SrcWidth = ImageInfo.xRes;
 	uint32 SrcHeight = ImageInfo.yRes;
 	const char * SrcData = &ImageBuffer[0];
@@ -1076,9 +1104,14 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 			break;
 	}
 
-	for (uint32 y = 0; y < SrcHeight; y++)
+	// Convert the rows in parallel, and see if there is an actual alpha value in the texture
+	// or if we can ignore the texture alpha
+	const bool bCopyAlpha = TextureParameters.bUseAlpha && PackOffset == 4;
+	FThreadSafeBool bHasAlphaValue = false;
+	ParallelFor((int32)SrcHeight, [&](int32 y)
 	{
-		DestPtr = &MipData[(SrcHeight - 1 - y) * SrcWidth * sizeof(FColor)];
+		uint8* DestPtr = &MipData[(SrcHeight - 1 - y) * SrcWidth * sizeof(FColor)];
+		bool bRowHasAlpha = false;
 
 		for (uint32 x = 0; x < SrcWidth; x++)
 		{
@@ -1088,33 +1121,21 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 			*DestPtr++ = *(uint8*)(SrcData + DataOffset + OffsetG); // G
 			*DestPtr++ = *(uint8*)(SrcData + DataOffset + OffsetR); // R
 
-			if (TextureParameters.bUseAlpha && PackOffset == 4)
-				*DestPtr++ = *(uint8*)(SrcData + DataOffset + OffsetA); // A
+			if (bCopyAlpha)
+			{
+				const uint8 Alpha = *(uint8*)(SrcData + DataOffset + OffsetA); // A
+				bRowHasAlpha |= (Alpha != 0xFF);
+				*DestPtr++ = Alpha;
+			}
 			else
-				*DestPtr++ = 0xFF;
-		}
-	}
-
-	bool bHasAlphaValue = false;
-	if (TextureParameters.bUseAlpha)
-	{
-		// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-		for (uint32 y = 0; y < SrcHeight; y++)
-		{
-			for (uint32 x = 0; x < SrcWidth; x++)
 			{
-				uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-				if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-				{
-					bHasAlphaValue = true;
-					break;
-				}
+				*DestPtr++ = 0xFF;
 			}
-
-			if (bHasAlphaValue)
-				break;
 		}
-	}
+
+		if (bRowHasAlpha)
+			bHasAlphaValue = true;
+	});
 
 	// Unlock the texture.
 	Texture->Source.UnlockMip(0);
@@ -1133,7 +1154,8 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	}
 	*/
 
-	Texture->PostEditChange();
+	// PostEditChange() is left to the callers, that call it once the texture has been assigned,
+	// so that the texture is only built once.
 
 	return Texture;
 }
@@ -1263,6 +1285,94 @@ FHoudiniMaterialTranslator::HapiGetImagePlanes(
 }
 
 
+UTexture2D*
+FHoudiniMaterialTranslator::FindCachedTexture(
+	const HAPI_NodeId& InAssetId,
+	const HAPI_MaterialInfo& InMaterialInfo,
+	const HAPI_ParmId& InTextureParmId,
+	const FString& InTextureType,
+	const FHoudiniPackageParams& InPackageParams,
+	FHoudiniTextureCacheKey& OutKey)
+{
+	OutKey = FHoudiniTextureCacheKey();
+
+	if (CVarHoudiniEngineCacheMaterialTextures.GetValueOnAnyThread() == 0)
+		return nullptr;
+
+	// Baked textures always go to new packages
+	if (InPackageParams.PackageMode == EPackageMode::Bake)
+		return nullptr;
+
+	// Get the value of the texture parameter
+	HAPI_ParmInfo TextureParmInfo;
+	FHoudiniApi::ParmInfo_Init(&TextureParmInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmInfo(
+		FHoudiniEngine::Get().GetSession(),
+		InMaterialInfo.nodeId, InTextureParmId, &TextureParmInfo))
+		return nullptr;
+
+	HAPI_StringHandle TextureParmValueSH = -1;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmStringValues(
+		FHoudiniEngine::Get().GetSession(),
+		InMaterialInfo.nodeId, true, &TextureParmValueSH, TextureParmInfo.stringValuesIndex, 1))
+		return nullptr;
+
+	FString TextureParmValue;
+	if (!FHoudiniEngineString::ToFString(TextureParmValueSH, TextureParmValue))
+		return nullptr;
+
+	FString MaterialPath;
+	FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, MaterialPath);
+
+	OutKey.Id = FString::Printf(TEXT("%d/%d/%d/%s"), InAssetId, InMaterialInfo.nodeId, InTextureParmId, *InTextureType);
+	OutKey.ContentHash = HashCombine(GetTypeHash(TextureParmValue), GetTypeHash(MaterialPath));
+
+	// Houdini doesn't flag the material as changed when a texture file it reads is modified on disk
+	if (!TextureParmValue.StartsWith(TEXT("op:")) && FPaths::FileExists(TextureParmValue))
+		OutKey.ContentHash = HashCombine(OutKey.ContentHash, GetTypeHash(IFileManager::Get().GetTimeStamp(*TextureParmValue)));
+
+	// The material has changed, its textures need to be rendered again
+	if (InMaterialInfo.hasChanged)
+		return nullptr;
+
+	const FHoudiniCachedTexture* CachedTexture = HoudiniTextureCache.Find(OutKey.Id);
+	if (!CachedTexture || CachedTexture->ContentHash != OutKey.ContentHash)
+		return nullptr;
+
+	UTexture2D* Texture = CachedTexture->Texture.Get();
+	if (!IsValid(Texture))
+		return nullptr;
+
+	// The temp folder could have been changed between cooks
+	if (!InPackageParams.HasMatchingPackageDirectories(Texture))
+		return nullptr;
+
+	return Texture;
+}
+
+void
+FHoudiniMaterialTranslator::CacheTexture(const FHoudiniTextureCacheKey& InKey, UTexture2D* InTexture)
+{
+	if (!InKey.IsValid() || !IsValid(InTexture))
+		return;
+
+	FHoudiniCachedTexture& CachedTexture = HoudiniTextureCache.FindOrAdd(InKey.Id);
+	CachedTexture.ContentHash = InKey.ContentHash;
+	CachedTexture.Texture = InTexture;
+}
+
+void
+FHoudiniMaterialTranslator::InvalidateTextureCache(const HAPI_NodeId& InAssetId)
+{
+	const FString AssetPrefix = FString::Printf(TEXT("%d/"), InAssetId);
+	for (auto Iter = HoudiniTextureCache.CreateIterator(); Iter; ++Iter)
+	{
+		if (Iter.Key().StartsWith(AssetPrefix) || !Iter.Value().Texture.IsValid())
+			Iter.RemoveCurrent();
+	}
+}
+
+
 UMaterialExpression *
 FHoudiniMaterialTranslator::MaterialLocateExpression(UMaterialExpression* Expression, UClass* ExpressionClass)
 {
@@ -1457,9 +1567,14 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 	{
 		TArray<char> ImageBuffer;
 
+		// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+		FHoudiniTextureCacheKey TextureCacheKey;
+		UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+			InAssetId, InMaterialInfo, ParmDiffuseTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE, InPackageParams, TextureCacheKey);
+
 		// Get image planes of diffuse map.
 		TArray<FString> DiffuseImagePlanes;
-		bool bFoundImagePlanes = FHoudiniMaterialTranslator::HapiGetImagePlanes(
+		bool bFoundImagePlanes = !CachedTexture && FHoudiniMaterialTranslator::HapiGetImagePlanes(
 			ParmDiffuseTextureId, InMaterialInfo, DiffuseImagePlanes);
 
 		HAPI_ImagePacking ImagePacking = HAPI_IMAGE_PACKING_UNKNOWN;
@@ -1490,21 +1605,28 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 		}
 
 		// Retrieve color plane.
-		if (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
+		if (CachedTexture || (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmDiffuseTextureId, InMaterialInfo, PlaneType,
-			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer)))
 		{
+			// Use the texture created from this image by a previous cook
+			if (CachedTexture)
+				TextureDiffuse = CachedTexture;
+
 			UPackage * TextureDiffusePackage = nullptr;
 			if (IsValid(TextureDiffuse))
 				TextureDiffusePackage = Cast<UPackage>(TextureDiffuse->GetOuter());
 
 			HAPI_ImageInfo ImageInfo;
 			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
+			if (!CachedTexture)
+			{
+				Result = FHoudiniApi::GetImageInfo(
+					FHoudiniEngine::Get().GetSession(),
+					InMaterialInfo.nodeId, &ImageInfo);
+			}
 
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 			{
 				// Create texture.
 				FString TextureDiffuseName;
@@ -1537,16 +1659,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing diffuse texture, or create new one.
-				TextureDiffuse = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureDiffuse,
-					ImageInfo,
-					TextureDiffusePackage,
-					TextureDiffuseName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-					NodePath);
+				if (!CachedTexture)
+				{
+					TextureDiffuse = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureDiffuse,
+						ImageInfo,
+						TextureDiffusePackage,
+						TextureDiffuseName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
+						NodePath);
+
+					FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureDiffuse);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureDiffuse->SetFlags(RF_Public | RF_Standalone);
@@ -1571,9 +1698,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				if (bCreatedNewTextureDiffuse)
 					FAssetRegistryModule::AssetCreated(TextureDiffuse);
 
-				TextureDiffuse->PreEditChange(nullptr);
-				TextureDiffuse->PostEditChange();
-				TextureDiffuse->MarkPackageDirty();
+				// The cached texture is already up to date
+				if (!CachedTexture)
+				{
+					TextureDiffuse->PreEditChange(nullptr);
+					TextureDiffuse->PostEditChange();
+					TextureDiffuse->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -1775,9 +1906,14 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 	{
 		TArray< char > ImageBuffer;
 
+		// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+		FHoudiniTextureCacheKey TextureCacheKey;
+		UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+			InAssetId, InMaterialInfo, ParmOpacityTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK, InPackageParams, TextureCacheKey);
+
 		// Get image planes of opacity map.
 		TArray< FString > OpacityImagePlanes;
-		bool bFoundImagePlanes = FHoudiniMaterialTranslator::HapiGetImagePlanes(
+		bool bFoundImagePlanes = !CachedTexture && FHoudiniMaterialTranslator::HapiGetImagePlanes(
 			ParmOpacityTextureId, InMaterialInfo, OpacityImagePlanes);
 
 		HAPI_ImagePacking ImagePacking = HAPI_IMAGE_PACKING_UNKNOWN;
@@ -1796,9 +1932,9 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 			bFoundImagePlanes = false;
 		}
 
-		if (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
+		if (CachedTexture || (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmOpacityTextureId, InMaterialInfo, PlaneType,
-			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer)))
 		{
 			// Locate sampling expression.
 			ExpressionTextureOpacitySample = Cast< UMaterialExpressionTextureSampleParameter2D >(
@@ -1809,16 +1945,23 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 			if (ExpressionTextureOpacitySample)
 				TextureOpacity = Cast< UTexture2D >(ExpressionTextureOpacitySample->Texture);
 
+			// Use the texture created from this image by a previous cook
+			if (CachedTexture)
+				TextureOpacity = CachedTexture;
+
 			UPackage * TextureOpacityPackage = nullptr;
 			if (TextureOpacity)
 				TextureOpacityPackage = Cast< UPackage >(TextureOpacity->GetOuter());
 
 			HAPI_ImageInfo ImageInfo;
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
+			if (!CachedTexture)
+			{
+				Result = FHoudiniApi::GetImageInfo(
+					FHoudiniEngine::Get().GetSession(),
+					InMaterialInfo.nodeId, &ImageInfo);
+			}
 
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 			{
 				// Create texture.
 				FString TextureOpacityName;
@@ -1851,16 +1994,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing opacity texture, or create new one.
-				TextureOpacity = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureOpacity,
-					ImageInfo,
-					TextureOpacityPackage, 
-					TextureOpacityName, 
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-					NodePath);
+				if (!CachedTexture)
+				{
+					TextureOpacity = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureOpacity,
+						ImageInfo,
+						TextureOpacityPackage, 
+						TextureOpacityName, 
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
+						NodePath);
+
+					FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureOpacity);
+				}
 
  				// if (BakeMode == EBakeMode::CookToTemp)
 				TextureOpacity->SetFlags(RF_Public | RF_Standalone);
@@ -1904,9 +2052,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				if (bCreatedNewTextureOpacity)
 					FAssetRegistryModule::AssetCreated(TextureOpacity);
 
-				TextureOpacity->PreEditChange(nullptr);
-				TextureOpacity->PostEditChange();
-				TextureOpacity->MarkPackageDirty();
+				// The cached texture is already up to date
+				if (!CachedTexture)
+				{
+					TextureOpacity->PreEditChange(nullptr);
+					TextureOpacity->PostEditChange();
+					TextureOpacity->MarkPackageDirty();
+				}
 
 				bExpressionCreated = true;
 			}
@@ -2218,7 +2370,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 			
 		// Retrieve color plane.
 		TArray<char> ImageBuffer;
-		if (FHoudiniMaterialTranslator::HapiExtractImage(
+
+		// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+		FHoudiniTextureCacheKey TextureCacheKey;
+		UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+			InAssetId, InMaterialInfo, ParmNormalTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, InPackageParams, TextureCacheKey);
+		if (CachedTexture || FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmNormalTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
 			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer))
 		{
@@ -2240,17 +2397,24 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				}
 			}
 
+			// Use the texture created from this image by a previous cook
+			if (CachedTexture)
+				TextureNormal = CachedTexture;
+
 			UPackage * TextureNormalPackage = nullptr;
 			if (TextureNormal)
 				TextureNormalPackage = Cast< UPackage >(TextureNormal->GetOuter());
 
 			HAPI_ImageInfo ImageInfo;
 			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
+			if (!CachedTexture)
+			{
+				Result = FHoudiniApi::GetImageInfo(
+					FHoudiniEngine::Get().GetSession(),
+					InMaterialInfo.nodeId, &ImageInfo);
+			}
 
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 			{
 				// Create texture.
 				FString TextureNormalName;
@@ -2283,16 +2447,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing normal texture, or create new one.
-				TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureNormal,
-					ImageInfo,
-					TextureNormalPackage,
-					TextureNormalName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_WorldNormalMap,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-					NodePath);
+				if (!CachedTexture)
+				{
+					TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureNormal,
+						ImageInfo,
+						TextureNormalPackage,
+						TextureNormalName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_WorldNormalMap,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
+						NodePath);
+
+					FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureNormal);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -2327,9 +2496,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				if (bCreatedNewTextureNormal)
 					FAssetRegistryModule::AssetCreated(TextureNormal);
 
-				TextureNormal->PreEditChange(nullptr);
-				TextureNormal->PostEditChange();
-				TextureNormal->MarkPackageDirty();
+				// The cached texture is already up to date
+				if (!CachedTexture)
+				{
+					TextureNormal->PreEditChange(nullptr);
+					TextureNormal->PostEditChange();
+					TextureNormal->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2376,8 +2549,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 			// Normal plane is available in diffuse map.
 			TArray<char> ImageBuffer;
 
+			// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+			FHoudiniTextureCacheKey TextureCacheKey;
+			UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+				InAssetId, InMaterialInfo, ParmDiffuseTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, InPackageParams, TextureCacheKey);
+
 			// Retrieve color plane - this will contain normal data.
-			if (FHoudiniMaterialTranslator::HapiExtractImage(
+			if (CachedTexture || FHoudiniMaterialTranslator::HapiExtractImage(
 				ParmDiffuseTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_NORMAL,
 				HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGB, true, ImageBuffer))
 			{
@@ -2399,16 +2577,23 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					}
 				}
 
+				// Use the texture created from this image by a previous cook
+				if (CachedTexture)
+					TextureNormal = CachedTexture;
+
 				UPackage* TextureNormalPackage = nullptr;
 				if (TextureNormal)
 					TextureNormalPackage = Cast<UPackage>(TextureNormal->GetOuter());
 
 				HAPI_ImageInfo ImageInfo;
 				FHoudiniApi::ImageInfo_Init(&ImageInfo);
-				Result = FHoudiniApi::GetImageInfo(
-					FHoudiniEngine::Get().GetSession(),	InMaterialInfo.nodeId, &ImageInfo);
+				if (!CachedTexture)
+				{
+					Result = FHoudiniApi::GetImageInfo(
+						FHoudiniEngine::Get().GetSession(),	InMaterialInfo.nodeId, &ImageInfo);
+				}
 
-				if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+				if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 				{
 					// Create texture.
 					FString TextureNormalName;
@@ -2441,16 +2626,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 					// Reuse existing normal texture, or create new one.
-					TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
-						TextureNormal, 
-						ImageInfo,
-						TextureNormalPackage, 
-						TextureNormalName,
-						ImageBuffer,
-						CreateTexture2DParameters,
-						TEXTUREGROUP_WorldNormalMap,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-						NodePath);
+					if (!CachedTexture)
+					{
+						TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
+							TextureNormal, 
+							ImageInfo,
+							TextureNormalPackage, 
+							TextureNormalName,
+							ImageBuffer,
+							CreateTexture2DParameters,
+							TEXTUREGROUP_WorldNormalMap,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
+							NodePath);
+
+						FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureNormal);
+					}
 
 					//if (BakeMode == EBakeMode::CookToTemp)
 					TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -2483,9 +2673,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					if (bCreatedNewTextureNormal)
 						FAssetRegistryModule::AssetCreated(TextureNormal);
 
-					TextureNormal->PreEditChange(nullptr);
-					TextureNormal->PostEditChange();
-					TextureNormal->MarkPackageDirty();
+					// The cached texture is already up to date
+					if (!CachedTexture)
+					{
+						TextureNormal->PreEditChange(nullptr);
+						TextureNormal->PostEditChange();
+						TextureNormal->MarkPackageDirty();
+					}
 
 					bExpressionCreated = true;
 				}
@@ -2570,8 +2764,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 	{
 		TArray<char> ImageBuffer;
 
+		// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+		FHoudiniTextureCacheKey TextureCacheKey;
+		UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+			InAssetId, InMaterialInfo, ParmSpecularTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR, InPackageParams, TextureCacheKey);
+
 		// Retrieve color plane.
-		if (FHoudiniMaterialTranslator::HapiExtractImage(
+		if (CachedTexture || FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmSpecularTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
 			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer))
 		{
@@ -2593,17 +2792,24 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				}
 			}
 
+			// Use the texture created from this image by a previous cook
+			if (CachedTexture)
+				TextureSpecular = CachedTexture;
+
 			UPackage * TextureSpecularPackage = nullptr;
 			if (TextureSpecular)
 				TextureSpecularPackage = Cast< UPackage >(TextureSpecular->GetOuter());
 
 			HAPI_ImageInfo ImageInfo;
 			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
+			if (!CachedTexture)
+			{
+				Result = FHoudiniApi::GetImageInfo(
+					FHoudiniEngine::Get().GetSession(),
+					InMaterialInfo.nodeId, &ImageInfo);
+			}
 
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 			{
 				// Create texture.
 				FString TextureSpecularName;
@@ -2636,16 +2842,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing specular texture, or create new one.
-				TextureSpecular = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureSpecular,
-					ImageInfo,
-					TextureSpecularPackage,
-					TextureSpecularName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-					NodePath);
+				if (!CachedTexture)
+				{
+					TextureSpecular = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureSpecular,
+						ImageInfo,
+						TextureSpecularPackage,
+						TextureSpecularName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
+						NodePath);
+
+					FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureSpecular);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureSpecular->SetFlags(RF_Public | RF_Standalone);
@@ -2679,9 +2890,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				if (bCreatedNewTextureSpecular)
 					FAssetRegistryModule::AssetCreated(TextureSpecular);
 
-				TextureSpecular->PreEditChange(nullptr);
-				TextureSpecular->PostEditChange();
-				TextureSpecular->MarkPackageDirty();
+				// The cached texture is already up to date
+				if (!CachedTexture)
+				{
+					TextureSpecular->PreEditChange(nullptr);
+					TextureSpecular->PostEditChange();
+					TextureSpecular->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2829,8 +3044,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 	if (ParmRoughnessTextureId >= 0)
 	{
 		TArray<char> ImageBuffer;
+
+		// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+		FHoudiniTextureCacheKey TextureCacheKey;
+		UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+			InAssetId, InMaterialInfo, ParmRoughnessTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS, InPackageParams, TextureCacheKey);
 		// Retrieve color plane.
-		if (FHoudiniMaterialTranslator::HapiExtractImage(
+		if (CachedTexture || FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmRoughnessTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
 			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer ) )
 		{
@@ -2852,17 +3072,24 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				}
 			}
 
+			// Use the texture created from this image by a previous cook
+			if (CachedTexture)
+				TextureRoughness = CachedTexture;
+
 			UPackage * TextureRoughnessPackage = nullptr;
 			if (TextureRoughness)
 				TextureRoughnessPackage = Cast< UPackage >(TextureRoughness->GetOuter());
 
 			HAPI_ImageInfo ImageInfo;
 			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
+			if (!CachedTexture)
+			{
+				Result = FHoudiniApi::GetImageInfo(
+					FHoudiniEngine::Get().GetSession(),
+					InMaterialInfo.nodeId, &ImageInfo);
+			}
 
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 			{
 				// Create texture.
 				FString TextureRoughnessName;
@@ -2895,16 +3122,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing roughness texture, or create new one.
-				TextureRoughness = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureRoughness,
-					ImageInfo,
-					TextureRoughnessPackage,
-					TextureRoughnessName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-					NodePath);
+				if (!CachedTexture)
+				{
+					TextureRoughness = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureRoughness,
+						ImageInfo,
+						TextureRoughnessPackage,
+						TextureRoughnessName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
+						NodePath);
+
+					FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureRoughness);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureRoughness->SetFlags(RF_Public | RF_Standalone);
@@ -2936,9 +3168,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				if (bCreatedNewTextureRoughness)
 					FAssetRegistryModule::AssetCreated(TextureRoughness);
 
-				TextureRoughness->PreEditChange(nullptr);
-				TextureRoughness->PostEditChange();
-				TextureRoughness->MarkPackageDirty();
+				// The cached texture is already up to date
+				if (!CachedTexture)
+				{
+					TextureRoughness->PreEditChange(nullptr);
+					TextureRoughness->PostEditChange();
+					TextureRoughness->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -3089,8 +3325,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 	{
 		TArray<char> ImageBuffer;
 
+		// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+		FHoudiniTextureCacheKey TextureCacheKey;
+		UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+			InAssetId, InMaterialInfo, ParmMetallicTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC, InPackageParams, TextureCacheKey);
+
 		// Retrieve color plane.
-		if (FHoudiniMaterialTranslator::HapiExtractImage(
+		if (CachedTexture || FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmMetallicTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
 			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer))
 		{
@@ -3112,17 +3353,24 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				}
 			}
 
+			// Use the texture created from this image by a previous cook
+			if (CachedTexture)
+				TextureMetallic = CachedTexture;
+
 			UPackage * TextureMetallicPackage = nullptr;
 			if (TextureMetallic)
 				TextureMetallicPackage = Cast< UPackage >(TextureMetallic->GetOuter());
 
 			HAPI_ImageInfo ImageInfo;
 			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
+			if (!CachedTexture)
+			{
+				Result = FHoudiniApi::GetImageInfo(
+					FHoudiniEngine::Get().GetSession(),
+					InMaterialInfo.nodeId, &ImageInfo);
+			}
 
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 			{
 				// Create texture.
 				FString TextureMetallicName;
@@ -3156,16 +3404,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing metallic texture, or create new one.
-				TextureMetallic = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureMetallic, 
-					ImageInfo,
-					TextureMetallicPackage,
-					TextureMetallicName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-					NodePath);
+				if (!CachedTexture)
+				{
+					TextureMetallic = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureMetallic, 
+						ImageInfo,
+						TextureMetallicPackage,
+						TextureMetallicName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
+						NodePath);
+
+					FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureMetallic);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureMetallic->SetFlags(RF_Public | RF_Standalone);
@@ -3197,9 +3450,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				if (bCreatedNewTextureMetallic)
 					FAssetRegistryModule::AssetCreated(TextureMetallic);
 
-				TextureMetallic->PreEditChange(nullptr);
-				TextureMetallic->PostEditChange();
-				TextureMetallic->MarkPackageDirty();
+				// The cached texture is already up to date
+				if (!CachedTexture)
+				{
+					TextureMetallic->PreEditChange(nullptr);
+					TextureMetallic->PostEditChange();
+					TextureMetallic->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -3443,9 +3700,14 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 	{
 		TArray<char> ImageBuffer;
 
+		// Reuse the texture created by a previous cook if the material and its texture parameter haven't changed
+		FHoudiniTextureCacheKey TextureCacheKey;
+		UTexture2D* CachedTexture = FHoudiniMaterialTranslator::FindCachedTexture(
+			InAssetId, InMaterialInfo, ParmEmissiveTextureId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE, InPackageParams, TextureCacheKey);
+
 		// Get image planes of the emissive map.
 		TArray<FString> EmissiveImagePlanes;
-		bool bFoundImagePlanes = FHoudiniMaterialTranslator::HapiGetImagePlanes(
+		bool bFoundImagePlanes = !CachedTexture && FHoudiniMaterialTranslator::HapiGetImagePlanes(
 			ParmEmissiveTextureId, InMaterialInfo, EmissiveImagePlanes);
 
 		HAPI_ImagePacking ImagePacking = HAPI_IMAGE_PACKING_UNKNOWN;
@@ -3476,21 +3738,28 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 		}
 
 		// Retrieve color plane.
-		if (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
+		if (CachedTexture || (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmEmissiveTextureId, InMaterialInfo, PlaneType,
-			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer)))
 		{
+			// Use the texture created from this image by a previous cook
+			if (CachedTexture)
+				TextureEmissive = CachedTexture;
+
 			UPackage* TextureEmissivePackage = nullptr;
 			if (IsValid(TextureEmissive))
 				TextureEmissivePackage = Cast<UPackage>(TextureEmissive->GetOuter());
 
 			HAPI_ImageInfo ImageInfo;
 			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
+			if (!CachedTexture)
+			{
+				Result = FHoudiniApi::GetImageInfo(
+					FHoudiniEngine::Get().GetSession(),
+					InMaterialInfo.nodeId, &ImageInfo);
+			}
 
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (CachedTexture || (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0))
 			{
 				// Create texture.
 				FString TextureEmissiveName;
@@ -3523,16 +3792,21 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing emissive texture, or create new one.
-				TextureEmissive = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureEmissive,
-					ImageInfo,
-					TextureEmissivePackage,
-					TextureEmissiveName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-					NodePath);
+				if (!CachedTexture)
+				{
+					TextureEmissive = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureEmissive,
+						ImageInfo,
+						TextureEmissivePackage,
+						TextureEmissiveName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
+						NodePath);
+
+					FHoudiniMaterialTranslator::CacheTexture(TextureCacheKey, TextureEmissive);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureEmissive->SetFlags(RF_Public | RF_Standalone);
@@ -3557,9 +3831,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				if (bCreatedNewTextureEmissive)
 					FAssetRegistryModule::AssetCreated(TextureEmissive);
 
-				TextureEmissive->PreEditChange(nullptr);
-				TextureEmissive->PostEditChange();
-				TextureEmissive->MarkPackageDirty();
+				// The cached texture is already up to date
+				if (!CachedTexture)
+				{
+					TextureEmissive->PreEditChange(nullptr);
+					TextureEmissive->PostEditChange();
+					TextureEmissive->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
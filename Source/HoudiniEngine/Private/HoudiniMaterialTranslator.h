@@ -158,6 +158,17 @@ struct HOUDINIENGINE_API FHoudiniMaterialInfo
 	TMap<FName, FHoudiniMaterialParameterValue> MaterialInstanceParameters;
 };
 
+// Identifies a texture generated from a material's texture parameter, see FHoudiniMaterialTranslator::FindCachedTexture()
+struct HOUDINIENGINE_API FHoudiniTextureCacheKey
+{
+	// Asset, material node, texture parameter and texture type
+	FString Id;
+
+	// Hash of the parameter's value, the material's path and the file's timestamp for file textures
+	uint32 ContentHash = 0;
+
+	bool IsValid() const { return !Id.IsEmpty(); };
+};
 
 struct HOUDINIENGINE_API FHoudiniMaterialTranslator
 {
@@ -271,6 +282,22 @@ public:
 		const FString& TextureType,
 		const FString& NodePath);
 
+	// Returns the texture created from the given texture parameter by a previous cook, if the material
+	// hasn't changed since and the parameter's value is the same. OutKey is filled so the texture
+	// created when there is no cached texture can be added to the cache with CacheTexture().
+	static UTexture2D* FindCachedTexture(
+		const HAPI_NodeId& InAssetId,
+		const HAPI_MaterialInfo& InMaterialInfo,
+		const HAPI_ParmId& InTextureParmId,
+		const FString& InTextureType,
+		const FHoudiniPackageParams& InPackageParams,
+		FHoudiniTextureCacheKey& OutKey);
+
+	static void CacheTexture(const FHoudiniTextureCacheKey& InKey, UTexture2D* InTexture);
+
+	// Removes the textures generated by the given asset from the texture cache.
+	static void InvalidateTextureCache(const HAPI_NodeId& InAssetId);
+
 	// HAPI : Retrieve a list of image planes.
 	static bool HapiExtractImage(
 		const HAPI_ParmId& NodeParmId,
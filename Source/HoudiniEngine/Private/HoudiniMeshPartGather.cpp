@@ -0,0 +1,187 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniMeshPartGather.h"
+
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniMeshTranslator.h"
+
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineGatherMeshParts(
+	TEXT("HoudiniEngine.GatherMeshParts"),
+	1,
+	TEXT("When enabled, the HAPI data of the mesh parts of a cook is fetched in worker tasks before their meshes are created on the game thread.\n")
+	TEXT("0: Fetch each part's data on the game thread when translating it.\n")
+	TEXT("1: Gather the data of all the mesh parts in parallel (default).\n")
+);
+
+namespace
+{
+	// Innermost gather the mesh translator takes part data from
+	FHoudiniMeshPartGather* ActiveMeshPartGather = nullptr;
+}
+
+FHoudiniMeshPartGather::FHoudiniMeshPartGather()
+	: ActiveScope(ActiveMeshPartGather)
+	, bStarted(false)
+{
+	// Part data is only taken on the game thread, and when gathering hasn't been disabled
+	if (!IsInGameThread() || CVarHoudiniEngineGatherMeshParts.GetValueOnGameThread() == 0)
+		return;
+
+	ActiveScope.Activate(this);
+}
+
+FHoudiniMeshPartGather::~FHoudiniMeshPartGather()
+{
+	// The tasks write to the entries, wait for them before releasing them
+	for (TUniquePtr<FPartEntry>& CurrentPart : Parts)
+	{
+		if (CurrentPart->Task.IsValid())
+			CurrentPart->Task.Wait();
+	}
+
+	ActiveScope.Deactivate();
+}
+
+FHoudiniMeshPartGather*
+FHoudiniMeshPartGather::GetActive()
+{
+	return THoudiniScopedActiveInstance<FHoudiniMeshPartGather>::GetActive(ActiveMeshPartGather);
+}
+
+void
+FHoudiniMeshPartGather::AddPart(const FHoudiniGeoPartObject& InHGPO, const bool& bInFetchMeshData)
+{
+	if (!ActiveScope.IsActive() || bStarted)
+		return;
+
+	if (InHGPO.Type != EHoudiniPartType::Mesh)
+		return;
+
+	const TPair<HAPI_NodeId, HAPI_PartId> Key(InHGPO.GeoId, InHGPO.PartId);
+	if (const int32* FoundIndex = PartIndices.Find(Key))
+	{
+		Parts[*FoundIndex]->bFetchMeshData |= bInFetchMeshData;
+		return;
+	}
+
+	TUniquePtr<FPartEntry> NewPart = MakeUnique<FPartEntry>();
+	NewPart->HGPO = InHGPO;
+	NewPart->bFetchMeshData = bInFetchMeshData;
+
+	PartIndices.Add(Key, Parts.Num());
+	Parts.Add(MoveTemp(NewPart));
+}
+
+void
+FHoudiniMeshPartGather::Start()
+{
+	if (!ActiveScope.IsActive() || bStarted)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshPartGather::Start);
+
+	bStarted = true;
+
+	// Settings are read here, on the game thread
+	const bool bReadNormals = FHoudiniMeshTranslator::ShouldReadPartNormals();
+	const bool bReadTangents = FHoudiniMeshTranslator::ShouldReadPartTangents();
+
+	// The session index is per thread: the workers must use the session the outputs are being built from
+	const int32 SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+
+	for (TUniquePtr<FPartEntry>& CurrentPart : Parts)
+	{
+		FPartEntry* Entry = CurrentPart.Get();
+		Entry->Task = Async(EAsyncExecution::TaskGraph, [Entry, bReadNormals, bReadTangents, SessionIndex]()
+		{
+			FHoudiniEngineScopedSession SessionScope(SessionIndex);
+			FHoudiniMeshPartGather::GatherPart(*Entry, bReadNormals, bReadTangents);
+		});
+	}
+}
+
+bool
+FHoudiniMeshPartGather::TakePartData(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FHoudiniMeshPartData& OutData)
+{
+	if (!bStarted)
+		return false;
+
+	const int32* FoundIndex = PartIndices.Find(TPair<HAPI_NodeId, HAPI_PartId>(InGeoId, InPartId));
+	if (!FoundIndex)
+		return false;
+
+	FPartEntry& Entry = *Parts[*FoundIndex];
+	if (Entry.bTaken)
+		return false;
+
+	if (Entry.Task.IsValid())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshPartGather::WaitForPart);
+		Entry.Task.Wait();
+	}
+
+	OutData = MoveTemp(Entry.Data);
+	Entry.bTaken = true;
+
+	return true;
+}
+
+void
+FHoudiniMeshPartGather::GatherPart(FPartEntry& InOutEntry, const bool& bInReadNormals, const bool& bInReadTangents)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshPartGather::GatherPart);
+
+	const FHoudiniGeoPartObject& HGPO = InOutEntry.HGPO;
+	FHoudiniMeshPartData& Data = InOutEntry.Data;
+
+	if (InOutEntry.bFetchMeshData)
+	{
+		if (!FHoudiniMeshTranslator::FetchPartVertexList(HGPO, Data.VertexList))
+			Data.VertexList.Empty();
+
+		FHoudiniMeshTranslator::PrefetchPartAttributes(HGPO, bInReadNormals, bInReadTangents, Data.AttributeStore);
+	}
+
+	// The uproperty attributes of the outer component are read for every mesh part,
+	// from the prefetched attributes if we have them.
+	if (Data.AttributeStore.IsValid())
+	{
+		Data.bHasDetailPropertyAttributes = Data.AttributeStore.GetGenericPropertiesAttributes(
+			true, 0, 0, 0, Data.DetailPropertyAttributes);
+	}
+	else
+	{
+		Data.bHasDetailPropertyAttributes = FHoudiniEngineUtils::GetGenericPropertiesAttributes(
+			HGPO.GeoId, HGPO.PartId, true, 0, 0, 0, Data.DetailPropertyAttributes);
+	}
+}
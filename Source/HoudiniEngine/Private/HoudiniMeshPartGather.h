@@ -0,0 +1,112 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniGenericAttribute.h"
+#include "HoudiniGeoPartObject.h"
+#include "HoudiniPartAttributeStore.h"
+#include "HoudiniScopedActiveInstance.h"
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Templates/UniquePtr.h"
+
+// HAPI data of a mesh part, gathered before any UObject is created for it.
+struct HOUDINIENGINE_API FHoudiniMeshPartData
+{
+	// Vertex list of the part, empty if it hasn't been fetched.
+	TArray<int32> VertexList;
+
+	// Attributes prefetched for the part, invalid if they haven't been fetched.
+	FHoudiniPartAttributeStore AttributeStore;
+
+	// Detail uproperty attributes to update on the outer component.
+	TArray<FHoudiniGenericAttribute> DetailPropertyAttributes;
+	bool bHasDetailPropertyAttributes = false;
+};
+
+// Splits the translation of the mesh outputs of a cook in two phases: a "gather" phase, where
+// the vertex lists and attributes of the mesh parts are pulled from HAPI in worker tasks,
+// and a "commit" phase on the game thread, where the mesh translator only has to convert the
+// gathered data and create the packages, meshes and components.
+//
+// While a gather is in scope, it is the active gather: the mesh translator takes the data of
+// the part it is translating from it, waiting for that part's task if it hasn't finished yet,
+// and fetches the data itself for the parts that haven't been gathered.
+// Gathers can be nested, the innermost one is active.
+class HOUDINIENGINE_API FHoudiniMeshPartGather
+{
+public:
+
+	FHoudiniMeshPartGather();
+
+	// Waits for the remaining tasks.
+	~FHoudiniMeshPartGather();
+
+	// Returns the gather the mesh translator should take part data from, or null.
+	static FHoudiniMeshPartGather* GetActive();
+
+	// Adds a mesh part to gather. Its vertex list and attributes are only fetched if
+	// bInFetchMeshData is true, i.e. if the part's meshes are going to be rebuilt.
+	void AddPart(const FHoudiniGeoPartObject& InHGPO, const bool& bInFetchMeshData);
+
+	// Launches the tasks gathering the parts that have been added.
+	void Start();
+
+	// Waits for the given part to be gathered and moves its data to OutData.
+	// Returns false if the part hasn't been gathered, or if its data has already been taken.
+	bool TakePartData(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FHoudiniMeshPartData& OutData);
+
+	int32 GetNumParts() const { return Parts.Num(); };
+
+private:
+
+	FHoudiniMeshPartGather(const FHoudiniMeshPartGather&) = delete;
+	FHoudiniMeshPartGather& operator=(const FHoudiniMeshPartGather&) = delete;
+
+	struct FPartEntry
+	{
+		FHoudiniGeoPartObject HGPO;
+		bool bFetchMeshData = false;
+		bool bTaken = false;
+		FHoudiniMeshPartData Data;
+		TFuture<void> Task;
+	};
+
+	// Fetches the data of a part, runs in a worker task.
+	static void GatherPart(FPartEntry& InOutEntry, const bool& bInReadNormals, const bool& bInReadTangents);
+
+	// Entries are allocated individually as the tasks write to them
+	TArray<TUniquePtr<FPartEntry>> Parts;
+	TMap<TPair<HAPI_NodeId, HAPI_PartId>, int32> PartIndices;
+
+	// Makes this the active gather while it is in scope
+	THoudiniScopedActiveInstance<FHoudiniMeshPartGather> ActiveScope;
+
+	bool bStarted;
+};
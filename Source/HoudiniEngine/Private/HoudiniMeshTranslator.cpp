@@ -39,6 +39,7 @@
 #include "HoudiniInstanceTranslator.h"
 #include "HoudiniStaticMesh.h"
 #include "HoudiniStaticMeshComponent.h"
+#include "HoudiniStaticMeshBuildBatch.h"
 #include "HoudiniSkeletalMeshTranslator.h"
 
 #include "Engine/StaticMeshSocket.h"
@@ -63,10 +64,14 @@
 #include "Engine/SkeletalMesh.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineString.h" 
+#include "HoudiniPartAttributeStore.h"
+#include "HoudiniMeshPartGather.h"
 
 #include "Components/SkeletalMeshComponent.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeBool.h"
 
 #include "EditorSupportDelegates.h"
 #include "HoudiniGeometryCollectionTranslator.h"
@@ -87,6 +92,50 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+static TAutoConsoleVariable<float> CVarHoudiniEngineOrientedBoxCollisionFastMode(
+	TEXT("HoudiniEngine.OrientedBoxCollisionFastMode"),
+	0.0f,
+	TEXT("Angle step, in degrees, used to approximate the minimum volume box of the box colliders.\n")
+	TEXT("The volume of the approximate box is at most (A + E) * (B + E) * (C + E), A, B and C being the edges of the\n")
+	TEXT("minimum volume box, E = sqrt(2) * sin(1.5 * step) * D and D the diameter of the collider's points\n")
+	TEXT("(E is about 0.37 * D for a 10 degree step). The edges of the approximate box are not bounded individually.\n")
+	TEXT("0: Compute the exact minimum volume box (default).\n")
+);
+
+namespace
+{
+	// Appends the colliders generated for a split to an aggregate
+	void
+	AppendAggregateGeom(const FKAggregateGeom& InAggregateGeom, FKAggregateGeom& OutAggregateGeom)
+	{
+		OutAggregateGeom.SphereElems.Append(InAggregateGeom.SphereElems);
+		OutAggregateGeom.BoxElems.Append(InAggregateGeom.BoxElems);
+		OutAggregateGeom.SphylElems.Append(InAggregateGeom.SphylElems);
+		OutAggregateGeom.ConvexElems.Append(InAggregateGeom.ConvexElems);
+	}
+
+	// Simple colliders that can be fitted without creating UObjects (unlike the k-DOPs)
+	bool
+	CanFitSimpleCollisionInParallel(const FString& InSplitGroupName)
+	{
+		return InSplitGroupName.Contains("Box") || InSplitGroupName.Contains("Sphere") || InSplitGroupName.Contains("Capsule");
+	}
+
+	// UCX colliders that can be fitted without creating UObjects (unlike the multi-hull decompositions)
+	bool
+	CanFitConvexCollisionInParallel(const FString& InSplitGroupName)
+	{
+#if WITH_EDITOR
+		return !InSplitGroupName.Contains(TEXT("ucx_multi"), ESearchCase::IgnoreCase);
+#else
+		return true;
+#endif
+	}
+}
+
+// Number of vertices / triangles transferred per task when filling a UHoudiniStaticMesh.
+static const int32 HoudiniStaticMeshTransferChunkSize = 16384;
+
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	UHoudiniOutput* InOutput, 
@@ -121,6 +170,9 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 		InForceRebuild = true;
 	}
 
+	// Part data that has been gathered in worker tasks, if any
+	FHoudiniMeshPartGather* PartGather = FHoudiniMeshPartGather::GetActive();
+
 	// Iterate on all of the output's HGPO, creating meshes as we go
 	for (const FHoudiniGeoPartObject& CurHGPO : InOutput->HoudiniGeoPartObjects)
 	{
@@ -128,13 +180,27 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 		if (CurHGPO.Type != EHoudiniPartType::Mesh)
 			continue;
 
+		FHoudiniMeshPartData GatheredPartData;
+		const bool bHasGatheredPartData = PartGather && PartGather->TakePartData(CurHGPO.GeoId, CurHGPO.PartId, GatheredPartData);
+
 		// See if we have some uproperty attributes to update on 
 		// the outer component (in most case, the HAC)
 		TArray<FHoudiniGenericAttribute> PropertyAttributes;
-		if (FHoudiniEngineUtils::GetGenericPropertiesAttributes(
-			CurHGPO.GeoId, CurHGPO.PartId,
-			true, 0, 0, 0,
-			PropertyAttributes))
+		bool bHasPropertyAttributes = false;
+		if (bHasGatheredPartData)
+		{
+			PropertyAttributes = MoveTemp(GatheredPartData.DetailPropertyAttributes);
+			bHasPropertyAttributes = GatheredPartData.bHasDetailPropertyAttributes;
+		}
+		else
+		{
+			bHasPropertyAttributes = FHoudiniEngineUtils::GetGenericPropertiesAttributes(
+				CurHGPO.GeoId, CurHGPO.PartId,
+				true, 0, 0, 0,
+				PropertyAttributes);
+		}
+
+		if (bHasPropertyAttributes)
 		{
 			FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(
 				InOuterComponent, PropertyAttributes);
@@ -154,7 +220,28 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 			bSplitMeshSupport,
 			InSMGenerationProperties,
 			InMeshBuildSettings,
-			bInTreatExistingMaterialsAsUpToDate);
+			bInTreatExistingMaterialsAsUpToDate,
+			bHasGatheredPartData ? &GatheredPartData : nullptr);
+	}
+
+	// If the meshes are being built in a batch, assign the components once they are built
+	if (FHoudiniStaticMeshBuildBatch* BuildBatch = FHoudiniStaticMeshBuildBatch::GetActive())
+	{
+		TWeakObjectPtr<UHoudiniOutput> WeakOutput = InOutput;
+		TWeakObjectPtr<UObject> WeakOuterComponent = InOuterComponent;
+		BuildBatch->AddCompletion([WeakOutput, WeakOuterComponent, NewOutputObjects = MoveTemp(NewOutputObjects), bInDestroyProxies]() mutable
+		{
+			if (!WeakOutput.IsValid() || !WeakOuterComponent.IsValid())
+				return;
+
+			FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
+				WeakOutput.Get(),
+				WeakOuterComponent.Get(),
+				NewOutputObjects,
+				bInDestroyProxies);
+		});
+
+		return true;
 	}
 
 	return FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
@@ -698,7 +785,8 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	bool bSplitMeshSupport,
 	const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 	const FMeshBuildSettings& InSMBuildSettings,
-	bool bInTreatExistingMaterialsAsUpToDate)
+	bool bInTreatExistingMaterialsAsUpToDate,
+	FHoudiniMeshPartData* InGatheredPartData)
 {
 	// If we're not forcing the rebuild
 	// No need to recreate something that hasn't changed
@@ -748,6 +836,7 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	CurrentTranslator.SetStaticMeshGenerationProperties(InSMGenerationProperties);
 	CurrentTranslator.SetStaticMeshBuildSettings(InSMBuildSettings);
 	CurrentTranslator.SetOuterComponent(InOuterComponent);
+	CurrentTranslator.GatheredPartData = InGatheredPartData;
 
 	// TODO: Fetch from settings/HAC
 	CurrentTranslator.DefaultMeshSmoothing = 1;
@@ -792,17 +881,35 @@ FHoudiniMeshTranslator::UpdatePartVertexList()
 	if (HGPO.PartInfo.VertexCount <= 0)
 		return false;
 
+	// Use the vertex list gathered ahead of the translation if we have it
+	if (GatheredPartData && GatheredPartData->VertexList.Num() == HGPO.PartInfo.VertexCount)
+	{
+		PartVertexList = MoveTemp(GatheredPartData->VertexList);
+		return true;
+	}
+
+	return FetchPartVertexList(HGPO, PartVertexList);
+}
+
+bool
+FHoudiniMeshTranslator::FetchPartVertexList(const FHoudiniGeoPartObject& InHGPO, TArray<int32>& OutVertexList)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::FetchPartVertexList"));
+
+	if (InHGPO.PartInfo.VertexCount <= 0)
+		return false;
+
 	// Get the vertex List
-	PartVertexList.SetNumUninitialized(HGPO.PartInfo.VertexCount);
+	OutVertexList.SetNumUninitialized(InHGPO.PartInfo.VertexCount);
 
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVertexList(
 		FHoudiniEngine::Get().GetSession(),
-		HGPO.GeoId, HGPO.PartId, &PartVertexList[0], 0, HGPO.PartInfo.VertexCount))
+		InHGPO.GeoId, InHGPO.PartId, &OutVertexList[0], 0, InHGPO.PartInfo.VertexCount))
 	{
 		// Error getting the vertex list.
 		HOUDINI_LOG_MESSAGE(
 			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve vertex list - skipping."),
-			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
+			InHGPO.ObjectId, *InHGPO.ObjectName, InHGPO.GeoId, InHGPO.PartId, *InHGPO.PartName);
 
 		return false;
 	}
@@ -1079,6 +1186,93 @@ FHoudiniMeshTranslator::ResetPartCache()
 	// LOD Screensize
 	PartLODScreensize.Empty();
 	FHoudiniApi::AttributeInfo_Init(&AttribInfoLODScreensize);
+
+	// Prefetched attributes
+	PartAttributeStore.Reset();
+}
+
+bool
+FHoudiniMeshTranslator::PrefetchPartAttributes()
+{
+	// Use the attributes gathered ahead of the translation if we have them
+	if (GatheredPartData && GatheredPartData->AttributeStore.IsValid())
+	{
+		PartAttributeStore = MoveTemp(GatheredPartData->AttributeStore);
+		GatheredPartData->AttributeStore.Reset();
+		return true;
+	}
+
+	return PrefetchPartAttributes(HGPO, ShouldReadPartNormals(), ShouldReadPartTangents(), PartAttributeStore);
+}
+
+bool
+FHoudiniMeshTranslator::ShouldReadPartNormals()
+{
+	// No need to read the normals if we want unreal to recompute them
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	return !HoudiniRuntimeSettings || HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
+}
+
+bool
+FHoudiniMeshTranslator::ShouldReadPartTangents()
+{
+	// No need to read the tangents if we want unreal to recompute them
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	return !HoudiniRuntimeSettings || HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
+}
+
+bool
+FHoudiniMeshTranslator::PrefetchPartAttributes(
+	const FHoudiniGeoPartObject& InHGPO,
+	const bool& bInReadNormals,
+	const bool& bInReadTangents,
+	FHoudiniPartAttributeStore& OutAttributeStore)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::PrefetchPartAttributes"));
+
+	// Enumerate the part's attributes once and fetch everything the Update*IfNeeded functions
+	// and the generic property attributes will need, so missing attributes cost no HAPI calls
+	// and splits don't have to refetch the uproperty attributes.
+	TArray<const char*> FloatAttributes = {
+		HAPI_UNREAL_ATTRIB_POSITION,
+		HAPI_UNREAL_ATTRIB_COLOR,
+		HAPI_UNREAL_ATTRIB_ALPHA,
+		HAPI_UNREAL_ATTRIB_LOD_SCREENSIZE };
+
+	if (bInReadNormals)
+		FloatAttributes.Add(HAPI_UNREAL_ATTRIB_NORMAL);
+
+	if (bInReadTangents)
+	{
+		FloatAttributes.Add(HAPI_UNREAL_ATTRIB_TANGENTU);
+		FloatAttributes.Add(HAPI_UNREAL_ATTRIB_TANGENTV);
+	}
+
+	// The uv sets: uv, then uv1 or uv2 onwards (see FHoudiniEngineUtils::UpdateMeshPartUVSets)
+	static const char* UVSetAttributes[] = { "uv1", "uv2", "uv3", "uv4", "uv5", "uv6", "uv7", "uv8" };
+	FloatAttributes.Add(HAPI_UNREAL_ATTRIB_UV);
+	FloatAttributes.Append(UVSetAttributes, UE_ARRAY_COUNT(UVSetAttributes));
+
+	const TArray<const char*> IntAttributes = {
+		HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK,
+		HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION };
+
+	const TArray<const char*> StringAttributes = {
+		HAPI_UNREAL_ATTRIB_MATERIAL,
+		HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE,
+		HAPI_UNREAL_ATTRIB_MATERIAL_FALLBACK };
+
+	const TArray<FString> GenericPrefixes = { TEXT(HAPI_UNREAL_ATTRIB_GENERIC_UPROP_PREFIX) };
+
+	if (!OutAttributeStore.Prefetch(InHGPO.GeoId, InHGPO.PartId, FloatAttributes, IntAttributes, StringAttributes, GenericPrefixes))
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], unable to prefetch attributes, fetching them individually."),
+			InHGPO.ObjectId, *InHGPO.ObjectName, InHGPO.GeoId, InHGPO.PartId, *InHGPO.PartName);
+		return false;
+	}
+
+	return true;
 }
 
 bool
@@ -1090,12 +1284,11 @@ FHoudiniMeshTranslator::UpdatePartPositionIfNeeded()
 	if (PartPositions.Num() > 0)
 		return true;
 
-	if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId,
-		HGPO.PartInfo.PartId,
+	if (!PartAttributeStore.GetAttributeDataAsFloat(
 		HAPI_UNREAL_ATTRIB_POSITION,
 		AttribInfoPositions,
-		PartPositions))
+		PartPositions,
+		true))
 	{
 		// Error retrieving positions.
 		HOUDINI_LOG_WARNING(
@@ -1123,12 +1316,11 @@ FHoudiniMeshTranslator::UpdatePartNormalsIfNeeded()
 		return true;
 
 	// Retrieve normal data for this part
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId,
-		HGPO.PartInfo.PartId,
+	bool Success = PartAttributeStore.GetAttributeDataAsFloat(
 		HAPI_UNREAL_ATTRIB_NORMAL,
 		AttribInfoNormals,
-		PartNormals);
+		PartNormals,
+		true);
 
 	// There is no normals to fetch
 	if (!AttribInfoNormals.exists)
@@ -1155,12 +1347,11 @@ FHoudiniMeshTranslator::UpdatePartTangentsIfNeeded()
 	if (PartTangentU.Num() <= 0)
 	{
 		// Retrieve TangentU data for this part
-		bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-			HGPO.GeoInfo.NodeId,
-			HGPO.PartInfo.PartId,
+		bool Success = PartAttributeStore.GetAttributeDataAsFloat(
 			HAPI_UNREAL_ATTRIB_TANGENTU,
 			AttribInfoTangentU,
-			PartTangentU);
+			PartTangentU,
+			true);
 		
 		if (!Success && AttribInfoTangentU.exists)
 		{
@@ -1175,12 +1366,11 @@ FHoudiniMeshTranslator::UpdatePartTangentsIfNeeded()
 	if (PartTangentV.Num() <= 0)
 	{
 		// Retrieve TangentV data for this part
-		bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-			HGPO.GeoInfo.NodeId,
-			HGPO.PartInfo.PartId,
+		bool Success = PartAttributeStore.GetAttributeDataAsFloat(
 			HAPI_UNREAL_ATTRIB_TANGENTV,
 			AttribInfoTangentV,
-			PartTangentV);
+			PartTangentV,
+			true);
 
 		if (!Success && AttribInfoTangentV.exists)
 		{
@@ -1204,9 +1394,8 @@ FHoudiniMeshTranslator::UpdatePartColorsIfNeeded()
 	if (PartColors.Num() > 0)
 		return true;
 
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-		HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors);
+	bool Success = PartAttributeStore.GetAttributeDataAsFloat(
+		HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors, true);
 
 	if (!Success && AttribInfoColors.exists)
 	{
@@ -1229,9 +1418,8 @@ FHoudiniMeshTranslator::UpdatePartAlphasIfNeeded()
 	if (PartAlphas.Num() > 0)
 		return true;
 
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-		HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas);
+	bool Success = PartAttributeStore.GetAttributeDataAsFloat(
+		HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas, true);
 
 	if (!Success && AttribInfoAlpha.exists)
 	{
@@ -1252,10 +1440,9 @@ FHoudiniMeshTranslator::UpdatePartFaceSmoothingIfNeeded()
 	if (PartFaceSmoothingMasks.Num() > 0)
 		return true;
 
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+	bool Success = PartAttributeStore.GetAttributeDataAsInteger(
 		HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK,
-		AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks);
+		AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks, true);
 
 	if (!Success && AttribInfoFaceSmoothingMasks.exists)
 	{
@@ -1274,7 +1461,8 @@ FHoudiniMeshTranslator::UpdatePartUVSetsIfNeeded(const bool& bRemoveUnused)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::UpdatePartUVSetsIfNeeded"));
 
-	FHoudiniEngineUtils::UpdateMeshPartUVSets(HGPO.GeoId, HGPO.PartId, bRemoveUnused, PartUVSets, AttribInfoUVSets);
+	FHoudiniEngineUtils::UpdateMeshPartUVSets(
+		HGPO.GeoId, HGPO.PartId, bRemoveUnused, PartUVSets, AttribInfoUVSets, &PartAttributeStore);
 
 	return true;
 }
@@ -1287,10 +1475,9 @@ FHoudiniMeshTranslator::UpdatePartLightmapResolutionsIfNeeded()
 		return true;
 
 	// Get lightmap resolution (if present).
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+	bool Success = PartAttributeStore.GetAttributeDataAsInteger(
 		HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION, 
-		AttribInfoLightmapResolution, PartLightMapResolutions);
+		AttribInfoLightmapResolution, PartLightMapResolutions, true);
 
 	if (!Success && AttribInfoLightmapResolution.exists)
 	{
@@ -1356,8 +1543,7 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 	HAPI_AttributeInfo AttribInfoFaceMaterialOverrides;
 	FHoudiniApi::AttributeInfo_Init(&AttribInfoFaceMaterialOverrides);
 	
-	FHoudiniEngineUtils::HapiGetAttributeDataAsString(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+	PartAttributeStore.GetAttributeDataAsString(
 		HAPI_UNREAL_ATTRIB_MATERIAL,
 		AttribInfoFaceMaterialOverrides, MaterialOverrides);
 	bool bMaterialAttributeExists = AttribInfoFaceMaterialOverrides.exists;
@@ -1371,8 +1557,7 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 	}
 
 	// If material attribute and fallbacks were not found, check the material instance attribute.
-	FHoudiniEngineUtils::HapiGetAttributeDataAsString(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+	PartAttributeStore.GetAttributeDataAsString(
 		HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE,
 		AttribInfoFaceMaterialOverrides, MaterialInstanceOverrides);
 	bool bMaterialInstanceAttributeExists = AttribInfoFaceMaterialOverrides.exists;
@@ -1389,8 +1574,7 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 	if ((!bMaterialAttributeExists && !bMaterialInstanceAttributeExists) || (MaterialOverrides.Num() == 0 && MaterialInstanceOverrides.Num() == 0))
 	{
 		PartFaceMaterialOverrides.Empty();
-		FHoudiniEngineUtils::HapiGetAttributeDataAsString(
-			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+		PartAttributeStore.GetAttributeDataAsString(
 			HAPI_UNREAL_ATTRIB_MATERIAL_FALLBACK,
 			AttribInfoFaceMaterialOverrides, MaterialOverrides);
 		bMaterialAttributeExists = AttribInfoFaceMaterialOverrides.exists;
@@ -1563,10 +1747,9 @@ FHoudiniMeshTranslator::UpdatePartLODScreensizeIfNeeded()
 	if (PartLODScreensize.Num() > 0)
 		return true;
 
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+	bool Success = PartAttributeStore.GetAttributeDataAsFloat(
 		HAPI_UNREAL_ATTRIB_LOD_SCREENSIZE,
-		AttribInfoLODScreensize, PartLODScreensize);
+		AttribInfoLODScreensize, PartLODScreensize, true);
 
 	if (!Success && AttribInfoLODScreensize.exists)
 	{
@@ -1919,6 +2102,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 	// Resets the containers used for the raw data extraction.
 	ResetPartCache();
 
+	// Fetch the attributes needed for this part
+	PrefetchPartAttributes();
+
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
 
@@ -1990,6 +2176,22 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 	// Map of object identifiers to package params
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniPackageParams> ObjectIdentifiersToPackageParams;
 
+	// Fit the UCX and simple colliders of all the splits in parallel before creating the meshes
+	{
+		TArray<FString> ConvexSplitGroups;
+		TArray<FString> SimpleSplitGroups;
+		for (const FString& SplitGroupName : AllSplitGroups)
+		{
+			const EHoudiniSplitType SplitType = GetSplitTypeFromSplitName(SplitGroupName);
+			if (SplitType == EHoudiniSplitType::InvisibleUCXCollider || SplitType == EHoudiniSplitType::RenderedUCXCollider)
+				ConvexSplitGroups.Add(SplitGroupName);
+			else if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider || SplitType == EHoudiniSplitType::RenderedSimpleCollider)
+				SimpleSplitGroups.Add(SplitGroupName);
+		}
+
+		FitCollisionsInParallel(ConvexSplitGroups, SimpleSplitGroups);
+	}
+
 	// Iterate through all detected split groups we care about and split geometry.
 	// The split are ordered in the following way:
 	// Invisible Simple/Convex Colliders > LODs > MainGeo > Visible Colliders > Invisible Colliders
@@ -3107,8 +3309,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 
 		// Update property attributes on the source model
 		TArray<FHoudiniGenericAttribute> PropertyAttributes;
-		if (FHoudiniEngineUtils::GetGenericPropertiesAttributes(
-			HGPO.GeoId, HGPO.PartId,
+		if (PartAttributeStore.GetGenericPropertiesAttributes(
 			true,
 			OutputObjectIdentifier.PrimitiveIndex,
 			INDEX_NONE,
@@ -3378,45 +3579,17 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		}
 
 		// BUILD the Static Mesh
-		// bSilent doesnt add the Build Errors...
+		// When a build batch is active (cooks), the build and its post build steps are
+		// deferred so that all the meshes of the cook are built together.
 		double build_start = FPlatformTime::Seconds();
-		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);
+		FHoudiniStaticMeshBuildBatch::BuildOrDefer(SM);
+
 		if (bDoTiming)
 		{
 			tick = FPlatformTime::Seconds();
 			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_RawMesh() - StaticMesh->Build() executed in %f seconds."), tick - build_start);
 		}
 
-		// This replaces the call to RefreshCollision below, but without CreateNavCollision
-		// as it is already called by UStaticMesh::PostBuildInternal as part of the ::Build call,
-		// and can be expensive depending on the vert/poly count of the mesh
-		// RefreshCollisionChange(*SM);
-		{
-			for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-			{
-				UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-				if (StaticMeshComponent->GetStaticMesh() == SM)
-				{
-					// it needs to recreate IF it already has been created
-					if (StaticMeshComponent->IsPhysicsStateCreated())
-					{
-						StaticMeshComponent->RecreatePhysicsState();
-					}
-				}
-			}
-
-			FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-		}
-
-		SM->GetOnMeshChanged().Broadcast();
-
-		UPackage* MeshPackage = SM->GetOutermost();
-		if (IsValid(MeshPackage))
-		{
-			MeshPackage->MarkPackageDirty();
-		}
-
 		if (bDoTiming)
 		{
 			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_RawMesh() - Post SM->Build() in %f seconds."), FPlatformTime::Seconds() - tick);
@@ -3463,6 +3636,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	// Resets the containers used for the raw data extraction.
 	ResetPartCache();
 
+	// Fetch the attributes needed for this part
+	PrefetchPartAttributes();
+
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
 
@@ -3532,6 +3708,22 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	// Map of object identifiers to package params
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniPackageParams> ObjectIdentifiersToPackageParams;
 
+	// Fit the UCX and simple colliders of all the splits in parallel before creating the meshes
+	{
+		TArray<FString> ConvexSplitGroups;
+		TArray<FString> SimpleSplitGroups;
+		for (const FString& SplitGroupName : AllSplitGroups)
+		{
+			const EHoudiniSplitType SplitType = GetSplitTypeFromSplitName(SplitGroupName);
+			if (SplitType == EHoudiniSplitType::InvisibleUCXCollider || SplitType == EHoudiniSplitType::RenderedUCXCollider)
+				ConvexSplitGroups.Add(SplitGroupName);
+			else if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider || SplitType == EHoudiniSplitType::RenderedSimpleCollider)
+				SimpleSplitGroups.Add(SplitGroupName);
+		}
+
+		FitCollisionsInParallel(ConvexSplitGroups, SimpleSplitGroups);
+	}
+
 	// Iterate through all detected split groups we care about and split geometry.
 	// The split are ordered in the following way:
 	// Invisible Simple/Convex Colliders > LODs > MainGeo > Visible Colliders > Invisible Colliders
@@ -4607,9 +4799,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		// UPDATE UPROPERTY ATTRIBS
 		// Update property attributes on the source model
 		TArray<FHoudiniGenericAttribute> PropertyAttributes;
-		if (FHoudiniEngineUtils::GetGenericPropertiesAttributes(
-			HGPO.GeoId,
-			HGPO.PartId,
+		if (PartAttributeStore.GetGenericPropertiesAttributes(
 			true,
 			OutputObjectIdentifier.PrimitiveIndex,
 			INDEX_NONE,
@@ -4813,46 +5003,17 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 
 		// BUILD the Static Mesh
-		// bSilent doesnt add the Build Errors...
+		// When a build batch is active (cooks), the build and its post build steps are
+		// deferred so that all the meshes of the cook are built together.
 		double build_start = FPlatformTime::Seconds();
-		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);		
+		FHoudiniStaticMeshBuildBatch::BuildOrDefer(SM);
 
 		if (bDoTiming)
-		{			
+		{
 			tick = FPlatformTime::Seconds();
 			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - StaticMesh->Build() executed in %f seconds."), tick - build_start);
 		}
 
-		// This replaces the call to RefreshCollision below, but without CreateNavCollision
-		// as it is already called by UStaticMesh::PostBuildInternal as part of the ::Build call,
-		// and can be expensive depending on the vert/poly count of the mesh
-		// RefreshCollisionChange(*SM);
-		{
-			for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-			{
-				UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-				if (StaticMeshComponent->GetStaticMesh() == SM)
-				{
-					// it needs to recreate IF it already has been created
-					if (StaticMeshComponent->IsPhysicsStateCreated())
-					{
-						StaticMeshComponent->RecreatePhysicsState();
-					}
-				}
-			}
-
-			FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-		}
-
-		SM->GetOnMeshChanged().Broadcast();
-
-		UPackage* MeshPackage = SM->GetOutermost();
-		if (IsValid(MeshPackage))
-		{
-			MeshPackage->MarkPackageDirty();
-		}
-
 		if (bDoTiming)
 		{
 			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Post SM->Build() in %f seconds."), FPlatformTime::Seconds() - tick);
@@ -4901,6 +5062,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 	// Resets the containers used for the raw data extraction.
 	ResetPartCache();
 
+	// Fetch the attributes needed for this part
+	PrefetchPartAttributes();
+
 	// Determine if there is "main" geo, if not we'll use the first LOD
 	// as main geo
 	bool bHasMainGeo = false;
@@ -5359,27 +5523,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions"));
 
-				bool bHasInvalidPositionIndexData = false;
-				for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-				//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
-				{
-					int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-					if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-					{
-						// Error retrieving positions.
-						bHasInvalidPositionIndexData = true;
-						continue;
-					}
+				const bool bValidPositions = FHoudiniMeshTranslator::SetHoudiniStaticMeshVertexPositions(
+					FoundStaticMesh, NeededVertices, PartPositions);
 
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector3f(
-						PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
-					));
-				}//);
-
-				if (bHasInvalidPositionIndexData)
+				if (!bValidPositions)
 				{
 					HOUDINI_LOG_WARNING(
 						TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
@@ -5397,124 +5544,22 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
 
 				// Now add the triangles to the mesh
-				for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-				// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
-				{
-					// TODO: add some additional intermediate consts for index calculations to make the indexing
-					// TODO: code a bit more readable
-					const int32 TriVertIdx0 = TriangleIdx * 3;
-					FoundStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
-						TriangleIndices[TriVertIdx0 + 0],
-						TriangleIndices[TriVertIdx0 + 1],
-						TriangleIndices[TriVertIdx0 + 2]
-					));
-
-					const int32 TriWindingIndex[3] = { 0, 2, 1 };
-					// Normals and tangents (either getting tangents from attributes or generating tangents from the
-					// normals
-					if (NormalCount > 0 || bReadTangents)
-					{
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							const bool bHasNormal = (NormalCount > 0 && SplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1));
-							FVector3f Normal = FVector3f::ZeroVector;
-							if (bHasNormal)
-							{
-								// Flip Z and Y coordinate for normal, but don't scale
-								Normal.Set(
-									SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 0],
-									SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 2],
-									SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 1]
-								);
-
-								FoundStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
-							}
-
-							if (bReadTangents || bGenerateTangentsFromNormalAttribute)
-							{
-								FVector3f TangentU, TangentV;
-								if (bGenerateTangentsFromNormalAttribute)
-								{
-									if (bHasNormal)
-									{
-										// Generate the tangents if needed
-										Normal.FindBestAxisVectors(TangentU, TangentV);
-
-										FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-										FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-									}
-								}
-								else
-								{
-									// Transfer the tangents from Houdini
-									TangentU.X = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-									TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-									FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-									FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-								}
-							}
-						}
-					}
-
-					// Vertex Colors
-					if (bSplitColorValid && SplitColors.IsValidIndex(TriVertIdx0 * AttribInfoColors.tupleSize + 3 * AttribInfoColors.tupleSize - 1))
-					{
-						FLinearColor VertexLinearColor;
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							VertexLinearColor.R = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 0], 0.0f, 1.0f);
-							VertexLinearColor.G = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 1], 0.0f, 1.0f);
-							VertexLinearColor.B = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 2], 0.0f, 1.0f);
-
-							if (bSplitAlphaValid)
-							{
-								VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
-							}
-							else if (AttribInfoColors.tupleSize >= 4)
-							{
-								VertexLinearColor.A = FMath::Clamp(
-									SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 3], 0.0f, 1.0f);
-							}
-							else
-							{
-								VertexLinearColor.A = 1.0f;
-							}
-							const FColor VertexColor = VertexLinearColor.ToFColor(false);
-							FoundStaticMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
-						}
-					}
-
-					// UVs
-					if (NumUVLayers > 0)
-					{
-						// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
-						// on the mesh itself only, and we set all layers on the AttributeSet
-						for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
-						{
-							const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
-							if (SplitUVs.IsValidIndex(TriVertIdx0 * 2 + 3 * 2 - 1))
-							{
-								for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-								{
-									const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
-									// We need to flip V coordinate when it's coming from HAPI.
-									const FVector2f UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
-									// Set the UV on the vertex instance in the UVLayer
-									FoundStaticMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
-								}
-							}
-						}
-					}
-				}
+				FHoudiniMeshTranslator::SetHoudiniStaticMeshTriangles(
+					FoundStaticMesh,
+					TriangleIndices,
+					SplitNormals,
+					NormalCount,
+					SplitTangentU,
+					SplitTangentV,
+					bReadTangents,
+					bGenerateTangentsFromNormalAttribute,
+					SplitColors,
+					AttribInfoColors.tupleSize,
+					bSplitColorValid,
+					SplitAlphas,
+					bSplitAlphaValid,
+					SplitUVSets,
+					NumUVLayers);
 			}
 
 			FMeshBuildSettings BuildSettings;
@@ -6180,36 +6225,124 @@ FHoudiniMeshTranslator::GetSplitTypeFromSplitName(const FString& InSplitName)
 	//return EHoudiniSplitType::Normal;
 }
 
-bool
-FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+void
+FHoudiniMeshTranslator::FitCollisionsInParallel(const TArray<FString>& InConvexSplitGroups, const TArray<FString>& InSimpleSplitGroups)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::FitCollisionsInParallel);
+
+	PrefittedConvexCollisions.Empty();
+	PrefittedSimpleCollisions.Empty();
+
+	TArray<FString> SplitGroupsToFit;
+	TBitArray<> IsConvexSplitGroup;
+	for (const FString& SplitGroupName : InConvexSplitGroups)
+	{
+		if (!AllSplitVertexLists.Contains(SplitGroupName) || !CanFitConvexCollisionInParallel(SplitGroupName))
+			continue;
+
+		SplitGroupsToFit.Add(SplitGroupName);
+		IsConvexSplitGroup.Add(true);
+	}
+
+	for (const FString& SplitGroupName : InSimpleSplitGroups)
+	{
+		if (!AllSplitVertexLists.Contains(SplitGroupName) || !CanFitSimpleCollisionInParallel(SplitGroupName))
+			continue;
+
+		SplitGroupsToFit.Add(SplitGroupName);
+		IsConvexSplitGroup.Add(false);
+	}
+
+	// A single collider is simply fitted when adding it to its aggregate
+	if (SplitGroupsToFit.Num() < 2)
+		return;
+
+	// The positions have to be fetched on this thread, the tasks only read them
+	UpdatePartPositionIfNeeded();
+
+	TArray<FKAggregateGeom> FittedCollisions;
+	FittedCollisions.SetNum(SplitGroupsToFit.Num());
+
+	// Stop the remaining tasks if one of them was cancelled
+	FThreadSafeBool bCancelled(false);
+	ParallelFor(SplitGroupsToFit.Num(), [&](int32 SplitIdx)
+	{
+		FHEProgressCancel Progress;
+		Progress.CancelF = [&bCancelled]() { return bCancelled || IsEngineExitRequested(); };
+		if (Progress.Cancelled())
+		{
+			bCancelled = true;
+			return;
+		}
+
+		if (IsConvexSplitGroup[SplitIdx])
+			AddConvexCollisionToAggregate(SplitGroupsToFit[SplitIdx], FittedCollisions[SplitIdx]);
+		else
+			AddSimpleCollisionToAggregate(SplitGroupsToFit[SplitIdx], FittedCollisions[SplitIdx], &Progress);
+
+		if (Progress.Cancelled())
+			bCancelled = true;
+	});
+
+	if (bCancelled)
+		return;
+
+	for (int32 SplitIdx = 0; SplitIdx < SplitGroupsToFit.Num(); SplitIdx++)
+	{
+		TMap<FString, FKAggregateGeom>& PrefittedCollisions = IsConvexSplitGroup[SplitIdx] ? PrefittedConvexCollisions : PrefittedSimpleCollisions;
+		PrefittedCollisions.Add(SplitGroupsToFit[SplitIdx], MoveTemp(FittedCollisions[SplitIdx]));
+	}
+}
+
+void
+FHoudiniMeshTranslator::GetSplitGroupUniquePositions(const FString& SplitGroupName, TArray<FVector>& OutPositions) const
 {
 	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
+	const TArray<int32>& SplitGroupVertexList = AllSplitVertexLists.FindChecked(SplitGroupName);
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
+	TSet<int32> VisitedVertexIndexes;
+	VisitedVertexIndexes.Reserve(SplitGroupVertexList.Num());
 	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
 	{
 		int32 Index = SplitGroupVertexList[VertexIdx];
 		if (!PartPositions.IsValidIndex(Index))
 			continue;
 
-		UniqueVertexIndexes.AddUnique(Index);
+		bool bAlreadyVisited = false;
+		VisitedVertexIndexes.Add(Index, &bAlreadyVisited);
+		if (!bAlreadyVisited)
+			UniqueVertexIndexes.Add(Index);
 	}
 
 	// Extract the collision geo's vertices
-	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
+	OutPositions.SetNumZeroed(UniqueVertexIndexes.Num());
 	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
 	{
 		int32 VertexIndex = UniqueVertexIndexes[Idx];
 		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
 			continue;
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
 	}
+}
+
+bool
+FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+{
+	// Use the collider fitted by FitCollisionsInParallel if we have one
+	if (const FKAggregateGeom* PrefittedCollision = PrefittedConvexCollisions.Find(SplitGroupName))
+	{
+		AppendAggregateGeom(*PrefittedCollision, AggCollisions);
+		return PrefittedCollision->GetElementCount() > 0;
+	}
+
+	// Extract the collision geo's unique vertices
+	TArray< FVector > VertexArray;
+	GetSplitGroupUniquePositions(SplitGroupName, VertexArray);
 
 #if WITH_EDITOR
 	// Do we want to create multiple convex hulls?
@@ -6225,12 +6358,13 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 		// Look for extra attributes for the decomposition parameters? (HullCount/MaxHullVerts)
 	}
 
-	if (bDoMultiHullDecomp && (VertexArray.Num() >= 3 || UniqueVertexIndexes.Num() >= 3))
+	if (bDoMultiHullDecomp && VertexArray.Num() >= 3)
 	{
 		// creating multiple convex hull collision
 		// ... this might take a while
 
 		// We're only interested in the valid indices!
+		const TArray<int32>& SplitGroupVertexList = AllSplitVertexLists.FindChecked(SplitGroupName);
 		TArray<uint32> Indices;
 		for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
 		{
@@ -6283,41 +6417,23 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 }
 
 bool
-FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions, FHEProgressCancel* Progress)
 {
-	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
-
-	// We're only interested in unique vertices
-	TArray<int32> UniqueVertexIndexes;
-
-	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
+	// Use the colliders fitted by FitCollisionsInParallel if we have them
+	if (const FKAggregateGeom* PrefittedCollision = PrefittedSimpleCollisions.Find(SplitGroupName))
 	{
-		int32 Index = SplitGroupVertexList[VertexIdx];
-		if (!PartPositions.IsValidIndex(Index))
-			continue;
-
-		UniqueVertexIndexes.AddUnique(Index);
+		AppendAggregateGeom(*PrefittedCollision, AggCollisions);
+		return PrefittedCollision->GetElementCount() > 0;
 	}
 
-	// Extract the collision geo's vertices
+	// Extract the collision geo's unique vertices
 	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
-	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
-	{
-		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
-			continue;
-
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	GetSplitGroupUniquePositions(SplitGroupName, VertexArray);
 
 	int32 NewColliders = 0;
 	if (SplitGroupName.Contains("Box"))
 	{
-		NewColliders = FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(VertexArray, AggCollisions);
+		NewColliders = FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(VertexArray, AggCollisions, Progress);
 	}
 	else if (SplitGroupName.Contains("Sphere"))
 	{
@@ -6379,6 +6495,201 @@ FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
 		InVertexList, InAttribInfo,	InData,	OutVertexData);
 }
 
+bool
+FHoudiniMeshTranslator::SetHoudiniStaticMeshVertexPositions(
+	UHoudiniStaticMesh* InMesh,
+	const TArray<int32>& InNeededVertices,
+	const TArray<float>& InPositions,
+	const bool bInParallel)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::SetHoudiniStaticMeshVertexPositions"));
+
+	if (!IsValid(InMesh))
+		return false;
+
+	const int32 NumVertexPositions = InNeededVertices.Num();
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumVertexPositions, HoudiniStaticMeshTransferChunkSize);
+
+	// Each chunk writes to its own range of vertices, only the invalid index flag is shared
+	FThreadSafeBool bHasInvalidPositionIndexData(false);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 ChunkStart = ChunkIdx * HoudiniStaticMeshTransferChunkSize;
+		const int32 ChunkEnd = FMath::Min(ChunkStart + HoudiniStaticMeshTransferChunkSize, NumVertexPositions);
+
+		bool bChunkHasInvalidIndex = false;
+		for (int32 VertexPositionIdx = ChunkStart; VertexPositionIdx < ChunkEnd; ++VertexPositionIdx)
+		{
+			const int32 NeededVertexIndex = InNeededVertices[VertexPositionIdx];
+			if (!InPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
+			{
+				// Error retrieving positions.
+				bChunkHasInvalidIndex = true;
+				continue;
+			}
+
+			// We need to swap Z and Y coordinate here, and convert from m to cm. 
+			InMesh->SetVertexPosition(VertexPositionIdx, FVector3f(
+				InPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+				InPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+				InPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
+			));
+		}
+
+		if (bChunkHasInvalidIndex)
+			bHasInvalidPositionIndexData.AtomicSet(true);
+	}, !bInParallel);
+
+	return !bHasInvalidPositionIndexData;
+}
+
+void
+FHoudiniMeshTranslator::SetHoudiniStaticMeshTriangles(
+	UHoudiniStaticMesh* InMesh,
+	const TArray<int32>& InTriangleIndices,
+	const TArray<float>& InSplitNormals,
+	const int32 InNormalCount,
+	const TArray<float>& InSplitTangentU,
+	const TArray<float>& InSplitTangentV,
+	const bool bInReadTangents,
+	const bool bInGenerateTangentsFromNormalAttribute,
+	const TArray<float>& InSplitColors,
+	const int32 InColorTupleSize,
+	const bool bInSplitColorValid,
+	const TArray<float>& InSplitAlphas,
+	const bool bInSplitAlphaValid,
+	const TArray<TArray<float>>& InSplitUVSets,
+	const int32 InNumUVLayers,
+	const bool bInParallel)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::SetHoudiniStaticMeshTriangles"));
+
+	if (!IsValid(InMesh))
+		return;
+
+	const int32 NumTriangles = InTriangleIndices.Num() / 3;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumTriangles, HoudiniStaticMeshTransferChunkSize);
+	const int32 TriWindingIndex[3] = { 0, 2, 1 };
+
+	// Each chunk only writes the vertex instances of its own triangles
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 ChunkStart = ChunkIdx * HoudiniStaticMeshTransferChunkSize;
+		const int32 ChunkEnd = FMath::Min(ChunkStart + HoudiniStaticMeshTransferChunkSize, NumTriangles);
+
+		for (int32 TriangleIdx = ChunkStart; TriangleIdx < ChunkEnd; ++TriangleIdx)
+		{
+			const int32 TriVertIdx0 = TriangleIdx * 3;
+			InMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
+				InTriangleIndices[TriVertIdx0 + 0],
+				InTriangleIndices[TriVertIdx0 + 1],
+				InTriangleIndices[TriVertIdx0 + 2]
+			));
+
+			// Normals and tangents (either getting tangents from attributes or generating tangents from the
+			// normals
+			if (InNormalCount > 0 || bInReadTangents)
+			{
+				const bool bHasNormal = (InNormalCount > 0 && InSplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1));
+				const bool bHasTangents = bInReadTangents
+					&& InSplitTangentU.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1)
+					&& InSplitTangentV.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1);
+
+				for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+				{
+					const int32 VectorIdx = TriVertIdx0 * 3 + 3 * ElementIdx;
+					FVector3f Normal = FVector3f::ZeroVector;
+					if (bHasNormal)
+					{
+						// Flip Z and Y coordinate for normal, but don't scale
+						Normal.Set(
+							InSplitNormals[VectorIdx + 0],
+							InSplitNormals[VectorIdx + 2],
+							InSplitNormals[VectorIdx + 1]
+						);
+
+						InMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
+					}
+
+					FVector3f TangentU, TangentV;
+					if (bInGenerateTangentsFromNormalAttribute)
+					{
+						if (bHasNormal)
+						{
+							// Generate the tangents if needed
+							Normal.FindBestAxisVectors(TangentU, TangentV);
+
+							InMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
+							InMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
+						}
+					}
+					else if (bHasTangents)
+					{
+						// Transfer the tangents from Houdini
+						TangentU.Set(
+							InSplitTangentU[VectorIdx + 0],
+							InSplitTangentU[VectorIdx + 2],
+							InSplitTangentU[VectorIdx + 1]);
+
+						TangentV.Set(
+							InSplitTangentV[VectorIdx + 0],
+							InSplitTangentV[VectorIdx + 2],
+							InSplitTangentV[VectorIdx + 1]);
+
+						InMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
+						InMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
+					}
+				}
+			}
+
+			// Vertex Colors
+			if (bInSplitColorValid && InSplitColors.IsValidIndex(TriVertIdx0 * InColorTupleSize + 3 * InColorTupleSize - 1))
+			{
+				FLinearColor VertexLinearColor;
+				for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+				{
+					const int32 ColorIdx = TriVertIdx0 * InColorTupleSize + InColorTupleSize * ElementIdx;
+					VertexLinearColor.R = FMath::Clamp(InSplitColors[ColorIdx + 0], 0.0f, 1.0f);
+					VertexLinearColor.G = FMath::Clamp(InSplitColors[ColorIdx + 1], 0.0f, 1.0f);
+					VertexLinearColor.B = FMath::Clamp(InSplitColors[ColorIdx + 2], 0.0f, 1.0f);
+
+					if (bInSplitAlphaValid)
+					{
+						VertexLinearColor.A = FMath::Clamp(InSplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
+					}
+					else if (InColorTupleSize >= 4)
+					{
+						VertexLinearColor.A = FMath::Clamp(InSplitColors[ColorIdx + 3], 0.0f, 1.0f);
+					}
+					else
+					{
+						VertexLinearColor.A = 1.0f;
+					}
+					const FColor VertexColor = VertexLinearColor.ToFColor(false);
+					InMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
+				}
+			}
+
+			// UVs
+			for (int32 TexCoordIdx = 0; TexCoordIdx < InNumUVLayers; ++TexCoordIdx)
+			{
+				const TArray<float>& SplitUVs = InSplitUVSets[TexCoordIdx];
+				if (!SplitUVs.IsValidIndex(TriVertIdx0 * 2 + 3 * 2 - 1))
+					continue;
+
+				for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+				{
+					const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
+					// We need to flip V coordinate when it's coming from HAPI.
+					const FVector2f UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
+					// Set the UV on the vertex instance in the UVLayer
+					InMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
+				}
+			}
+		}
+	}, !bInParallel);
+}
+
 /*
 int32
 FHoudiniMeshTranslator::GetSplitNormals(
@@ -6789,8 +7100,26 @@ FHoudiniMeshTranslator::GenerateBoxAsSimpleCollision(const TArray<FVector>& InPo
 }
 
 int32 
-FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions)
+FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions, FHEProgressCancel* Progress)
 {
+	const float FastModeAngleStep = CVarHoudiniEngineOrientedBoxCollisionFastMode.GetValueOnAnyThread();
+	if (FastModeAngleStep > 0.0f)
+	{
+		FVector Center, Extents;
+		FRotator Rotation;
+		CalcApproximateMinimumVolumeBox(InPositionArray, FastModeAngleStep, Center, Extents, Rotation);
+
+		FKBoxElem BoxElem;
+		BoxElem.Center = Center;
+		BoxElem.X = Extents.X * 2.0f;
+		BoxElem.Y = Extents.Y * 2.0f;
+		BoxElem.Z = Extents.Z * 2.0f;
+		BoxElem.Rotation = Rotation;
+		OutAggregateCollisions.BoxElems.Add(BoxElem);
+
+		return 1;
+	}
+
 	//
 	// Code adapted from Experimental GeometryProcessing plugin for simple mesh approximation.
 	//
@@ -6805,7 +7134,11 @@ FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(const TArray<FVecto
 	// Calculate bounding Box.
 	gte::OrientedBox3<double> MinimalBox = gte::OrientedBox3<double>();
 	gte::MinimumVolumeBox3<double, double> BoxCompute;
-	MinimalBox = BoxCompute(NumPoints, Points.GetData(), nullptr);
+	MinimalBox = BoxCompute(NumPoints, Points.GetData(), Progress);
+
+	// The box is invalid if the computation was cancelled
+	if (Progress && Progress->Cancelled())
+		return 0;
 	
 	// FVector unitVec = FVector::OneVector;// bs->BuildScale3D;
 	// CalcBoundingBox(InPositionArray, Center, Extents, unitVec);
@@ -6841,6 +7174,113 @@ FHoudiniMeshTranslator::CalcBoundingBox(const TArray<FVector>& PositionArray, FV
 	Box.GetCenterAndExtents(Center, Extents);
 }
 
+void
+FHoudiniMeshTranslator::CalcApproximateMinimumVolumeBox(
+	const TArray<FVector>& PositionArray, const float AngleStep, FVector& Center, FVector& Extents, FRotator& Rotation)
+{
+	// The box orientations are sampled with their first axis on a grid of the upper hemisphere, and their second
+	// axis rotated around the first one. The optimal orientation is within 1.5 * AngleStep of a sampled one,
+	// whose edges are then each at most E = sqrt(2) * sin(1.5 * AngleStep) * D longer than the optimal ones
+	// (the extent along a rotated axis grows by at most sqrt(2) * sin(angle) * D).
+	// We keep the sample of smallest volume, which isn't necessarily that one: only its volume is bounded,
+	// by the volume of that sample, (A + E) * (B + E) * (C + E) for optimal edges A, B and C.
+	// The best sample is then refined by rotating it around its own axes with decreasing steps,
+	// which can only reduce its volume.
+	Center = FVector::ZeroVector;
+	Extents = FVector::ZeroVector;
+	Rotation = FRotator::ZeroRotator;
+	if (PositionArray.Num() <= 0)
+		return;
+
+	const double Step = FMath::DegreesToRadians((double)FMath::Clamp(AngleStep, 0.5f, 45.0f));
+
+	double BestVolume = TNumericLimits<double>::Max();
+	FVector BestAxes[3] = { FVector::XAxisVector, FVector::YAxisVector, FVector::ZAxisVector };
+	FVector BestMin = FVector::ZeroVector;
+	FVector BestMax = FVector::ZeroVector;
+
+	auto EvaluateAxes = [&](const FVector& X, const FVector& Y, const FVector& Z)
+	{
+		FVector Min(TNumericLimits<double>::Max());
+		FVector Max(TNumericLimits<double>::Lowest());
+		for (const FVector& Position : PositionArray)
+		{
+			const FVector Projected(Position | X, Position | Y, Position | Z);
+			Min = Min.ComponentMin(Projected);
+			Max = Max.ComponentMax(Projected);
+		}
+
+		const FVector Size = Max - Min;
+		const double Volume = Size.X * Size.Y * Size.Z;
+		if (Volume < BestVolume)
+		{
+			BestVolume = Volume;
+			BestAxes[0] = X;
+			BestAxes[1] = Y;
+			BestAxes[2] = Z;
+			BestMin = Min;
+			BestMax = Max;
+			return true;
+		}
+
+		return false;
+	};
+
+	// Coarse search
+	const int32 NumRings = FMath::CeilToInt(HALF_PI / Step);
+	for (int32 RingIdx = 0; RingIdx <= NumRings; RingIdx++)
+	{
+		const double Polar = FMath::Min(RingIdx * Step, (double)HALF_PI);
+
+		// The arc between two azimuth samples must not exceed the step anywhere in the ring's band
+		const double BandSin = FMath::Sin(FMath::Min(Polar + 0.5 * Step, (double)HALF_PI));
+		const int32 NumAzimuths = FMath::Max(1, FMath::CeilToInt(TWO_PI * BandSin / Step));
+		for (int32 AzimuthIdx = 0; AzimuthIdx < NumAzimuths; AzimuthIdx++)
+		{
+			const double Azimuth = AzimuthIdx * TWO_PI / NumAzimuths;
+			const FVector U(FMath::Sin(Polar) * FMath::Cos(Azimuth), FMath::Sin(Polar) * FMath::Sin(Azimuth), FMath::Cos(Polar));
+
+			FVector V0, W0;
+			U.FindBestAxisVectors(V0, W0);
+
+			// Boxes are symmetric under quarter turns around their axes
+			const int32 NumSpins = FMath::CeilToInt(HALF_PI / Step);
+			for (int32 SpinIdx = 0; SpinIdx < NumSpins; SpinIdx++)
+			{
+				const double Spin = SpinIdx * HALF_PI / NumSpins;
+				const FVector V = V0 * FMath::Cos(Spin) + W0 * FMath::Sin(Spin);
+				EvaluateAxes(U, V, U ^ V);
+			}
+		}
+	}
+
+	// Refinement around the best sample
+	double RefineStep = Step * 0.5;
+	for (int32 RefineIdx = 0; RefineIdx < 4; RefineIdx++, RefineStep *= 0.5)
+	{
+		bool bImproved = true;
+		for (int32 Iteration = 0; bImproved && Iteration < 8; Iteration++)
+		{
+			bImproved = false;
+			for (int32 AxisIdx = 0; AxisIdx < 3; AxisIdx++)
+			{
+				for (const double Sign : { -1.0, 1.0 })
+				{
+					const FQuat Delta(BestAxes[AxisIdx], Sign * RefineStep);
+					const FVector X = Delta.RotateVector(BestAxes[0]);
+					const FVector Y = Delta.RotateVector(BestAxes[1]);
+					bImproved |= EvaluateAxes(X, Y, X ^ Y);
+				}
+			}
+		}
+	}
+
+	const FVector LocalCenter = (BestMin + BestMax) * 0.5;
+	Center = BestAxes[0] * LocalCenter.X + BestAxes[1] * LocalCenter.Y + BestAxes[2] * LocalCenter.Z;
+	Extents = (BestMax - BestMin) * 0.5;
+	Rotation = FRotationMatrix::MakeFromXY(BestAxes[0], BestAxes[1]).Rotator();
+}
+
 int32
 FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions)
 {
@@ -8904,6 +9344,9 @@ FHoudiniMeshTranslator::CreateStaticMeshesFromSplitGroups()
 
 	UpdatePartVertexList();
 
+	// Fetch the attributes needed for this part
+	PrefetchPartAttributes();
+
 	//  Get a list of all Static Meshes  to build.
 	FHoudiniMeshToBuild MeshesToBuild = FHoudiniMeshTranslator::ScanOutputForMeshesToBuild();
 	AllSplitGroups = HGPO.SplitGroups;
@@ -8921,6 +9364,18 @@ FHoudiniMeshTranslator::CreateStaticMeshesFromSplitGroups()
 		AddDefaultMesh(MeshesToBuild, AllSplitGroups[AllSplitGroups.Num() - 1]);
 	}
 
+	// Fit the simple colliders of all the meshes in parallel before building them
+	{
+		TArray<FString> SimpleSplitGroups;
+		for (auto& It : MeshesToBuild.Meshes)
+		{
+			for (int32 Index : It.Value.SimpleCollisions)
+				SimpleSplitGroups.Add(It.Value.SplitMeshData[Index].SplitGroupName);
+		}
+
+		FitCollisionsInParallel(TArray<FString>(), SimpleSplitGroups);
+	}
+
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 	// Loop through and build each mesh.
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
@@ -9040,9 +9495,7 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 
 		// Update property attributes on the source model
 		TArray<FHoudiniGenericAttribute> PropertyAttributes;
-		if (FHoudiniEngineUtils::GetGenericPropertiesAttributes(
-			HGPO.GeoId,
-			HGPO.PartId,
+		if (PartAttributeStore.GetGenericPropertiesAttributes(
 			true,
 			SplitMeshData.OutputObjectIdentifier.PrimitiveIndex,
 			INDEX_NONE,
@@ -9137,32 +9590,8 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 
 	double BuildTimeStart = FPlatformTime::Seconds();
 
-	TArray<FText> SMBuildErrors;
 	SplitMeshData.UnrealStaticMesh->ImportVersion = EImportStaticMeshVersion::LastVersion;
-	SplitMeshData.UnrealStaticMesh->Build(true, &SMBuildErrors);
-
-	for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-	{
-		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-		if (StaticMeshComponent->GetStaticMesh() == SplitMeshData.UnrealStaticMesh)
-		{
-			// it needs to recreate IF it already has been created
-			if (StaticMeshComponent->IsPhysicsStateCreated())
-			{
-				StaticMeshComponent->RecreatePhysicsState();
-			}
-		}
-	}
-
-	FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-
-	SplitMeshData.UnrealStaticMesh->GetOnMeshChanged().Broadcast();
-
-	UPackage* MeshPackage = SplitMeshData.UnrealStaticMesh->GetOutermost();
-	if (IsValid(MeshPackage))
-	{
-		MeshPackage->MarkPackageDirty();
-	}
+	FHoudiniStaticMeshBuildBatch::BuildOrDefer(SplitMeshData.UnrealStaticMesh);
 
 	double BuildTimeEnd = FPlatformTime::Seconds();
 	if (bDoTiming)
@@ -9233,6 +9662,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMeshesFromSplitGroups()
 
 	UpdatePartVertexList();
 
+	// Fetch the attributes needed for this part
+	PrefetchPartAttributes();
+
 	//  Get a list of all Static Meshes  to build.
 	FHoudiniMeshToBuild MeshesToBuild = FHoudiniMeshTranslator::ScanOutputForMeshesToBuild();
 	AllSplitGroups = HGPO.SplitGroups;
@@ -9714,27 +10146,10 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions"));
 
-		bool bHasInvalidPositionIndexData = false;
-		for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-			//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
-		{
-			int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-			if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-			{
-				// Error retrieving positions.
-				bHasInvalidPositionIndexData = true;
-				continue;
-			}
+		const bool bValidPositions = FHoudiniMeshTranslator::SetHoudiniStaticMeshVertexPositions(
+			FoundStaticMesh, NeededVertices, PartPositions);
 
-			// We need to swap Z and Y coordinate here, and convert from m to cm. 
-			FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector3f(
-				PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-				PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-				PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
-			));
-		}//);
-
-		if (bHasInvalidPositionIndexData)
+		if (!bValidPositions)
 		{
 			HOUDINI_LOG_WARNING(
 				TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%s] invalid position/index data ")
@@ -9752,124 +10167,22 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
 
 		// Now add the triangles to the mesh
-		for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-			// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
-		{
-			// TODO: add some additional intermediate consts for index calculations to make the indexing
-			// TODO: code a bit more readable
-			const int32 TriVertIdx0 = TriangleIdx * 3;
-			FoundStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
-				TriangleIndices[TriVertIdx0 + 0],
-				TriangleIndices[TriVertIdx0 + 1],
-				TriangleIndices[TriVertIdx0 + 2]
-			));
-
-			const int32 TriWindingIndex[3] = { 0, 2, 1 };
-			// Normals and tangents (either getting tangents from attributes or generating tangents from the
-			// normals
-			if (NormalCount > 0 || bReadTangents)
-			{
-				for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-				{
-					const bool bHasNormal = (NormalCount > 0 && SplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1));
-					FVector3f Normal = FVector3f::ZeroVector;
-					if (bHasNormal)
-					{
-						// Flip Z and Y coordinate for normal, but don't scale
-						Normal.Set(
-							SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 0],
-							SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 2],
-							SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 1]
-						);
-
-						FoundStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
-					}
-
-					if (bReadTangents || bGenerateTangentsFromNormalAttribute)
-					{
-						FVector3f TangentU, TangentV;
-						if (bGenerateTangentsFromNormalAttribute)
-						{
-							if (bHasNormal)
-							{
-								// Generate the tangents if needed
-								Normal.FindBestAxisVectors(TangentU, TangentV);
-
-								FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-								FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-							}
-						}
-						else
-						{
-							// Transfer the tangents from Houdini
-							TangentU.X = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-							TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-							TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-							TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-							TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-							TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-							FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-							FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-						}
-					}
-				}
-			}
-
-			// Vertex Colors
-			if (bSplitColorValid && SplitColors.IsValidIndex(TriVertIdx0 * AttribInfoColors.tupleSize + 3 * AttribInfoColors.tupleSize - 1))
-			{
-				FLinearColor VertexLinearColor;
-				for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-				{
-					VertexLinearColor.R = FMath::Clamp(
-						SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 0], 0.0f, 1.0f);
-					VertexLinearColor.G = FMath::Clamp(
-						SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 1], 0.0f, 1.0f);
-					VertexLinearColor.B = FMath::Clamp(
-						SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 2], 0.0f, 1.0f);
-
-					if (bSplitAlphaValid)
-					{
-						VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
-					}
-					else if (AttribInfoColors.tupleSize >= 4)
-					{
-						VertexLinearColor.A = FMath::Clamp(
-							SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 3], 0.0f, 1.0f);
-					}
-					else
-					{
-						VertexLinearColor.A = 1.0f;
-					}
-					const FColor VertexColor = VertexLinearColor.ToFColor(false);
-					FoundStaticMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
-				}
-			}
-
-			// UVs
-			if (NumUVLayers > 0)
-			{
-				// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
-				// on the mesh itself only, and we set all layers on the AttributeSet
-				for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
-				{
-					const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
-					if (SplitUVs.IsValidIndex(TriVertIdx0 * 2 + 3 * 2 - 1))
-					{
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
-							// We need to flip V coordinate when it's coming from HAPI.
-							const FVector2f UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
-							// Set the UV on the vertex instance in the UVLayer
-							FoundStaticMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
-						}
-					}
-				}
-			}
-		}
+		FHoudiniMeshTranslator::SetHoudiniStaticMeshTriangles(
+			FoundStaticMesh,
+			TriangleIndices,
+			SplitNormals,
+			NormalCount,
+			SplitTangentU,
+			SplitTangentV,
+			bReadTangents,
+			bGenerateTangentsFromNormalAttribute,
+			SplitColors,
+			AttribInfoColors.tupleSize,
+			bSplitColorValid,
+			SplitAlphas,
+			bSplitAlphaValid,
+			SplitUVSets,
+			NumUVLayers);
 	}
 
 	FMeshBuildSettings BuildSettings;
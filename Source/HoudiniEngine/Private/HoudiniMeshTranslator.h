@@ -32,6 +32,7 @@
 #include "HoudiniPackageParams.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniMaterialTranslator.h"
+#include "HoudiniPartAttributeStore.h"
 
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
@@ -51,6 +52,8 @@ class UHoudiniStaticMeshComponent;
 struct FKAggregateGeom;
 struct FHoudiniGenericAttribute;
 struct FHoudiniMeshesToBuild;
+struct FHoudiniMeshPartData;
+class FHEProgressCancel;
 
 UENUM()
 enum class EHoudiniSplitType : uint8
@@ -183,7 +186,8 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			bool bSplitMeshSupport,
 			const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 			const FMeshBuildSettings& InMeshBuildSettings,
-			bool bInTreatExistingMaterialsAsUpToDate = false);
+			bool bInTreatExistingMaterialsAsUpToDate = false,
+			FHoudiniMeshPartData* InGatheredPartData = nullptr);
 
 		static bool CreateOrUpdateAllComponents(
 			UHoudiniOutput* InOutput,
@@ -214,6 +218,36 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const TArray<TYPE>& InData,
 			TArray<TYPE>& OutSplitData);
 
+		// Transfers the positions of a split's needed vertices to a UHoudiniStaticMesh that has already been initialized.
+		// Vertices are processed in parallel chunks, unless bInParallel is false.
+		// Returns false if some of the needed vertices had no position.
+		static bool SetHoudiniStaticMeshVertexPositions(
+			UHoudiniStaticMesh* InMesh,
+			const TArray<int32>& InNeededVertices,
+			const TArray<float>& InPositions,
+			const bool bInParallel = true);
+
+		// Transfers a split's triangle indices and per vertex instance normals, tangents, colors and UVs
+		// to a UHoudiniStaticMesh that has already been initialized.
+		// Triangles are processed in parallel chunks, unless bInParallel is false.
+		static void SetHoudiniStaticMeshTriangles(
+			UHoudiniStaticMesh* InMesh,
+			const TArray<int32>& InTriangleIndices,
+			const TArray<float>& InSplitNormals,
+			const int32 InNormalCount,
+			const TArray<float>& InSplitTangentU,
+			const TArray<float>& InSplitTangentV,
+			const bool bInReadTangents,
+			const bool bInGenerateTangentsFromNormalAttribute,
+			const TArray<float>& InSplitColors,
+			const int32 InColorTupleSize,
+			const bool bInSplitColorValid,
+			const TArray<float>& InSplitAlphas,
+			const bool bInSplitAlphaValid,
+			const TArray<TArray<float>>& InSplitUVSets,
+			const int32 InNumUVLayers,
+			const bool bInParallel = true);
+
 		// Try to find the named InPropertyName property on the source model at InSourceModelIndex on InStaticMesh.
 		static bool TryToFindPropertyOnSourceModel(
 			UStaticMesh* const InStaticMesh,
@@ -235,6 +269,25 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		static bool ExtractMaterialIndex(FString& MaterialName, int32& MatIndex);
 
+		// Returns true if the normals should be read from the parts, false if unreal recomputes them.
+		// Reads the runtime settings, so must be called on the game thread.
+		static bool ShouldReadPartNormals();
+
+		// Returns true if the tangents should be read from the parts, false if unreal recomputes them.
+		// Reads the runtime settings, so must be called on the game thread.
+		static bool ShouldReadPartTangents();
+
+		// Fetches the vertex list of the given part. Only makes HAPI calls, safe to call from worker threads.
+		static bool FetchPartVertexList(const FHoudiniGeoPartObject& InHGPO, TArray<int32>& OutVertexList);
+
+		// Fetches all the attributes needed to create the meshes of the given part in a single pass into
+		// OutAttributeStore. Only makes HAPI calls, safe to call from worker threads.
+		static bool PrefetchPartAttributes(
+			const FHoudiniGeoPartObject& InHGPO,
+			const bool& bInReadNormals,
+			const bool& bInReadTangents,
+			FHoudiniPartAttributeStore& OutAttributeStore);
+
 		// Update the MeshBuild Settings using the values from the runtime settings/overrides on the HAC
 		void UpdateMeshBuildSettings(
 			FMeshBuildSettings& OutMeshBuildSettings,
@@ -321,6 +374,10 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		void ResetPartCache();
 
+		// Fetch all the attributes needed by this part in a single pass into the attribute store,
+		// or take them from the gathered part data
+		bool PrefetchPartAttributes();
+
 		bool UpdatePartVertexList();
 
 		void SortSplitGroups();
@@ -382,14 +439,23 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		float GetLODSCreensizeForSplit(const FString& SplitGroupName);
 
+		// Fit the colliders of the given convex/UCX and simple collider split groups in parallel tasks.
+		// The results are then used by AddConvexCollisionToAggregate / AddSimpleCollisionToAggregate.
+		// Split groups whose colliders need to create UObjects (k-DOPs, multi-hull decompositions) are skipped
+		// and fitted on the game thread as before.
+		void FitCollisionsInParallel(const TArray<FString>& InConvexSplitGroups, const TArray<FString>& InSimpleSplitGroups);
+
+		// Returns the unique positions used by a split, in unreal space
+		void GetSplitGroupUniquePositions(const FString& SplitGroupName, TArray<FVector>& OutPositions) const;
+
 		// Create convex/UCX collider for a split and add to the aggregate
 		bool AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
 		// Create simple colliders for a split and add to the aggregate
-		bool AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
+		bool AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions, FHEProgressCancel* Progress = nullptr);
 		
 		// Helper functions to generate the simple colliders and add them to the aggregate
 		static int32 GenerateBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
-		static int32 GenerateOrientedBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
+		static int32 GenerateOrientedBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions, FHEProgressCancel* Progress = nullptr);
 		static int32 GenerateSphereAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
 		static int32 GenerateSphylAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
 		static int32 GenerateOrientedSphylAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
@@ -400,6 +466,10 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		static void CalcBoundingSphere(const TArray<FVector>& PositionArray, FSphere& sphere, FVector& LimitVec);
 		static void CalcBoundingSphere2(const TArray<FVector>& PositionArray, FSphere& sphere, FVector& LimitVec);
 		static void CalcBoundingSphyl(const TArray<FVector>& PositionArray, FSphere& sphere, float& length, FRotator& rotation, FVector& LimitVec);
+		// Approximate minimum volume oriented box, searching the box orientations on a grid of AngleStep degrees.
+		// The volume of the returned box is at most (A + E) * (B + E) * (C + E), where A, B and C are the edges of the
+		// minimum volume box, E = sqrt(2) * sin(1.5 * AngleStep) * D and D is the diameter of the point set.
+		static void CalcApproximateMinimumVolumeBox(const TArray<FVector>& PositionArray, const float AngleStep, FVector& Center, FVector& Extents, FRotator& Rotation);
 		
 		// Helper functions to remove unused/stale components
 		static bool RemoveAndDestroyComponent(UObject* InComponent);
@@ -484,6 +554,10 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Per-split lists of faces
 		TMap<FString, TArray<int32>> AllSplitVertexLists;
 
+		// Colliders fitted by FitCollisionsInParallel, per split group
+		TMap<FString, FKAggregateGeom> PrefittedConvexCollisions;
+		TMap<FString, FKAggregateGeom> PrefittedSimpleCollisions;
+
 		// Per-split number of faces
 		TMap<FString, int32> AllSplitVertexCounts;
 
@@ -499,6 +573,12 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Vertex Indices for the part
 		TArray<int32> PartVertexList;
 
+		// Attributes prefetched for the part, read by the Update*IfNeeded functions
+		FHoudiniPartAttributeStore PartAttributeStore;
+
+		// Part data gathered ahead of the translation, its vertex list and attributes are used instead of fetching them
+		FHoudiniMeshPartData* GatheredPartData = nullptr;
+
 		// Positions
 		TArray<float> PartPositions;
 		HAPI_AttributeInfo AttribInfoPositions;
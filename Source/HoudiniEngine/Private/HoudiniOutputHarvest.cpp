@@ -0,0 +1,331 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniOutputHarvest.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniOutputTranslator.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineHarvestOutputInfos(
+	TEXT("HoudiniEngine.HarvestOutputInfos"),
+	1,
+	TEXT("When enabled, the part infos and attribute names of the output geos are harvested once per geo when building outputs, and reused across cooks while the geos' cook counts are unchanged.\n")
+	TEXT("0: Query the part infos and attributes for each part.\n")
+	TEXT("1: Harvest the part infos and attribute names of each geo (default).\n")
+);
+
+namespace
+{
+	// Innermost harvest the attribute lookups are answered from
+	FHoudiniOutputHarvest* ActiveOutputHarvest = nullptr;
+
+	// Upper bound of the geos kept across cooks, the cache is flushed when it is reached
+	constexpr int32 MaxHarvestedGeos = 4096;
+}
+
+FCriticalSection FHoudiniOutputHarvest::HarvestedGeosLock;
+TMap<TPair<int32, HAPI_NodeId>, TSharedPtr<const FHoudiniOutputHarvest::FGeoEntry>> FHoudiniOutputHarvest::HarvestedGeos;
+
+FHoudiniOutputHarvest::FHoudiniOutputHarvest()
+	: SessionIndex(-1)
+	, ActiveScope(ActiveOutputHarvest)
+	, NumHapiCalls(0)
+	, NumHapiCallsSaved(0)
+	, NumGeosReused(0)
+{
+	// Lookups are only answered on the game thread, and when harvesting hasn't been disabled
+	if (!IsInGameThread() || CVarHoudiniEngineHarvestOutputInfos.GetValueOnGameThread() == 0)
+		return;
+
+	SessionIndex = FHoudiniEngine::GetCurrentSessionIndex();
+	ActiveScope.Activate(this);
+}
+
+FHoudiniOutputHarvest::~FHoudiniOutputHarvest()
+{
+	ActiveScope.Deactivate();
+}
+
+FHoudiniOutputHarvest*
+FHoudiniOutputHarvest::GetActive()
+{
+	return THoudiniScopedActiveInstance<FHoudiniOutputHarvest>::GetActive(ActiveOutputHarvest);
+}
+
+bool
+FHoudiniOutputHarvest::HarvestGeo(const HAPI_GeoInfo& InGeoInfo, const int32& InCookCount, const bool& bInCanReuse)
+{
+	if (!ActiveScope.IsActive())
+		return false;
+
+	const HAPI_NodeId GeoId = InGeoInfo.nodeId;
+	if (Geos.Contains(GeoId))
+		return true;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputHarvest::HarvestGeo);
+
+	const TPair<int32, HAPI_NodeId> CacheKey(SessionIndex, GeoId);
+	const int32 PartCount = FMath::Max(InGeoInfo.partCount, 0);
+
+	// Reuse the geo harvested on a previous cook if it hasn't cooked since
+	if (bInCanReuse)
+	{
+		FScopeLock ScopeLock(&HarvestedGeosLock);
+		TSharedPtr<const FGeoEntry>* CachedEntry = HarvestedGeos.Find(CacheKey);
+		if (CachedEntry && (*CachedEntry)->CookCount == InCookCount && (*CachedEntry)->Parts.Num() == PartCount)
+		{
+			Geos.Add(GeoId, *CachedEntry);
+			NumHapiCallsSaved += (*CachedEntry)->NumHapiCalls;
+			NumGeosReused++;
+			return true;
+		}
+	}
+
+	TSharedPtr<FGeoEntry> Entry = MakeShared<FGeoEntry>();
+	Entry->CookCount = InCookCount;
+	Entry->Parts.SetNum(PartCount);
+
+	// Location of each part's names in the handles array, so all the names
+	// of the geo can be resolved with a single string batch
+	struct FPartNames
+	{
+		int32 NameIndex = INDEX_NONE;
+		int32 AttributeNamesStart[HAPI_ATTROWNER_MAX] = {};
+	};
+	TArray<FPartNames> PartNames;
+	PartNames.SetNum(PartCount);
+	TArray<HAPI_StringHandle> NameHandles;
+
+	int32 NumCalls = 0;
+	for (int32 PartId = 0; PartId < PartCount; ++PartId)
+	{
+		FHoudiniHarvestedPart& CurrentPart = Entry->Parts[PartId];
+		FHoudiniApi::PartInfo_Init(&CurrentPart.PartInfo);
+
+		NumCalls++;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+			FHoudiniEngine::Get().GetSession(), GeoId, PartId, &CurrentPart.PartInfo))
+		{
+			continue;
+		}
+
+		CurrentPart.bIsValid = true;
+		CurrentPart.bHasAttributeNames = true;
+		PartNames[PartId].NameIndex = NameHandles.Add(CurrentPart.PartInfo.nameSH);
+
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+		{
+			const int32 AttribCount = CurrentPart.PartInfo.attributeCounts[OwnerIdx];
+			const int32 Start = NameHandles.Num();
+			PartNames[PartId].AttributeNamesStart[OwnerIdx] = Start;
+			if (AttribCount <= 0)
+				continue;
+
+			NameHandles.AddUninitialized(AttribCount);
+
+			NumCalls++;
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+				FHoudiniEngine::Get().GetSession(), GeoId, PartId, (HAPI_AttributeOwner)OwnerIdx,
+				&NameHandles[Start], AttribCount))
+			{
+				// Attribute lookups on this part will have to call HAPI
+				CurrentPart.bHasAttributeNames = false;
+				NameHandles.SetNum(Start);
+			}
+		}
+	}
+
+	TArray<FString> Names;
+	bool bNamesResolved = true;
+	if (NameHandles.Num() > 0)
+	{
+		// GetStringBatchSize + GetStringBatch
+		NumCalls += 2;
+		bNamesResolved = FHoudiniEngineString::SHArrayToFStringArray(NameHandles, Names);
+	}
+
+	for (int32 PartId = 0; PartId < PartCount; ++PartId)
+	{
+		FHoudiniHarvestedPart& CurrentPart = Entry->Parts[PartId];
+		if (!CurrentPart.bIsValid)
+			continue;
+
+		if (!bNamesResolved)
+		{
+			// Fall back to resolving the part name on its own
+			CurrentPart.bHasAttributeNames = false;
+			FHoudiniOutputTranslator::CachePartInfo(CurrentPart.PartInfo, CurrentPart.PartInfoCache);
+			continue;
+		}
+
+		FHoudiniOutputTranslator::CachePartInfo(
+			CurrentPart.PartInfo, Names[PartNames[PartId].NameIndex], CurrentPart.PartInfoCache);
+
+		if (!CurrentPart.bHasAttributeNames)
+			continue;
+
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+		{
+			const int32 AttribCount = CurrentPart.PartInfo.attributeCounts[OwnerIdx];
+			if (AttribCount > 0)
+				CurrentPart.AttributeNames[OwnerIdx].Append(&Names[PartNames[PartId].AttributeNamesStart[OwnerIdx]], AttribCount);
+		}
+	}
+
+	Entry->NumHapiCalls = NumCalls;
+	NumHapiCalls += NumCalls;
+
+	{
+		FScopeLock ScopeLock(&HarvestedGeosLock);
+		if (bInCanReuse)
+		{
+			if (HarvestedGeos.Num() >= MaxHarvestedGeos && !HarvestedGeos.Contains(CacheKey))
+				HarvestedGeos.Empty();
+
+			HarvestedGeos.Add(CacheKey, Entry);
+		}
+		else
+		{
+			HarvestedGeos.Remove(CacheKey);
+		}
+	}
+
+	Geos.Add(GeoId, Entry);
+
+	return true;
+}
+
+const FHoudiniHarvestedPart*
+FHoudiniOutputHarvest::FindHarvestedPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId) const
+{
+	const TSharedPtr<const FGeoEntry>* Entry = Geos.Find(InGeoId);
+	if (!Entry || !(*Entry)->Parts.IsValidIndex(InPartId))
+		return nullptr;
+
+	return &(*Entry)->Parts[InPartId];
+}
+
+const FHoudiniHarvestedPart*
+FHoudiniOutputHarvest::FindPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId)
+{
+	const FHoudiniHarvestedPart* HarvestedPart = FindHarvestedPart(InGeoId, InPartId);
+	if (HarvestedPart)
+	{
+		// GetPartInfo
+		NumHapiCallsSaved++;
+	}
+
+	return HarvestedPart;
+}
+
+bool
+FHoudiniOutputHarvest::FindAttributeOwner(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char* InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeOwner& OutOwner)
+{
+	FHoudiniOutputHarvest* Harvest = GetActive();
+	if (!Harvest || !InAttribName)
+		return false;
+
+	const FHoudiniHarvestedPart* HarvestedPart = Harvest->FindHarvestedPart(InGeoId, InPartId);
+	if (!HarvestedPart || !HarvestedPart->bIsValid || !HarvestedPart->bHasAttributeNames)
+		return false;
+
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	auto HasAttribute = [&AttribName, HarvestedPart](const int32& InOwnerIdx)
+	{
+		return HarvestedPart->AttributeNames[InOwnerIdx].ContainsByPredicate([&AttribName](const FString& Name)
+		{
+			// Attribute names are case sensitive
+			return Name.Equals(AttribName, ESearchCase::CaseSensitive);
+		});
+	};
+
+	OutOwner = HAPI_ATTROWNER_INVALID;
+	if (InOwner == HAPI_ATTROWNER_INVALID)
+	{
+		// Every owner the attribute isn't on would have been queried
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+		{
+			if (HasAttribute(OwnerIdx))
+			{
+				OutOwner = (HAPI_AttributeOwner)OwnerIdx;
+				break;
+			}
+
+			Harvest->NumHapiCallsSaved++;
+		}
+	}
+	else if (InOwner >= 0 && InOwner < HAPI_ATTROWNER_MAX)
+	{
+		if (HasAttribute(InOwner))
+			OutOwner = InOwner;
+		else
+			Harvest->NumHapiCallsSaved++;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniOutputHarvest::GetAttributeNames(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const HAPI_AttributeOwner& InOwner,
+	TArray<FString>& OutAttributeNames)
+{
+	FHoudiniOutputHarvest* Harvest = GetActive();
+	if (!Harvest || InOwner < 0 || InOwner >= HAPI_ATTROWNER_MAX)
+		return false;
+
+	const FHoudiniHarvestedPart* HarvestedPart = Harvest->FindHarvestedPart(InGeoId, InPartId);
+	if (!HarvestedPart || !HarvestedPart->bIsValid || !HarvestedPart->bHasAttributeNames)
+		return false;
+
+	OutAttributeNames = HarvestedPart->AttributeNames[InOwner];
+
+	// GetPartInfo + GetAttributeNames
+	Harvest->NumHapiCallsSaved += 2;
+
+	return true;
+}
+
+void
+FHoudiniOutputHarvest::Reset()
+{
+	FScopeLock ScopeLock(&HarvestedGeosLock);
+	HarvestedGeos.Empty();
+}
@@ -0,0 +1,140 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniGeoPartObject.h"
+#include "HoudiniScopedActiveInstance.h"
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+// Infos and attribute names harvested for a part.
+struct HOUDINIENGINE_API FHoudiniHarvestedPart
+{
+	HAPI_PartInfo PartInfo;
+	FHoudiniPartInfo PartInfoCache;
+
+	// False if the part's infos couldn't be retrieved.
+	bool bIsValid = false;
+
+	// Names of the part's attributes, per owner. Only valid if bHasAttributeNames is true.
+	TArray<FString> AttributeNames[HAPI_ATTROWNER_MAX];
+	bool bHasAttributeNames = false;
+};
+
+// Harvesting stage of the output translation: the part infos and attribute names of the
+// output geos are fetched once per geo, instead of being queried again for each part by
+// the part type and attribute checks.
+//
+// The harvested geos are kept across cooks, and reused as long as the geo's cook count
+// hasn't changed.
+//
+// While a harvest is in scope, it is the active harvest: the attribute checks and lookups of
+// FHoudiniEngineUtils answer from it for the parts it has harvested, and only call HAPI when
+// the attribute exists. Harvests can be nested, the innermost one is active.
+class HOUDINIENGINE_API FHoudiniOutputHarvest
+{
+public:
+
+	FHoudiniOutputHarvest();
+	~FHoudiniOutputHarvest();
+
+	// Returns the harvest attribute lookups should be answered from, or null.
+	static FHoudiniOutputHarvest* GetActive();
+
+	// Harvests the infos and attribute names of all the parts of a geo.
+	// If bInCanReuse is true, the geo harvested on a previous cook is used if its cook count
+	// matches InCookCount, otherwise the harvested geo isn't kept for later cooks.
+	// Returns false if the harvest isn't active.
+	bool HarvestGeo(const HAPI_GeoInfo& InGeoInfo, const int32& InCookCount, const bool& bInCanReuse);
+
+	// Returns the harvested part, or null if it hasn't been harvested.
+	const FHoudiniHarvestedPart* FindPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId);
+
+	// Looks an attribute up in the names harvested by the active harvest.
+	// Returns false if the part hasn't been harvested. Otherwise, OutOwner is set to the owner
+	// holding the attribute (the first one if InOwner is HAPI_ATTROWNER_INVALID),
+	// or to HAPI_ATTROWNER_INVALID if the attribute doesn't exist.
+	static bool FindAttributeOwner(
+		const HAPI_NodeId& InGeoId,
+		const HAPI_PartId& InPartId,
+		const char* InAttribName,
+		const HAPI_AttributeOwner& InOwner,
+		HAPI_AttributeOwner& OutOwner);
+
+	// Returns the names of the attributes of the given owner harvested by the active harvest.
+	// Returns false if the part hasn't been harvested.
+	static bool GetAttributeNames(
+		const HAPI_NodeId& InGeoId,
+		const HAPI_PartId& InPartId,
+		const HAPI_AttributeOwner& InOwner,
+		TArray<FString>& OutAttributeNames);
+
+	// Forgets the geos harvested on previous cooks. Must be called when their session is lost.
+	static void Reset();
+
+	// HAPI calls issued by this harvest
+	int32 GetNumHapiCalls() const { return NumHapiCalls; };
+	// HAPI calls that were answered from this harvest instead
+	int32 GetNumHapiCallsSaved() const { return NumHapiCallsSaved; };
+	// Geos harvested on a previous cook that were reused
+	int32 GetNumGeosReused() const { return NumGeosReused; };
+
+private:
+
+	FHoudiniOutputHarvest(const FHoudiniOutputHarvest&) = delete;
+	FHoudiniOutputHarvest& operator=(const FHoudiniOutputHarvest&) = delete;
+
+	struct FGeoEntry
+	{
+		int32 CookCount = -1;
+		// HAPI calls issued when harvesting the geo
+		int32 NumHapiCalls = 0;
+		TArray<FHoudiniHarvestedPart> Parts;
+	};
+
+	const FHoudiniHarvestedPart* FindHarvestedPart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId) const;
+
+	// Geos harvested on previous cooks, keyed by session and geo node
+	static FCriticalSection HarvestedGeosLock;
+	static TMap<TPair<int32, HAPI_NodeId>, TSharedPtr<const FGeoEntry>> HarvestedGeos;
+
+	// Geos harvested for this cook
+	TMap<HAPI_NodeId, TSharedPtr<const FGeoEntry>> Geos;
+
+	// Session the geos have been harvested from
+	int32 SessionIndex;
+
+	// Makes this the active harvest while it is in scope
+	THoudiniScopedActiveInstance<FHoudiniOutputHarvest> ActiveScope;
+
+	int32 NumHapiCalls;
+	int32 NumHapiCallsSaved;
+	int32 NumGeosReused;
+};
@@ -46,6 +46,9 @@
 
 #include "HoudiniDataTableTranslator.h"
 #include "HoudiniMeshTranslator.h"
+#include "HoudiniStaticMeshBuildBatch.h"
+#include "HoudiniMeshPartGather.h"
+#include "HoudiniOutputHarvest.h"
 #include "HoudiniSkeletalMeshTranslator.h"
 #include "HoudiniSplineTranslator.h"
 #include "HoudiniLandscapeTranslator.h"
@@ -79,6 +82,8 @@
 #include "HoudiniHLODLayerUtils.h"
 #include "HoudiniAnimationTranslator.h"
 #include "HoudiniFoliageUtils.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniWorldActorIndex.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
@@ -99,6 +104,10 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	// before the original landscape gets destroyed.
 	TArray<UHoudiniOutput*> DeferredClearOutputs;
 
+	// Tracks the HAPI calls issued when building the outputs, the landscape data held in memory
+	// and the instances updated while translating the outputs
+	FHoudiniEngineOutputStats OutputStats;
+
 	// Check if the HDA has been marked as not producing outputs
 	if (!HAC->bOutputless)
 	{
@@ -107,7 +116,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		TMap<HAPI_NodeId, int32> OutputNodeCookCounts = HAC->GetOutputNodeCookCounts();
 		if (FHoudiniOutputTranslator::BuildAllOutputs(
 			HAC->GetAssetId(), HAC, OutputNodes, OutputNodeCookCounts,
-			HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos, HAC->bUseOutputNodes))
+			HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos, HAC->bUseOutputNodes, &OutputStats))
 		{
 			// NOTE: For now we are currently forcing all outputs to be cleared here. There is still an issue where, in some
 			// circumstances, landscape tiles disappear when clearing outputs after processing.
@@ -288,6 +297,31 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	// (this can easily happen when using packed prims)
 	TMap<FHoudiniMaterialIdentifier, UMaterialInterface*> AllOutputMaterials;
 
+	// Collects the static meshes created by the mesh outputs so they are built together.
+	// Their components are assigned once they have been built, before processing the instancers.
+	FHoudiniStaticMeshBuildBatch MeshBuildBatch(HoudiniAssetNameString);
+	TArray<UHoudiniOutput*> ProxyMeshOutputs;
+
+	// Gather the HAPI data of the mesh parts in worker tasks while the outputs are processed,
+	// so the mesh translator only has to create the meshes and components on the game thread.
+	// Only the parts whose meshes will be rebuilt have their vertex list and attributes fetched.
+	FHoudiniMeshPartGather MeshPartGather;
+	for (UHoudiniOutput* CurOutput : HAC->Outputs)
+	{
+		if (!IsValid(CurOutput) || CurOutput->GetType() != EHoudiniOutputType::Mesh)
+			continue;
+
+		if (!HAC->IsOutputTypeSupported(CurOutput->GetType()))
+			continue;
+
+		const bool bRebuildAllParts = CurOutput->GetOutputObjects().Num() <= 0 || CurOutput->HasAnyCurrentProxy();
+		for (const FHoudiniGeoPartObject& HGPO : CurOutput->GetHoudiniGeoPartObjects())
+		{
+			MeshPartGather.AddPart(HGPO, bRebuildAllParts || HGPO.bHasGeoChanged || HGPO.bHasPartChanged);
+		}
+	}
+	MeshPartGather.Start();
+
 	TArray<UPackage*> CreatedPackages;
 	for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
 	{
@@ -350,11 +384,9 @@ FHoudiniOutputTranslator::UpdateOutputs(
 
 				NumVisibleOutputs++;
 
-				// Look for UHoudiniStaticMesh in the output, and set bOutHasHoudiniStaticMeshOutput accordingly
-				if (bIsProxyStaticMeshEnabled && !bOutHasHoudiniStaticMeshOutput)
-				{
-					bOutHasHoudiniStaticMeshOutput = bOutHasHoudiniStaticMeshOutput || CurOutput->HasAnyCurrentProxy();
-				}
+				// Look for UHoudiniStaticMesh in the output once its components have been assigned
+				if (bIsProxyStaticMeshEnabled)
+					ProxyMeshOutputs.Add(CurOutput);
 
 				break;
 			}
@@ -427,7 +459,8 @@ FHoudiniOutputTranslator::UpdateOutputs(
 				PackageParams,
 				LandscapeMap,
 				ClearedLandscapeLayers,
-				CreatedPackages);
+				CreatedPackages,
+				&OutputStats);
 
 			bHasLandscape = true;
 
@@ -509,12 +542,49 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		}
 	}
 
+	if (OutputStats.NumHapiCalls > 0 || OutputStats.NumHapiCallsSaved > 0)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Output harvest: %d HAPI calls, %d calls answered from harvested infos, %d geos reused from the previous cook"),
+			OutputStats.NumHapiCalls,
+			OutputStats.NumHapiCallsSaved,
+			OutputStats.NumHarvestedGeosReused);
+	}
+
+	if (OutputStats.LandscapeDataPeakBytes > 0)
+	{
+		HOUDINI_LANDSCAPE_MESSAGE(TEXT("Landscape outputs peak data memory: %.2f MB, streamed bands: %d"),
+			OutputStats.LandscapeDataPeakBytes / (1024.0 * 1024.0),
+			OutputStats.NumLandscapeTilesStreamed);
+	}
+
+	// Build the static meshes and assign the mesh outputs' components
+	MeshBuildBatch.Finish();
+
+	// Look for UHoudiniStaticMesh in the outputs, and set bOutHasHoudiniStaticMeshOutput accordingly
+	for (UHoudiniOutput* CurOutput : ProxyMeshOutputs)
+	{
+		if (IsValid(CurOutput) && CurOutput->HasAnyCurrentProxy())
+		{
+			bOutHasHoudiniStaticMeshOutput = true;
+			break;
+		}
+	}
+
 	bool HasGeometryCollection = false;
 	
 	// Now that all meshes have been created, process the instancers
-	int InstanceCount = FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(HAC->Outputs, OuterComponent, PackageParams);
+	int InstanceCount = FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(HAC->Outputs, OuterComponent, PackageParams, nullptr, &OutputStats);
 	NumVisibleOutputs += InstanceCount;
 
+	if (OutputStats.NumInstancesAdded > 0 || OutputStats.NumInstancesRemoved > 0 || OutputStats.NumInstancesUpdated > 0 || OutputStats.NumInstancesCustomDataUpdated > 0)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Instancer outputs: %d instances added, %d removed, %d updated, %d custom data updated"),
+			OutputStats.NumInstancesAdded,
+			OutputStats.NumInstancesRemoved,
+			OutputStats.NumInstancesUpdated,
+			OutputStats.NumInstancesCustomDataUpdated);
+	}
+
 	for (auto& CurOutput : InstancerOutputs)
 	{
 		if (!HasGeometryCollection && FHoudiniGeometryCollectionTranslator::IsGeometryCollectionInstancer(CurOutput))
@@ -693,6 +763,29 @@ FHoudiniOutputTranslator::UpdateOutputs(
 
 	FHoudiniLevelInstanceUtils::FetchLevelInstanceParameters(HAC->Outputs);
 
+	// The output components and actors were created or resized without the editor's moved notifications:
+	// refresh their bounds in the world actor index used by the world inputs' bound selectors.
+	FHoudiniWorldActorIndex::NotifyActorChanged(HAC->GetOwner());
+	for (auto& CurrentOutput : HAC->Outputs)
+	{
+		for (auto& It : CurrentOutput->OutputObjects)
+		{
+			FHoudiniOutputObject& Obj = It.Value;
+			FHoudiniWorldActorIndex::NotifyActorChanged(Cast<AActor>(Obj.OutputObject));
+			for (const TSoftObjectPtr<AActor>& OutputActor : Obj.OutputActors)
+				FHoudiniWorldActorIndex::NotifyActorChanged(OutputActor.Get());
+
+			for (UObject* OutputComponent : Obj.OutputComponents)
+			{
+				if (UActorComponent* ActorComponent = Cast<UActorComponent>(OutputComponent))
+				{
+					if (ActorComponent->GetOwner() != HAC->GetOwner())
+						FHoudiniWorldActorIndex::NotifyActorChanged(ActorComponent->GetOwner());
+				}
+			}
+		}
+	}
+
 	if (CreatedPackages.Num() > 0)
 	{
 		// Save created packages. For example, we don't want landscape layers deleted 
@@ -743,6 +836,9 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 	// Keep track of all generated houdini materials to avoid recreating them over and over
 	TMap<FHoudiniMaterialIdentifier, UMaterialInterface*> AllOutputMaterials;
 
+	// Build all the refined meshes together, and assign their components once they are built
+	FHoudiniStaticMeshBuildBatch MeshBuildBatch;
+
 	bool bFoundProxies = false;
 	TArray<UHoudiniOutput*> InstancerOutputs;
 	for (auto& CurOutput : HAC->Outputs)
@@ -780,6 +876,8 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 		}
 	}
 
+	MeshBuildBatch.Finish();
+
 	// Rebuild instancers if we built any static meshes from proxies
 	if (bFoundProxies)
 	{
@@ -1057,7 +1155,8 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	TArray<UHoudiniOutput*>& InOldOutputs,
 	TArray<UHoudiniOutput*>& OutNewOutputs,
 	const bool& InOutputTemplatedGeos,
-	const bool& InUseOutputNodes)
+	const bool& InUseOutputNodes,
+	FHoudiniEngineOutputStats* OutStats)
 {
 	// NOTE: This function still gathers output nodes from the asset id. This is old behaviour.
 	//       Output nodes are now being gathered before cooking starts and is passed in through
@@ -1240,6 +1339,10 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	}
 
 	TMap<HAPI_NodeId, int32> CurrentCookCounts;
+
+	// Part infos and attribute names are harvested once per geo,
+	// and answer the part type and attribute checks below.
+	FHoudiniOutputHarvest OutputHarvest;
 	
 	// Iterate through all objects.
 	int32 OutputIdx = 1;
@@ -1373,12 +1476,14 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			GeoInfos[GeoIdx].hasGeoChanged = CurrentHapiGeoInfo.hasGeoChanged || bHasChanged; 
 
 			// Cook editable/templated nodes to get their parts.
+			bool bGeoWasCooked = false;
 			if ((ForceNodesToCook.Contains(CurrentHapiGeoInfo.nodeId) && CurrentHapiGeoInfo.partCount <= 0)
 				|| (CurrentHapiGeoInfo.isEditable && CurrentHapiGeoInfo.partCount <= 0)
 				|| (CurrentHapiGeoInfo.isTemplated && CurrentHapiGeoInfo.partCount <= 0)
 				|| (!CurrentHapiGeoInfo.isDisplayGeo && CurrentHapiGeoInfo.partCount <= 0))
 			{
 				FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
+				bGeoWasCooked = true;
 
 				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
 					FHoudiniEngine::Get().GetSession(),
@@ -1390,6 +1495,12 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			FHoudiniGeoInfo CurrentGeoInfo;
 			CacheGeoInfo(CurrentHapiGeoInfo, CurrentGeoInfo);
 
+			// Harvest the infos and attribute names of all the geo's parts.
+			// Templated geos are cooked again for each of their parts, so they aren't harvested.
+			// A geo we've just cooked doesn't match its cook count anymore, so it isn't kept for later cooks.
+			if (!(CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos))
+				OutputHarvest.HarvestGeo(CurrentHapiGeoInfo, CurrentCookCounts[CurrentHapiGeoInfo.nodeId], !bGeoWasCooked);
+
 			// Simply create an empty array for this geo's group names
 			// We might need it later for splitting
 			TArray<FString> GeoGroupNames;
@@ -1493,7 +1604,13 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				}
 
 				bool bPartInfoFailed = false;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+				const FHoudiniHarvestedPart* HarvestedPart = OutputHarvest.FindPart(CurrentHapiGeoInfo.nodeId, PartId);
+				if (HarvestedPart)
+				{
+					CurrentHapiPartInfo = HarvestedPart->PartInfo;
+					bPartInfoFailed = !HarvestedPart->bIsValid;
+				}
+				else if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
 					FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
 				{
 					bPartInfoFailed = true;
@@ -1530,7 +1647,10 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 
 				// Convert/cache the part info
 				FHoudiniPartInfo CurrentPartInfo;
-				CachePartInfo(CurrentHapiPartInfo, CurrentPartInfo);
+				if (HarvestedPart)
+					CurrentPartInfo = HarvestedPart->PartInfoCache;
+				else
+					CachePartInfo(CurrentHapiPartInfo, CurrentPartInfo);
 
 				// Retrieve part name.
 				FString CurrentPartName = CurrentPartInfo.Name;
@@ -1645,7 +1765,13 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				}
 
 				bool bPartInfoFailed = false;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+				const FHoudiniHarvestedPart* HarvestedPart = OutputHarvest.FindPart(CurrentHapiGeoInfo.nodeId, PartId);
+				if (HarvestedPart)
+				{
+					CurrentHapiPartInfo = HarvestedPart->PartInfo;
+					bPartInfoFailed = !HarvestedPart->bIsValid;
+				}
+				else if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
 					FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
 				{
 					bPartInfoFailed = true;
@@ -1699,7 +1825,10 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 
 				// Convert/cache the part info
 				FHoudiniPartInfo CurrentPartInfo;
-				CachePartInfo(CurrentHapiPartInfo, CurrentPartInfo);
+				if (HarvestedPart)
+					CurrentPartInfo = HarvestedPart->PartInfoCache;
+				else
+					CachePartInfo(CurrentHapiPartInfo, CurrentPartInfo);
 
 				// Retrieve part name.
 				FString CurrentPartName = CurrentPartInfo.Name;
@@ -2325,6 +2454,12 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	}
 	// END: for OBJ
 
+	if (OutStats)
+	{
+		OutStats->NotifyHapiCalls(
+			OutputHarvest.GetNumHapiCalls(), OutputHarvest.GetNumHapiCallsSaved(), OutputHarvest.GetNumGeosReused());
+	}
+
 	// Update the output/HGPO associations from the map
 	// Clear the old HGPO since we don't need them anymore
 	for (auto& CurrentOuput : OutNewOutputs)
@@ -2609,10 +2744,18 @@ FHoudiniOutputTranslator::ConvertHapiPartType(const HAPI_PartType& InType)
 void
 FHoudiniOutputTranslator::CachePartInfo(const HAPI_PartInfo& InPartInfo, FHoudiniPartInfo& OutPartInfoCache)
 {
-	OutPartInfoCache.PartId = InPartInfo.id;
-	
+	FString PartName;
 	FHoudiniEngineString hapiSTR(InPartInfo.nameSH);
-	hapiSTR.ToFString(OutPartInfoCache.Name);
+	hapiSTR.ToFString(PartName);
+
+	CachePartInfo(InPartInfo, PartName, OutPartInfoCache);
+};
+
+void
+FHoudiniOutputTranslator::CachePartInfo(const HAPI_PartInfo& InPartInfo, const FString& InPartName, FHoudiniPartInfo& OutPartInfoCache)
+{
+	OutPartInfoCache.PartId = InPartInfo.id;
+	OutPartInfoCache.Name = InPartName;
 
 	OutPartInfoCache.Type = ConvertHapiPartType(InPartInfo.type);
 
@@ -2730,6 +2873,9 @@ FHoudiniOutputTranslator::ClearAndRemoveOutputs(UHoudiniAssetComponent *InHAC, T
 	}
 
 	InHAC->Outputs.Empty();	
+
+	// The outputs of the last cook are gone
+	InHAC->CookCacheKey.Empty();
 }
 
 void 
@@ -38,6 +38,7 @@ struct FHoudiniGeoInfo;
 struct FHoudiniPartInfo;
 struct FHoudiniVolumeInfo;
 struct FHoudiniCurveInfo;
+struct FHoudiniEngineOutputStats;
 
 enum class EHoudiniOutputType : uint8;
 enum class EHoudiniGeoType : uint8;
@@ -71,7 +72,8 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 		TArray<UHoudiniOutput*>& InOldOutputs,
 		TArray<UHoudiniOutput*>& OutNewOutputs,
 		const bool& InOutputTemplatedGeos,
-		const bool& InUseOutputNodes);
+		const bool& InUseOutputNodes,
+		FHoudiniEngineOutputStats* OutStats = nullptr);
 
 	static bool UpdateChangedOutputs(
 		UHoudiniAssetComponent* HAC);
@@ -85,6 +87,7 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 	static void CacheObjectInfo(const HAPI_ObjectInfo& InObjInfo, FHoudiniObjectInfo& OutObjInfoCache);
 	static void CacheGeoInfo(const HAPI_GeoInfo& InGeoInfo, FHoudiniGeoInfo& OutGeoInfoCache);
 	static void CachePartInfo(const HAPI_PartInfo& InPartInfo, FHoudiniPartInfo& OutPartInfoCache);
+	static void CachePartInfo(const HAPI_PartInfo& InPartInfo, const FString& InPartName, FHoudiniPartInfo& OutPartInfoCache);
 	static void CacheVolumeInfo(const HAPI_VolumeInfo& InVolumeInfo, FHoudiniVolumeInfo& OutVolumeInfoCache);
 	static void CacheCurveInfo(const HAPI_CurveInfo& InCurveInfo, FHoudiniCurveInfo& OutCurveInfoCache);
 
@@ -0,0 +1,375 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPDGEventPump.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGEventPumpInterval(
+	TEXT("HoudiniEngine.PDGEventPumpInterval"),
+	0.05f,
+	TEXT("Interval, in seconds, at which the PDG event pump thread drains the PDG events.\n")
+);
+
+namespace
+{
+	// Number of events requested per GetPDGEvents call.
+	constexpr int32 PDGEventBufferSize = 1024;
+
+	bool
+	IsTransientWorkItemState(const int32 InState)
+	{
+		switch ((HAPI_PDG_WorkItemState)InState)
+		{
+			case HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_UNDEFINED:
+			case HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_UNCOOKED:
+			case HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_WAITING:
+			case HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_SCHEDULED:
+			case HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_COOKING:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	// Returns true for the event types that FHoudiniPDGManager::ProcessPDGEvent acts on.
+	bool
+	IsHandledEventType(const int32 InEventType)
+	{
+		switch ((HAPI_PDG_EventType)InEventType)
+		{
+			case HAPI_PDG_EVENT_NULL:
+			case HAPI_PDG_EVENT_NODE_CLEAR:
+			case HAPI_PDG_EVENT_WORKITEM_ADD:
+			case HAPI_PDG_EVENT_WORKITEM_REMOVE:
+			case HAPI_PDG_EVENT_COOK_WARNING:
+			case HAPI_PDG_EVENT_COOK_ERROR:
+			case HAPI_PDG_EVENT_COOK_COMPLETE:
+			case HAPI_PDG_EVENT_DIRTY_START:
+			case HAPI_PDG_EVENT_DIRTY_STOP:
+			case HAPI_PDG_EVENT_WORKITEM_STATE_CHANGE:
+			case HAPI_PDG_EVENT_COOK_START:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	uint64
+	GetWorkItemKey(const HAPI_PDG_EventInfo& InEventInfo)
+	{
+		return ((uint64)(uint32)InEventInfo.nodeId << 32) | (uint64)(uint32)InEventInfo.workItemId;
+	}
+}
+
+FHoudiniPDGEventPump::FHoudiniPDGEventPump()
+	: Thread(nullptr)
+	, WakeEvent(nullptr)
+	, bStopping(false)
+	, bLoggedEventsError(false)
+{
+	// Auto-reset event, a single Wait() consumes a Trigger().
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FHoudiniPDGEventPump::~FHoudiniPDGEventPump()
+{
+	Shutdown();
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+void
+FHoudiniPDGEventPump::Start()
+{
+	if (Thread)
+		return;
+
+	bStopping = false;
+	bLoggedEventsError = false;
+	Thread = FRunnableThread::Create(this, TEXT("HoudiniPDGEventPumpThread"), 0, TPri_Normal);
+}
+
+void
+FHoudiniPDGEventPump::Shutdown()
+{
+	// The pump thread can't wait for itself, it will exit after the current drain
+	if (Thread && FPlatformTLS::GetCurrentThreadId() == Thread->GetThreadID())
+	{
+		Stop();
+		return;
+	}
+
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	bStopping = false;
+
+	// The batches refer to graph contexts / work items of the session the pump was draining
+	FScopeLock ScopeLock(&BatchesLock);
+	PendingBatches.Empty();
+}
+
+void
+FHoudiniPDGEventPump::Wake()
+{
+	if (WakeEvent)
+		WakeEvent->Trigger();
+}
+
+void
+FHoudiniPDGEventPump::DequeueBatches(TArray<FHoudiniPDGEventBatch>& OutBatches)
+{
+	FScopeLock ScopeLock(&BatchesLock);
+	OutBatches = MoveTemp(PendingBatches);
+	PendingBatches.Reset();
+}
+
+uint32
+FHoudiniPDGEventPump::Run()
+{
+	while (!bStopping)
+	{
+		DrainEvents();
+
+		if (bStopping)
+			break;
+
+		const float Interval = CVarHoudiniEnginePDGEventPumpInterval.GetValueOnAnyThread();
+		if (WakeEvent)
+			WakeEvent->Wait(FMath::Max(1u, static_cast<uint32>(Interval * 1000.0f)));
+		else
+			FPlatformProcess::SleepNoStats(FMath::Max(Interval, 0.001f));
+	}
+
+	return 0;
+}
+
+void
+FHoudiniPDGEventPump::Stop()
+{
+	bStopping = true;
+
+	// Wake up the pump thread so it can exit.
+	if (WakeEvent)
+		WakeEvent->Trigger();
+}
+
+void
+FHoudiniPDGEventPump::DrainEvents()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGEventPump::DrainEvents);
+
+	// PDG always runs in the main session
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+		return;
+
+	int32 NumContexts = 0;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGGraphContextsCount(Session, &NumContexts) || NumContexts <= 0)
+		return;
+
+	ContextNames.SetNum(NumContexts);
+	ContextIds.SetNum(NumContexts);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGGraphContexts(
+		Session, ContextNames.GetData(), ContextIds.GetData(), 0, NumContexts))
+	{
+		return;
+	}
+
+	if (EventBuffer.Num() != PDGEventBufferSize)
+		EventBuffer.SetNum(PDGEventBufferSize);
+
+	for (const HAPI_PDG_GraphContextId& ContextId : ContextIds)
+	{
+		TArray<HAPI_PDG_EventInfo> Events;
+		int32 NumReceivedEvents = 0;
+		int32 RemainingEventCount = 0;
+		do
+		{
+			if (bStopping)
+				return;
+
+			int32 EventCount = 0;
+			RemainingEventCount = 0;
+			HAPI_Result Result = FHoudiniApi::GetPDGEvents(
+				Session, ContextId, EventBuffer.GetData(), EventBuffer.Num(), &EventCount, &RemainingEventCount);
+
+			if (Result != HAPI_RESULT_SUCCESS)
+			{
+				// We poll every few ms, only log the first failure until events can be fetched again
+				if (!bLoggedEventsError)
+					HOUDINI_LOG_ERROR(TEXT("Failed to get PDG events, error code: %d"), Result);
+				bLoggedEventsError = true;
+				break;
+			}
+
+			bLoggedEventsError = false;
+
+			if (EventCount < 1)
+				break;
+
+			Events.Append(EventBuffer.GetData(), EventCount);
+			NumReceivedEvents += EventCount;
+		}
+		while (RemainingEventCount > 0);
+
+		if (NumReceivedEvents < 1)
+			continue;
+
+		CoalesceEvents(Events);
+
+		TMap<HAPI_PDG_WorkItemId, FHoudiniPDGWorkItemData> WorkItems;
+		FetchWorkItemData(Session, ContextId, Events, WorkItems);
+
+		FScopeLock ScopeLock(&BatchesLock);
+		FHoudiniPDGEventBatch* Batch = PendingBatches.FindByPredicate(
+			[ContextId](const FHoudiniPDGEventBatch& InBatch) { return InBatch.ContextId == ContextId; });
+
+		if (!Batch)
+		{
+			Batch = &PendingBatches.AddDefaulted_GetRef();
+			Batch->ContextId = ContextId;
+			Batch->Events = MoveTemp(Events);
+		}
+		else
+		{
+			// The game thread hasn't processed the previous events yet, coalesce them with the new ones
+			Batch->Events.Append(Events);
+			CoalesceEvents(Batch->Events);
+		}
+
+		Batch->NumReceivedEvents += NumReceivedEvents;
+		for (auto& WorkItem : WorkItems)
+			Batch->WorkItems.Add(WorkItem.Key, MoveTemp(WorkItem.Value));
+	}
+}
+
+void
+FHoudiniPDGEventPump::CoalesceEvents(TArray<HAPI_PDG_EventInfo>& InOutEvents)
+{
+	// Walk the events backwards, keeping track of the work items that have a later state change.
+	// Adding or removing a work item resets its state, so state changes are not dropped across these events.
+	TSet<uint64> WorkItemsWithLaterStateChange;
+	TBitArray<> KeepEvent(true, InOutEvents.Num());
+	for (int32 Idx = InOutEvents.Num() - 1; Idx >= 0; Idx--)
+	{
+		const HAPI_PDG_EventInfo& EventInfo = InOutEvents[Idx];
+		const HAPI_PDG_EventType EventType = (HAPI_PDG_EventType)EventInfo.eventType;
+		if (!IsHandledEventType(EventType))
+		{
+			// Unhandled events are only logged, if they have a message
+			KeepEvent[Idx] = EventInfo.msgSH > 0;
+			continue;
+		}
+
+		if (EventType == HAPI_PDG_EVENT_WORKITEM_STATE_CHANGE)
+		{
+			bool bAlreadyInSet = false;
+			WorkItemsWithLaterStateChange.Add(GetWorkItemKey(EventInfo), &bAlreadyInSet);
+			if (bAlreadyInSet && IsTransientWorkItemState(EventInfo.currentState) && EventInfo.msgSH <= 0)
+				KeepEvent[Idx] = false;
+		}
+		else if (EventType == HAPI_PDG_EVENT_WORKITEM_ADD || EventType == HAPI_PDG_EVENT_WORKITEM_REMOVE)
+		{
+			WorkItemsWithLaterStateChange.Remove(GetWorkItemKey(EventInfo));
+		}
+	}
+
+	int32 NumKept = 0;
+	for (int32 Idx = 0; Idx < InOutEvents.Num(); Idx++)
+	{
+		if (KeepEvent[Idx])
+			InOutEvents[NumKept++] = InOutEvents[Idx];
+	}
+	InOutEvents.SetNum(NumKept);
+}
+
+void
+FHoudiniPDGEventPump::FetchWorkItemData(
+	const HAPI_Session* InSession,
+	const HAPI_PDG_GraphContextId& InContextId,
+	const TArray<HAPI_PDG_EventInfo>& InEvents,
+	TMap<HAPI_PDG_WorkItemId, FHoudiniPDGWorkItemData>& OutWorkItems)
+{
+	for (const HAPI_PDG_EventInfo& EventInfo : InEvents)
+	{
+		const HAPI_PDG_EventType EventType = (HAPI_PDG_EventType)EventInfo.eventType;
+		const bool bCooked = EventType == HAPI_PDG_EVENT_WORKITEM_STATE_CHANGE
+			&& (EventInfo.currentState == HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_COOKED_SUCCESS
+				|| EventInfo.currentState == HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_COOKED_CACHE);
+
+		if (EventType != HAPI_PDG_EVENT_WORKITEM_ADD && !bCooked)
+			continue;
+
+		// The info fetched for a cooked event is up to date for any earlier event of the work item
+		const FHoudiniPDGWorkItemData* ExistingData = OutWorkItems.Find(EventInfo.workItemId);
+		if (ExistingData && (!bCooked || ExistingData->bOutputFilesFetched))
+			continue;
+
+		// On failure, the game thread will query and report the error itself
+		FHoudiniPDGWorkItemData Data;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetWorkItemInfo(
+			InSession, InContextId, EventInfo.workItemId, &Data.Info))
+		{
+			continue;
+		}
+
+		if (bCooked)
+		{
+			if (Data.Info.outputFileCount > 0)
+			{
+				Data.OutputFiles.SetNum(Data.Info.outputFileCount);
+				Data.bOutputFilesFetched = HAPI_RESULT_SUCCESS == FHoudiniApi::GetWorkItemOutputFiles(
+					InSession, EventInfo.nodeId, EventInfo.workItemId, Data.OutputFiles.GetData(), Data.Info.outputFileCount);
+
+				if (!Data.bOutputFilesFetched)
+					Data.OutputFiles.Empty();
+			}
+			else
+			{
+				Data.bOutputFilesFetched = true;
+			}
+		}
+
+		OutWorkItems.Add(EventInfo.workItemId, MoveTemp(Data));
+	}
+}
@@ -0,0 +1,131 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+
+class FEvent;
+class FRunnableThread;
+
+// Work item data fetched by the event pump along with the events that need it.
+struct FHoudiniPDGWorkItemData
+{
+	HAPI_PDG_WorkItemInfo Info;
+
+	// Only fetched for the cooked work items.
+	TArray<HAPI_PDG_WorkItemOutputFile> OutputFiles;
+	bool bOutputFilesFetched = false;
+};
+
+// The coalesced PDG events of a graph context, waiting to be processed on the game thread.
+struct FHoudiniPDGEventBatch
+{
+	HAPI_PDG_GraphContextId ContextId = -1;
+
+	// The events to process, in the order they were received.
+	TArray<HAPI_PDG_EventInfo> Events;
+
+	// Work item infos / output files for the work item add and cooked events, by work item id.
+	TMap<HAPI_PDG_WorkItemId, FHoudiniPDGWorkItemData> WorkItems;
+
+	// Number of events drained from HAPI for this batch, before coalescing.
+	int32 NumReceivedEvents = 0;
+};
+
+// Drains the PDG events of the graph contexts of the main session on a background thread.
+//
+// Events that the PDG manager does not handle are dropped, and the intermediate state changes of
+// a work item (waiting, scheduled, cooking...) are dropped when a later state change of the same
+// work item has been received. The work item infos and output files needed by the remaining add
+// and cooked events are fetched on the pump thread as well.
+// The game thread collects the resulting batches with DequeueBatches().
+class FHoudiniPDGEventPump : public FRunnable
+{
+public:
+
+	FHoudiniPDGEventPump();
+	virtual ~FHoudiniPDGEventPump();
+
+	// Starts the pump thread if it isn't running.
+	void Start();
+
+	// Stops the pump thread, waits for it to exit and discards the pending batches.
+	// From the pump thread itself, only requests the thread to stop.
+	void Shutdown();
+
+	bool IsRunning() const { return Thread != nullptr; }
+
+	// Wakes up the pump thread so it drains the events without waiting for the poll interval.
+	void Wake();
+
+	// Moves the pending batches to OutBatches.
+	void DequeueBatches(TArray<FHoudiniPDGEventBatch>& OutBatches);
+
+	// Removes the events the PDG manager does not need to process from InOutEvents.
+	static void CoalesceEvents(TArray<HAPI_PDG_EventInfo>& InOutEvents);
+
+	// FRunnable methods.
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+
+	// Drains and coalesces the events of all the graph contexts, and queues them.
+	void DrainEvents();
+
+	// Fetches the work item data needed to process InEvents.
+	static void FetchWorkItemData(
+		const HAPI_Session* InSession,
+		const HAPI_PDG_GraphContextId& InContextId,
+		const TArray<HAPI_PDG_EventInfo>& InEvents,
+		TMap<HAPI_PDG_WorkItemId, FHoudiniPDGWorkItemData>& OutWorkItems);
+
+	FRunnableThread* Thread;
+
+	// Event used to wake up the pump thread before the poll interval, or when stopping.
+	FEvent* WakeEvent;
+
+	// Stopping flag.
+	FThreadSafeBool bStopping;
+
+	// Batches waiting to be dequeued by the game thread, at most one per graph context.
+	FCriticalSection BatchesLock;
+	TArray<FHoudiniPDGEventBatch> PendingBatches;
+
+	// Only accessed by the pump thread.
+	TArray<HAPI_StringHandle> ContextNames;
+	TArray<HAPI_PDG_GraphContextId> ContextIds;
+	TArray<HAPI_PDG_EventInfo> EventBuffer;
+
+	// A failure to get the events has been logged and events haven't been fetched since.
+	bool bLoggedEventsError;
+};
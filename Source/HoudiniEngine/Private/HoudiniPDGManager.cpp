@@ -29,6 +29,7 @@
 #include "Modules/ModuleManager.h"
 #include "MessageEndpointBuilder.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 
 #include "HoudiniApi.h"
 #include "HoudiniAsset.h"
@@ -52,6 +53,28 @@ HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGImportTimeLimit(
+	TEXT("HoudiniEngine.PDGImportTimeLimit"),
+	0.05f,
+	TEXT("Time (in seconds) spent per tick loading work results or merging the results imported by the async importer.\n")
+	TEXT("At least one work result is processed per tick. Remaining results are processed on the next ticks.\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGImportMaxRequestsPerWorker(
+	TEXT("HoudiniEngine.PDGImportMaxRequestsPerWorker"),
+	4,
+	TEXT("Maximum number of work results sent to an async importer commandlet that haven't been imported yet.\n")
+	TEXT("Other work results stay queued until a commandlet can take them.\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGEventPump(
+	TEXT("HoudiniEngine.PDGEventPump"),
+	1,
+	TEXT("When enabled, the PDG events are drained and coalesced on a background thread.\n")
+	TEXT("0: Poll the PDG events on the game thread on every tick.\n")
+	TEXT("1: Use the PDG event pump thread (default).\n")
+);
+
 FHoudiniPDGManager::FHoudiniPDGManager()
 {
 }
@@ -761,7 +784,10 @@ FHoudiniPDGManager::Update()
 
 	// Do nothing if we dont have any valid PDG asset Link
 	if (PDGAssetLinks.Num() <= 0)
+	{
+		StopPDGEventPump();
 		return;
+	}
 
 	// Update the PDG contexts and handle all pdg events and work item status updates
 	UpdatePDGContexts();
@@ -775,6 +801,54 @@ FHoudiniPDGManager::Update()
 // Forward relevant events to PDGAssetLink objects.
 void
 FHoudiniPDGManager::UpdatePDGContexts()
+{
+	if (CVarHoudiniEnginePDGEventPump.GetValueOnGameThread() > 0)
+	{
+		PDGEventPump.Start();
+
+		// Process the events drained by the pump since the last tick
+		TArray<FHoudiniPDGEventBatch> EventBatches;
+		PDGEventPump.DequeueBatches(EventBatches);
+		for (FHoudiniPDGEventBatch& EventBatch : EventBatches)
+		{
+			for (HAPI_PDG_EventInfo& EventInfo : EventBatch.Events)
+			{
+				ProcessPDGEvent(EventBatch.ContextId, EventInfo, &EventBatch.WorkItems);
+			}
+
+			HOUDINI_LOG_MESSAGE(TEXT("PDG: Tick processed %d events (%d received)."), EventBatch.Events.Num(), EventBatch.NumReceivedEvents);
+		}
+	}
+	else
+	{
+		StopPDGEventPump();
+		PollPDGEvents();
+	}
+
+	for (auto CurAssetLink : PDGAssetLinks)
+	{
+		UHoudiniPDGAssetLink* const AssetLink = CurAssetLink.Get();
+		if (!IsValid(AssetLink))
+			continue;
+
+		// Check if the post bake delegate should be fired
+		AssetLink->BroadcastPostAutoBakeDelegateIfRequired();
+
+		// Refresh UI if necessary, otherwise just make sure the work item tally is up to date
+		if (AssetLink->bNeedsUIRefresh)
+		{
+			FHoudiniPDGManager::RefreshPDGAssetLinkUI(AssetLink);
+			AssetLink->bNeedsUIRefresh = false;
+		}
+		else
+		{
+			AssetLink->UpdateWorkItemTally();
+		}
+	}
+}
+
+void
+FHoudiniPDGManager::PollPDGEvents()
 {
 	// Get current PDG graph contexts
 	ReinitializePDGContext();
@@ -831,27 +905,13 @@ FHoudiniPDGManager::UpdatePDGContexts()
 			HOUDINI_LOG_MESSAGE(TEXT("PDG: Tick processed %d events, %d remaining."), PDGEventCount, RemainingPDGEventCount);
 		}
 	}
+}
 
-	for (auto CurAssetLink : PDGAssetLinks)
-	{
-		UHoudiniPDGAssetLink* const AssetLink = CurAssetLink.Get();
-		if (!IsValid(AssetLink))
-			continue;
-
-		// Check if the post bake delegate should be fired
-		AssetLink->BroadcastPostAutoBakeDelegateIfRequired();
-
-		// Refresh UI if necessary, otherwise just make sure the work item tally is up to date
-		if (AssetLink->bNeedsUIRefresh)
-		{
-			FHoudiniPDGManager::RefreshPDGAssetLinkUI(AssetLink);
-			AssetLink->bNeedsUIRefresh = false;
-		}
-		else
-		{
-			AssetLink->UpdateWorkItemTally();
-		}
-	}
+void
+FHoudiniPDGManager::StopPDGEventPump()
+{
+	if (PDGEventPump.IsRunning())
+		PDGEventPump.Shutdown();
 }
 
 // Query the currently active PDG graph contexts in the Houdini Engine session.
@@ -884,12 +944,18 @@ FHoudiniPDGManager::ReinitializePDGContext()
 
 // Process a PDG event. Notify the relevant PDGAssetLink object.
 void
-FHoudiniPDGManager::ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_EventInfo& EventInfo)
+FHoudiniPDGManager::ProcessPDGEvent(
+	const HAPI_PDG_GraphContextId& InContextID,
+	HAPI_PDG_EventInfo& EventInfo,
+	const TMap<HAPI_PDG_WorkItemId, FHoudiniPDGWorkItemData>* InWorkItems)
 {
 	UHoudiniPDGAssetLink* PDGAssetLink = nullptr;
 	UTOPNetwork* TOPNetwork = nullptr;
 	UTOPNode* TOPNode = nullptr;
 
+	// Work item data already fetched by the event pump
+	const FHoudiniPDGWorkItemData* WorkItemData = InWorkItems ? InWorkItems->Find(EventInfo.workItemId) : nullptr;
+
 	HAPI_PDG_EventType EventType = (HAPI_PDG_EventType)EventInfo.eventType;
 	HAPI_PDG_WorkItemState CurrentWorkItemState = (HAPI_PDG_WorkItemState)EventInfo.currentState;
 	HAPI_PDG_WorkItemState LastWorkItemState = (HAPI_PDG_WorkItemState)EventInfo.lastState;
@@ -924,7 +990,7 @@ FHoudiniPDGManager::ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID,
 			break;
 
 		case HAPI_PDG_EVENT_WORKITEM_ADD:
-			CreateOrRelinkWorkItem(TOPNode, InContextID, EventInfo.workItemId);
+			CreateOrRelinkWorkItem(TOPNode, InContextID, EventInfo.workItemId, WorkItemData ? &WorkItemData->Info : nullptr);
 			bUpdatePDGNodeState = true;
 			NotifyTOPNodeCreatedWorkItem(PDGAssetLink, TOPNode, EventInfo.workItemId);
 			break;
@@ -1021,7 +1087,7 @@ FHoudiniPDGManager::ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID,
 				NotifyTOPNodeCookedWorkItem(PDGAssetLink, TOPNode, EventInfo.workItemId);
 
 				// On cook success, handle results
-				CreateOrRelinkWorkItemResult(TOPNode, InContextID, EventInfo.workItemId, TOPNode->bAutoLoad);
+				CreateOrRelinkWorkItemResult(TOPNode, InContextID, EventInfo.workItemId, TOPNode->bAutoLoad, WorkItemData);
 			}
 			else if (CurrentWorkItemState == HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_COOKED_FAIL)
 			{
@@ -1385,7 +1451,8 @@ int32
 FHoudiniPDGManager::CreateOrRelinkWorkItem(
 	UTOPNode* InTOPNode,
 	const HAPI_PDG_GraphContextId& InContextID,
-	HAPI_PDG_WorkItemId InWorkItemID)
+	HAPI_PDG_WorkItemId InWorkItemID,
+	const HAPI_PDG_WorkItemInfo* InWorkItemInfo)
 {
 	if (!IsValid(InTOPNode))
 	{
@@ -1394,7 +1461,11 @@ FHoudiniPDGManager::CreateOrRelinkWorkItem(
 	}
 	
 	HAPI_PDG_WorkItemInfo WorkItemInfo;
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetWorkItemInfo(
+	if (InWorkItemInfo)
+	{
+		WorkItemInfo = *InWorkItemInfo;
+	}
+	else if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetWorkItemInfo(
 		FHoudiniEngine::Get().GetSession(), InContextID, InWorkItemID, &WorkItemInfo))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to get work item %d info for %s"), InWorkItemID, *(InTOPNode->NodeName));
@@ -1437,16 +1508,25 @@ FHoudiniPDGManager::CreateOrRelinkWorkItemResult(
 	UTOPNode* InTOPNode,
 	const HAPI_PDG_GraphContextId& InContextID,
 	HAPI_PDG_WorkItemId InWorkItemID,
-	bool bInLoadResultObjects)
+	bool bInLoadResultObjects,
+	const FHoudiniPDGWorkItemData* InWorkItemData)
 {
 	if (!IsValid(InTOPNode))
 	{
 		HOUDINI_LOG_WARNING(TEXT("Failed to get work %d info: InTOPNode is null."), InWorkItemID);
 		return false;
 	}
+
+	// Only use the prefetched data if the output files were fetched along with the info
+	if (InWorkItemData && !InWorkItemData->bOutputFilesFetched)
+		InWorkItemData = nullptr;
 	
 	HAPI_PDG_WorkItemInfo WorkItemInfo;
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetWorkItemInfo(
+	if (InWorkItemData)
+	{
+		WorkItemInfo = InWorkItemData->Info;
+	}
+	else if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetWorkItemInfo(
 		FHoudiniEngine::Get().GetSession(), InContextID, InWorkItemID, &WorkItemInfo))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to get work item %d info for %s"), InWorkItemID, *(InTOPNode->NodeName));
@@ -1463,7 +1543,7 @@ FHoudiniPDGManager::CreateOrRelinkWorkItemResult(
 	{
 		// TODO: This shouldn't really happen, it means a work item finished cooking and generated a result before
 		// we received an event that the work item was added/generated.
-		WorkResultArrayIndex = CreateOrRelinkWorkItem(InTOPNode, InContextID, InWorkItemID);
+		WorkResultArrayIndex = CreateOrRelinkWorkItem(InTOPNode, InContextID, InWorkItemID, &WorkItemInfo);
 		if (WorkResultArrayIndex != INDEX_NONE)
 		{
 			WorkResult = InTOPNode->GetWorkResultByArrayIndex(WorkResultArrayIndex);
@@ -1481,9 +1561,16 @@ FHoudiniPDGManager::CreateOrRelinkWorkItemResult(
 	if (WorkItemInfo.outputFileCount > 0)
 	{
 		TArray<HAPI_PDG_WorkItemOutputFile> OutputFiles;
-		OutputFiles.SetNum(WorkItemInfo.outputFileCount);
+		if (InWorkItemData)
+		{
+			OutputFiles = InWorkItemData->OutputFiles;
+		}
+		else
+		{
+			OutputFiles.SetNum(WorkItemInfo.outputFileCount);
+		}
 		const int32 resultCount = WorkItemInfo.outputFileCount;
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetWorkItemOutputFiles(
+		if (!InWorkItemData && HAPI_RESULT_SUCCESS != FHoudiniApi::GetWorkItemOutputFiles(
             FHoudiniEngine::Get().GetSession(),
             InTOPNode->NodeId, InWorkItemID, OutputFiles.GetData(), resultCount))
 		{
@@ -1676,6 +1763,16 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ProcessWorkItemResults);
 
 	const EHoudiniBGEOCommandletStatus CommandletStatus = UpdateAndGetBGEOCommandletStatus();
+
+	// Bound the game thread time spent merging / loading results in this tick
+	const double StartTime = FPlatformTime::Seconds();
+	const double TimeLimit = CVarHoudiniEnginePDGImportTimeLimit.GetValueOnGameThread();
+
+	// Merge the results imported by the commandlets first, to free their workers
+	MergeImportBGEOResults(StartTime, TimeLimit);
+
+	ImportStats.NumQueued = 0;
+	bool bLoadedInThisTick = false;
 	for (auto& CurrentPDGAssetLink : PDGAssetLinks)
 	{
 		// Iterate through all PDG Asset Link
@@ -1761,6 +1858,24 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 						FTOPWorkResultObject& CurrentWorkResultObj = CurrentWorkResult.ResultObjects[WorkResultObjectArrayIndex];
 						if (CurrentWorkResultObj.State == EPDGWorkResultState::ToLoad)
 						{
+							FHoudiniBGEOCommandletWorker* Worker = nullptr;
+							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
+							{
+								// Leave the result queued until a worker can take it
+								Worker = GetAvailableBGEOCommandletWorker();
+								if (!Worker)
+								{
+									ImportStats.NumQueued++;
+									continue;
+								}
+							}
+							else if (bLoadedInThisTick && (FPlatformTime::Seconds() - StartTime) > TimeLimit)
+							{
+								// Out of time for this tick, the result will be loaded on the next one
+								ImportStats.NumQueued++;
+								continue;
+							}
+
 							CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
 
 							// Load this WRObj
@@ -1771,7 +1886,7 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 							// CurrentWorkResult.WorkItemIndex is not necessarily unique)
 							PackageParams.PDGWorkResultArrayIndex = WorkResultArrayIndex;
 
-							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
+							if (Worker)
 							{
 								BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
 									CurrentWorkResultObj.FilePath,
@@ -1781,10 +1896,17 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 									CurrentWorkResult.WorkItemID,
 									StaticMeshGenerationProperties,
 									MeshBuildSettings
-								), BGEOCommandletAddress);
+								), Worker->Address);
+
+								FHoudiniBGEOImportRequest Request;
+								Request.TOPNodeId = CurrentTOPNode->NodeId;
+								Request.WorkItemId = CurrentWorkResult.WorkItemID;
+								Request.Name = CurrentWorkResultObj.Name;
+								Worker->PendingRequests.Add(Request);
 							}
 							else
 							{
+								bLoadedInThisTick = true;
 								if (FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
 									AssetLink,
 									CurrentTOPNode,
@@ -1794,6 +1916,7 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 									CurrentWorkResultObj.State = EPDGWorkResultState::Loaded;
 									CurrentWorkResultObj.SetAutoBakedSinceLastLoad(false);
 									CurrentTOPNode->bCachedHaveLoadedWorkResults = true;
+									ImportStats.NumLoaded++;
 									
 									// Broadcast that we have loaded the work result object to those interested
 									AssetLink->OnWorkResultObjectLoaded.Broadcast(
@@ -1842,6 +1965,110 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 			}
 		}
 	}
+
+	// Update the counters displayed in the UI
+	ImportStats.NumWorkers = 0;
+	ImportStats.NumConnectedWorkers = 0;
+	ImportStats.NumInFlight = 0;
+	for (const FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Status == EHoudiniBGEOCommandletStatus::Running || Worker.Status == EHoudiniBGEOCommandletStatus::Connected)
+			ImportStats.NumWorkers++;
+		if (Worker.Status == EHoudiniBGEOCommandletStatus::Connected)
+			ImportStats.NumConnectedWorkers++;
+		ImportStats.NumInFlight += Worker.PendingRequests.Num();
+	}
+	ImportStats.NumPendingMerge = PendingImportBGEOResults.Num();
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastStatsSampleTime >= 1.0)
+	{
+		ImportStats.LoadedPerSecond = LastStatsSampleTime > 0.0
+			? (ImportStats.NumLoaded - NumLoadedAtLastSample) / (Now - LastStatsSampleTime)
+			: 0.0f;
+		NumLoadedAtLastSample = ImportStats.NumLoaded;
+		LastStatsSampleTime = Now;
+	}
+}
+
+void
+FHoudiniPDGManager::MergeImportBGEOResults(const double InStartTime, const double InTimeLimit)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::MergeImportBGEOResults);
+
+	int32 NumMerged = 0;
+	while (NumMerged < PendingImportBGEOResults.Num())
+	{
+		// Always merge at least one result per tick
+		if (NumMerged > 0 && (FPlatformTime::Seconds() - InStartTime) > InTimeLimit)
+			break;
+
+		MergeImportBGEOResult(PendingImportBGEOResults[NumMerged]);
+		NumMerged++;
+	}
+
+	if (NumMerged > 0)
+		PendingImportBGEOResults.RemoveAt(0, NumMerged);
+}
+
+FTOPWorkResultObject*
+FHoudiniPDGManager::FindLoadingWorkResultObject(const HAPI_NodeId& InTOPNodeId, const HAPI_PDG_WorkItemId& InWorkItemId, const FString& InName)
+{
+	UHoudiniPDGAssetLink* AssetLink = nullptr;
+	UTOPNetwork* TOPNetwork = nullptr;
+	UTOPNode* TOPNode = nullptr;
+	if (!GetTOPAssetLinkNetworkAndNode(InTOPNodeId, AssetLink, TOPNetwork, TOPNode) || !IsValid(TOPNode))
+		return nullptr;
+
+	FTOPWorkResult* WorkResult = TOPNode->GetWorkResultByArrayIndex(TOPNode->ArrayIndexOfWorkResultByID(InWorkItemId));
+	if (!WorkResult)
+		return nullptr;
+
+	FTOPWorkResultObject* WorkResultObject = WorkResult->ResultObjects.FindByPredicate(
+		[&InName](const FTOPWorkResultObject& InWorkResultObject)
+		{
+			return InWorkResultObject.Name == InName;
+		}
+	);
+
+	if (!WorkResultObject || WorkResultObject->State != EPDGWorkResultState::Loading)
+		return nullptr;
+
+	return WorkResultObject;
+}
+
+FHoudiniBGEOCommandletWorker*
+FHoudiniPDGManager::GetAvailableBGEOCommandletWorker()
+{
+	const int32 MaxRequestsPerWorker = FMath::Max(1, CVarHoudiniEnginePDGImportMaxRequestsPerWorker.GetValueOnGameThread());
+
+	FHoudiniBGEOCommandletWorker* AvailableWorker = nullptr;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Status != EHoudiniBGEOCommandletStatus::Connected)
+			continue;
+
+		if (Worker.PendingRequests.Num() >= MaxRequestsPerWorker)
+			continue;
+
+		if (!AvailableWorker || Worker.PendingRequests.Num() < AvailableWorker->PendingRequests.Num())
+			AvailableWorker = &Worker;
+	}
+
+	return AvailableWorker;
+}
+
+void
+FHoudiniPDGManager::RequeueBGEOImportRequests(FHoudiniBGEOCommandletWorker& InWorker)
+{
+	for (const FHoudiniBGEOImportRequest& Request : InWorker.PendingRequests)
+	{
+		FTOPWorkResultObject* WorkResultObject = FindLoadingWorkResultObject(Request.TOPNodeId, Request.WorkItemId, Request.Name);
+		if (WorkResultObject)
+			WorkResultObject->State = EPDGWorkResultState::ToLoad;
+	}
+
+	InWorker.PendingRequests.Empty();
 }
 
 void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
@@ -1849,14 +2076,20 @@ void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_DISPLAY(TEXT("Received Discover from %s"), *InContext->GetSender().ToString());
-	// Ignore any discover acks received if we already have a valid local address
-	// for the commandlet
-	if (BGEOCommandletAddress.IsValid())
+	if (!InMessage.CommandletGuid.IsValid())
 		return;
 
-	if (BGEOCommandletProcHandle.IsValid() && InMessage.CommandletGuid.IsValid() && BGEOCommandletGuid == InMessage.CommandletGuid)
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		BGEOCommandletAddress = InContext->GetSender();
+		if (Worker.Guid != InMessage.CommandletGuid)
+			continue;
+
+		// Ignore any discover acks received if we already have a valid local address
+		// for the commandlet
+		if (Worker.ProcHandle.IsValid() && !Worker.Address.IsValid())
+			Worker.Address = InContext->GetSender();
+
+		break;
 	}
 }
 
@@ -1865,6 +2098,37 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Received BGEO import result message"));
+
+	// The worker that imported the result can take a new request
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Address != InContext->GetSender())
+			continue;
+
+		const int32 RequestIndex = Worker.PendingRequests.IndexOfByPredicate(
+			[&InMessage](const FHoudiniBGEOImportRequest& InRequest)
+			{
+				return InRequest.TOPNodeId == InMessage.TOPNodeId
+					&& InRequest.WorkItemId == InMessage.WorkItemId
+					&& InRequest.Name == InMessage.Name;
+			}
+		);
+
+		if (RequestIndex != INDEX_NONE)
+			Worker.PendingRequests.RemoveAt(RequestIndex);
+
+		break;
+	}
+
+	// Outputs are created on the game thread, within the time limit of ProcessWorkItemResults
+	PendingImportBGEOResults.Add(InMessage);
+}
+
+void
+FHoudiniPDGManager::MergeImportBGEOResult(const FHoudiniPDGImportBGEOResultMessage& InMessage)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::MergeImportBGEOResult);
+
 	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success || InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess)
 	{
 		FHoudiniPackageParams PackageParams;
@@ -2091,6 +2355,7 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 		{
 			WorkResultObject->State = EPDGWorkResultState::Loaded;
 			WorkResultObject->SetAutoBakedSinceLastLoad(false);
+			ImportStats.NumLoaded++;
 			HOUDINI_LOG_MESSAGE(TEXT("Loaded geo for %s"), *InMessage.Name);
 			// Broadcast that we have loaded the work result object to those interested
 			AssetLink->OnWorkResultObjectLoaded.Broadcast(
@@ -2105,6 +2370,10 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	else
 	{
 		HOUDINI_LOG_WARNING(TEXT("Commandlet failed to import bgeo for %s"), *InMessage.Name);
+
+		FTOPWorkResultObject* WorkResultObject = FindLoadingWorkResultObject(InMessage.TOPNodeId, InMessage.WorkItemId, InMessage.Name);
+		if (WorkResultObject)
+			WorkResultObject->State = EPDGWorkResultState::None;
 	}
 }
 
@@ -2112,7 +2381,6 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 {
 	if (!BGEOCommandletEndpoint.IsValid())
 	{
-		BGEOCommandletAddress.Invalidate();
 		BGEOCommandletEndpoint = FMessageEndpoint::Builder(TEXT("Houdini BGEO Commandlet"))
 			.Handling<FHoudiniPDGImportBGEOResultMessage>(this, &FHoudiniPDGManager::HandleImportBGEOResultMessage)
 			.Handling<FHoudiniPDGImportBGEODiscoverMessage>(this, &FHoudiniPDGManager::HandleImportBGEODiscoverMessage)
@@ -2125,104 +2393,165 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 		}
 
 		BGEOCommandletEndpoint->Subscribe<FHoudiniPDGImportBGEODiscoverMessage>();
+
+		// Workers started before the endpoint existed can't reach it
+		for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+			Worker.Address.Invalidate();
 	}
 
-	if (!BGEOCommandletProcHandle.IsValid() || !FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	int32 NumWorkers = 1;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (IsValid(HoudiniRuntimeSettings))
+		NumWorkers = FMath::Clamp(HoudiniRuntimeSettings->PDGAsyncCommandletWorkerCount, 1, 16);
+
+	if (BGEOCommandletWorkers.Num() < NumWorkers)
+		BGEOCommandletWorkers.SetNum(NumWorkers);
+
+	bool bSuccess = true;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		// Start the bgeo commandlet
-		static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
-		BGEOCommandletGuid = FGuid::NewGuid();
-		BGEOCommandletAddress.Invalidate();
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			continue;
 
-		// Get the absolute path to the project file, if known, otherwise get
-		// the project name. For the path: quote it for the command line.
-		IFileManager& FileManager = IFileManager::Get();
-		FString ProjectPathOrName = FApp::GetProjectName();
-		if (FPaths::IsProjectFilePathSet())
+		if (!StartBGEOCommandletWorker(Worker))
+			bSuccess = false;
+	}
+
+	return bSuccess;
+}
+
+bool FHoudiniPDGManager::StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker)
+{
+	// Requests sent to a previous process of this worker will never be answered
+	RequeueBGEOImportRequests(InWorker);
+
+	// Start the bgeo commandlet
+	static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
+	InWorker.Guid = FGuid::NewGuid();
+	InWorker.Address.Invalidate();
+	InWorker.Status = EHoudiniBGEOCommandletStatus::NotStarted;
+
+	// Get the absolute path to the project file, if known, otherwise get
+	// the project name. For the path: quote it for the command line.
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
 		{
-			const FString ProjectPath = FPaths::GetProjectFilePath();
-			if (!ProjectPath.IsEmpty())
-			{
-				ProjectPathOrName = FString::Printf(
-                    TEXT("\"%s\""),
-                    *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
-                );
-			}
+			ProjectPathOrName = FString::Printf(
+                TEXT("\"%s\""),
+                *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
+            );
 		}
+	}
 
-		if (ProjectPathOrName.IsEmpty())
-			return false;
+	if (ProjectPathOrName.IsEmpty())
+		return false;
 
-		// Get the executable path for the app/editor
-		FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
-		if (!ExePath.IsEmpty())
-			ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+	// Get the executable path for the app/editor
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
 
-		if (ExePath.IsEmpty())
-			return false;
-		
-		const FString CommandLineParameters = FString::Printf(
-			TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
-			*ProjectPathOrName,
-			*BGEOCommandletName,
-			*BGEOCommandletGuid.ToString(),
-			*BGEOCommandletEndpoint->GetAddress().ToString(),
-			FPlatformProcess::GetCurrentProcessId());
-
-		BGEOCommandletProcHandle = FPlatformProcess::CreateProc(
-			*ExePath,
-			*CommandLineParameters,
-			false,
-			true,
-			false,
-			&BGEOCommandletProcessId,
-			0,
-			NULL,
-			NULL);
-		if (!BGEOCommandletProcHandle.IsValid())
-		{
-			return false;
-		}
+	if (ExePath.IsEmpty())
+		return false;
+	
+	const FString CommandLineParameters = FString::Printf(
+		TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
+		*ProjectPathOrName,
+		*BGEOCommandletName,
+		*InWorker.Guid.ToString(),
+		*BGEOCommandletEndpoint->GetAddress().ToString(),
+		FPlatformProcess::GetCurrentProcessId());
+
+	InWorker.ProcHandle = FPlatformProcess::CreateProc(
+		*ExePath,
+		*CommandLineParameters,
+		false,
+		true,
+		false,
+		&InWorker.ProcessId,
+		0,
+		NULL,
+		NULL);
+	if (!InWorker.ProcHandle.IsValid())
+	{
+		return false;
 	}
 
+	InWorker.Status = EHoudiniBGEOCommandletStatus::Running;
+
 	return true;
 }
 
 void FHoudiniPDGManager::StopBGEOCommandletAndEndpoint()
 {
 	BGEOCommandletEndpoint.Reset();
-	BGEOCommandletAddress.Invalidate();
-	BGEOCommandletGuid.Invalidate();
 
-	if (BGEOCommandletProcHandle.IsValid() && FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		FPlatformProcess::TerminateProc(BGEOCommandletProcHandle, true);
-		if (BGEOCommandletProcHandle.IsValid())
+		RequeueBGEOImportRequests(Worker);
+
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
 		{
-			FPlatformProcess::WaitForProc(BGEOCommandletProcHandle);
-			FPlatformProcess::CloseProc(BGEOCommandletProcHandle);
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			if (Worker.ProcHandle.IsValid())
+			{
+				FPlatformProcess::WaitForProc(Worker.ProcHandle);
+				FPlatformProcess::CloseProc(Worker.ProcHandle);
+			}
 		}
 	}
+
+	BGEOCommandletWorkers.Empty();
 }
 
 EHoudiniBGEOCommandletStatus FHoudiniPDGManager::UpdateAndGetBGEOCommandletStatus()
 {
-	if (BGEOCommandletProcHandle.IsValid())
+	// Order in which the worker statuses are reported for the whole pool
+	auto GetStatusPriority = [](const EHoudiniBGEOCommandletStatus InStatus)
 	{
-		if (!FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
-		else if (BGEOCommandletAddress.IsValid())
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+		switch (InStatus)
+		{
+			case EHoudiniBGEOCommandletStatus::Connected:
+				return 3;
+			case EHoudiniBGEOCommandletStatus::Running:
+				return 2;
+			case EHoudiniBGEOCommandletStatus::Crashed:
+				return 1;
+			default:
+				return 0;
+		}
+	};
+
+	BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.ProcHandle.IsValid())
+		{
+			if (!FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			{
+				// Let the other workers (or the main session) load what this worker was importing
+				RequeueBGEOImportRequests(Worker);
+				Worker.Status = EHoudiniBGEOCommandletStatus::Crashed;
+			}
+			else if (Worker.Address.IsValid())
+				Worker.Status = EHoudiniBGEOCommandletStatus::Connected;
+			else
+				Worker.Status = EHoudiniBGEOCommandletStatus::Running;
+		}
 		else
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+			Worker.Status = EHoudiniBGEOCommandletStatus::NotStarted;
+
+		if (GetStatusPriority(Worker.Status) > GetStatusPriority(BGEOCommandletStatus))
+			BGEOCommandletStatus = Worker.Status;
 	}
-	else
-		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 
 	return BGEOCommandletStatus;
 }
 
-
 bool
 FHoudiniPDGManager::IsPDGAsset(const HAPI_NodeId& InAssetId)
 {
@@ -32,11 +32,15 @@
 
 #include "MessageEndpoint.h"
 
+#include "HoudiniPDGImporterMessages.h"
+#include "HoudiniPDGEventPump.h"
+
 class UHoudiniAssetComponent;
 class UHoudiniPDGAssetLink;
 class UTOPNetwork;
 class UTOPNode;
 class FSocket;
+struct FTOPWorkResultObject;
 
 enum class EPDGNodeState : uint8;
 
@@ -55,6 +59,50 @@ enum class HOUDINIENGINE_API EHoudiniBGEOCommandletStatus : uint8
 	Crashed
 };
 
+// A BGEO import request sent to a commandlet worker that hasn't been answered yet
+struct FHoudiniBGEOImportRequest
+{
+	HAPI_NodeId TOPNodeId = -1;
+	HAPI_PDG_WorkItemId WorkItemId = -1;
+	FString Name;
+};
+
+// One of the BGEO commandlet processes of the async importer
+struct FHoudiniBGEOCommandletWorker
+{
+	FMessageAddress Address;
+	FProcHandle ProcHandle;
+	FGuid Guid;
+	uint32 ProcessId = 0;
+	EHoudiniBGEOCommandletStatus Status = EHoudiniBGEOCommandletStatus::NotStarted;
+
+	// Requests sent to this worker that are still being imported
+	TArray<FHoudiniBGEOImportRequest> PendingRequests;
+};
+
+// Work result loading counters, displayed in the PDG asset link UI
+struct HOUDINIENGINE_API FHoudiniPDGImportStats
+{
+	// Number of commandlet workers started / connected
+	int32 NumWorkers = 0;
+	int32 NumConnectedWorkers = 0;
+
+	// Work result objects waiting for a worker to be available
+	int32 NumQueued = 0;
+
+	// Work result objects being imported by the workers
+	int32 NumInFlight = 0;
+
+	// Imported work result objects waiting to be merged on the game thread
+	int32 NumPendingMerge = 0;
+
+	// Work result objects loaded since the manager was started
+	int32 NumLoaded = 0;
+
+	// Work result objects loaded per second, over the last sampling period
+	float LoadedPerSecond = 0.0f;
+};
+
 struct HOUDINIENGINE_API FHoudiniPDGManager
 {
 
@@ -127,15 +175,29 @@ public:
 
 	// Create a (or re-use an existing) FTOPWorkResult for a given TOPNode and the specified work item ID, without
 	// creating its FTOPWorkResultObjects.
+	// InWorkItemInfo can be used to pass the work item info if it was already fetched from HAPI.
 	// Returns INDEX_NONE if an entry could not be created or data could not be retrieved from HAPI.
-	int32 CreateOrRelinkWorkItem(UTOPNode* InTOPNode, const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_WorkItemId InWorkItemID);
+	int32 CreateOrRelinkWorkItem(
+		UTOPNode* InTOPNode,
+		const HAPI_PDG_GraphContextId& InContextID,
+		HAPI_PDG_WorkItemId InWorkItemID,
+		const HAPI_PDG_WorkItemInfo* InWorkItemInfo=nullptr);
 
 	// Ensure that FTOPWorkResult exists, and create its FTOPWorkResultObjects for a given TOP node and work item id,
 	// and optionally (via bInLoadResultObjects) create its FTOPWorkResultObjects.
 	// Geometry is not directly loaded by this function, the FTOPWorkResultObjects' states will be set to ToLoad and
 	// the ProcessWorkItemResults function will take care of loading the geo.
 	// Results must be tagged with 'file', and must have a file path, otherwise will not included.
-	bool CreateOrRelinkWorkItemResult(UTOPNode* InTOPNode, const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_WorkItemId InWorkItemID, bool bInLoadResultObjects=false);
+	// InWorkItemData can be used to pass the work item info and output files if they were already fetched from HAPI.
+	bool CreateOrRelinkWorkItemResult(
+		UTOPNode* InTOPNode,
+		const HAPI_PDG_GraphContextId& InContextID,
+		HAPI_PDG_WorkItemId InWorkItemID,
+		bool bInLoadResultObjects=false,
+		const FHoudiniPDGWorkItemData* InWorkItemData=nullptr);
+
+	// Stops the PDG event pump thread, if running.
+	void StopPDGEventPump();
 
 	// First Create or re-link FTOPWorkResults based on the work items that exist on InTOPNode in HAPI. 
 	// Then remove any FTOPWorkResults (and clean up their output) from the WorkResults of InTOPNode if:
@@ -148,26 +210,55 @@ public:
 		const struct FHoudiniPDGImportBGEODiscoverMessage& InMessage,
 		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
 
-	// Handles messages sent by the commandlet once an import of a bgeo is complete, and uassets have been created.
+	// Handles messages sent by the commandlets once an import of a bgeo is complete, and uassets have been created.
+	// The results are queued and merged in ProcessWorkItemResults.
 	void HandleImportBGEOResultMessage(
 		const struct FHoudiniPDGImportBGEOResultMessage& InMessage, 
 		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
 
-	// Create the bgeo commandlet endpoint and start the commandlet (if not already running).
+	// Create the bgeo commandlet endpoint and start the commandlet workers (if not already running).
 	bool CreateBGEOCommandletAndEndpoint();
 
 	void StopBGEOCommandletAndEndpoint();
 
-	// Updates and returns the BGEO commandlet status
+	// Updates and returns the BGEO commandlet status: the status of the most advanced worker of the pool
 	EHoudiniBGEOCommandletStatus UpdateAndGetBGEOCommandletStatus();
 
+	// Returns the work result loading counters
+	const FHoudiniPDGImportStats& GetImportStats() const { return ImportStats; }
+
 private:
 	
 	void UpdatePDGContexts();
 
+	// Polls the events of each PDG graph context on the game thread, used when the event pump is disabled.
+	void PollPDGEvents();
+
 	void ProcessWorkItemResults();
 
-	void ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_EventInfo& EventInfo);
+	// Merges the results imported by the commandlets, until the time limit is reached.
+	void MergeImportBGEOResults(const double InStartTime, const double InTimeLimit);
+
+	// Creates the outputs of a work result object from the assets imported by a commandlet.
+	void MergeImportBGEOResult(const FHoudiniPDGImportBGEOResultMessage& InMessage);
+
+	// Starts the process of a commandlet worker
+	bool StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker);
+
+	// Returns the connected worker with the fewest pending requests, if it can accept a new one
+	FHoudiniBGEOCommandletWorker* GetAvailableBGEOCommandletWorker();
+
+	// Returns the work result object in the Loading state matching a commandlet import request
+	FTOPWorkResultObject* FindLoadingWorkResultObject(const HAPI_NodeId& InTOPNodeId, const HAPI_PDG_WorkItemId& InWorkItemId, const FString& InName);
+
+	// Puts the requests pending on a worker that stopped running back in the ToLoad state
+	void RequeueBGEOImportRequests(FHoudiniBGEOCommandletWorker& InWorker);
+
+	// InWorkItems contains the work item data fetched by the event pump for the events of this batch, if any.
+	void ProcessPDGEvent(
+		const HAPI_PDG_GraphContextId& InContextID,
+		HAPI_PDG_EventInfo& EventInfo,
+		const TMap<HAPI_PDG_WorkItemId, FHoudiniPDGWorkItemData>* InWorkItems=nullptr);
 
 	static void ResetPDGEventInfo(HAPI_PDG_EventInfo& InEventInfo);
 
@@ -204,11 +295,19 @@ private:
 
 	int32 MaxNumberOfPDGEvents = 20;
 
+	// Drains and coalesces the PDG events on a background thread
+	FHoudiniPDGEventPump PDGEventPump;
+
 	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> BGEOCommandletEndpoint;
-	FMessageAddress BGEOCommandletAddress;
-	FProcHandle BGEOCommandletProcHandle;
-	FGuid BGEOCommandletGuid;
-	uint32 BGEOCommandletProcessId;
+	// The commandlet processes of the async importer
+	TArray<FHoudiniBGEOCommandletWorker> BGEOCommandletWorkers;
 	// Keep track of the BGEO commandlet status
 	EHoudiniBGEOCommandletStatus BGEOCommandletStatus;
+
+	// Results received from the commandlets, waiting to be merged
+	TArray<FHoudiniPDGImportBGEOResultMessage> PendingImportBGEOResults;
+
+	FHoudiniPDGImportStats ImportStats;
+	int32 NumLoadedAtLastSample = 0;
+	double LastStatsSampleTime = 0.0;
 };
@@ -103,6 +103,7 @@ FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
 
 		// Replace with the new parameters
 		HAC->Parameters = NewParameters;
+		HAC->InvalidateParameterIndices();
 
 		// Update the details panel after the parameter changes/updates
 		FHoudiniEngineUtils::UpdateEditorProperties(true);
@@ -211,6 +212,7 @@ FHoudiniParameterTranslator::UpdateLoadedParameters(UHoudiniAssetComponent* HAC)
 
 		// Simply replace with the new parameters
 		HAC->Parameters = NewParameters;
+		HAC->InvalidateParameterIndices();
 
 		// Update the details panel after the parameter changes/updates
 		FHoudiniEngineUtils::UpdateEditorProperties(true);
@@ -240,7 +242,8 @@ FHoudiniParameterTranslator::BuildAllParameters(
 
 	int32 ParmCount = 0;
 
-	// Default value counts and arrays for if we need to fetch those from Houdini.
+	// Value counts and arrays, fetched from Houdini in one go for all parameters:
+	// from the node when it is instantiated, or the defaults from the asset definition.
 	int DefaultIntValueCount = 0;
 	int DefaultFloatValueCount = 0;
 	int DefaultStringValueCount = 0;
@@ -277,6 +280,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &NodeInfo), false);
 
 		ParmCount = NodeInfo.parmCount;
+		DefaultIntValueCount = NodeInfo.parmIntValueCount;
+		DefaultFloatValueCount = NodeInfo.parmFloatValueCount;
+		DefaultStringValueCount = NodeInfo.parmStringValueCount;
+		DefaultChoiceValueCount = NodeInfo.parmChoiceCount;
 	}
 	else
 	{
@@ -382,6 +389,37 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	{
 		HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParameters(
 				FHoudiniEngine::Get().GetSession(), NodeId, &ParmInfos[0], 0, ParmCount), false);
+
+		// Fetch the values of all the node's parameters with one call per value type,
+		// instead of querying each parameter individually in UpdateParameterFromInfo().
+		// If any of these fail, the parameters will fall back to fetching their own values.
+		DefaultIntValues.SetNumZeroed(DefaultIntValueCount);
+		if (DefaultIntValueCount > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmIntValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, DefaultIntValues.GetData(), 0, DefaultIntValueCount))
+		{
+			DefaultIntValues.Empty();
+		}
+
+		DefaultFloatValues.SetNumZeroed(DefaultFloatValueCount);
+		if (DefaultFloatValueCount > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmFloatValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, DefaultFloatValues.GetData(), 0, DefaultFloatValueCount))
+		{
+			DefaultFloatValues.Empty();
+		}
+
+		DefaultStringValues.SetNumZeroed(DefaultStringValueCount);
+		if (DefaultStringValueCount > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmStringValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, false, DefaultStringValues.GetData(), 0, DefaultStringValueCount))
+		{
+			DefaultStringValues.Empty();
+		}
+
+		DefaultChoiceValues.SetNumZeroed(DefaultChoiceValueCount);
+		if (DefaultChoiceValueCount > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmChoiceLists(
+			FHoudiniEngine::Get().GetSession(), NodeId, DefaultChoiceValues.GetData(), 0, DefaultChoiceValueCount))
+		{
+			DefaultChoiceValues.Empty();
+		}
 	}
 	else
 	{
@@ -389,6 +427,33 @@ FHoudiniParameterTranslator::BuildAllParameters(
 				FHoudiniEngine::Get().GetSession(), AssetLibraryId, TCHAR_TO_UTF8(*HoudiniAssetName), &ParmInfos[0], 0, ParmCount), false);
 	}
 
+	// Resolve the parameters' names, labels, help, string values and choice labels with a single
+	// string batch, the FHoudiniEngineString conversions below will be served from it.
+	TArray<int32> StringHandlesToResolve;
+	StringHandlesToResolve.Reserve(ParmCount * 4 + DefaultStringValues.Num() + DefaultChoiceValues.Num() * 2);
+	for (const HAPI_ParmInfo& CurrentParmInfo : ParmInfos)
+	{
+		StringHandlesToResolve.Add(CurrentParmInfo.nameSH);
+		StringHandlesToResolve.Add(CurrentParmInfo.labelSH);
+		StringHandlesToResolve.Add(CurrentParmInfo.helpSH);
+		StringHandlesToResolve.Add(CurrentParmInfo.typeInfoSH);
+	}
+	StringHandlesToResolve.Append(DefaultStringValues);
+	for (const HAPI_ParmChoiceInfo& CurrentChoiceInfo : DefaultChoiceValues)
+	{
+		StringHandlesToResolve.Add(CurrentChoiceInfo.labelSH);
+		StringHandlesToResolve.Add(CurrentChoiceInfo.valueSH);
+	}
+	FHoudiniEngineScopedStringCache ParmStringCache(StringHandlesToResolve);
+
+	// Index the parm infos by id, to look up the parent folders
+	TMap<HAPI_ParmId, int32> ParmInfoIndexById;
+	ParmInfoIndexById.Reserve(ParmCount);
+	for (int32 ParamIdx = 0; ParamIdx < ParmCount; ++ParamIdx)
+	{
+		ParmInfoIndexById.Add(ParmInfos[ParamIdx].id, ParamIdx);
+	}
+
 	// Create a name lookup cache for the current parameters
 	// Use an array has in some cases, multiple parameters can have the same name!
 	TMap<FString, TArray<UHoudiniParameter*>> CurrentParametersByName;
@@ -443,10 +508,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 		HAPI_ParmId ParentId = ParmInfo.parentId;
 		while (ParentId > 0 && !SkipParm)
 		{
-			if (const HAPI_ParmInfo* ParentInfoPtr = ParmInfos.FindByPredicate([=](const HAPI_ParmInfo& Info) {
-				return Info.id == ParentId;
-			}))
+			const int32* ParentInfoIndex = ParmInfoIndexById.Find(ParentId);
+			if (ParentInfoIndex)
 			{
+				const HAPI_ParmInfo* ParentInfoPtr = &ParmInfos[*ParentInfoIndex];
 				// We now keep invisible parameters but show/hid them in UpdateParameterFromInfo().
 				if (ParentInfoPtr->invisible && ParentInfoPtr->type == HAPI_PARMTYPE_FOLDER)
 					ParentFolderVisible = false;
@@ -532,10 +597,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			// Do a fast update of this parameter
 			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					HoudiniAssetParameter, NodeId, ParmInfo, InForceFullUpdate, bUpdateValues, 
-					AssetId >= 0 ? nullptr : &DefaultIntValues,
-					AssetId >= 0 ? nullptr : &DefaultFloatValues,
-					AssetId >= 0 ? nullptr : &DefaultStringValues,
-					AssetId >= 0 ? nullptr : &DefaultChoiceValues))
+					DefaultIntValues.Num() > 0 ? &DefaultIntValues : nullptr,
+					DefaultFloatValues.Num() > 0 ? &DefaultFloatValues : nullptr,
+					DefaultStringValues.Num() > 0 ? &DefaultStringValues : nullptr,
+					DefaultChoiceValues.Num() > 0 ? &DefaultChoiceValues : nullptr))
 				continue;
 
 			// Reset the states of ramp parameters.
@@ -581,10 +646,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			// Fully update this parameter
 			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					HoudiniAssetParameter, NodeId, ParmInfo, true, true,
-					AssetId >= 0 ? nullptr : &DefaultIntValues,
-					AssetId >= 0 ? nullptr : &DefaultFloatValues,
-					AssetId >= 0 ? nullptr : &DefaultStringValues,
-					AssetId >= 0 ? nullptr : &DefaultChoiceValues))
+					DefaultIntValues.Num() > 0 ? &DefaultIntValues : nullptr,
+					DefaultFloatValues.Num() > 0 ? &DefaultFloatValues : nullptr,
+					DefaultStringValues.Num() > 0 ? &DefaultStringValues : nullptr,
+					DefaultChoiceValues.Num() > 0 ? &DefaultChoiceValues : nullptr))
 				continue;
 
 			// Record float and color ramps for further processing (creating their Points arrays)
@@ -1414,8 +1479,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 		}
 		
 		// Get parameter tags.
+		// The tags are then used for the unit, no swap, asset ref and file read-only flags below.
 		if (bHasValidNodeId)
 		{
+			HoudiniParameter->GetTags().Empty();
 			int32 TagCount = HoudiniParameter->GetTagCount();
 			for (int32 Idx = 0; Idx < TagCount; ++Idx)
 			{
@@ -1476,7 +1543,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				// Stop if we don't want to update the value
 				if (bUpdateValue)
 				{
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultIntValues)
 					{
 						if (FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -1507,7 +1574,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
 					FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
 
-				if (bHasValidNodeId)
+				if (bHasValidNodeId && !DefaultChoiceValues)
 				{
 					HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmChoiceLists(
 						FHoudiniEngine::Get().GetSession(),
@@ -1556,7 +1623,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual value for this property.
 					FLinearColor Color = FLinearColor::White;
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultFloatValues)
 					{
 						if (FHoudiniApi::GetParmFloatValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -1628,7 +1695,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Check if we are read-only
 					bool bIsReadOnly = false;
 					FString FileChooserTag;
-					if (bHasValidNodeId && FHoudiniParameterTranslator::HapiGetParameterTagValue(InNodeId, ParmInfo.id, HAPI_PARAM_TAG_FILE_READONLY, FileChooserTag))
+					if (bHasValidNodeId && FHoudiniParameterTranslator::GetParameterTagValue(HoudiniParameter, HAPI_PARAM_TAG_FILE_READONLY, FileChooserTag))
 					{
 						if (FileChooserTag.Equals(TEXT("read"), ESearchCase::IgnoreCase))
 							bIsReadOnly = true;
@@ -1653,7 +1720,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					TArray< HAPI_StringHandle > StringHandles;
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultStringValues)
 					{
 						StringHandles.SetNumZeroed(ParmInfo.size);
 						if (FHoudiniApi::GetParmStringValues(
@@ -1711,7 +1778,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Update the parameter's value
 					HoudiniParameterFloat->SetNumberOfValues(ParmInfo.size);
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultFloatValues)
 					{
 						if (FHoudiniApi::GetParmFloatValues(
 								FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -1751,10 +1818,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					FString ParamUnit;
 					if (bHasValidNodeId)
 					{
-						FHoudiniParameterTranslator::HapiGetParameterUnit(InNodeId, ParmInfo.id, ParamUnit);
+						FHoudiniParameterTranslator::GetParameterUnit(HoudiniParameter, ParamUnit);
 						HoudiniParameterFloat->SetUnit(ParamUnit);
 						// Get the parameter's no swap tag (hengine_noswap)
-						HoudiniParameterFloat->SetNoSwap(HapiGetParameterHasTag(InNodeId, ParmInfo.id, HAPI_PARAM_TAG_NOSWAP));
+						HoudiniParameterFloat->SetNoSwap(HoudiniParameter->GetTags().Contains(TEXT(HAPI_PARAM_TAG_NOSWAP)));
 					}
 
 					// Set the min and max for this parameter
@@ -1930,7 +1997,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					HoudiniParameterInt->SetNumberOfValues(ParmInfo.size);
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultIntValues)
 					{
 						if (FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -1973,7 +2040,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					FString ParamUnit;
 					if (bHasValidNodeId)
 					{
-						FHoudiniParameterTranslator::HapiGetParameterUnit(InNodeId, ParmInfo.id, ParamUnit);
+						FHoudiniParameterTranslator::GetParameterUnit(HoudiniParameter, ParamUnit);
 						HoudiniParameterInt->SetUnit(ParamUnit);
 					}
 
@@ -2050,7 +2117,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					int32 CurrentIntValue = 0;
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultIntValues)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(),
@@ -2093,7 +2160,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
 						FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultChoiceValues)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmChoiceLists(
 							FHoudiniEngine::Get().GetSession(), 
@@ -2178,7 +2245,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					HAPI_StringHandle StringHandle;
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultStringValues)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmStringValues(
 							FHoudiniEngine::Get().GetSession(),
@@ -2214,7 +2281,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
 						FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultChoiceValues)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmChoiceLists(
 							FHoudiniEngine::Get().GetSession(),
@@ -2290,7 +2357,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				// Get the actual value for this property.
 				TArray<HAPI_StringHandle> StringHandles;
 
-				if (bHasValidNodeId)
+				if (bHasValidNodeId && !DefaultStringValues)
 				{
 					StringHandles.SetNumZeroed(ParmInfo.size);
 					FHoudiniApi::GetParmStringValues(
@@ -2340,7 +2407,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				// Set the multiparm value
 				int32 MultiParmValue = 0;
 
-				if (bHasValidNodeId)
+				if (bHasValidNodeId && !DefaultIntValues)
 				{
 					HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
 						FHoudiniEngine::Get().GetSession(),
@@ -2402,7 +2469,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual value for this property.
 					TArray< HAPI_StringHandle > StringHandles;
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultStringValues)
 					{
 						StringHandles.SetNumZeroed(ParmInfo.size);
 						if (FHoudiniApi::GetParmStringValues(
@@ -2446,7 +2513,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					if (bHasValidNodeId)
 					{
 						HoudiniParameterString->SetIsAssetRef(
-							FHoudiniParameterTranslator::HapiGetParameterHasTag(InNodeId, ParmInfo.id, HOUDINI_PARAMETER_STRING_REF_TAG));
+							HoudiniParameter->GetTags().Contains(HOUDINI_PARAMETER_STRING_REF_TAG));
 					}
 				}
 			}
@@ -2470,7 +2537,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					HoudiniParameterToggle->SetNumberOfValues(ParmInfo.size);
 
-					if (bHasValidNodeId)
+					if (bHasValidNodeId && !DefaultIntValues)
 					{
 						if (FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -2557,7 +2624,46 @@ FHoudiniParameterTranslator::HapiGetParameterUnit(const HAPI_NodeId& NodeId, con
 	FString UnitString = TEXT("");
 	if (!FHoudiniParameterTranslator::HapiGetParameterTagValue(NodeId, ParmId, "units", UnitString))
 		return false;
-	
+
+	OutUnitString = ConvertHoudiniUnitString(UnitString);
+
+	return true;
+}
+
+bool
+FHoudiniParameterTranslator::GetParameterTagValue(UHoudiniParameter* InParam, const FString& Tag, FString& TagValue)
+{
+	TagValue = FString();
+	if (!IsValid(InParam))
+		return false;
+
+	const FString* FoundValue = InParam->GetTags().Find(Tag);
+	if (!FoundValue)
+		return false;
+
+	TagValue = *FoundValue;
+	return true;
+}
+
+bool
+FHoudiniParameterTranslator::GetParameterUnit(UHoudiniParameter* InParam, FString& OutUnitString)
+{
+	OutUnitString = TEXT("");
+
+	FString UnitString = TEXT("");
+	if (!FHoudiniParameterTranslator::GetParameterTagValue(InParam, TEXT("units"), UnitString))
+		return false;
+
+	OutUnitString = ConvertHoudiniUnitString(UnitString);
+
+	return true;
+}
+
+FString
+FHoudiniParameterTranslator::ConvertHoudiniUnitString(const FString& InUnitString)
+{
+	FString UnitString = InUnitString;
+
 	// We need to do some replacement in the string here in order to be able to get the
 	// proper unit type when calling FUnitConversion::UnitFromString(...) after.
 
@@ -2571,9 +2677,7 @@ FHoudiniParameterTranslator::HapiGetParameterUnit(const HAPI_NodeId& NodeId, con
 	UnitString.ReplaceInline(TEXT("1"), TEXT(""));
 	UnitString.ReplaceInline(TEXT("--"), TEXT("-1"));
 
-	OutUnitString = UnitString;
-
-	return true;
+	return UnitString;
 }
 
 bool
@@ -2589,6 +2693,115 @@ FHoudiniParameterTranslator::HapiGetParameterHasTag(const HAPI_NodeId& NodeId, c
 }
 
 
+namespace
+{
+	// Values of changed parameters waiting to be uploaded.
+	// Parameters whose values are next to each other in the node's int or float value array
+	// are uploaded together with a single SetParmIntValues / SetParmFloatValues call.
+	template<typename ValueType>
+	struct THoudiniPendingParmValues
+	{
+		struct FPendingParm
+		{
+			UHoudiniParameter* Parameter = nullptr;
+			HAPI_NodeId NodeId = -1;
+			int32 ValueIndex = -1;
+			int32 Count = 0;
+			int32 Offset = 0;
+		};
+
+		void Add(UHoudiniParameter* InParam, const ValueType* InValues, const int32& InCount)
+		{
+			FPendingParm& PendingParm = Parms.AddDefaulted_GetRef();
+			PendingParm.Parameter = InParam;
+			PendingParm.NodeId = InParam->GetNodeId();
+			PendingParm.ValueIndex = InParam->GetValueIndex();
+			PendingParm.Count = InCount;
+			PendingParm.Offset = Values.Num();
+			Values.Append(InValues, InCount);
+		}
+
+		TArray<FPendingParm> Parms;
+		TArray<ValueType> Values;
+	};
+
+	HAPI_Result
+	SetParmValues(const HAPI_NodeId& InNodeId, const float* InValues, const int32& InStart, const int32& InLength)
+	{
+		return FHoudiniApi::SetParmFloatValues(FHoudiniEngine::Get().GetSession(), InNodeId, InValues, InStart, InLength);
+	}
+
+	HAPI_Result
+	SetParmValues(const HAPI_NodeId& InNodeId, const int32* InValues, const int32& InStart, const int32& InLength)
+	{
+		return FHoudiniApi::SetParmIntValues(FHoudiniEngine::Get().GetSession(), InNodeId, InValues, InStart, InLength);
+	}
+
+	// Uploads the pending values, one call per contiguous range of values,
+	// and updates the changed state of the parameters the same way UploadChangedParameters does.
+	template<typename ValueType>
+	void
+	FlushPendingParmValues(THoudiniPendingParmValues<ValueType>& InPending)
+	{
+		if (InPending.Parms.Num() <= 0)
+			return;
+
+		InPending.Parms.Sort([](const auto& A, const auto& B)
+		{
+			return A.NodeId != B.NodeId ? A.NodeId < B.NodeId : A.ValueIndex < B.ValueIndex;
+		});
+
+		TArray<ValueType> RangeValues;
+		int32 RangeStart = 0;
+		while (RangeStart < InPending.Parms.Num())
+		{
+			int32 RangeEnd = RangeStart + 1;
+			while (RangeEnd < InPending.Parms.Num()
+				&& InPending.Parms[RangeEnd].NodeId == InPending.Parms[RangeStart].NodeId
+				&& InPending.Parms[RangeEnd].ValueIndex == InPending.Parms[RangeEnd - 1].ValueIndex + InPending.Parms[RangeEnd - 1].Count)
+			{
+				RangeEnd++;
+			}
+
+			// A single parameter is uploaded as usual.
+			// If uploading a range fails, fall back to uploading its parameters one by one
+			// so only the ones actually failing keep their changed state.
+			bool bRangeUploaded = false;
+			if (RangeEnd - RangeStart > 1)
+			{
+				RangeValues.Reset();
+				for (int32 Idx = RangeStart; Idx < RangeEnd; Idx++)
+				{
+					const auto& PendingParm = InPending.Parms[Idx];
+					RangeValues.Append(&InPending.Values[PendingParm.Offset], PendingParm.Count);
+				}
+
+				bRangeUploaded = HAPI_RESULT_SUCCESS == SetParmValues(
+					InPending.Parms[RangeStart].NodeId, RangeValues.GetData(), InPending.Parms[RangeStart].ValueIndex, RangeValues.Num());
+			}
+
+			for (int32 Idx = RangeStart; Idx < RangeEnd; Idx++)
+			{
+				UHoudiniParameter* CurrentParm = InPending.Parms[Idx].Parameter;
+				if (bRangeUploaded || FHoudiniParameterTranslator::UploadParameterValue(CurrentParm))
+				{
+					CurrentParm->MarkChanged(false);
+				}
+				else
+				{
+					// Keep this param marked as changed but prevent it from generating updates
+					CurrentParm->SetNeedsToTriggerUpdate(false);
+				}
+			}
+
+			RangeStart = RangeEnd;
+		}
+
+		InPending.Parms.Reset();
+		InPending.Values.Reset();
+	}
+}
+
 bool
 FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * HAC )
 {
@@ -2605,6 +2818,17 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 	// parameter values after the insert.
 	TArray<UHoudiniParameter*> RampsToUpload;
 
+	// Changed float, int, toggle and color values are gathered and uploaded by contiguous ranges.
+	// They are flushed before any other parameter is processed, as reverts and multiparm changes
+	// can shift the value indices of the parameters after them.
+	THoudiniPendingParmValues<float> PendingFloatValues;
+	THoudiniPendingParmValues<int32> PendingIntValues;
+	auto FlushPendingValues = [&PendingFloatValues, &PendingIntValues]()
+	{
+		FlushPendingParmValues(PendingFloatValues);
+		FlushPendingParmValues(PendingIntValues);
+	};
+
 	for (int32 ParmIdx = 0; ParmIdx < HAC->GetNumParameters(); ParmIdx++)
 	{
 		UHoudiniParameter*& CurrentParm = HAC->Parameters[ParmIdx];
@@ -2614,6 +2838,53 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 		bool bSuccess = false;
 
 		const EHoudiniParameterType CurrentParmType = CurrentParm->GetParameterType();
+		if (!CurrentParm->IsPendingRevertToDefault() && CurrentParm->GetNodeId() >= 0 && CurrentParm->GetValueIndex() >= 0)
+		{
+			bool bIsPending = false;
+			if (CurrentParmType == EHoudiniParameterType::Float)
+			{
+				UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(CurrentParm);
+				if (IsValid(FloatParam) && FloatParam->GetValuesPtr() && FloatParam->GetNumberOfValues() >= FloatParam->GetTupleSize())
+				{
+					PendingFloatValues.Add(FloatParam, FloatParam->GetValuesPtr(), FloatParam->GetTupleSize());
+					bIsPending = true;
+				}
+			}
+			else if (CurrentParmType == EHoudiniParameterType::Color)
+			{
+				UHoudiniParameterColor* ColorParam = Cast<UHoudiniParameterColor>(CurrentParm);
+				if (IsValid(ColorParam))
+				{
+					const FLinearColor Color = ColorParam->GetColorValue();
+					PendingFloatValues.Add(ColorParam, (const float*)(&Color.R), ColorParam->GetTupleSize() == 4 ? 4 : 3);
+					bIsPending = true;
+				}
+			}
+			else if (CurrentParmType == EHoudiniParameterType::Int)
+			{
+				UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(CurrentParm);
+				if (IsValid(IntParam) && IntParam->GetValuesPtr() && IntParam->GetNumberOfValues() >= IntParam->GetTupleSize())
+				{
+					PendingIntValues.Add(IntParam, IntParam->GetValuesPtr(), IntParam->GetTupleSize());
+					bIsPending = true;
+				}
+			}
+			else if (CurrentParmType == EHoudiniParameterType::Toggle)
+			{
+				UHoudiniParameterToggle* ToggleParam = Cast<UHoudiniParameterToggle>(CurrentParm);
+				if (IsValid(ToggleParam) && ToggleParam->GetValuesPtr() && ToggleParam->GetNumValues() >= ToggleParam->GetTupleSize())
+				{
+					PendingIntValues.Add(ToggleParam, ToggleParam->GetValuesPtr(), ToggleParam->GetTupleSize());
+					bIsPending = true;
+				}
+			}
+
+			if (bIsPending)
+				continue;
+		}
+
+		FlushPendingValues();
+
 		if (CurrentParm->IsPendingRevertToDefault())
 		{
 			bSuccess = RevertParameterToDefault(CurrentParm);
@@ -2650,6 +2921,8 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 		}
 	}
 
+	FlushPendingValues();
+
 	FHoudiniParameterTranslator::RevertRampParameters(RampsToRevert, HAC->GetAssetId());
 
 	for (UHoudiniParameter* const RampParam : RampsToUpload)
@@ -105,6 +105,8 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 	// and set to true when creating a new parameter
 	// bUpdateValue should be set to false when updating loaded parameters
 	// as the internal parameter's value from HAPI
+	// The Default*Values arrays are values fetched beforehand for all the parameters (from the node
+	// or the asset definition's defaults), when given they are used instead of querying the node.
 	static bool UpdateParameterFromInfo(
 		UHoudiniParameter * HoudiniParameter,
 		const HAPI_NodeId& InNodeId,
@@ -145,6 +147,20 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 		const HAPI_ParmId& ParmId,
 		FString& OutUnitString );
 
+	// Get a parameter's tag value from the tags fetched during its last full update.
+	static bool GetParameterTagValue(
+		UHoudiniParameter* InParam,
+		const FString& Tag,
+		FString& TagValue);
+
+	// Get a parameter's unit from the tags fetched during its last full update.
+	static bool GetParameterUnit(
+		UHoudiniParameter* InParam,
+		FString& OutUnitString);
+
+	// Converts a Houdini unit string (ie "m1 s-1") to one that FUnitConversion::UnitFromString() understands.
+	static FString ConvertHoudiniUnitString(const FString& InUnitString);
+
 	// HAPI: Indicates if a parameter has a given tag
 	static bool HapiGetParameterHasTag(
 		const HAPI_NodeId& NodeId,
@@ -0,0 +1,451 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPartAttributeStore.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+bool
+FHoudiniPartAttributeStore::Prefetch(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const TArray<const char*>& InFloatAttributes,
+	const TArray<const char*>& InIntAttributes,
+	const TArray<const char*>& InStringAttributes,
+	const TArray<FString>& InGenericAttributePrefixes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniPartAttributeStore::Prefetch"));
+
+	Reset();
+
+	GeoId = InGeoId;
+	PartId = InPartId;
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
+		FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo), false);
+
+	// Get the names of all the attributes of the part, for all owners.
+	// The handles are converted in a single batch.
+	TArray<int32> AllNameHandles;
+	int32 OwnerStart[HAPI_ATTROWNER_MAX];
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+	{
+		OwnerStart[OwnerIdx] = AllNameHandles.Num();
+
+		const int32 AttribCount = PartInfo.attributeCounts[OwnerIdx];
+		if (AttribCount <= 0)
+			continue;
+
+		TArray<HAPI_StringHandle> NameHandles;
+		NameHandles.SetNum(AttribCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			GeoId, PartId, (HAPI_AttributeOwner)OwnerIdx,
+			NameHandles.GetData(), AttribCount), false);
+
+		AllNameHandles.Append(NameHandles);
+	}
+
+	TArray<FString> AllNames;
+	if (!FHoudiniEngineString::SHArrayToFStringArray(AllNameHandles, AllNames) || AllNames.Num() != AllNameHandles.Num())
+		return false;
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+	{
+		const int32 End = (OwnerIdx + 1 < HAPI_ATTROWNER_MAX) ? OwnerStart[OwnerIdx + 1] : AllNames.Num();
+		for (int32 NameIdx = OwnerStart[OwnerIdx]; NameIdx < End; ++NameIdx)
+			AttributeNames[OwnerIdx].Add(AllNames[NameIdx]);
+	}
+
+	bIsValid = true;
+
+	// Fetch the data of the requested attributes that exist, on their owner
+	for (const char* AttribName : InFloatAttributes)
+	{
+		const HAPI_AttributeOwner Owner = FindAttributeOwner(AttribName);
+		if (Owner == HAPI_ATTROWNER_INVALID)
+			continue;
+
+		TAttributeEntry<float>& Entry = FloatAttributes.Add(FString(AttribName));
+		FHoudiniApi::AttributeInfo_Init(&Entry.Info);
+		Entry.bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			GeoId, PartId, AttribName, Entry.Info, Entry.Data, 0, Owner);
+	}
+
+	for (const char* AttribName : InIntAttributes)
+	{
+		const HAPI_AttributeOwner Owner = FindAttributeOwner(AttribName);
+		if (Owner == HAPI_ATTROWNER_INVALID)
+			continue;
+
+		TAttributeEntry<int32>& Entry = IntAttributes.Add(FString(AttribName));
+		FHoudiniApi::AttributeInfo_Init(&Entry.Info);
+		Entry.bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+			GeoId, PartId, AttribName, Entry.Info, Entry.Data, 0, Owner);
+	}
+
+	for (const char* AttribName : InStringAttributes)
+	{
+		const HAPI_AttributeOwner Owner = FindAttributeOwner(AttribName);
+		if (Owner == HAPI_ATTROWNER_INVALID)
+			continue;
+
+		TAttributeEntry<FString>& Entry = StringAttributes.Add(FString(AttribName));
+		FHoudiniApi::AttributeInfo_Init(&Entry.Info);
+		Entry.bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+			GeoId, PartId, AttribName, Entry.Info, Entry.Data, 0, Owner);
+	}
+
+	for (const FString& Prefix : InGenericAttributePrefixes)
+	{
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+		{
+			for (const FString& AttribName : AttributeNames[OwnerIdx])
+			{
+				if (AttribName.StartsWith(Prefix, ESearchCase::IgnoreCase))
+					FindOrFetchGenericAttribute(AttribName, (HAPI_AttributeOwner)OwnerIdx);
+			}
+		}
+	}
+
+	// Only count the accesses made after the prefetch
+	NumHits = 0;
+	NumMisses = 0;
+
+	return true;
+}
+
+void
+FHoudiniPartAttributeStore::Reset()
+{
+	GeoId = -1;
+	PartId = -1;
+	bIsValid = false;
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+	{
+		AttributeNames[OwnerIdx].Empty();
+		GenericAttributes[OwnerIdx].Empty();
+	}
+
+	FloatAttributes.Empty();
+	IntAttributes.Empty();
+	StringAttributes.Empty();
+
+	NumHits = 0;
+	NumMisses = 0;
+}
+
+HAPI_AttributeOwner
+FHoudiniPartAttributeStore::FindAttributeOwner(const FString& InAttribName) const
+{
+	// Same search order as FHoudiniEngineUtils::HapiGetAttributeDataAs*: vertex, point, prim then detail
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+	{
+		if (AttributeNames[OwnerIdx].Contains(InAttribName))
+			return (HAPI_AttributeOwner)OwnerIdx;
+	}
+
+	return HAPI_ATTROWNER_INVALID;
+}
+
+bool
+FHoudiniPartAttributeStore::HasAttribute(const char* InAttribName, const HAPI_AttributeOwner& InOwner) const
+{
+	if (!bIsValid)
+		return FHoudiniEngineUtils::HapiCheckAttributeExists(GeoId, PartId, InAttribName, InOwner);
+
+	if (InOwner == HAPI_ATTROWNER_INVALID)
+		return FindAttributeOwner(InAttribName) != HAPI_ATTROWNER_INVALID;
+
+	if (InOwner < 0 || InOwner >= HAPI_ATTROWNER_MAX)
+		return false;
+
+	return AttributeNames[InOwner].Contains(InAttribName);
+}
+
+const TArray<FString>&
+FHoudiniPartAttributeStore::GetAttributeNames(const HAPI_AttributeOwner& InOwner) const
+{
+	static const TArray<FString> NoNames;
+	if (!bIsValid || InOwner < 0 || InOwner >= HAPI_ATTROWNER_MAX)
+		return NoNames;
+
+	return AttributeNames[InOwner];
+}
+
+bool
+FHoudiniPartAttributeStore::GetAttributeDataAsFloat(
+	const char* InAttribName,
+	HAPI_AttributeInfo& OutAttributeInfo,
+	TArray<float>& OutData,
+	const bool bInTakeData)
+{
+	if (!bIsValid)
+	{
+		NumMisses++;
+		return FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(GeoId, PartId, InAttribName, OutAttributeInfo, OutData);
+	}
+
+	TAttributeEntry<float>* Entry = FloatAttributes.Find(InAttribName);
+	if (!Entry)
+	{
+		const HAPI_AttributeOwner Owner = FindAttributeOwner(InAttribName);
+		if (Owner == HAPI_ATTROWNER_INVALID)
+		{
+			// The attribute doesn't exist on this part
+			NumHits++;
+			OutAttributeInfo.exists = false;
+			OutData.SetNum(0);
+			return false;
+		}
+
+		NumMisses++;
+		Entry = &FloatAttributes.Add(FString(InAttribName));
+		FHoudiniApi::AttributeInfo_Init(&Entry->Info);
+		Entry->bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			GeoId, PartId, InAttribName, Entry->Info, Entry->Data, 0, Owner);
+	}
+	else
+	{
+		NumHits++;
+	}
+
+	OutAttributeInfo = Entry->Info;
+	const bool bSuccess = Entry->bSuccess;
+	if (bInTakeData)
+	{
+		OutData = MoveTemp(Entry->Data);
+		FloatAttributes.Remove(InAttribName);
+	}
+	else
+	{
+		OutData = Entry->Data;
+	}
+
+	return bSuccess;
+}
+
+bool
+FHoudiniPartAttributeStore::GetAttributeDataAsInteger(
+	const char* InAttribName,
+	HAPI_AttributeInfo& OutAttributeInfo,
+	TArray<int32>& OutData,
+	const bool bInTakeData)
+{
+	if (!bIsValid)
+	{
+		NumMisses++;
+		return FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(GeoId, PartId, InAttribName, OutAttributeInfo, OutData);
+	}
+
+	TAttributeEntry<int32>* Entry = IntAttributes.Find(InAttribName);
+	if (!Entry)
+	{
+		const HAPI_AttributeOwner Owner = FindAttributeOwner(InAttribName);
+		if (Owner == HAPI_ATTROWNER_INVALID)
+		{
+			// The attribute doesn't exist on this part
+			NumHits++;
+			OutAttributeInfo.exists = false;
+			OutData.SetNum(0);
+			return false;
+		}
+
+		NumMisses++;
+		Entry = &IntAttributes.Add(FString(InAttribName));
+		FHoudiniApi::AttributeInfo_Init(&Entry->Info);
+		Entry->bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+			GeoId, PartId, InAttribName, Entry->Info, Entry->Data, 0, Owner);
+	}
+	else
+	{
+		NumHits++;
+	}
+
+	OutAttributeInfo = Entry->Info;
+	const bool bSuccess = Entry->bSuccess;
+	if (bInTakeData)
+	{
+		OutData = MoveTemp(Entry->Data);
+		IntAttributes.Remove(InAttribName);
+	}
+	else
+	{
+		OutData = Entry->Data;
+	}
+
+	return bSuccess;
+}
+
+bool
+FHoudiniPartAttributeStore::GetAttributeDataAsString(
+	const char* InAttribName,
+	HAPI_AttributeInfo& OutAttributeInfo,
+	TArray<FString>& OutData)
+{
+	if (!bIsValid)
+	{
+		NumMisses++;
+		return FHoudiniEngineUtils::HapiGetAttributeDataAsString(GeoId, PartId, InAttribName, OutAttributeInfo, OutData);
+	}
+
+	TAttributeEntry<FString>* Entry = StringAttributes.Find(InAttribName);
+	if (!Entry)
+	{
+		const HAPI_AttributeOwner Owner = FindAttributeOwner(InAttribName);
+		if (Owner == HAPI_ATTROWNER_INVALID)
+		{
+			// The attribute doesn't exist on this part
+			NumHits++;
+			OutAttributeInfo.exists = false;
+			OutData.SetNum(0);
+			return false;
+		}
+
+		NumMisses++;
+		Entry = &StringAttributes.Add(FString(InAttribName));
+		FHoudiniApi::AttributeInfo_Init(&Entry->Info);
+		Entry->bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+			GeoId, PartId, InAttribName, Entry->Info, Entry->Data, 0, Owner);
+	}
+	else
+	{
+		NumHits++;
+	}
+
+	OutAttributeInfo = Entry->Info;
+	OutData = Entry->Data;
+
+	return Entry->bSuccess;
+}
+
+const FHoudiniGenericAttribute*
+FHoudiniPartAttributeStore::FindOrFetchGenericAttribute(const FString& InAttribName, const HAPI_AttributeOwner& InOwner)
+{
+	if (const FHoudiniGenericAttribute* Found = GenericAttributes[InOwner].Find(InAttribName))
+	{
+		NumHits++;
+		return Found;
+	}
+
+	NumMisses++;
+
+	// Fetch all the values, splits are sliced from the stored attribute
+	FHoudiniGenericAttribute Attribute;
+	if (!FHoudiniEngineUtils::HapiGetGenericAttribute(GeoId, PartId, InAttribName, InOwner, -1, Attribute))
+		return nullptr;
+
+	return &GenericAttributes[InOwner].Add(InAttribName, MoveTemp(Attribute));
+}
+
+int32
+FHoudiniPartAttributeStore::GetGenericAttributeList(
+	const FString& InGenericAttributePrefix,
+	TArray<FHoudiniGenericAttribute>& OutFoundAttributes,
+	const HAPI_AttributeOwner& AttributeOwner,
+	const int32& InAttribIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniPartAttributeStore::GetGenericAttributeList"));
+
+	if (!bIsValid)
+	{
+		NumMisses++;
+		return FHoudiniEngineUtils::GetGenericAttributeList(
+			GeoId, PartId, InGenericAttributePrefix, OutFoundAttributes, AttributeOwner, InAttribIndex);
+	}
+
+	if (AttributeOwner < 0 || AttributeOwner >= HAPI_ATTROWNER_MAX)
+		return 0;
+
+	// Same as FHoudiniEngineUtils::GetGenericAttributeList(): for everything but detail attributes,
+	// only keep the value at the given index if one was specified
+	const bool bHandleSplit = (AttributeOwner != HAPI_ATTROWNER_DETAIL) && (InAttribIndex != -1);
+
+	int32 FoundCount = 0;
+	for (const FString& AttribName : AttributeNames[AttributeOwner])
+	{
+		if (!AttribName.StartsWith(InGenericAttributePrefix, ESearchCase::IgnoreCase))
+			continue;
+
+		const FHoudiniGenericAttribute* StoredAttribute = FindOrFetchGenericAttribute(AttribName, AttributeOwner);
+		if (!StoredAttribute)
+			continue;
+
+		FHoudiniGenericAttribute& CurrentGenericAttribute = OutFoundAttributes.Add_GetRef(*StoredAttribute);
+
+		// Remove the generic attribute prefix
+		CurrentGenericAttribute.AttributeName = AttribName.Right(AttribName.Len() - InGenericAttributePrefix.Len());
+
+		// Slice the value(s) of the split, invalid indices keep all the values
+		if (bHandleSplit && InAttribIndex >= 0 && InAttribIndex < StoredAttribute->AttributeCount)
+		{
+			const int32 TupleSize = FMath::Max(StoredAttribute->AttributeTupleSize, 1);
+			const int32 Start = InAttribIndex * TupleSize;
+			if (StoredAttribute->DoubleValues.Num() > 0)
+				CurrentGenericAttribute.DoubleValues = TArray<double>(StoredAttribute->DoubleValues.GetData() + Start, TupleSize);
+			if (StoredAttribute->IntValues.Num() > 0)
+				CurrentGenericAttribute.IntValues = TArray<int64>(StoredAttribute->IntValues.GetData() + Start, TupleSize);
+			if (StoredAttribute->StringValues.Num() > 0)
+				CurrentGenericAttribute.StringValues = TArray<FString>(StoredAttribute->StringValues.GetData() + Start, TupleSize);
+		}
+
+		FoundCount++;
+	}
+
+	return FoundCount;
+}
+
+bool
+FHoudiniPartAttributeStore::GetGenericPropertiesAttributes(
+	const bool InFindDetailAttributes,
+	const int32& InFirstValidPrimIndex,
+	const int32& InFirstValidVertexIndex,
+	const int32& InFirstValidPointIndex,
+	TArray<FHoudiniGenericAttribute>& OutPropertyAttributes)
+{
+	int32 FoundCount = 0;
+
+	if (InFindDetailAttributes)
+		FoundCount += GetGenericAttributeList(HAPI_UNREAL_ATTRIB_GENERIC_UPROP_PREFIX, OutPropertyAttributes, HAPI_ATTROWNER_DETAIL);
+
+	if (InFirstValidPrimIndex != INDEX_NONE)
+		FoundCount += GetGenericAttributeList(HAPI_UNREAL_ATTRIB_GENERIC_UPROP_PREFIX, OutPropertyAttributes, HAPI_ATTROWNER_PRIM, InFirstValidPrimIndex);
+
+	if (InFirstValidVertexIndex != INDEX_NONE)
+		FoundCount += GetGenericAttributeList(HAPI_UNREAL_ATTRIB_GENERIC_UPROP_PREFIX, OutPropertyAttributes, HAPI_ATTROWNER_VERTEX, InFirstValidVertexIndex);
+
+	if (InFirstValidPointIndex != INDEX_NONE)
+		FoundCount += GetGenericAttributeList(HAPI_UNREAL_ATTRIB_GENERIC_UPROP_PREFIX, OutPropertyAttributes, HAPI_ATTROWNER_POINT, InFirstValidPointIndex);
+
+	return FoundCount > 0;
+}
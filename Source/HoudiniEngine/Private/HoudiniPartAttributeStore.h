@@ -0,0 +1,141 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniGenericAttribute.h"
+
+#include "CoreMinimal.h"
+
+// Attribute data of a single part, fetched in one prefetch pass.
+//
+// Prefetch() enumerates the part's attribute names once per owner, then fetches the info and
+// data of the requested attributes that exist, on their known owner.
+// Getters are then served from the store: attributes missing from the part are answered without
+// any HAPI call, and generic attributes are fetched once for the part and sliced per split
+// instead of being re-enumerated and re-fetched for every split.
+// Attributes that were not prefetched are fetched on their known owner on first access.
+// If the store hasn't been prefetched, getters fall back to the FHoudiniEngineUtils helpers.
+class HOUDINIENGINE_API FHoudiniPartAttributeStore
+{
+public:
+
+	// Enumerates the part's attributes and fetches the given float, int and string attributes,
+	// as well as all the attributes starting with one of the given generic prefixes.
+	bool Prefetch(
+		const HAPI_NodeId& InGeoId,
+		const HAPI_PartId& InPartId,
+		const TArray<const char*>& InFloatAttributes,
+		const TArray<const char*>& InIntAttributes,
+		const TArray<const char*>& InStringAttributes,
+		const TArray<FString>& InGenericAttributePrefixes);
+
+	void Reset();
+
+	bool IsValid() const { return bIsValid; }
+
+	// Returns true if the part has the given attribute, on any owner if InOwner is invalid.
+	bool HasAttribute(const char* InAttribName, const HAPI_AttributeOwner& InOwner = HAPI_ATTROWNER_INVALID) const;
+
+	// Returns the names of the part's attributes on the given owner, empty if the store hasn't been prefetched.
+	const TArray<FString>& GetAttributeNames(const HAPI_AttributeOwner& InOwner) const;
+
+	// Same behaviour as FHoudiniEngineUtils::HapiGetAttributeDataAsFloat() for the whole attribute.
+	// If bInTakeData is true, the stored data is moved to OutData instead of being copied.
+	bool GetAttributeDataAsFloat(
+		const char* InAttribName,
+		HAPI_AttributeInfo& OutAttributeInfo,
+		TArray<float>& OutData,
+		const bool bInTakeData = false);
+
+	// Same behaviour as FHoudiniEngineUtils::HapiGetAttributeDataAsInteger() for the whole attribute.
+	// If bInTakeData is true, the stored data is moved to OutData instead of being copied.
+	bool GetAttributeDataAsInteger(
+		const char* InAttribName,
+		HAPI_AttributeInfo& OutAttributeInfo,
+		TArray<int32>& OutData,
+		const bool bInTakeData = false);
+
+	// Same behaviour as FHoudiniEngineUtils::HapiGetAttributeDataAsString() for the whole attribute.
+	bool GetAttributeDataAsString(
+		const char* InAttribName,
+		HAPI_AttributeInfo& OutAttributeInfo,
+		TArray<FString>& OutData);
+
+	// Same behaviour as FHoudiniEngineUtils::GetGenericAttributeList().
+	int32 GetGenericAttributeList(
+		const FString& InGenericAttributePrefix,
+		TArray<FHoudiniGenericAttribute>& OutFoundAttributes,
+		const HAPI_AttributeOwner& AttributeOwner,
+		const int32& InAttribIndex = -1);
+
+	// Same behaviour as FHoudiniEngineUtils::GetGenericPropertiesAttributes().
+	bool GetGenericPropertiesAttributes(
+		const bool InFindDetailAttributes,
+		const int32& InFirstValidPrimIndex,
+		const int32& InFirstValidVertexIndex,
+		const int32& InFirstValidPointIndex,
+		TArray<FHoudiniGenericAttribute>& OutPropertyAttributes);
+
+	// Number of attribute fetches served from the store since the last prefetch.
+	int32 GetNumHits() const { return NumHits; }
+	// Number of attribute fetches that had to go to HAPI since the last prefetch.
+	int32 GetNumMisses() const { return NumMisses; }
+
+protected:
+
+	// Returns the first owner holding the given attribute, in the order used by FHoudiniEngineUtils.
+	HAPI_AttributeOwner FindAttributeOwner(const FString& InAttribName) const;
+
+	// Fetches all the values of a generic attribute, or returns the stored one.
+	const FHoudiniGenericAttribute* FindOrFetchGenericAttribute(const FString& InAttribName, const HAPI_AttributeOwner& InOwner);
+
+	template<typename TValue>
+	struct TAttributeEntry
+	{
+		HAPI_AttributeInfo Info;
+		TArray<TValue> Data;
+		bool bSuccess = false;
+	};
+
+	HAPI_NodeId GeoId = -1;
+	HAPI_PartId PartId = -1;
+	bool bIsValid = false;
+
+	// Attribute names of the part, per owner
+	TArray<FString> AttributeNames[HAPI_ATTROWNER_MAX];
+
+	TMap<FString, TAttributeEntry<float>> FloatAttributes;
+	TMap<FString, TAttributeEntry<int32>> IntAttributes;
+	TMap<FString, TAttributeEntry<FString>> StringAttributes;
+
+	// Generic attributes with all their values, per owner, keyed by their full name
+	TMap<FString, FHoudiniGenericAttribute> GenericAttributes[HAPI_ATTROWNER_MAX];
+
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+};
@@ -0,0 +1,90 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Makes an object the active instance of its type while it is in scope.
+// The owner keeps the active instance pointer (usually file static) and activates its helper
+// when it is constructed. Active instances are only used by the game thread.
+// Instances can be nested: the innermost one is active, and deactivating it (or destroying
+// the helper) restores the instance that was active before it.
+template<typename T>
+class THoudiniScopedActiveInstance
+{
+public:
+
+	explicit THoudiniScopedActiveInstance(T*& InActiveInstance)
+		: ActiveInstance(InActiveInstance)
+		, Instance(nullptr)
+		, PreviousInstance(nullptr)
+	{}
+
+	~THoudiniScopedActiveInstance() { Deactivate(); }
+
+	THoudiniScopedActiveInstance(const THoudiniScopedActiveInstance&) = delete;
+	THoudiniScopedActiveInstance& operator=(const THoudiniScopedActiveInstance&) = delete;
+
+	// Makes InInstance the active instance, fails if not called on the game thread.
+	bool Activate(T* InInstance)
+	{
+		if (IsActive() || !InInstance || !IsInGameThread())
+			return false;
+
+		PreviousInstance = ActiveInstance;
+		ActiveInstance = InInstance;
+		Instance = InInstance;
+		return true;
+	}
+
+	// Restores the instance that was active before this one.
+	void Deactivate()
+	{
+		if (!IsActive())
+			return;
+
+		// Instances are expected to be deactivated in the reverse order of their activation
+		if (ensure(ActiveInstance == Instance))
+			ActiveInstance = PreviousInstance;
+
+		Instance = nullptr;
+	}
+
+	bool IsActive() const { return Instance != nullptr; }
+
+	// Returns the instance that was active when this one was activated.
+	T* GetPrevious() const { return PreviousInstance; }
+
+	// Returns the current active instance, or null if not called on the game thread.
+	static T* GetActive(T* const InActiveInstance) { return IsInGameThread() ? InActiveInstance : nullptr; }
+
+private:
+
+	T*& ActiveInstance;
+	T* Instance;
+	T* PreviousInstance;
+};
@@ -0,0 +1,328 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniStaticMeshBuildBatch.h"
+
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "EditorSupportDelegates.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_EDITOR
+	#include "StaticMeshCompiler.h"
+#endif
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineBatchStaticMeshBuild(
+	TEXT("HoudiniEngine.BatchStaticMeshBuild"),
+	1,
+	TEXT("When enabled, the static meshes created by a cook are built together using the engine's async static mesh build.\n")
+	TEXT("0: Build each static mesh when it is created.\n")
+	TEXT("1: Build all the static meshes of a cook in one batch (default).\n")
+);
+
+namespace
+{
+	// Innermost batch currently collecting meshes
+	FHoudiniStaticMeshBuildBatch* ActiveStaticMeshBuildBatch = nullptr;
+}
+
+FHoudiniStaticMeshBuildBatch::FHoudiniStaticMeshBuildBatch(const FString& InDisplayName)
+	: DisplayName(InDisplayName)
+	, ActiveScope(ActiveStaticMeshBuildBatch)
+	, bCancelled(false)
+{
+	// Meshes are only collected on the game thread, and when batching hasn't been disabled
+	if (!IsInGameThread() || CVarHoudiniEngineBatchStaticMeshBuild.GetValueOnGameThread() == 0)
+		return;
+
+	ActiveScope.Activate(this);
+}
+
+FHoudiniStaticMeshBuildBatch::~FHoudiniStaticMeshBuildBatch()
+{
+	Finish();
+}
+
+FHoudiniStaticMeshBuildBatch*
+FHoudiniStaticMeshBuildBatch::GetActive()
+{
+	return THoudiniScopedActiveInstance<FHoudiniStaticMeshBuildBatch>::GetActive(ActiveStaticMeshBuildBatch);
+}
+
+void
+FHoudiniStaticMeshBuildBatch::BuildOrDefer(UStaticMesh* InStaticMesh)
+{
+	if (!IsValid(InStaticMesh))
+		return;
+
+	FHoudiniStaticMeshBuildBatch* Batch = GetActive();
+	if (Batch)
+	{
+		Batch->AddStaticMesh(InStaticMesh);
+		return;
+	}
+
+	// No batch, build the mesh now
+	// bSilent doesnt add the Build Errors...
+	TArray<FText> SMBuildErrors;
+	InStaticMesh->Build(true, &SMBuildErrors);
+
+	PostBuildStaticMeshes({ InStaticMesh });
+}
+
+void
+FHoudiniStaticMeshBuildBatch::PostBuildStaticMeshes(const TArray<UStaticMesh*>& InStaticMeshes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshBuildBatch::PostBuildStaticMeshes);
+
+	if (InStaticMeshes.Num() <= 0)
+		return;
+
+	TSet<UStaticMesh*> BuiltMeshes;
+	BuiltMeshes.Reserve(InStaticMeshes.Num());
+	for (UStaticMesh* CurrentMesh : InStaticMeshes)
+	{
+		if (IsValid(CurrentMesh))
+			BuiltMeshes.Add(CurrentMesh);
+	}
+
+	if (BuiltMeshes.Num() <= 0)
+		return;
+
+	// This replaces the call to RefreshCollisionChange, but without CreateNavCollision
+	// as it is already called by UStaticMesh::PostBuildInternal as part of the build,
+	// and can be expensive depending on the vert/poly count of the mesh.
+	// Iterate on the components once for all the meshes.
+	for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
+	{
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
+		if (!StaticMeshComponent || !BuiltMeshes.Contains(StaticMeshComponent->GetStaticMesh()))
+			continue;
+
+		// it needs to recreate IF it already has been created
+		if (StaticMeshComponent->IsPhysicsStateCreated())
+		{
+			StaticMeshComponent->RecreatePhysicsState();
+		}
+	}
+
+	FEditorSupportDelegates::RedrawAllViewports.Broadcast();
+
+	for (UStaticMesh* CurrentMesh : BuiltMeshes)
+	{
+		CurrentMesh->GetOnMeshChanged().Broadcast();
+
+		UPackage* MeshPackage = CurrentMesh->GetOutermost();
+		if (IsValid(MeshPackage))
+		{
+			MeshPackage->MarkPackageDirty();
+		}
+	}
+}
+
+void
+FHoudiniStaticMeshBuildBatch::AddStaticMesh(UStaticMesh* InStaticMesh)
+{
+	if (!IsValid(InStaticMesh))
+		return;
+
+	if (!ActiveScope.IsActive())
+	{
+		BuildOrDefer(InStaticMesh);
+		return;
+	}
+
+	StaticMeshes.AddUnique(InStaticMesh);
+}
+
+void
+FHoudiniStaticMeshBuildBatch::AddCompletion(TFunction<void()>&& InCompletion)
+{
+	if (!InCompletion)
+		return;
+
+	if (!ActiveScope.IsActive())
+	{
+		InCompletion();
+		return;
+	}
+
+	Completions.Add(MoveTemp(InCompletion));
+}
+
+void
+FHoudiniStaticMeshBuildBatch::Finish()
+{
+	if (!ActiveScope.IsActive())
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshBuildBatch::Finish);
+
+	// Stop collecting, anything added from now on is built immediately
+	ActiveScope.Deactivate();
+
+	TArray<UStaticMesh*> MeshesToBuild;
+	MeshesToBuild.Reserve(StaticMeshes.Num());
+	for (const TWeakObjectPtr<UStaticMesh>& CurrentMesh : StaticMeshes)
+	{
+		if (CurrentMesh.IsValid())
+			MeshesToBuild.Add(CurrentMesh.Get());
+	}
+
+	if (MeshesToBuild.Num() > 0)
+	{
+		const double BuildStart = FPlatformTime::Seconds();
+		UpdateNotification(0);
+
+		// Start building all the meshes.
+		// When async static mesh compilation is enabled, this only kicks off the builds.
+		TArray<FText> SMBuildErrors;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+		UStaticMesh::FBuildParameters BuildParameters;
+		BuildParameters.bInSilent = true;
+		BuildParameters.OutErrors = &SMBuildErrors;
+		UStaticMesh::BatchBuild(MeshesToBuild, BuildParameters);
+#else
+		UStaticMesh::BatchBuild(MeshesToBuild, true, nullptr, &SMBuildErrors);
+#endif
+
+		TArray<UStaticMesh*> BuiltMeshes;
+		TArray<UStaticMesh*> CompilingMeshes;
+
+#if WITH_EDITOR
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshBuildBatch::WaitForBuilds);
+
+			// Wait for the async builds, the progress dialog only shows up if the builds take a while
+			FScopedSlowTask SlowTask(
+				(float)MeshesToBuild.Num(),
+				FText::FromString(FString::Printf(TEXT("Building %d static meshes..."), MeshesToBuild.Num())));
+			SlowTask.MakeDialogDelayed(1.0f, true);
+
+			int32 NumBuilt = 0;
+			while (true)
+			{
+				FStaticMeshCompilingManager::Get().ProcessAsyncTasks(true);
+
+				int32 NumCompiling = 0;
+				for (UStaticMesh* CurrentMesh : MeshesToBuild)
+				{
+					if (IsValid(CurrentMesh) && CurrentMesh->IsCompiling())
+						NumCompiling++;
+				}
+
+				const int32 NewNumBuilt = MeshesToBuild.Num() - NumCompiling;
+				if (NewNumBuilt > NumBuilt)
+				{
+					SlowTask.EnterProgressFrame((float)(NewNumBuilt - NumBuilt));
+					NumBuilt = NewNumBuilt;
+					UpdateNotification(NumBuilt);
+				}
+				else
+				{
+					SlowTask.TickProgress();
+				}
+
+				if (NumCompiling <= 0)
+					break;
+
+				if (SlowTask.ShouldCancel())
+				{
+					bCancelled = true;
+					break;
+				}
+
+				FPlatformProcess::Sleep(0.005f);
+			}
+		}
+#endif
+
+		for (UStaticMesh* CurrentMesh : MeshesToBuild)
+		{
+			if (!IsValid(CurrentMesh))
+				continue;
+
+			if (CurrentMesh->IsCompiling())
+				CompilingMeshes.Add(CurrentMesh);
+			else
+				BuiltMeshes.Add(CurrentMesh);
+		}
+
+		// Run the post build steps once for all the built meshes
+		PostBuildStaticMeshes(BuiltMeshes);
+
+		// Meshes that are still building (cancelled wait) get their post build steps when they are done
+		for (UStaticMesh* CurrentMesh : CompilingMeshes)
+		{
+			TSharedRef<FDelegateHandle> PostBuildHandle = MakeShared<FDelegateHandle>();
+			*PostBuildHandle = CurrentMesh->OnPostMeshBuild().AddLambda([PostBuildHandle](UStaticMesh* InStaticMesh)
+			{
+				const FDelegateHandle Handle = *PostBuildHandle;
+				PostBuildStaticMeshes({ InStaticMesh });
+
+				// Removing the delegate destroys this lambda, this must be the last thing we do
+				if (IsValid(InStaticMesh))
+					InStaticMesh->OnPostMeshBuild().Remove(Handle);
+			});
+		}
+
+		HOUDINI_LOG_MESSAGE(TEXT("Built %d static meshes in %f seconds."), BuiltMeshes.Num(), FPlatformTime::Seconds() - BuildStart);
+		if (bCancelled)
+		{
+			HOUDINI_LOG_WARNING(TEXT("Stopped waiting for %d static mesh builds, they will finish in the background."), CompilingMeshes.Num());
+		}
+
+		if (!DisplayName.IsEmpty())
+			FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString(DisplayName + " :\nProcessing outputs..."), false);
+	}
+
+	StaticMeshes.Empty();
+
+	// Completion stage: assign the components now that the meshes have been built
+	TArray<TFunction<void()>> CompletionsToRun = MoveTemp(Completions);
+	Completions.Empty();
+	for (TFunction<void()>& CurrentCompletion : CompletionsToRun)
+	{
+		CurrentCompletion();
+	}
+}
+
+void
+FHoudiniStaticMeshBuildBatch::UpdateNotification(const int32& InNumBuilt) const
+{
+	if (DisplayName.IsEmpty())
+		return;
+
+	FHoudiniEngine::Get().UpdateCookingNotification(
+		FText::FromString(FString::Printf(TEXT("%s :\nBuilding static meshes (%d / %d)..."), *DisplayName, InNumBuilt, StaticMeshes.Num())),
+		false);
+}
@@ -0,0 +1,96 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HoudiniScopedActiveInstance.h"
+
+#include "CoreMinimal.h"
+
+class UStaticMesh;
+
+// Collects the static meshes created while translating the outputs of a cook so they
+// can be built together through the engine's batch / async static mesh build,
+// instead of one synchronous UStaticMesh::Build() per mesh.
+//
+// While a batch is in scope, it is the active batch: the mesh translator hands it the
+// meshes it would otherwise build, and defers the component assignment of its outputs
+// to the batch's completion stage.
+// Finish() builds all the meshes, waits for the async builds while reporting progress
+// on the cooking notification, runs the post build steps once for all the meshes and
+// then runs the completion callbacks. Batches can be nested, the innermost one is active.
+class HOUDINIENGINE_API FHoudiniStaticMeshBuildBatch
+{
+public:
+
+	// InDisplayName is used for the cooking notification, no notification is shown if empty.
+	FHoudiniStaticMeshBuildBatch(const FString& InDisplayName = FString());
+
+	// Finishes the batch if it hasn't been finished already.
+	~FHoudiniStaticMeshBuildBatch();
+
+	// Returns the batch currently collecting meshes, or null if meshes should be built immediately.
+	static FHoudiniStaticMeshBuildBatch* GetActive();
+
+	// Builds the given mesh, or adds it to the active batch if there is one.
+	static void BuildOrDefer(UStaticMesh* InStaticMesh);
+
+	// Runs the steps needed after building static meshes: recreating the physics state of
+	// the components using them, broadcasting their change and dirtying their packages.
+	static void PostBuildStaticMeshes(const TArray<UStaticMesh*>& InStaticMeshes);
+
+	void AddStaticMesh(UStaticMesh* InStaticMesh);
+
+	// Adds a callback that will be called once all the meshes of the batch have been built.
+	void AddCompletion(TFunction<void()>&& InCompletion);
+
+	// Builds all the meshes of the batch and runs the completion callbacks.
+	// The batch stops being active and meshes are built immediately afterwards.
+	void Finish();
+
+	int32 GetNumStaticMeshes() const { return StaticMeshes.Num(); };
+
+	// Returns true if the wait for the builds was cancelled by the user.
+	// The remaining builds finish in the background and get their post build steps when done.
+	bool WasCancelled() const { return bCancelled; };
+
+private:
+
+	FHoudiniStaticMeshBuildBatch(const FHoudiniStaticMeshBuildBatch&) = delete;
+	FHoudiniStaticMeshBuildBatch& operator=(const FHoudiniStaticMeshBuildBatch&) = delete;
+
+	void UpdateNotification(const int32& InNumBuilt) const;
+
+	TArray<TWeakObjectPtr<UStaticMesh>> StaticMeshes;
+	TArray<TFunction<void()>> Completions;
+
+	FString DisplayName;
+
+	// Makes this the active batch until it is finished
+	THoudiniScopedActiveInstance<FHoudiniStaticMeshBuildBatch> ActiveScope;
+
+	bool bCancelled;
+};
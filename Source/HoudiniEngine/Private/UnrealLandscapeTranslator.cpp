@@ -53,6 +53,188 @@
 #include "HoudiniHLODLayerUtils.h"
 #include "HoudiniLandscapeUtils.h"
 
+#include "Engine/Texture2D.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "UObject/UObjectGlobals.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeIncrementalUpload(
+	TEXT("HoudiniEngine.LandscapeIncrementalUpload"),
+	1,
+	TEXT("When a landscape input exported as a heightfield changes, only send the landscape components that changed.\n")
+	TEXT("0: Always resend the whole landscape\n")
+	TEXT("1: Send the changed components into the existing heightfield (default)\n")
+);
+
+namespace
+{
+	// Upload state of the landscape heightfield inputs, by input identifier (ref counted input system only)
+	TMap<FUnrealObjectInputIdentifier, FUnrealLandscapeHeightfieldUploadState> LandscapeHeightfieldUploadStates;
+
+#if WITH_EDITOR
+	FDelegateHandle LandscapeObjectModifiedHandle;
+	FDelegateHandle LandscapeObjectTransactedHandle;
+
+	// Marks a landscape component as modified in the upload states of its landscape
+	void MarkLandscapeComponentDirty(ULandscapeComponent* Component)
+	{
+		const ULandscapeInfo* LandscapeInfo = Component->GetLandscapeInfo();
+		if (!LandscapeInfo)
+			return;
+
+		for (auto& Entry : LandscapeHeightfieldUploadStates)
+		{
+			if (Entry.Value.LandscapeInfo.Get() == LandscapeInfo)
+				Entry.Value.DirtyComponents.Add(Component->GetSectionBase());
+		}
+	}
+
+	// The landscape tools modify the components they edit, or their heightmap / weightmap textures
+	void OnLandscapeObjectModified(UObject* Object)
+	{
+		if (!Object || LandscapeHeightfieldUploadStates.Num() <= 0)
+			return;
+
+		if (ULandscapeComponent* Component = Cast<ULandscapeComponent>(Object))
+		{
+			MarkLandscapeComponentDirty(Component);
+			return;
+		}
+
+		UTexture2D* Texture = Cast<UTexture2D>(Object);
+		ALandscapeProxy* LandscapeProxy = Texture ? Cast<ALandscapeProxy>(Texture->GetOuter()) : nullptr;
+		if (!LandscapeProxy)
+			return;
+
+		for (ULandscapeComponent* Component : LandscapeProxy->LandscapeComponents)
+		{
+			if (!Component)
+				continue;
+
+			if (Component->GetHeightmap(false) == Texture || Component->GetHeightmap(true) == Texture
+				|| Component->GetWeightmapTextures(false).Contains(Texture) || Component->GetWeightmapTextures(true).Contains(Texture))
+			{
+				MarkLandscapeComponentDirty(Component);
+			}
+		}
+	}
+#endif
+
+	// Starts tracking the modified landscape components if there are upload states, stops it otherwise
+	void UpdateLandscapeModificationTracking()
+	{
+#if WITH_EDITOR
+		const bool bTrack = LandscapeHeightfieldUploadStates.Num() > 0;
+		if (bTrack && !LandscapeObjectModifiedHandle.IsValid())
+		{
+			LandscapeObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&OnLandscapeObjectModified);
+			// Undo / redo don't modify the objects they restore
+			LandscapeObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddLambda(
+				[](UObject* Object, const FTransactionObjectEvent&) { OnLandscapeObjectModified(Object); });
+		}
+		else if (!bTrack && LandscapeObjectModifiedHandle.IsValid())
+		{
+			FCoreUObjectDelegates::OnObjectModified.Remove(LandscapeObjectModifiedHandle);
+			FCoreUObjectDelegates::OnObjectTransacted.Remove(LandscapeObjectTransactedHandle);
+			LandscapeObjectModifiedHandle.Reset();
+			LandscapeObjectTransactedHandle.Reset();
+		}
+#endif
+	}
+
+	// Height and target layer data of a region of the landscape
+	struct FLandscapeRegionData
+	{
+		int32 MinX = 0;
+		int32 MinY = 0;
+		int32 XSize = 0;
+		int32 YSize = 0;
+		TArray<uint16> HeightData;
+		TArray<FString> LayerNames;
+		TArray<TArray<uint8>> LayerData;
+		TArray<FLinearColor> LayerDebugColors;
+	};
+
+	// Returns the landscape components whose data is exported for a landscape proxy
+	TArray<ULandscapeComponent*> GetExportedLandscapeComponents(ALandscapeProxy* LandscapeProxy, ULandscapeInfo* LandscapeInfo)
+	{
+		TArray<ULandscapeComponent*> Components;
+		if (LandscapeProxy == LandscapeProxy->GetLandscapeActor())
+		{
+			LandscapeInfo->ForAllLandscapeComponents([&Components](ULandscapeComponent* Component)
+			{
+				if (Component)
+					Components.Add(Component);
+			});
+		}
+		else
+		{
+			for (ULandscapeComponent* Component : LandscapeProxy->LandscapeComponents)
+			{
+				if (Component)
+					Components.Add(Component);
+			}
+		}
+		return Components;
+	}
+
+	bool ExtractLandscapeRegionData(
+		ULandscapeInfo* LandscapeInfo,
+		const int32& MinX,
+		const int32& MinY,
+		const int32& MaxX,
+		const int32& MaxY,
+		bool bIncludePaintLayers,
+		FLandscapeRegionData& OutRegion)
+	{
+		OutRegion.MinX = MinX;
+		OutRegion.MinY = MinY;
+		if (!FUnrealLandscapeTranslator::GetLandscapeData(
+			LandscapeInfo, MinX, MinY, MaxX, MaxY, OutRegion.HeightData, OutRegion.XSize, OutRegion.YSize))
+			return false;
+
+		if (!bIncludePaintLayers)
+			return true;
+
+		for (int32 TargetLayerIndex = 0; TargetLayerIndex < LandscapeInfo->Layers.Num(); TargetLayerIndex++)
+		{
+			TArray<uint8> LayerData;
+			FLinearColor LayerDebugColor;
+			FString LayerName;
+			if (!FUnrealLandscapeTranslator::GetLandscapeTargetLayerData(
+				LandscapeInfo, TargetLayerIndex, MinX, MinY, MaxX, MaxY, LayerData, LayerDebugColor, LayerName))
+				continue;
+
+			// Match the volume names used by SendCombinedTargetLayersToHoudini()
+			if (FName(LayerName).Compare(ALandscape::VisibilityLayer->LayerName) == 0)
+				LayerName = HAPI_UNREAL_VISIBILITY_LAYER_NAME;
+
+			OutRegion.LayerNames.Add(LayerName);
+			OutRegion.LayerData.Add(MoveTemp(LayerData));
+			OutRegion.LayerDebugColors.Add(LayerDebugColor);
+		}
+
+		return true;
+	}
+
+	// Writes a region's converted values (in Houdini order, one row per landscape X) into a heightfield volume.
+	// The region must span the whole volume in Y, so that its values are contiguous in the volume.
+	bool SetHeightfieldRegionData(
+		const HAPI_NodeId& VolumeNodeId,
+		const FString& VolumeName,
+		const TArray<float>& RegionValues,
+		const FLandscapeRegionData& Region,
+		const FUnrealLandscapeHeightfieldUploadState& UploadState)
+	{
+		const int32 VolumeXSize = UploadState.MaxY - UploadState.MinY + 1;
+		if (Region.MinY != UploadState.MinY || Region.YSize != VolumeXSize || RegionValues.Num() != Region.XSize * Region.YSize)
+			return false;
+
+		const int32 Start = (Region.MinX - UploadState.MinX) * VolumeXSize;
+		return HAPI_RESULT_SUCCESS == FHoudiniEngineUtils::HapiSetHeightFieldData(
+			VolumeNodeId, 0, RegionValues.GetData(), Start, RegionValues.Num(), VolumeName);
+	}
+}
 
 bool 
 FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
@@ -286,7 +468,8 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	HAPI_NodeId& CreatedHeightfieldNodeId, 
 	const FString& InputNodeNameStr,
 	HAPI_NodeId ParentNodeId,
-	const bool bSetObjectTransformToWorldTransform) 
+	const bool bSetObjectTransformToWorldTransform,
+	FUnrealLandscapeHeightfieldUploadState* OutUploadState)
 {
   	if (!LandscapeProxy)
 		return false;
@@ -383,7 +566,8 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	if (bExportPaintLayers)
 	{
-		if (!SendTargetLayersToHoudini(LandscapeProxy, HeightFieldId, PartId, MergeId, MaskId, bExportEditLayers, HeightfieldVolumeInfo, XSize, YSize, MergeInputIndex))
+		TMap<FString, HAPI_NodeId>* LayerVolumeIds = OutUploadState ? &OutUploadState->LayerVolumeIds : nullptr;
+		if (!SendTargetLayersToHoudini(LandscapeProxy, HeightFieldId, PartId, MergeId, MaskId, bExportEditLayers, HeightfieldVolumeInfo, XSize, YSize, MergeInputIndex, LayerVolumeIds))
 			return false;
 	}
 
@@ -534,9 +718,190 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	CreatedHeightfieldNodeId = HeightFieldId;
 
+	if (OutUploadState)
+	{
+		OutUploadState->HeightFieldId = HeightFieldId;
+		OutUploadState->HeightId = HeightId;
+		OutUploadState->LandscapeTransform = FHoudiniEngineRuntimeUtils::CalculateHoudiniLandscapeTransform(LandscapeProxy);
+		OutUploadState->bExportPaintLayers = bExportPaintLayers;
+		GetLandscapeProxyExtent(LandscapeProxy, OutUploadState->MinX, OutUploadState->MinY, OutUploadState->MaxX, OutUploadState->MaxY);
+
+		ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+		OutUploadState->LandscapeInfo = LandscapeInfo;
+		OutUploadState->Components.Empty();
+		OutUploadState->DirtyComponents.Empty();
+		if (IsValid(LandscapeInfo))
+		{
+			for (const ULandscapeComponent* Component : GetExportedLandscapeComponents(LandscapeProxy, LandscapeInfo))
+				OutUploadState->Components.Add(Component->GetSectionBase());
+		}
+	}
+
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldTilesFromLandscape(
+	ALandscapeProxy* LandscapeProxy,
+	FUnrealLandscapeHeightfieldUploadState& InOutUploadState,
+	int32& OutNumTilesSent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealLandscapeTranslator::UpdateHeightfieldTilesFromLandscape);
+
+	OutNumTilesSent = 0;
+	if (!IsValid(LandscapeProxy))
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!IsValid(LandscapeInfo) || LandscapeInfo != InOutUploadState.LandscapeInfo.Get())
+		return false;
+
+	//--------------------------------------------------------------------------------------------------
+	// Make sure the existing heightfield still matches the landscape
+	//--------------------------------------------------------------------------------------------------
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(InOutUploadState.HeightFieldId)
+		|| !FHoudiniEngineUtils::IsHoudiniNodeValid(InOutUploadState.HeightId))
+		return false;
+
+	for (const auto& LayerVolume : InOutUploadState.LayerVolumeIds)
+	{
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(LayerVolume.Value))
+			return false;
+	}
+
+	int32 MinX = MAX_int32;
+	int32 MinY = MAX_int32;
+	int32 MaxX = -MAX_int32;
+	int32 MaxY = -MAX_int32;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
+
+	if (MinX != InOutUploadState.MinX || MinY != InOutUploadState.MinY || MaxX != InOutUploadState.MaxX || MaxY != InOutUploadState.MaxY)
+		return false;
+
+	const FTransform LandscapeTransform = FHoudiniEngineRuntimeUtils::CalculateHoudiniLandscapeTransform(LandscapeProxy);
+	if (!LandscapeTransform.Equals(InOutUploadState.LandscapeTransform))
+		return false;
+
+	const TArray<ULandscapeComponent*> Components = GetExportedLandscapeComponents(LandscapeProxy, LandscapeInfo);
+	if (Components.Num() != InOutUploadState.Components.Num())
+		return false;
+
+	for (const ULandscapeComponent* Component : Components)
+	{
+		if (!InOutUploadState.Components.Contains(Component->GetSectionBase()))
+			return false;
+	}
+
+	if (InOutUploadState.bExportPaintLayers)
+	{
+		int32 NumLayers = 0;
+		for (const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers)
+		{
+			if (!LayerSettings.LayerInfoObj)
+				continue;
+
+			// Layers that came from Houdini are converted using their min/max over the whole landscape
+			if (LayerSettings.LayerInfoObj->LayerUsageDebugColor.A == PI)
+				return false;
+
+			NumLayers++;
+		}
+
+		if (NumLayers != InOutUploadState.LayerVolumeIds.Num())
+			return false;
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// Send the components modified since the last upload
+	//--------------------------------------------------------------------------------------------------
+	// Without the editor's modification notifications, we can't know which components changed
+#if WITH_EDITOR
+	const TSet<FIntPoint>& DirtyComponents = InOutUploadState.DirtyComponents;
+#else
+	const TSet<FIntPoint>& DirtyComponents = InOutUploadState.Components;
+#endif
+
+	// The volume values are contiguous along the landscape's Y axis only: the dirty components are sent
+	// by bands of landscape X covering the whole volume, a single call per band and per volume.
+	TMap<FIntPoint, int32> DirtyBands;
+	for (ULandscapeComponent* Component : Components)
+	{
+		if (!DirtyComponents.Contains(Component->GetSectionBase()))
+			continue;
+
+		int32 ComponentMinX = MAX_int32;
+		int32 ComponentMinY = MAX_int32;
+		int32 ComponentMaxX = -MAX_int32;
+		int32 ComponentMaxY = -MAX_int32;
+		Component->GetComponentExtent(ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY);
+		DirtyBands.FindOrAdd(FIntPoint(ComponentMinX, ComponentMaxX))++;
+	}
+
+	TSet<HAPI_NodeId> ModifiedVolumeIds;
+	for (const auto& DirtyBand : DirtyBands)
+	{
+		FLandscapeRegionData Region;
+		if (!ExtractLandscapeRegionData(
+			LandscapeInfo, DirtyBand.Key.X, InOutUploadState.MinY, DirtyBand.Key.Y, InOutUploadState.MaxY,
+			InOutUploadState.bExportPaintLayers, Region))
+			return false;
+
+		// Height
+		TArray<float> RegionFloatValues;
+		HAPI_VolumeInfo RegionVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&RegionVolumeInfo);
+		FVector CenterOffset = FVector::ZeroVector;
+		if (!ConvertLandscapeDataToHeightfieldData(
+			Region.HeightData, Region.XSize, Region.YSize, FVector::ZeroVector, FVector::ZeroVector, LandscapeTransform,
+			RegionFloatValues, RegionVolumeInfo, CenterOffset))
+			return false;
+
+		if (!SetHeightfieldRegionData(InOutUploadState.HeightId, TEXT("height"), RegionFloatValues, Region, InOutUploadState))
+			return false;
+
+		ModifiedVolumeIds.Add(InOutUploadState.HeightId);
+
+		// Target layers
+		for (int32 LayerIndex = 0; LayerIndex < Region.LayerData.Num(); LayerIndex++)
+		{
+			const HAPI_NodeId* LayerVolumeId = InOutUploadState.LayerVolumeIds.Find(Region.LayerNames[LayerIndex]);
+			if (!LayerVolumeId)
+				return false;
+
+			if (!ConvertLandscapeLayerDataToHeightfieldData(
+				Region.LayerData[LayerIndex], Region.XSize, Region.YSize, Region.LayerDebugColors[LayerIndex], RegionFloatValues))
+				return false;
+
+			if (!SetHeightfieldRegionData(*LayerVolumeId, Region.LayerNames[LayerIndex], RegionFloatValues, Region, InOutUploadState))
+				return false;
+
+			ModifiedVolumeIds.Add(*LayerVolumeId);
+		}
+
+		OutNumTilesSent += DirtyBand.Value;
+	}
+
+	for (const HAPI_NodeId& VolumeId : ModifiedVolumeIds)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(FHoudiniEngine::Get().GetSession(), VolumeId), false);
+	}
+
+	if (ModifiedVolumeIds.Num() > 0 && !FHoudiniEngineUtils::HapiCookNode(InOutUploadState.HeightFieldId, nullptr, true))
+		return false;
+
+	InOutUploadState.DirtyComponents.Empty();
+
+	return true;
+}
+
+void
+FUnrealLandscapeTranslator::ResetHeightfieldUploadStates()
+{
+	LandscapeHeightfieldUploadStates.Empty();
+	UpdateLandscapeModificationTracking();
+}
+
 bool 
 FUnrealLandscapeTranslator::CreateHeightfieldFromLandscapeComponentArray(
 	ALandscapeProxy* LandscapeProxy,
@@ -852,6 +1217,14 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject(
 	FUnrealObjectInputHandle ParentHandle;
 	HAPI_NodeId ParentNodeId = -1;
 
+	// Changes to landscapes exported as a single heightfield can be sent per component into the existing heightfield
+	const bool bExportWholeLandscape = !bExportSelectionOnly || (SelectedComponents.Num() == InLandscape->LandscapeComponents.Num());
+	const bool bIncrementalHeightfieldUpload = bUseRefCountedInputSystem
+		&& ExportType == EHoudiniLandscapeExportType::Heightfield
+		&& bExportWholeLandscape
+		&& !InInput->IsEditLayerExportEnabled()
+		&& CVarHoudiniEngineLandscapeIncrementalUpload.GetValueOnAnyThread() != 0;
+
 	if (bUseRefCountedInputSystem)
 	{
 		const FUnrealObjectInputOptions Options = FUnrealObjectInputOptions::MakeOptionsForLandscapeData(
@@ -873,6 +1246,39 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject(
 			}
 		}
 
+		// The landscape changed, if we've kept track of what was sent for it, only send the components that changed
+		if (bIncrementalHeightfieldUpload && Handle.IsValid())
+		{
+			FUnrealLandscapeHeightfieldUploadState* UploadState = LandscapeHeightfieldUploadStates.Find(Identifier);
+			HAPI_NodeId NodeId = -1;
+			if (UploadState
+				&& UploadState->bExportPaintLayers == InInput->IsPaintLayerExportEnabled()
+				&& FUnrealObjectInputUtils::GetHAPINodeId(Handle, NodeId)
+				&& NodeId == UploadState->HeightFieldId)
+			{
+				int32 NumTilesSent = 0;
+				if (UpdateHeightfieldTilesFromLandscape(InLandscape, *UploadState, NumTilesSent))
+				{
+					HOUDINI_LANDSCAPE_MESSAGE(
+						TEXT("[FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject] Sent %d of %d landscape components for %s."),
+						NumTilesSent, UploadState->Components.Num(), *InLandscape->GetName());
+
+					FUnrealObjectInputHandle UpdatedHandle;
+					HAPI_NodeId InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NodeId);
+					if (FUnrealObjectInputUtils::AddNodeOrUpdateNode(Identifier, NodeId, UpdatedHandle, InputObjectNodeId, nullptr, bInputNodesCanBeDeleted))
+					{
+						OutHandle = UpdatedHandle;
+						InputNodeId = NodeId;
+						return true;
+					}
+				}
+			}
+
+			// We'll have to send the whole landscape again
+			LandscapeHeightfieldUploadStates.Remove(Identifier);
+			UpdateLandscapeModificationTracking();
+		}
+
 		FUnrealObjectInputUtils::GetDefaultInputNodeName(Identifier, FinalInputNodeName);
 		// Create any parent/container nodes that we would need, and get the node id of the immediate parent
 		if (FUnrealObjectInputUtils::EnsureParentsExist(Identifier, ParentHandle, bInputNodesCanBeDeleted) && ParentHandle.IsValid())
@@ -950,9 +1356,10 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject(
 		// Ensure we destroy any (Houdini) input nodes before clobbering this object with a new heightfield.
 		//DestroyInputNodes(InInput, InInput->GetInputType());
 
-		int32 NumComponents = InLandscape->LandscapeComponents.Num();
-		if (!bExportSelectionOnly || (SelectedComponents.Num() == NumComponents))
+		if (bExportWholeLandscape)
+		{
 			// Export the whole landscape and its layer as a single heightfield node
+			FUnrealLandscapeHeightfieldUploadState UploadState;
 			bSuccess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 				InLandscape,
 				InInput->IsEditLayerExportEnabled(),
@@ -960,8 +1367,19 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject(
 				InputNodeId, 
 				FinalInputNodeName, 
 				ParentNodeId,
-				bSetObjectTransformToWorldTransform);
+				bSetObjectTransformToWorldTransform,
+				bIncrementalHeightfieldUpload ? &UploadState : nullptr);
+
+			// Keep track of what was sent, and of the components modified from now on,
+			// so that the next changes can be sent per component
+			if (bSuccess && bIncrementalHeightfieldUpload && UploadState.LandscapeInfo.IsValid())
+			{
+				LandscapeHeightfieldUploadStates.Add(Identifier, MoveTemp(UploadState));
+				UpdateLandscapeModificationTracking();
+			}
+		}
 		else
+		{
 			// Each selected landscape component will be exported as separate volumes in a single heightfield
 			bSuccess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscapeComponentArray(
 				InLandscape, 
@@ -971,6 +1389,7 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject(
 				FinalInputNodeName, 
 				ParentNodeId,
 				bSetObjectTransformToWorldTransform);
+		}
 	}
 	else
 	{
@@ -1114,24 +1533,7 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 	int32 MinY = MAX_int32;
 	int32 MaxX = -MAX_int32;
 	int32 MaxY = -MAX_int32;
-	
-	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
-	if (LandscapeProxy == Landscape)
-	{
-		// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
-		// may have been moved to proxies and may not be present on this actor).
-		LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
-	}
-	else
-	{
-		// We only want to get the data for this landscape proxy.
-		// To handle streaming proxies correctly, get the extents via all the components,
-		// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-		for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-		{
-			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-		}
-	}
+	GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY);
 
 	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
 		return false;
@@ -1178,6 +1580,38 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::GetLandscapeProxyExtent(
+	ALandscapeProxy* LandscapeProxy,
+	int32& MinX, int32& MinY,
+	int32& MaxX, int32& MaxY)
+{
+	if (!LandscapeProxy)
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	if (LandscapeProxy == LandscapeProxy->GetLandscapeActor())
+	{
+		// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
+		// may have been moved to proxies and may not be present on this actor).
+		LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
+	}
+	else
+	{
+		// We only want to get the data for this landscape proxy.
+		// To handle streaming proxies correctly, get the extents via all the components,
+		// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
+		for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+		{
+			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+		}
+	}
+
+	return MinX != MAX_int32 && MinY != MAX_int32 && MaxX != -MAX_int32 && MaxY != -MAX_int32;
+}
 
 void
 FUnrealLandscapeTranslator::GetLandscapeProxyBounds(
@@ -1582,24 +2016,7 @@ FUnrealLandscapeTranslator::GetLandscapeTargetLayerData(
 	int32 MinY = MAX_int32;
 	int32 MaxX = -MAX_int32;
 	int32 MaxY = -MAX_int32;
-
-	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
-	if (LandscapeProxy == Landscape)
-	{
-		// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
-		// may have been moved to proxies and may not be present on this actor).
-		LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
-	}
-	else
-	{
-		// We only want to get the data for this landscape proxy.
-		// To handle streaming proxies correctly, get the extents via all the components,
-		// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-		for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-		{
-			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-		}
-	}
+	GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY);
 
 	if(MinX == MAX_int32 || MinY == MAX_int32 || MaxX == -MAX_int32 || MaxY == -MAX_int32)
 		return false;
@@ -2490,9 +2907,10 @@ bool FUnrealLandscapeTranslator::SendTargetLayersToHoudini(
 	const HAPI_VolumeInfo& HeightFieldVolumeInfo,
 	int32 XSize,
 	int32 YSize,
-	int32& OutMergeInputIndex)
+	int32& OutMergeInputIndex,
+	TMap<FString, HAPI_NodeId>* OutLayerVolumeIds)
 {
-	bool bSuccess = SendCombinedTargetLayersToHoudini(LandscapeProxy, HeightFieldId, PartId, MergeId, MaskId, HeightFieldVolumeInfo, XSize, YSize, OutMergeInputIndex);
+	bool bSuccess = SendCombinedTargetLayersToHoudini(LandscapeProxy, HeightFieldId, PartId, MergeId, MaskId, HeightFieldVolumeInfo, XSize, YSize, OutMergeInputIndex, OutLayerVolumeIds);
 
 	if (bExportIndividualEditLayers)
 		bSuccess &= SendAllEditLayerTargetLayersToHoudini(LandscapeProxy, HeightFieldId, PartId, MergeId, MaskId, HeightFieldVolumeInfo, XSize, YSize, OutMergeInputIndex);
@@ -2509,7 +2927,8 @@ bool FUnrealLandscapeTranslator::SendCombinedTargetLayersToHoudini(
 	const HAPI_VolumeInfo& HeightfieldVolumeInfo,
 	int32 XSize,
 	int32 YSize,
-	int32 & OutMergeInputIndex)
+	int32 & OutMergeInputIndex,
+	TMap<FString, HAPI_NodeId>* OutLayerVolumeIds)
 {
 	// This function sends the combined target (paint) layers to Houdini.
 	// "Combined" means that all target layers in all edit layers are combined.
@@ -2554,6 +2973,9 @@ bool FUnrealLandscapeTranslator::SendCombinedTargetLayersToHoudini(
 		if (LayerVolumeNodeId == -1)
 			return false;
 
+		if (OutLayerVolumeIds)
+			OutLayerVolumeIds->Add(TargetLayerName, LayerVolumeNodeId);
+
 		if (!TargetLayerName.Equals(TEXT("mask"), ESearchCase::IgnoreCase))
 		{
 			// We had to create a new volume for this layer, so we need to connect it to the HF's merge node
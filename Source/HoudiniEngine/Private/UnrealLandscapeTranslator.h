@@ -34,6 +34,39 @@ class UHoudiniInputLandscape;
 class FUnrealObjectInputHandle;
 class UHoudiniInput;
 
+// What was sent to Houdini for a landscape exported as a single heightfield, so that later edits
+// can be sent per landscape component into the existing volume nodes.
+struct HOUDINIENGINE_API FUnrealLandscapeHeightfieldUploadState
+{
+	HAPI_NodeId HeightFieldId = -1;
+	HAPI_NodeId HeightId = -1;
+
+	// Volume node used for each combined target layer, by volume name
+	TMap<FString, HAPI_NodeId> LayerVolumeIds;
+
+	// Landscape extent covered by the heightfield
+	int32 MinX = MAX_int32;
+	int32 MinY = MAX_int32;
+	int32 MaxX = -MAX_int32;
+	int32 MaxY = -MAX_int32;
+
+	// Transform used when converting the height values
+	FTransform LandscapeTransform = FTransform::Identity;
+
+	bool bExportPaintLayers = false;
+
+	// Landscape the heightfield was created from
+	TWeakObjectPtr<ULandscapeInfo> LandscapeInfo;
+
+	// Section bases of the components covered by the heightfield
+	TSet<FIntPoint> Components;
+
+	// Section bases of the components modified since their data was last sent.
+	// Filled from the editor's object modification notifications (the landscape tools modify the components
+	// they edit, or their heightmap / weightmap textures).
+	TSet<FIntPoint> DirtyComponents;
+};
+
 struct HOUDINIENGINE_API FUnrealLandscapeTranslator 
 {
 	public:
@@ -48,7 +81,19 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			HAPI_NodeId& CreatedHeightfieldNodeId,
 			const FString &InputNodeNameStr,
 			HAPI_NodeId ParentNodeId,
-			bool bSetObjectTransformToWorldTransform);
+			bool bSetObjectTransformToWorldTransform,
+			FUnrealLandscapeHeightfieldUploadState* OutUploadState = nullptr);
+
+		// Sends the landscape components modified since the last upload into the existing heightfield
+		// volumes of InOutUploadState. Returns false if the heightfield has to be recreated instead, for example
+		// if the landscape extent, transform, components or target layers have changed.
+		static bool UpdateHeightfieldTilesFromLandscape(
+			ALandscapeProxy* LandscapeProxy,
+			FUnrealLandscapeHeightfieldUploadState& InOutUploadState,
+			int32& OutNumTilesSent);
+
+		// Forgets the upload states of the landscape heightfield inputs and stops tracking the landscape modifications
+		static void ResetHeightfieldUploadStates();
 
 		static bool CreateHeightfieldFromLandscapeComponentArray(
 			ALandscapeProxy* LandscapeProxy,
@@ -122,6 +167,13 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			ALandscapeProxy* LandscapeProxy,
 			FVector3d& Origin, FVector3d& Extents);
 
+		// Gets the extent of the data exported for a landscape proxy: the whole landscape for the landscape
+		// actor, or only the proxy's components for streaming proxies.
+		static bool GetLandscapeProxyExtent(
+			ALandscapeProxy* LandscapeProxy,
+			int32& MinX, int32& MinY,
+			int32& MaxX, int32& MaxY);
+
 		// Converts Unreal uint16 values to Houdini Float
 		static bool ConvertLandscapeDataToHeightfieldData(
 			const TArray<uint16>& IntHeightData,
@@ -305,7 +357,8 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_VolumeInfo& HeightfieldVolumeInfo,
 			int32 XSize,
 			int32 YSize,
-			int32 & OutMergeInputIndex);
+			int32 & OutMergeInputIndex,
+			TMap<FString, HAPI_NodeId>* OutLayerVolumeIds = nullptr);
 
 
 		static bool SendAllEditLayerTargetLayersToHoudini(
@@ -329,7 +382,8 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_VolumeInfo& HeightfieldVolumeInfo,
 			int32 XSize,
 			int32 YSize,
-			int32& OutMergeInputIndex);
+			int32& OutMergeInputIndex,
+			TMap<FString, HAPI_NodeId>* OutLayerVolumeIds = nullptr);
 
 		static HAPI_NodeId CreateVolumeLayer(ALandscapeProxy* LandscapeProxy,
 			const FString& VolumeNameLayer,
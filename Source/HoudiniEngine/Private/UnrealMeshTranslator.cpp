@@ -47,6 +47,7 @@
 #include "MeshDescription.h"
 #include "MeshDescriptionOperations.h"
 #include "MeshUtilities.h"
+#include "Misc/SecureHash.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "RawMesh.h"
@@ -124,6 +125,7 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	HAPI_NodeId ParentNodeId = -1;
 	UObject* const InputSystemObject = bIsSplineMesh ? static_cast<UObject*>(SplineMeshComponent) : static_cast<UObject*>(StaticMesh);
 	const bool bUseRefCountedInputSystem = FUnrealObjectInputRuntimeUtils::IsRefCountedInputSystemEnabled();
+	FString ContentHash;
 	if (bUseRefCountedInputSystem)
 	{
 		// Check if we already have an input node for this asset
@@ -157,8 +159,16 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 			// Look for the reference node that references the per-option (LODs, sockets, colliders) nodes
 			Identifier = IdentReferenceNode;
 		}
+
+		// Leaf nodes of static mesh assets can be reused while dirty, as long as their content hasn't changed
+		if (bSingleLeafNodeOnly && !bIsSplineMesh)
+			ContentHash = ComputeStaticMeshContentHash(StaticMesh, bExportMaterialParameters);
+
 		FUnrealObjectInputHandle Handle;
-		if (FUnrealObjectInputUtils::NodeExistsAndIsNotDirty(Identifier, Handle))
+		const bool bNodeIsUpToDate = bSingleLeafNodeOnly
+			? FUnrealObjectInputUtils::NodeExistsAndContentIsUnchanged(Identifier, ContentHash, Handle)
+			: FUnrealObjectInputUtils::NodeExistsAndIsNotDirty(Identifier, Handle);
+		if (bNodeIsUpToDate)
 		{
 			HAPI_NodeId NodeId = -1;
 			if (FUnrealObjectInputUtils::GetHAPINodeId(Handle, NodeId) && (bSingleLeafNodeOnly || FUnrealObjectInputUtils::AreReferencedHAPINodesValid(Handle)))
@@ -770,13 +780,167 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	{
 		FUnrealObjectInputHandle Handle;
 		if (FUnrealObjectInputUtils::AddNodeOrUpdateNode(Identifier, InputNodeId, Handle, InputObjectNodeId, nullptr, bInputNodesCanBeDeleted))
+		{
+			FUnrealObjectInputUtils::SetContentHash(Handle, ContentHash);
 			OutHandle = Handle;
+		}
 	}
 	
 	//
 	return true;
 }
 
+FString
+FUnrealMeshTranslator::ComputeStaticMeshContentHash(UStaticMesh const* StaticMesh, const bool& bInExportMaterialParameters)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FUnrealMeshTranslator::ComputeStaticMeshContentHash"));
+
+	if (!IsValid(StaticMesh))
+		return FString();
+
+#if WITH_EDITORONLY_DATA
+	// The derived data key covers the source mesh descriptions, LODs and build settings of the mesh,
+	// it is not available while the mesh is compiling.
+	if (StaticMesh->IsCompiling())
+		return FString();
+
+	FStaticMeshRenderData const* const RenderData = StaticMesh->GetRenderData();
+	if (!RenderData || RenderData->DerivedDataKey.IsEmpty())
+		return FString();
+
+	FSHA1 Sha;
+	auto UpdateWithString = [&Sha](const FString& InString)
+	{
+		Sha.UpdateWithString(*InString, InString.Len());
+	};
+	auto UpdateWithValue = [&Sha](const auto& InValue)
+	{
+		Sha.Update(reinterpret_cast<const uint8*>(&InValue), sizeof(InValue));
+	};
+
+	UpdateWithString(StaticMesh->GetPathName());
+	UpdateWithString(RenderData->DerivedDataKey);
+	UpdateWithValue(CVarHoudiniEngineStaticMeshExportMethod.GetValueOnAnyThread());
+	UpdateWithValue(StaticMesh->GetLightMapResolution());
+	for (int32 LODIndex = 0; LODIndex < StaticMesh->GetNumSourceModels(); LODIndex++)
+		UpdateWithValue(StaticMesh->GetSourceModel(LODIndex).ScreenSize.Default);
+
+	// Sockets
+	for (UStaticMeshSocket const* const Socket : StaticMesh->Sockets)
+	{
+		if (!IsValid(Socket))
+			continue;
+
+		UpdateWithString(Socket->SocketName.ToString());
+		UpdateWithString(Socket->Tag);
+		UpdateWithValue(Socket->RelativeLocation);
+		UpdateWithValue(Socket->RelativeRotation);
+		UpdateWithValue(Socket->RelativeScale);
+	}
+
+	// Collision
+	if (UBodySetup const* const BodySetup = StaticMesh->GetBodySetup())
+	{
+		UpdateWithValue(BodySetup->CollisionTraceFlag);
+		if (BodySetup->PhysMaterial)
+			UpdateWithString(BodySetup->PhysMaterial->GetPathName());
+
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		for (const FKBoxElem& Box : AggGeom.BoxElems)
+		{
+			UpdateWithValue(Box.Center);
+			UpdateWithValue(Box.Rotation);
+			UpdateWithValue(Box.X);
+			UpdateWithValue(Box.Y);
+			UpdateWithValue(Box.Z);
+		}
+		for (const FKSphereElem& Sphere : AggGeom.SphereElems)
+		{
+			UpdateWithValue(Sphere.Center);
+			UpdateWithValue(Sphere.Radius);
+		}
+		for (const FKSphylElem& Sphyl : AggGeom.SphylElems)
+		{
+			UpdateWithValue(Sphyl.Center);
+			UpdateWithValue(Sphyl.Rotation);
+			UpdateWithValue(Sphyl.Radius);
+			UpdateWithValue(Sphyl.Length);
+		}
+		for (const FKConvexElem& Convex : AggGeom.ConvexElems)
+		{
+			UpdateWithValue(Convex.VertexData.Num());
+			if (Convex.VertexData.Num() > 0)
+				Sha.Update(reinterpret_cast<const uint8*>(Convex.VertexData.GetData()), Convex.VertexData.Num() * Convex.VertexData.GetTypeSize());
+			UpdateWithValue(Convex.GetTransform());
+		}
+	}
+
+	// Materials
+	for (const FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
+	{
+		UMaterialInterface* MaterialInterface = StaticMaterial.MaterialInterface;
+		UpdateWithString(StaticMaterial.MaterialSlotName.ToString());
+		UpdateWithString(MaterialInterface ? MaterialInterface->GetPathName() : FString());
+
+		// The parameter values are sent as attributes (see CreateFaceMaterialArray)
+		if (!bInExportMaterialParameters || !IsValid(MaterialInterface))
+			continue;
+
+		TArray<FMaterialParameterInfo> ParamInfos;
+		TArray<FGuid> ParamGuids;
+		MaterialInterface->GetAllScalarParameterInfo(ParamInfos, ParamGuids);
+		for (const FMaterialParameterInfo& ParamInfo : ParamInfos)
+		{
+			float ScalarValue = 0.0f;
+			MaterialInterface->GetScalarParameterValue(ParamInfo, ScalarValue);
+			UpdateWithString(ParamInfo.Name.ToString());
+			UpdateWithValue(ScalarValue);
+		}
+
+		ParamInfos.Reset();
+		ParamGuids.Reset();
+		MaterialInterface->GetAllVectorParameterInfo(ParamInfos, ParamGuids);
+		for (const FMaterialParameterInfo& ParamInfo : ParamInfos)
+		{
+			FLinearColor VectorValue = FLinearColor::Black;
+			MaterialInterface->GetVectorParameterValue(ParamInfo, VectorValue);
+			UpdateWithString(ParamInfo.Name.ToString());
+			UpdateWithValue(VectorValue);
+		}
+
+		ParamInfos.Reset();
+		ParamGuids.Reset();
+		MaterialInterface->GetAllTextureParameterInfo(ParamInfos, ParamGuids);
+		for (const FMaterialParameterInfo& ParamInfo : ParamInfos)
+		{
+			UTexture* TextureValue = nullptr;
+			MaterialInterface->GetTextureParameterValue(ParamInfo, TextureValue);
+			UpdateWithString(ParamInfo.Name.ToString());
+			UpdateWithString(IsValid(TextureValue) ? TextureValue->GetPathName() : FString());
+		}
+
+		ParamInfos.Reset();
+		ParamGuids.Reset();
+		MaterialInterface->GetAllStaticSwitchParameterInfo(ParamInfos, ParamGuids);
+		for (const FMaterialParameterInfo& ParamInfo : ParamInfos)
+		{
+			bool bSwitchValue = false;
+			FGuid ExpressionGuid;
+			MaterialInterface->GetStaticSwitchParameterValue(ParamInfo, bSwitchValue, ExpressionGuid);
+			UpdateWithString(ParamInfo.Name.ToString());
+			UpdateWithValue(bSwitchValue);
+		}
+	}
+
+	Sha.Final();
+	FSHAHash Hash;
+	Sha.GetHash(Hash.Hash);
+	return Hash.ToString();
+#else
+	return FString();
+#endif
+}
+
 bool
 FUnrealMeshTranslator::CreateInputNodeForMeshSockets(
 	const TArray<UStaticMeshSocket*>& InMeshSocket, const HAPI_NodeId& InParentNodeId, HAPI_NodeId& OutSocketsNodeId)
@@ -165,6 +165,11 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			const HAPI_NodeId& InParentNodeId,
 			HAPI_NodeId& OutSocketsNodeId);
 
+		// Computes a hash of the static mesh content sent to Houdini: the source mesh and LODs (via the render data's
+		// derived data key), sockets, collision and materials, and the materials' parameter values if they are exported.
+		// Returns an empty string if the content can't be hashed, for example while the mesh is being compiled.
+		static FString ComputeStaticMeshContentHash(UStaticMesh const* StaticMesh, const bool& bInExportMaterialParameters);
+
 		// Helper function to extract the array of material names used by a given mesh
 		// This is used for marshalling static mesh's materials.
 		// Memory allocated by this function needs to be cleared by DeleteFaceMaterialArray()
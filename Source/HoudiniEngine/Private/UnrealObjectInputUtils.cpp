@@ -10,6 +10,33 @@
 #include "UnrealObjectInputManager.h"
 #include "UnrealObjectInputRuntimeUtils.h"
 
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter.h"
+
+namespace UnrealObjectInputContentHash
+{
+	// Input uploads skipped / performed, see FUnrealObjectInputUtils::NodeExistsAndContentIsUnchanged()
+	static FThreadSafeCounter NumHits;
+	static FThreadSafeCounter NumMisses;
+}
+
+static FAutoConsoleCommand CCmdHoudiniEngineInputContentHashStats(
+	TEXT("HoudiniEngine.InputContentHash.Stats"),
+	TEXT("Logs the number of input uploads skipped (hits) and performed (misses) by the input content hash. Pass 'reset' to reset the counters."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		int32 NumHits = 0;
+		int32 NumMisses = 0;
+		FUnrealObjectInputUtils::GetContentHashStats(NumHits, NumMisses);
+		const int32 Total = NumHits + NumMisses;
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Input content hash: %d hits, %d misses (%.1f%% reused)."),
+			NumHits, NumMisses, Total > 0 ? 100.0f * NumHits / Total : 0.0f);
+
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+			FUnrealObjectInputUtils::ResetContentHashStats();
+	}));
+
 
 bool
 FUnrealObjectInputUtils::FindNodeViaManager(
@@ -113,6 +140,66 @@ FUnrealObjectInputUtils::NodeExistsAndIsNotDirty(const FUnrealObjectInputIdentif
 	return true;
 }
 
+bool
+FUnrealObjectInputUtils::NodeExistsAndContentIsUnchanged(
+	const FUnrealObjectInputIdentifier& InIdentifier,
+	const FString& InContentHash,
+	FUnrealObjectInputHandle& OutHandle)
+{
+	if (!FindNodeViaManager(InIdentifier, OutHandle) || !AreHAPINodesValid(OutHandle))
+	{
+		UnrealObjectInputContentHash::NumMisses.Increment();
+		return false;
+	}
+
+	FUnrealObjectInputNode* const Node = GetNodeViaManager(OutHandle);
+	if (!Node)
+	{
+		UnrealObjectInputContentHash::NumMisses.Increment();
+		return false;
+	}
+
+	if (Node->IsDirty())
+	{
+		// The entry was dirtied, but we can keep it if the content we would send is the same
+		if (InContentHash.IsEmpty() || Node->GetContentHash() != InContentHash)
+		{
+			UnrealObjectInputContentHash::NumMisses.Increment();
+			return false;
+		}
+
+		Node->ClearDirtyFlag();
+	}
+
+	UnrealObjectInputContentHash::NumHits.Increment();
+	return true;
+}
+
+bool
+FUnrealObjectInputUtils::SetContentHash(const FUnrealObjectInputHandle& InHandle, const FString& InContentHash)
+{
+	FUnrealObjectInputNode* const Node = GetNodeViaManager(InHandle);
+	if (!Node)
+		return false;
+
+	Node->SetContentHash(InContentHash);
+	return true;
+}
+
+void
+FUnrealObjectInputUtils::GetContentHashStats(int32& OutNumHits, int32& OutNumMisses)
+{
+	OutNumHits = UnrealObjectInputContentHash::NumHits.GetValue();
+	OutNumMisses = UnrealObjectInputContentHash::NumMisses.GetValue();
+}
+
+void
+FUnrealObjectInputUtils::ResetContentHashStats()
+{
+	UnrealObjectInputContentHash::NumHits.Reset();
+	UnrealObjectInputContentHash::NumMisses.Reset();
+}
+
 bool
 FUnrealObjectInputUtils::AreReferencedHAPINodesValid(const FUnrealObjectInputHandle& InHandle)
 {
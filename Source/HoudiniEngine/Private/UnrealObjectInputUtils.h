@@ -65,6 +65,21 @@ struct HOUDINIENGINE_API FUnrealObjectInputUtils
 		// the entry is not marked as dirty.
 		static bool NodeExistsAndIsNotDirty(const FUnrealObjectInputIdentifier& InIdentifier, FUnrealObjectInputHandle& OutHandle);
 
+		// Same as NodeExistsAndIsNotDirty(), but a dirty entry whose content hash matches InContentHash is considered
+		// up to date: its dirty flag is cleared and it is reused. Records a content hash hit or miss.
+		// An empty InContentHash never matches.
+		static bool NodeExistsAndContentIsUnchanged(
+			const FUnrealObjectInputIdentifier& InIdentifier,
+			const FString& InContentHash,
+			FUnrealObjectInputHandle& OutHandle);
+
+		// Set the hash of the content that was sent to Houdini for the entry referenced by InHandle.
+		static bool SetContentHash(const FUnrealObjectInputHandle& InHandle, const FString& InContentHash);
+
+		// Number of input uploads skipped (hits) and performed (misses) since the last reset.
+		static void GetContentHashStats(int32& OutNumHits, int32& OutNumMisses);
+		static void ResetContentHashStats();
+
 		// Returns true if the HAPI nodes referenced by the input reference node of InHandle are valid (exist).
 		static bool AreReferencedHAPINodesValid(const FUnrealObjectInputHandle& InHandle);
 
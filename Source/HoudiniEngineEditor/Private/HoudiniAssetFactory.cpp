@@ -31,6 +31,8 @@
 #include "HoudiniToolsPackageAsset.h"
 #include "HoudiniToolsEditor.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniAssetLibraryCache.h"
+#include "HoudiniCookCache.h"
 #include "EditorFramework/AssetImportData.h"
 #include "Misc/FileHelper.h"
 #include "Internationalization/Internationalization.h"
@@ -208,6 +210,10 @@ UHoudiniAssetFactory::Reimport(UObject * Obj)
 			HoudiniAsset->GetClass(), HoudiniAsset->GetOuter(), *HoudiniAsset->GetName(),
 			RF_Public | RF_Standalone, *Filename, NULL, this))
 		{
+			// The next instantiations have to load the new library
+			FHoudiniAssetLibraryCache::InvalidateAsset(HoudiniAsset);
+			FHoudiniCookCache::InvalidateAsset(HoudiniAsset);
+
 			UHoudiniToolsPackageAsset* ToolPackage = FHoudiniToolsEditor::FindOwningToolsPackage(HoudiniAsset);
 
 			if (IsValid(ToolPackage) && !ToolPackage->bReimportToolsDescription && IsValid(PrevToolData))
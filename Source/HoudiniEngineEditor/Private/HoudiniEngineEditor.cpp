@@ -36,6 +36,7 @@
 #include "HoudiniAssetComponentDetails.h"
 #include "HoudiniEditorNodeSyncSubsystem.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineCommandlet.h"
 #include "HoudiniEngineCommands.h"
 #include "HoudiniEngineEditorUtils.h"
 #include "HoudiniEngineStyle.h"
@@ -47,6 +48,7 @@
 #include "HoudiniPackageParams.h"
 #include "HoudiniParameter.h"
 #include "HoudiniPDGAssetLink.h"
+#include "HoudiniPublicAPIBatchProcessor.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniRuntimeSettingsDetails.h"
 #include "HoudiniSplineComponentVisualizer.h"
@@ -191,6 +193,21 @@ void FHoudiniEngineEditor::StartupModule()
 	// PreSaveWorld and PreBeginPIE, for HoudiniStaticMesh -> UStaticMesh builds
 	RegisterEditorDelegates();
 
+	// Let the HoudiniEngine commandlet run Public API batches
+	UHoudiniEngineCommandlet::GetRunBatchDelegate().BindLambda(
+		[](const FHoudiniEngineCommandletBatchArgs& InArgs, const FOnHoudiniEngineCommandletBatchDone& InOnBatchDone)
+		{
+			return UHoudiniPublicAPIBatchProcessor::RunBatchFromFile(
+				InArgs.JobFilePath,
+				InArgs.ReportFilePath,
+				InArgs.MaxConcurrentJobs,
+				InArgs.JobTimeoutSeconds,
+				FOnHoudiniBatchCompletedNative::FDelegate::CreateLambda([InOnBatchDone](UHoudiniPublicAPIBatchProcessor* InProcessor)
+				{
+					InOnBatchDone.ExecuteIfBound(IsValid(InProcessor) ? InProcessor->GetNumFailedJobs() : 0);
+				})) != nullptr;
+		});
+
 	// Store the instance.
 	FHoudiniEngineEditor::HoudiniEngineEditorInstance = this;
 
@@ -223,6 +240,8 @@ void FHoudiniEngineEditor::ShutdownModule()
 	// Deregister editor delegates
 	UnregisterEditorDelegates();
 
+	UHoudiniEngineCommandlet::GetRunBatchDelegate().Unbind();
+
 	// Deregister console commands
 	UnregisterConsoleCommands();
 
@@ -691,6 +691,33 @@ FHoudiniPDGDetails::AddPDGCommandletStatus(
             })
         ]
     ];
+
+	// Work result loading throughput
+	InPDGCategory.AddCustomRow(FText::FromString("PDG Import Stats"))
+	.WholeRowContent()
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.0f)
+		.Padding(2.0f, 0.0f)
+		.VAlign(VAlign_Center)
+		.HAlign(HAlign_Center)
+		[
+			SNew(STextBlock)
+			.Visibility_Lambda([]()
+			{
+				return FHoudiniEngineCommands::IsPDGCommandletEnabled() ? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			.Text_Lambda([]()
+			{
+				const FHoudiniPDGImportStats Stats = FHoudiniEngine::Get().GetPDGImportStats();
+				return FText::FromString(FString::Printf(
+					TEXT("Workers: %d/%d | Queued: %d | Importing: %d | Merging: %d | Loaded: %d (%.1f/s)"),
+					Stats.NumConnectedWorkers, Stats.NumWorkers, Stats.NumQueued, Stats.NumInFlight,
+					Stats.NumPendingMerge, Stats.NumLoaded, Stats.LoadedPerSecond));
+			})
+		]
+	];
 }
 
 bool
@@ -2595,6 +2595,21 @@ UHoudiniPublicAPIAssetWrapper::SetParameterTuples_Implementation(const TMap<FNam
 	return bSuccess;
 }
 
+bool
+UHoudiniPublicAPIAssetWrapper::ApplyParameterTuples_Implementation(const TMap<FName, FHoudiniParameterTuple>& InParameterTuples, const bool bInForceCook)
+{
+	UHoudiniAssetComponent* HAC = nullptr;
+	if (!GetValidHoudiniAssetComponentWithError(HAC))
+		return false;
+
+	const bool bSuccess = SetParameterTuples(InParameterTuples);
+
+	if (bInForceCook)
+		HAC->MarkAsNeedCook();
+
+	return bSuccess;
+}
+
 UHoudiniPublicAPIInput*
 UHoudiniPublicAPIAssetWrapper::CreateEmptyInput_Implementation(TSubclassOf<UHoudiniPublicAPIInput> InInputClass)
 {
@@ -3579,13 +3594,17 @@ UHoudiniPublicAPIAssetWrapper::HandleOnHoudiniProxyMeshesRefinedGlobal(UHoudiniA
 UHoudiniParameter*
 UHoudiniPublicAPIAssetWrapper::FindValidParameterByName(const FName& InParameterTupleName) const
 {
-	AActor* const Actor = GetHoudiniAssetActor();
-	const FString ActorName = IsValid(Actor) ? Actor->GetActorNameOrLabel() : FString();
+	// Only look the actor's name up for the error messages, as this is called for every parameter value
+	auto GetActorName = [this]()
+	{
+		AActor* const Actor = GetHoudiniAssetActor();
+		return IsValid(Actor) ? Actor->GetActorNameOrLabel() : FString();
+	};
 	
 	UHoudiniAssetComponent* const HAC = GetHoudiniAssetComponent();
 	if (!IsValid(HAC))
 	{
-		SetErrorMessage(FString::Printf(TEXT("Could not find HAC on Actor '%s'"), *ActorName));
+		SetErrorMessage(FString::Printf(TEXT("Could not find HAC on Actor '%s'"), *GetActorName()));
 		return nullptr;
 	}
 
@@ -3594,7 +3613,7 @@ UHoudiniPublicAPIAssetWrapper::FindValidParameterByName(const FName& InParameter
 	{
 		SetErrorMessage(FString::Printf(
 			TEXT("Could not find valid parameter tuple '%s' on '%s'."),
-			*InParameterTupleName.ToString(), *ActorName));
+			*InParameterTupleName.ToString(), *GetActorName()));
 		return nullptr;
 	}
 
@@ -4250,18 +4269,7 @@ UHoudiniPublicAPIAssetWrapper::FindValidHoudiniNodeInputParameter(const FName& I
 	if (!GetValidHoudiniAssetComponentWithError(HAC))
 		return nullptr;
 
-	const FString InputParameterName = InInputParameterName.ToString();
-	const int32 NumInputs = HAC->GetNumInputs();
-	for (int32 Index = 0; Index < NumInputs; ++Index)
-	{
-		UHoudiniInput* const Input = HAC->GetInputAt(Index);
-		if (!IsValid(Input))
-			continue;
-		if (Input->IsObjectPathParameter() && Input->GetInputName() == InputParameterName)
-			return Input;
-	}
-
-	return nullptr;
+	return HAC->FindInputParameterByName(InInputParameterName.ToString());
 }
 
 const UHoudiniInput*
@@ -4274,18 +4282,7 @@ UHoudiniPublicAPIAssetWrapper::FindValidHoudiniNodeInputParameter(const FName& I
 	if (!GetValidHoudiniAssetComponentWithError(HAC))
 		return nullptr;
 
-	const FString InputParameterName = InInputParameterName.ToString();
-	const int32 NumInputs = HAC->GetNumInputs();
-	for (int32 Index = 0; Index < NumInputs; ++Index)
-	{
-		UHoudiniInput const* const Input = HAC->GetInputAt(Index);
-		if (!IsValid(Input))
-			continue;
-		if (Input->IsObjectPathParameter() && Input->GetInputName() == InputParameterName)
-			return Input;
-	}
-
-	return nullptr;
+	return HAC->FindInputParameterByName(InInputParameterName.ToString());
 }
 
 bool
@@ -0,0 +1,1239 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPublicAPIBatchProcessor.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngine.h"
+#include "HoudiniParameter.h"
+#include "HoudiniPublicAPI.h"
+#include "HoudiniPublicAPIBlueprintLib.h"
+#include "HoudiniPublicAPIInputTypes.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+
+namespace
+{
+	// Reads a vector stored as an array of 3 numbers
+	bool
+	ReadJobVector(const FJsonObject& InObject, const FString& InFieldName, FVector& OutVector, FString& OutErrorMessage)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InObject.TryGetArrayField(InFieldName, Values))
+			return true;
+
+		if (Values->Num() != 3)
+		{
+			OutErrorMessage = FString::Printf(TEXT("'%s' must be an array of 3 numbers."), *InFieldName);
+			return false;
+		}
+
+		for (int32 Idx = 0; Idx < 3; ++Idx)
+		{
+			double Value = 0.0;
+			if (!(*Values)[Idx].IsValid() || !(*Values)[Idx]->TryGetNumber(Value))
+			{
+				OutErrorMessage = FString::Printf(TEXT("'%s' must be an array of 3 numbers."), *InFieldName);
+				return false;
+			}
+			OutVector[Idx] = Value;
+		}
+
+		return true;
+	}
+
+	// Reads a typed parameter value: { "int": [1, 2] }, { "float": 0.5 }, { "string": ["a"] } or { "bool": true }
+	bool
+	ReadJobParameterTuple(const FString& InParameterName, const TSharedPtr<FJsonValue>& InValue, FHoudiniParameterTuple& OutTuple, FString& OutErrorMessage)
+	{
+		const TSharedPtr<FJsonObject>* TupleObject = nullptr;
+		if (!InValue.IsValid() || !InValue->TryGetObject(TupleObject) || (*TupleObject)->Values.Num() != 1)
+		{
+			OutErrorMessage = FString::Printf(
+				TEXT("Parameter '%s' must be an object with a single 'bool', 'int', 'float' or 'string' entry."), *InParameterName);
+			return false;
+		}
+
+		const FString& Type = (*TupleObject)->Values.CreateConstIterator()->Key;
+		const TSharedPtr<FJsonValue>& TupleValue = (*TupleObject)->Values.CreateConstIterator()->Value;
+
+		TArray<TSharedPtr<FJsonValue>> Values;
+		if (TupleValue.IsValid() && TupleValue->Type == EJson::Array)
+			Values = TupleValue->AsArray();
+		else
+			Values.Add(TupleValue);
+
+		for (const TSharedPtr<FJsonValue>& Value : Values)
+		{
+			bool bValid = Value.IsValid();
+			if (bValid && Type == TEXT("bool"))
+			{
+				bool bBool = false;
+				bValid = Value->TryGetBool(bBool);
+				OutTuple.BoolValues.Add(bBool);
+			}
+			else if (bValid && Type == TEXT("int"))
+			{
+				int32 Int = 0;
+				bValid = Value->TryGetNumber(Int);
+				OutTuple.Int32Values.Add(Int);
+			}
+			else if (bValid && Type == TEXT("float"))
+			{
+				double Float = 0.0;
+				bValid = Value->TryGetNumber(Float);
+				OutTuple.FloatValues.Add(Float);
+			}
+			else if (bValid && Type == TEXT("string"))
+			{
+				FString String;
+				bValid = Value->TryGetString(String);
+				OutTuple.StringValues.Add(String);
+			}
+			else
+			{
+				bValid = false;
+			}
+
+			if (!bValid)
+			{
+				OutErrorMessage = FString::Printf(TEXT("Invalid '%s' value for parameter '%s'."), *Type, *InParameterName);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Reads the object paths of an input
+	bool
+	ReadJobInputObjects(const FString& InInputName, const TSharedPtr<FJsonValue>& InValue, FHoudiniPublicAPIBatchInputObjects& OutInputObjects, FString& OutErrorMessage)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InValue.IsValid() || !InValue->TryGetArray(Values))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Input '%s' must be an array of object paths."), *InInputName);
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : *Values)
+		{
+			FString ObjectPath;
+			if (!Value.IsValid() || !Value->TryGetString(ObjectPath) || ObjectPath.IsEmpty())
+			{
+				OutErrorMessage = FString::Printf(TEXT("Input '%s' must be an array of object paths."), *InInputName);
+				return false;
+			}
+			OutInputObjects.Objects.Add(FSoftObjectPath(ObjectPath));
+		}
+
+		return true;
+	}
+
+	// Reads the entries set in InObject into the job, entries that are not set are left untouched
+	bool
+	ReadJob(const FJsonObject& InObject, FHoudiniPublicAPIBatchJob& InOutJob, FString& OutErrorMessage)
+	{
+		InObject.TryGetStringField(TEXT("name"), InOutJob.JobName);
+
+		FString HoudiniAssetPath;
+		if (InObject.TryGetStringField(TEXT("hda"), HoudiniAssetPath))
+			InOutJob.HoudiniAsset = TSoftObjectPtr<UHoudiniAsset>(FSoftObjectPath(HoudiniAssetPath));
+
+		FVector Location = InOutJob.InstantiateAt.GetLocation();
+		FVector Rotation = InOutJob.InstantiateAt.Rotator().Euler();
+		FVector Scale = InOutJob.InstantiateAt.GetScale3D();
+		if (!ReadJobVector(InObject, TEXT("location"), Location, OutErrorMessage)
+			|| !ReadJobVector(InObject, TEXT("rotation"), Rotation, OutErrorMessage)
+			|| !ReadJobVector(InObject, TEXT("scale"), Scale, OutErrorMessage))
+		{
+			return false;
+		}
+		InOutJob.InstantiateAt = FTransform(FRotator::MakeFromEuler(Rotation), Location, Scale);
+
+		const TSharedPtr<FJsonObject>* Parameters = nullptr;
+		if (InObject.TryGetObjectField(TEXT("parameters"), Parameters))
+		{
+			for (const auto& Entry : (*Parameters)->Values)
+			{
+				FHoudiniParameterTuple ParameterTuple;
+				if (!ReadJobParameterTuple(Entry.Key, Entry.Value, ParameterTuple, OutErrorMessage))
+					return false;
+				InOutJob.Parameters.Add(FName(*Entry.Key), ParameterTuple);
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* NodeInputs = nullptr;
+		if (InObject.TryGetObjectField(TEXT("node_inputs"), NodeInputs))
+		{
+			for (const auto& Entry : (*NodeInputs)->Values)
+			{
+				int32 InputIndex = INDEX_NONE;
+				if (!LexTryParseString(InputIndex, *Entry.Key) || InputIndex < 0)
+				{
+					OutErrorMessage = FString::Printf(TEXT("Invalid node input index '%s'."), *Entry.Key);
+					return false;
+				}
+
+				FHoudiniPublicAPIBatchInputObjects InputObjects;
+				if (!ReadJobInputObjects(Entry.Key, Entry.Value, InputObjects, OutErrorMessage))
+					return false;
+				InOutJob.NodeInputObjects.Add(InputIndex, InputObjects);
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* ParameterInputs = nullptr;
+		if (InObject.TryGetObjectField(TEXT("parameter_inputs"), ParameterInputs))
+		{
+			for (const auto& Entry : (*ParameterInputs)->Values)
+			{
+				FHoudiniPublicAPIBatchInputObjects InputObjects;
+				if (!ReadJobInputObjects(Entry.Key, Entry.Value, InputObjects, OutErrorMessage))
+					return false;
+				InOutJob.ParameterInputObjects.Add(FName(*Entry.Key), InputObjects);
+			}
+		}
+
+		InObject.TryGetBoolField(TEXT("bake"), InOutJob.bBake);
+		InObject.TryGetStringField(TEXT("bake_directory"), InOutJob.BakeDirectoryPath);
+		InObject.TryGetBoolField(TEXT("remove_output_after_bake"), InOutJob.bRemoveOutputAfterBake);
+		InObject.TryGetBoolField(TEXT("recenter_baked_actors"), InOutJob.bRecenterBakedActors);
+		InObject.TryGetBoolField(TEXT("replace_previous_bake"), InOutJob.bReplacePreviousBake);
+
+		FString BakeMethod;
+		if (InObject.TryGetStringField(TEXT("bake_method"), BakeMethod))
+		{
+			const int64 Value = StaticEnum<EHoudiniEngineBakeOption>()->GetValueByNameString(BakeMethod);
+			if (Value == INDEX_NONE)
+			{
+				OutErrorMessage = FString::Printf(TEXT("Invalid bake method '%s'."), *BakeMethod);
+				return false;
+			}
+			InOutJob.BakeMethod = static_cast<EHoudiniEngineBakeOption>(Value);
+		}
+
+		return true;
+	}
+
+	// Applies the job's bake settings, the same way UHoudiniPublicAPI::InstantiateAssetWithExistingWrapper() does
+	void
+	ApplyJobBakeSettings(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const FHoudiniPublicAPIBatchJob& InJob)
+	{
+		FDirectoryPath BakeDirectoryPath;
+		BakeDirectoryPath.Path = InJob.BakeDirectoryPath;
+		InAssetWrapper->SetBakeFolder(BakeDirectoryPath);
+		InAssetWrapper->SetBakeMethod(InJob.BakeMethod);
+		InAssetWrapper->SetRemoveOutputAfterBake(InJob.bRemoveOutputAfterBake);
+		InAssetWrapper->SetRecenterBakedActors(InJob.bRecenterBakedActors);
+		InAssetWrapper->SetReplacePreviousBake(InJob.bReplacePreviousBake);
+		InAssetWrapper->SetAutoBakeEnabled(InJob.bBake);
+	}
+
+	// Creates a geometry input for the given objects
+	UHoudiniPublicAPIInput*
+	CreateJobGeoInput(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const FHoudiniPublicAPIBatchInputObjects& InInputObjects, FString& OutErrorMessage)
+	{
+		TArray<UObject*> Objects;
+		for (const FSoftObjectPath& ObjectPath : InInputObjects.Objects)
+		{
+			UObject* Object = ObjectPath.TryLoad();
+			if (!IsValid(Object))
+			{
+				OutErrorMessage = FString::Printf(TEXT("Could not load the input object '%s'."), *ObjectPath.ToString());
+				return nullptr;
+			}
+			Objects.Add(Object);
+		}
+
+		UHoudiniPublicAPIInput* Input = InAssetWrapper->CreateEmptyInput(UHoudiniPublicAPIGeoInput::StaticClass());
+		if (!IsValid(Input) || !Input->SetInputObjects(Objects))
+		{
+			OutErrorMessage = TEXT("Could not create the geometry input.");
+			return nullptr;
+		}
+
+		return Input;
+	}
+
+	// Returns the node input indices and the parameter input names set by a job
+	void
+	GetJobInputKeys(const FHoudiniPublicAPIBatchJob& InJob, TSet<int32>& OutNodeInputIndices, TSet<FName>& OutParameterInputNames)
+	{
+		OutNodeInputIndices.Reset();
+		OutParameterInputNames.Reset();
+		for (const auto& Entry : InJob.NodeInputs)
+			OutNodeInputIndices.Add(Entry.Key);
+		for (const auto& Entry : InJob.NodeInputObjects)
+			OutNodeInputIndices.Add(Entry.Key);
+		for (const auto& Entry : InJob.ParameterInputs)
+			OutParameterInputNames.Add(Entry.Key);
+		for (const auto& Entry : InJob.ParameterInputObjects)
+			OutParameterInputNames.Add(Entry.Key);
+	}
+
+	FString
+	ToJsonLine(const TSharedRef<FJsonObject>& InObject)
+	{
+		FString Line;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+		FJsonSerializer::Serialize(InObject, Writer);
+		return Line;
+	}
+}
+
+
+FHoudiniPublicAPIBatchJob::FHoudiniPublicAPIBatchJob()
+	: InstantiateAt(FTransform::Identity)
+	, bBake(false)
+	, BakeMethod(EHoudiniEngineBakeOption::ToActor)
+	, bRemoveOutputAfterBake(false)
+	, bRecenterBakedActors(false)
+	, bReplacePreviousBake(false)
+{
+}
+
+FHoudiniPublicAPIBatchJobResult::FHoudiniPublicAPIBatchJobResult()
+	: JobIndex(INDEX_NONE)
+	, bSuccess(false)
+	, bCookSuccess(false)
+	, bBakeSuccess(false)
+	, bReusedInstance(false)
+	, QueuedSeconds(0.0f)
+	, InstantiateSeconds(0.0f)
+	, CookSeconds(0.0f)
+	, BakeSeconds(0.0f)
+	, TotalSeconds(0.0f)
+{
+}
+
+UHoudiniPublicAPIBatchProcessor::UHoudiniPublicAPIBatchProcessor()
+	: WorldContextObject(nullptr)
+	, SpawnInLevelOverride(nullptr)
+	, NextQueuedJob(0)
+	, NumQueuedJobs(0)
+	, NumFailedJobs(0)
+	, NumReusedInstances(0)
+	, MaxConcurrentJobs(0)
+	, JobTimeoutSeconds(0.0f)
+	, bDeleteInstancesOnCompletion(true)
+	, bIsRunning(false)
+	, BatchStartTime(0.0)
+{
+}
+
+UHoudiniPublicAPIBatchProcessor*
+UHoudiniPublicAPIBatchProcessor::CreateBatchProcessor(UObject* InOuter)
+{
+	return NewObject<UHoudiniPublicAPIBatchProcessor>(IsValid(InOuter) ? InOuter : GetTransientPackage());
+}
+
+UHoudiniPublicAPIBatchProcessor*
+UHoudiniPublicAPIBatchProcessor::RunBatchFromFile(
+	const FString& InJobFilePath,
+	const FString& InReportFilePath,
+	const int32 InMaxConcurrentJobs,
+	const float InJobTimeoutSeconds,
+	const FOnHoudiniBatchCompletedNative::FDelegate& InOnCompleted)
+{
+	UHoudiniPublicAPIBatchProcessor* Processor = CreateBatchProcessor();
+	if (!IsValid(Processor))
+		return nullptr;
+
+	int32 NumJobs = 0;
+	if (!Processor->LoadJobsFromFile(InJobFilePath, NumJobs))
+		return nullptr;
+
+	Processor->GetOnBatchCompletedNativeDelegate().Add(InOnCompleted);
+	if (!Processor->Start(InReportFilePath, InMaxConcurrentJobs, InJobTimeoutSeconds))
+		return nullptr;
+
+	return Processor;
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::AddJob_Implementation(const FHoudiniPublicAPIBatchJob& InJob)
+{
+	if (bIsRunning)
+	{
+		SetErrorMessage(TEXT("AddJob: Jobs cannot be added while the batch is running."));
+		return INDEX_NONE;
+	}
+
+	if (InJob.HoudiniAsset.IsNull())
+	{
+		SetErrorMessage(FString::Printf(TEXT("AddJob: Job '%s' does not have an HDA."), *InJob.JobName));
+		return INDEX_NONE;
+	}
+
+	const int32 JobIndex = Jobs.Add(InJob);
+	if (Jobs[JobIndex].JobName.IsEmpty())
+		Jobs[JobIndex].JobName = FString::Printf(TEXT("%s_%d"), *InJob.HoudiniAsset.GetAssetName(), JobIndex);
+
+	return JobIndex;
+}
+
+bool
+UHoudiniPublicAPIBatchProcessor::AddJobs_Implementation(const TArray<FHoudiniPublicAPIBatchJob>& InJobs)
+{
+	bool bSuccess = true;
+	for (const FHoudiniPublicAPIBatchJob& Job : InJobs)
+	{
+		if (AddJob(Job) == INDEX_NONE)
+			bSuccess = false;
+	}
+
+	return bSuccess;
+}
+
+bool
+UHoudiniPublicAPIBatchProcessor::LoadJobsFromFile_Implementation(const FString& InJobFilePath, int32& OutNumJobs)
+{
+	OutNumJobs = 0;
+
+	FString JSONString;
+	if (!FFileHelper::LoadFileToString(JSONString, *InJobFilePath))
+	{
+		SetErrorMessage(FString::Printf(TEXT("LoadJobsFromFile: Could not read '%s'."), *InJobFilePath));
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JSONObject;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JSONString);
+	if (!FJsonSerializer::Deserialize(Reader, JSONObject) || !JSONObject.IsValid())
+	{
+		SetErrorMessage(FString::Printf(TEXT("LoadJobsFromFile: '%s' is not a valid JSON file."), *InJobFilePath));
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JobValues = nullptr;
+	if (!JSONObject->TryGetArrayField(TEXT("jobs"), JobValues))
+	{
+		SetErrorMessage(FString::Printf(TEXT("LoadJobsFromFile: '%s' does not have a 'jobs' array."), *InJobFilePath));
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Defaults = nullptr;
+	JSONObject->TryGetObjectField(TEXT("defaults"), Defaults);
+
+	// Read all the jobs before queuing any, so a bad entry does not leave a partial batch
+	TArray<FHoudiniPublicAPIBatchJob> NewJobs;
+	NewJobs.Reserve(JobValues->Num());
+	for (int32 Idx = 0; Idx < JobValues->Num(); ++Idx)
+	{
+		const TSharedPtr<FJsonObject>* JobObject = nullptr;
+		if (!(*JobValues)[Idx].IsValid() || !(*JobValues)[Idx]->TryGetObject(JobObject))
+		{
+			SetErrorMessage(FString::Printf(TEXT("LoadJobsFromFile: Job %d in '%s' is not an object."), Idx, *InJobFilePath));
+			return false;
+		}
+
+		FHoudiniPublicAPIBatchJob Job;
+		FString ErrorMessage;
+		if ((Defaults && !ReadJob(**Defaults, Job, ErrorMessage)) || !ReadJob(**JobObject, Job, ErrorMessage))
+		{
+			SetErrorMessage(FString::Printf(TEXT("LoadJobsFromFile: Job %d in '%s': %s"), Idx, *InJobFilePath, *ErrorMessage));
+			return false;
+		}
+
+		if (Job.HoudiniAsset.IsNull())
+		{
+			SetErrorMessage(FString::Printf(TEXT("LoadJobsFromFile: Job %d in '%s' does not have an 'hda'."), Idx, *InJobFilePath));
+			return false;
+		}
+
+		NewJobs.Add(MoveTemp(Job));
+	}
+
+	for (const FHoudiniPublicAPIBatchJob& Job : NewJobs)
+	{
+		if (AddJob(Job) == INDEX_NONE)
+			return false;
+		OutNumJobs++;
+	}
+
+	return true;
+}
+
+bool
+UHoudiniPublicAPIBatchProcessor::Start_Implementation(
+	const FString& InReportFilePath,
+	const int32 InMaxConcurrentJobs,
+	const float InJobTimeoutSeconds,
+	UObject* InWorldContextObject,
+	ULevel* InSpawnInLevelOverride,
+	const bool bInDeleteInstancesOnCompletion)
+{
+	if (bIsRunning)
+	{
+		SetErrorMessage(TEXT("Start: The batch is already running."));
+		return false;
+	}
+
+	if (Jobs.Num() <= 0)
+	{
+		SetErrorMessage(TEXT("Start: There are no jobs to run."));
+		return false;
+	}
+
+	ReportFilePath = InReportFilePath;
+	ReportFile.Reset();
+	if (!ReportFilePath.IsEmpty())
+	{
+		ReportFile.Reset(IFileManager::Get().CreateFileWriter(*ReportFilePath));
+		if (!ReportFile)
+		{
+			SetErrorMessage(FString::Printf(TEXT("Start: Could not open the report file '%s'."), *ReportFilePath));
+			return false;
+		}
+	}
+
+	MaxConcurrentJobs = InMaxConcurrentJobs > 0 ? InMaxConcurrentJobs : GetDefaultMaxConcurrentJobs();
+	JobTimeoutSeconds = InJobTimeoutSeconds;
+	WorldContextObject = InWorldContextObject;
+	SpawnInLevelOverride = InSpawnInLevelOverride;
+	bDeleteInstancesOnCompletion = bInDeleteInstancesOnCompletion;
+
+	Results.Reset();
+	RunningResults.Reset();
+	NumFailedJobs = 0;
+	NumReusedInstances = 0;
+
+	// Queue the jobs, and group them per HDA so the slots can pick the jobs matching their instance
+	QueuedJobs.Reset(Jobs.Num());
+	QueuedJobsByAsset.Reset();
+	JobStarted.Init(false, Jobs.Num());
+	NextQueuedJob = 0;
+	NumQueuedJobs = Jobs.Num();
+	for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+	{
+		QueuedJobs.Add(JobIndex);
+		QueuedJobsByAsset.FindOrAdd(Jobs[JobIndex].HoudiniAsset.ToSoftObjectPath()).JobIndices.Add(JobIndex);
+	}
+
+	Slots.Reset();
+	Slots.SetNum(MaxConcurrentJobs);
+	SlotWrappers.Init(nullptr, MaxConcurrentJobs);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("[UHoudiniPublicAPIBatchProcessor] Starting %d job(s) for %d HDA(s), %d at a time."),
+		Jobs.Num(), QueuedJobsByAsset.Num(), MaxConcurrentJobs);
+
+	bIsRunning = true;
+	BatchStartTime = FPlatformTime::Seconds();
+
+	// Keep the processor alive until the batch completes
+	AddToRoot();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UHoudiniPublicAPIBatchProcessor::Tick));
+
+	DispatchJobs();
+
+	return true;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::Cancel_Implementation()
+{
+	if (!bIsRunning)
+		return;
+
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex].JobIndex != INDEX_NONE)
+			CompleteJob(SlotIndex, false, TEXT("The batch was cancelled."));
+	}
+
+	for (int32 JobIndex = PopNextJob(FSoftObjectPath()); JobIndex != INDEX_NONE; JobIndex = PopNextJob(FSoftObjectPath()))
+		FailQueuedJob(JobIndex, TEXT("The batch was cancelled."));
+
+	CompleteBatch();
+}
+
+bool
+UHoudiniPublicAPIBatchProcessor::IsRunning_Implementation() const
+{
+	return bIsRunning;
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::GetNumJobs_Implementation() const
+{
+	return Jobs.Num();
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::GetNumCompletedJobs_Implementation() const
+{
+	return Results.Num();
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::GetNumFailedJobs_Implementation() const
+{
+	return NumFailedJobs;
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::GetDefaultMaxConcurrentJobs() const
+{
+	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+	const int32 PoolSize = HoudiniEngine.GetSessionPoolSize();
+	if (PoolSize <= 1 || HoudiniEngine.IsSessionSyncEnabled())
+		return 1;
+
+	// Instances with inputs are pinned to the main session (see FHoudiniEngineManager::MustUseMainSession),
+	// so they only add one to the jobs that can cook at the same time. The HDAs with a PDG asset link are
+	// pinned too, but we can't know which ones until they are instantiated.
+	int32 NumIndependentJobs = 0;
+	bool bHasMainSessionJobs = false;
+	for (const FHoudiniPublicAPIBatchJob& Job : Jobs)
+	{
+		bool bHasInputs = Job.NodeInputs.Num() > 0 || Job.ParameterInputs.Num() > 0;
+		for (const auto& Entry : Job.NodeInputObjects)
+			bHasInputs = bHasInputs || Entry.Value.Objects.Num() > 0;
+		for (const auto& Entry : Job.ParameterInputObjects)
+			bHasInputs = bHasInputs || Entry.Value.Objects.Num() > 0;
+
+		if (bHasInputs)
+			bHasMainSessionJobs = true;
+		else
+			NumIndependentJobs++;
+	}
+
+	return FMath::Clamp(NumIndependentJobs + (bHasMainSessionJobs ? 1 : 0), 1, PoolSize);
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::GetMaxConcurrentJobs_Implementation() const
+{
+	return MaxConcurrentJobs;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::GetResults_Implementation(TArray<FHoudiniPublicAPIBatchJobResult>& OutResults) const
+{
+	OutResults = Results;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::BeginDestroy()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	ReportFile.Reset();
+
+	Super::BeginDestroy();
+}
+
+bool
+UHoudiniPublicAPIBatchProcessor::Tick(float InDeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniPublicAPIBatchProcessor::Tick);
+
+	if (!bIsRunning)
+		return false;
+
+	const double Now = FPlatformTime::Seconds();
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		FHoudiniBatchSlot& Slot = Slots[SlotIndex];
+		if (Slot.JobIndex == INDEX_NONE)
+		{
+			// Instances are retired here rather than in the wrapper's delegates, which are broadcast by the component
+			if (Slot.bRetireInstance)
+				RetireInstance(SlotIndex);
+			continue;
+		}
+
+		UHoudiniPublicAPIAssetWrapper* const AssetWrapper = SlotWrappers[SlotIndex];
+		if (!IsValid(AssetWrapper) || !IsValid(AssetWrapper->GetHoudiniAssetComponent()))
+		{
+			CompleteJob(SlotIndex, false, TEXT("The instantiated HDA was deleted."));
+		}
+		else if (JobTimeoutSeconds > 0.0f && Now - Slot.JobStartTime > JobTimeoutSeconds)
+		{
+			CompleteJob(SlotIndex, false, FString::Printf(TEXT("Timed out after %.1f seconds."), JobTimeoutSeconds));
+		}
+	}
+
+	DispatchJobs();
+
+	if (NumQueuedJobs <= 0 && RunningResults.Num() <= 0)
+		CompleteBatch();
+
+	return bIsRunning;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::DispatchJobs()
+{
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num() && NumQueuedJobs > 0; ++SlotIndex)
+	{
+		const FHoudiniBatchSlot& Slot = Slots[SlotIndex];
+		if (Slot.JobIndex != INDEX_NONE)
+			continue;
+
+		// Prefer the jobs that can reuse the slot's instance
+		const bool bCanReuse = IsValid(SlotWrappers[SlotIndex]) && !Slot.bRetireInstance;
+		const int32 JobIndex = PopNextJob(bCanReuse ? Slot.HoudiniAssetPath : FSoftObjectPath());
+		if (JobIndex == INDEX_NONE)
+			break;
+
+		StartJob(SlotIndex, JobIndex);
+	}
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::PopNextJob(const FSoftObjectPath& InPreferredAsset)
+{
+	if (NumQueuedJobs <= 0)
+		return INDEX_NONE;
+
+	int32 JobIndex = INDEX_NONE;
+	if (InPreferredAsset.IsValid())
+	{
+		if (FHoudiniBatchAssetQueue* Queue = QueuedJobsByAsset.Find(InPreferredAsset))
+		{
+			while (JobIndex == INDEX_NONE && Queue->NextIndex < Queue->JobIndices.Num())
+			{
+				const int32 Candidate = Queue->JobIndices[Queue->NextIndex++];
+				if (!JobStarted[Candidate])
+					JobIndex = Candidate;
+			}
+		}
+	}
+
+	while (JobIndex == INDEX_NONE && NextQueuedJob < QueuedJobs.Num())
+	{
+		const int32 Candidate = QueuedJobs[NextQueuedJob++];
+		if (!JobStarted[Candidate])
+			JobIndex = Candidate;
+	}
+
+	if (JobIndex != INDEX_NONE)
+	{
+		JobStarted[JobIndex] = true;
+		NumQueuedJobs--;
+	}
+
+	return JobIndex;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::StartJob(const int32 InSlotIndex, const int32 InJobIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniPublicAPIBatchProcessor::StartJob);
+
+	FHoudiniBatchSlot& Slot = Slots[InSlotIndex];
+	const FHoudiniPublicAPIBatchJob& Job = Jobs[InJobIndex];
+	const FSoftObjectPath HoudiniAssetPath = Job.HoudiniAsset.ToSoftObjectPath();
+	const double Now = FPlatformTime::Seconds();
+
+	FHoudiniPublicAPIBatchJobResult& Result = RunningResults.Add(InJobIndex);
+	Result.JobIndex = InJobIndex;
+	Result.JobName = Job.JobName;
+	Result.HoudiniAssetPath = HoudiniAssetPath.ToString();
+	Result.QueuedSeconds = Now - BatchStartTime;
+
+	Slot.JobIndex = InJobIndex;
+	Slot.JobStartTime = Now;
+	Slot.PhaseStartTime = Now;
+
+	UHoudiniPublicAPIAssetWrapper* AssetWrapper = SlotWrappers[InSlotIndex];
+	UHoudiniAssetComponent* const HAC = IsValid(AssetWrapper) ? AssetWrapper->GetHoudiniAssetComponent() : nullptr;
+
+	// The instance of the previous job can be reused if it has the same HDA, and the job overrides all its inputs
+	TSet<int32> NodeInputIndices;
+	TSet<FName> ParameterInputNames;
+	GetJobInputKeys(Job, NodeInputIndices, ParameterInputNames);
+	const bool bReuseInstance = IsValid(HAC)
+		&& !Slot.bRetireInstance
+		&& Slot.HoudiniAssetPath == HoudiniAssetPath
+		&& Slot.SetNodeInputIndices.Num() == NodeInputIndices.Num() && Slot.SetNodeInputIndices.Includes(NodeInputIndices)
+		&& Slot.SetParameterInputNames.Num() == ParameterInputNames.Num() && Slot.SetParameterInputNames.Includes(ParameterInputNames);
+
+	if (bReuseInstance)
+	{
+		Result.bReusedInstance = true;
+		NumReusedInstances++;
+		Slot.Phase = EHoudiniBatchSlotPhase::Cooking;
+
+		// Revert the parameters set by the previous job that this job does not set
+		for (const FName& ParameterName : Slot.SetParameterNames)
+		{
+			if (Job.Parameters.Contains(ParameterName))
+				continue;
+
+			UHoudiniParameter* const Parameter = HAC->FindParameterByName(ParameterName.ToString());
+			if (IsValid(Parameter))
+				Parameter->RevertToDefault();
+		}
+
+		// Each job bakes its own outputs, never replace the bake of the previous job
+		HAC->GetBakedOutputs().Empty();
+
+		ApplyJobBakeSettings(AssetWrapper, Job);
+
+		Job.Parameters.GetKeys(Slot.SetParameterNames);
+
+		FString ErrorMessage;
+		if (!AssetWrapper->ApplyParameterTuples(Job.Parameters))
+		{
+			AssetWrapper->GetLastErrorMessage(ErrorMessage);
+			CompleteJob(InSlotIndex, false, ErrorMessage);
+			return;
+		}
+
+		if (!SetJobInputs(InSlotIndex, Job, ErrorMessage))
+		{
+			CompleteJob(InSlotIndex, false, ErrorMessage);
+			return;
+		}
+
+		// Recook even if the job's values match the previous job's
+		if (!AssetWrapper->Recook())
+		{
+			AssetWrapper->GetLastErrorMessage(ErrorMessage);
+			CompleteJob(InSlotIndex, false, ErrorMessage);
+		}
+
+		return;
+	}
+
+	// Different HDA or inputs: replace the slot's instance
+	if (IsValid(AssetWrapper))
+		RetireInstance(InSlotIndex);
+
+	Slot.Phase = EHoudiniBatchSlotPhase::Instantiating;
+	Slot.HoudiniAssetPath = HoudiniAssetPath;
+
+	UHoudiniPublicAPI* const API = UHoudiniPublicAPIBlueprintLib::GetAPI();
+	if (!IsValid(API))
+	{
+		CompleteJob(InSlotIndex, false, TEXT("Could not get the Houdini Public API."));
+		return;
+	}
+
+	UHoudiniAsset* const HoudiniAsset = Job.HoudiniAsset.LoadSynchronous();
+	if (!IsValid(HoudiniAsset))
+	{
+		CompleteJob(InSlotIndex, false, FString::Printf(TEXT("Could not load the HDA '%s'."), *HoudiniAssetPath.ToString()));
+		return;
+	}
+
+	AssetWrapper = UHoudiniPublicAPIAssetWrapper::CreateEmptyWrapper(API);
+	if (!IsValid(AssetWrapper))
+	{
+		CompleteJob(InSlotIndex, false, TEXT("Could not create an asset wrapper."));
+		return;
+	}
+
+	SlotWrappers[InSlotIndex] = AssetWrapper;
+	BindWrapperDelegates(AssetWrapper);
+
+	if (!API->InstantiateAssetWithExistingWrapper(
+			AssetWrapper,
+			HoudiniAsset,
+			Job.InstantiateAt,
+			WorldContextObject,
+			SpawnInLevelOverride,
+			true,
+			Job.bBake,
+			Job.BakeDirectoryPath,
+			Job.BakeMethod,
+			Job.bRemoveOutputAfterBake,
+			Job.bRecenterBakedActors,
+			Job.bReplacePreviousBake))
+	{
+		FString ErrorMessage;
+		API->GetLastErrorMessage(ErrorMessage);
+		CompleteJob(InSlotIndex, false, ErrorMessage);
+	}
+}
+
+bool
+UHoudiniPublicAPIBatchProcessor::SetJobInputs(const int32 InSlotIndex, const FHoudiniPublicAPIBatchJob& InJob, FString& OutErrorMessage)
+{
+	FHoudiniBatchSlot& Slot = Slots[InSlotIndex];
+	UHoudiniPublicAPIAssetWrapper* const AssetWrapper = SlotWrappers[InSlotIndex];
+
+	GetJobInputKeys(InJob, Slot.SetNodeInputIndices, Slot.SetParameterInputNames);
+
+	TMap<int32, UHoudiniPublicAPIInput*> NodeInputs = InJob.NodeInputs;
+	for (const auto& Entry : InJob.NodeInputObjects)
+	{
+		if (NodeInputs.Contains(Entry.Key))
+			continue;
+
+		UHoudiniPublicAPIInput* const Input = CreateJobGeoInput(AssetWrapper, Entry.Value, OutErrorMessage);
+		if (!Input)
+			return false;
+		NodeInputs.Add(Entry.Key, Input);
+	}
+
+	TMap<FName, UHoudiniPublicAPIInput*> ParameterInputs = InJob.ParameterInputs;
+	for (const auto& Entry : InJob.ParameterInputObjects)
+	{
+		if (ParameterInputs.Contains(Entry.Key))
+			continue;
+
+		UHoudiniPublicAPIInput* const Input = CreateJobGeoInput(AssetWrapper, Entry.Value, OutErrorMessage);
+		if (!Input)
+			return false;
+		ParameterInputs.Add(Entry.Key, Input);
+	}
+
+	if ((NodeInputs.Num() > 0 && !AssetWrapper->SetInputsAtIndices(NodeInputs))
+		|| (ParameterInputs.Num() > 0 && !AssetWrapper->SetInputParameters(ParameterInputs)))
+	{
+		AssetWrapper->GetLastErrorMessage(OutErrorMessage);
+		return false;
+	}
+
+	return true;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::CompleteJob(const int32 InSlotIndex, const bool bInSuccess, const FString& InErrorMessage)
+{
+	FHoudiniBatchSlot& Slot = Slots[InSlotIndex];
+	const int32 JobIndex = Slot.JobIndex;
+	if (JobIndex == INDEX_NONE)
+		return;
+
+	FHoudiniPublicAPIBatchJobResult Result;
+	RunningResults.RemoveAndCopyValue(JobIndex, Result);
+	Result.bSuccess = bInSuccess;
+	Result.ErrorMessage = bInSuccess || !InErrorMessage.IsEmpty() ? InErrorMessage : FString(TEXT("Unknown error."));
+	Result.TotalSeconds = FPlatformTime::Seconds() - Slot.JobStartTime;
+
+	// The state of the instance of a failed job is unknown, do not reuse it
+	if (!bInSuccess)
+		Slot.bRetireInstance = true;
+
+	Slot.JobIndex = INDEX_NONE;
+	Slot.Phase = EHoudiniBatchSlotPhase::Idle;
+
+	AddResult(Result);
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::FailQueuedJob(const int32 InJobIndex, const FString& InErrorMessage)
+{
+	const FHoudiniPublicAPIBatchJob& Job = Jobs[InJobIndex];
+
+	FHoudiniPublicAPIBatchJobResult Result;
+	Result.JobIndex = InJobIndex;
+	Result.JobName = Job.JobName;
+	Result.HoudiniAssetPath = Job.HoudiniAsset.ToString();
+	Result.ErrorMessage = InErrorMessage;
+	Result.QueuedSeconds = FPlatformTime::Seconds() - BatchStartTime;
+
+	AddResult(Result);
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::AddResult(const FHoudiniPublicAPIBatchJobResult& InResult)
+{
+	Results.Add(InResult);
+
+	if (InResult.bSuccess)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("[UHoudiniPublicAPIBatchProcessor] Job %d/%d '%s' completed in %.2fs (instantiate %.2fs, cook %.2fs, bake %.2fs)%s."),
+			Results.Num(), Jobs.Num(), *InResult.JobName, InResult.TotalSeconds, InResult.InstantiateSeconds,
+			InResult.CookSeconds, InResult.BakeSeconds, InResult.bReusedInstance ? TEXT(", reused instance") : TEXT(""));
+	}
+	else
+	{
+		NumFailedJobs++;
+		HOUDINI_LOG_WARNING(
+			TEXT("[UHoudiniPublicAPIBatchProcessor] Job %d/%d '%s' failed: %s"),
+			Results.Num(), Jobs.Num(), *InResult.JobName, *InResult.ErrorMessage);
+	}
+
+	if (ReportFile)
+	{
+		const TSharedRef<FJsonObject> JSONObject = MakeShared<FJsonObject>();
+		JSONObject->SetStringField(TEXT("type"), TEXT("job"));
+		JSONObject->SetNumberField(TEXT("index"), InResult.JobIndex);
+		JSONObject->SetStringField(TEXT("name"), InResult.JobName);
+		JSONObject->SetStringField(TEXT("hda"), InResult.HoudiniAssetPath);
+		JSONObject->SetBoolField(TEXT("success"), InResult.bSuccess);
+		JSONObject->SetBoolField(TEXT("cook_success"), InResult.bCookSuccess);
+		JSONObject->SetBoolField(TEXT("bake_success"), InResult.bBakeSuccess);
+		JSONObject->SetBoolField(TEXT("reused_instance"), InResult.bReusedInstance);
+		JSONObject->SetStringField(TEXT("error"), InResult.ErrorMessage);
+		JSONObject->SetNumberField(TEXT("queued_seconds"), InResult.QueuedSeconds);
+		JSONObject->SetNumberField(TEXT("instantiate_seconds"), InResult.InstantiateSeconds);
+		JSONObject->SetNumberField(TEXT("cook_seconds"), InResult.CookSeconds);
+		JSONObject->SetNumberField(TEXT("bake_seconds"), InResult.BakeSeconds);
+		JSONObject->SetNumberField(TEXT("total_seconds"), InResult.TotalSeconds);
+		WriteReportLine(ToJsonLine(JSONObject));
+	}
+
+	if (OnJobCompleted.IsBound())
+		OnJobCompleted.Broadcast(this, InResult);
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::CompleteBatch()
+{
+	if (!bIsRunning)
+		return;
+
+	bIsRunning = false;
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	for (int32 SlotIndex = 0; SlotIndex < SlotWrappers.Num(); ++SlotIndex)
+	{
+		if (bDeleteInstancesOnCompletion)
+			RetireInstance(SlotIndex);
+		else if (IsValid(SlotWrappers[SlotIndex]))
+			UnbindWrapperDelegates(SlotWrappers[SlotIndex]);
+	}
+	Slots.Reset();
+	SlotWrappers.Reset();
+
+	const double TotalSeconds = FPlatformTime::Seconds() - BatchStartTime;
+	HOUDINI_LOG_MESSAGE(
+		TEXT("[UHoudiniPublicAPIBatchProcessor] Completed %d job(s) in %.2fs: %d failed, %d reused instance(s)."),
+		Results.Num(), TotalSeconds, NumFailedJobs, NumReusedInstances);
+
+	if (ReportFile)
+	{
+		const TSharedRef<FJsonObject> JSONObject = MakeShared<FJsonObject>();
+		JSONObject->SetStringField(TEXT("type"), TEXT("summary"));
+		JSONObject->SetNumberField(TEXT("jobs"), Results.Num());
+		JSONObject->SetNumberField(TEXT("failed_jobs"), NumFailedJobs);
+		JSONObject->SetNumberField(TEXT("reused_instances"), NumReusedInstances);
+		JSONObject->SetNumberField(TEXT("max_concurrent_jobs"), MaxConcurrentJobs);
+		JSONObject->SetNumberField(TEXT("total_seconds"), TotalSeconds);
+		WriteReportLine(ToJsonLine(JSONObject));
+
+		ReportFile->Close();
+		ReportFile.Reset();
+
+		HOUDINI_LOG_MESSAGE(TEXT("[UHoudiniPublicAPIBatchProcessor] Report written to %s."), *ReportFilePath);
+	}
+
+	RemoveFromRoot();
+
+	if (OnBatchCompleted.IsBound())
+		OnBatchCompleted.Broadcast(this);
+
+	OnBatchCompletedNative.Broadcast(this);
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::WriteReportLine(const FString& InLine)
+{
+	if (!ReportFile)
+		return;
+
+	// Flush every line, so the report is usable while the batch runs, or if it is interrupted
+	const FTCHARToUTF8 UTF8Line(*(InLine + TEXT("\n")));
+	ReportFile->Serialize((void*)UTF8Line.Get(), UTF8Line.Length());
+	ReportFile->Flush();
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::RetireInstance(const int32 InSlotIndex)
+{
+	UHoudiniPublicAPIAssetWrapper* const AssetWrapper = SlotWrappers[InSlotIndex];
+	SlotWrappers[InSlotIndex] = nullptr;
+
+	if (Slots.IsValidIndex(InSlotIndex))
+	{
+		FHoudiniBatchSlot& Slot = Slots[InSlotIndex];
+		Slot.HoudiniAssetPath.Reset();
+		Slot.SetParameterNames.Reset();
+		Slot.SetNodeInputIndices.Reset();
+		Slot.SetParameterInputNames.Reset();
+		Slot.bRetireInstance = false;
+	}
+
+	if (!IsValid(AssetWrapper))
+		return;
+
+	UnbindWrapperDelegates(AssetWrapper);
+	if (IsValid(AssetWrapper->GetHoudiniAssetActor()))
+		AssetWrapper->DeleteInstantiatedAsset();
+}
+
+int32
+UHoudiniPublicAPIBatchProcessor::FindSlotIndex(const UHoudiniPublicAPIAssetWrapper* InAssetWrapper) const
+{
+	if (!IsValid(InAssetWrapper))
+		return INDEX_NONE;
+
+	const int32 SlotIndex = SlotWrappers.IndexOfByKey(InAssetWrapper);
+	if (SlotIndex == INDEX_NONE || !Slots.IsValidIndex(SlotIndex) || Slots[SlotIndex].JobIndex == INDEX_NONE)
+		return INDEX_NONE;
+
+	return SlotIndex;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::BindWrapperDelegates(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	InAssetWrapper->GetOnPreInstantiationDelegate().AddDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePreInstantiation);
+	InAssetWrapper->GetOnPostInstantiationDelegate().AddDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostInstantiation);
+	InAssetWrapper->GetOnPostCookDelegate().AddDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostCook);
+	InAssetWrapper->GetOnPostProcessingDelegate().AddDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostProcessing);
+	InAssetWrapper->GetOnPostBakeDelegate().AddDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostBake);
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::UnbindWrapperDelegates(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	InAssetWrapper->GetOnPreInstantiationDelegate().RemoveDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePreInstantiation);
+	InAssetWrapper->GetOnPostInstantiationDelegate().RemoveDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostInstantiation);
+	InAssetWrapper->GetOnPostCookDelegate().RemoveDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostCook);
+	InAssetWrapper->GetOnPostProcessingDelegate().RemoveDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostProcessing);
+	InAssetWrapper->GetOnPostBakeDelegate().RemoveDynamic(this, &UHoudiniPublicAPIBatchProcessor::HandlePostBake);
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::HandlePreInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	const int32 SlotIndex = FindSlotIndex(InAssetWrapper);
+	if (SlotIndex == INDEX_NONE || Slots[SlotIndex].Phase != EHoudiniBatchSlotPhase::Instantiating)
+		return;
+
+	// Set the parameters before the first cook
+	FHoudiniBatchSlot& Slot = Slots[SlotIndex];
+	const FHoudiniPublicAPIBatchJob& Job = Jobs[Slot.JobIndex];
+	Job.Parameters.GetKeys(Slot.SetParameterNames);
+	if (Job.Parameters.Num() > 0 && !InAssetWrapper->SetParameterTuples(Job.Parameters))
+	{
+		FString ErrorMessage;
+		InAssetWrapper->GetLastErrorMessage(ErrorMessage);
+		CompleteJob(SlotIndex, false, ErrorMessage);
+	}
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::HandlePostInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	const int32 SlotIndex = FindSlotIndex(InAssetWrapper);
+	if (SlotIndex == INDEX_NONE || Slots[SlotIndex].Phase != EHoudiniBatchSlotPhase::Instantiating)
+		return;
+
+	FHoudiniBatchSlot& Slot = Slots[SlotIndex];
+	const double Now = FPlatformTime::Seconds();
+	if (FHoudiniPublicAPIBatchJobResult* Result = RunningResults.Find(Slot.JobIndex))
+		Result->InstantiateSeconds = Now - Slot.PhaseStartTime;
+
+	Slot.Phase = EHoudiniBatchSlotPhase::Cooking;
+	Slot.PhaseStartTime = Now;
+
+	// Set the inputs before the first cook
+	FString ErrorMessage;
+	if (!SetJobInputs(SlotIndex, Jobs[Slot.JobIndex], ErrorMessage))
+		CompleteJob(SlotIndex, false, ErrorMessage);
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::HandlePostCook(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const bool bInCookSuccess)
+{
+	const int32 SlotIndex = FindSlotIndex(InAssetWrapper);
+	if (SlotIndex == INDEX_NONE || Slots[SlotIndex].Phase != EHoudiniBatchSlotPhase::Cooking)
+		return;
+
+	FHoudiniBatchSlot& Slot = Slots[SlotIndex];
+	if (FHoudiniPublicAPIBatchJobResult* Result = RunningResults.Find(Slot.JobIndex))
+	{
+		Result->bCookSuccess = bInCookSuccess;
+		if (!bInCookSuccess)
+			Result->CookSeconds = FPlatformTime::Seconds() - Slot.PhaseStartTime;
+	}
+
+	// Do not wait for the outputs of a failed cook
+	if (!bInCookSuccess)
+		CompleteJob(SlotIndex, false, TEXT("The cook failed."));
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::HandlePostProcessing(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	const int32 SlotIndex = FindSlotIndex(InAssetWrapper);
+	if (SlotIndex == INDEX_NONE || Slots[SlotIndex].Phase != EHoudiniBatchSlotPhase::Cooking)
+		return;
+
+	FHoudiniBatchSlot& Slot = Slots[SlotIndex];
+	const double Now = FPlatformTime::Seconds();
+	if (FHoudiniPublicAPIBatchJobResult* Result = RunningResults.Find(Slot.JobIndex))
+		Result->CookSeconds = Now - Slot.PhaseStartTime;
+
+	if (!Jobs[Slot.JobIndex].bBake)
+	{
+		CompleteJob(SlotIndex, true);
+		return;
+	}
+
+	// Wait for the auto-bake
+	Slot.Phase = EHoudiniBatchSlotPhase::Baking;
+	Slot.PhaseStartTime = Now;
+}
+
+void
+UHoudiniPublicAPIBatchProcessor::HandlePostBake(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const bool bInBakeSuccess)
+{
+	const int32 SlotIndex = FindSlotIndex(InAssetWrapper);
+	if (SlotIndex == INDEX_NONE || Slots[SlotIndex].Phase != EHoudiniBatchSlotPhase::Baking)
+		return;
+
+	FHoudiniBatchSlot& Slot = Slots[SlotIndex];
+	if (FHoudiniPublicAPIBatchJobResult* Result = RunningResults.Find(Slot.JobIndex))
+	{
+		Result->BakeSeconds = FPlatformTime::Seconds() - Slot.PhaseStartTime;
+		Result->bBakeSuccess = bInBakeSuccess;
+	}
+
+	CompleteJob(SlotIndex, bInBakeSuccess, bInBakeSuccess ? FString() : FString(TEXT("The bake failed.")));
+}
@@ -32,7 +32,12 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "HoudiniEditorTestUtils.h"
+#include "HoudiniWorldActorIndex.h"
 
+#include "Engine/TriggerBox.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Math/RandomStream.h"
 #include "Misc/AutomationTest.h"
 
 FString FHoudiniEditorInputTests::EquivalenceTestMapName = TEXT("Inputs");
@@ -265,5 +270,143 @@ bool HoudiniEditorInputTest_Curve_Input::RunTest(const FString & Parameters)
 }
 */
 
+// Does not need a Houdini session: runs bound selector and name queries on a synthetic world,
+// through the world actor index and by iterating over the world's actors.
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorInputTest_WorldActorIndexBenchmark, "Houdini.Editor.Inputs.WorldActorIndexBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniEditorInputTest_WorldActorIndexBenchmark::RunTest(const FString & Parameters)
+{
+	// 250 x 250 trigger boxes: 62500 actors
+	const int32 GridSize = 250;
+	const double Spacing = 400.0;
+	const int32 NumQueries = 200;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	if (!TestNotNull(TEXT("Synthetic world is created"), World))
+		return false;
+
+	TArray<AActor*> GridActors;
+	GridActors.Reserve(GridSize * GridSize);
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.Name = FName(*FString::Printf(TEXT("Box_%d_%d"), X, Y));
+			const FVector Location(X * Spacing, Y * Spacing, FMath::Sin(X * 0.1 + Y * 0.3) * Spacing);
+			ATriggerBox* Box = World->SpawnActor<ATriggerBox>(Location, FRotator::ZeroRotator, SpawnParams);
+			if (!Box)
+				continue;
+
+			Box->SetActorLabel(FString::Printf(TEXT("Label_%d_%d"), X, Y));
+			GridActors.Add(Box);
+		}
+	}
+
+	// Bound selector boxes covering a few dozen actors each
+	FRandomStream Random(42);
+	TArray<FBox> QueryBoxes;
+	for (int32 QueryIdx = 0; QueryIdx < NumQueries; QueryIdx++)
+	{
+		const FVector Center(Random.FRandRange(0.0, GridSize * Spacing), Random.FRandRange(0.0, GridSize * Spacing), 0.0);
+		const FVector Extent(Random.FRandRange(Spacing, Spacing * 4.0), Random.FRandRange(Spacing, Spacing * 4.0), Spacing * 2.0);
+		QueryBoxes.Add(FBox(Center - Extent, Center + Extent));
+	}
+
+	// Actor names and labels to look up, a quarter of them missing
+	TArray<FString> QueryNames;
+	for (int32 QueryIdx = 0; QueryIdx < NumQueries; QueryIdx++)
+	{
+		const int32 X = Random.RandRange(0, GridSize - 1);
+		const int32 Y = Random.RandRange(0, GridSize - 1);
+		switch (QueryIdx % 4)
+		{
+			case 0: QueryNames.Add(FString::Printf(TEXT("Box_%d_%d"), X, Y)); break;
+			case 3: QueryNames.Add(FString::Printf(TEXT("Missing_%d_%d"), X, Y)); break;
+			default: QueryNames.Add(FString::Printf(TEXT("Label_%d_%d"), X, Y)); break;
+		}
+	}
+
+	auto FindInBoundsByIterating = [World](const FBox& InBox)
+	{
+		TArray<AActor*> Found;
+		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+		{
+			AActor* CurrentActor = *ActorItr;
+			if (IsValid(CurrentActor) && CurrentActor->GetComponentsBoundingBox(true).Intersect(InBox))
+				Found.Add(CurrentActor);
+		}
+		return Found;
+	};
+
+	auto FindByNameByIterating = [World](const FString& InName) -> AActor*
+	{
+		for (TActorIterator<AActor> ActorItr(World, AActor::StaticClass(), EActorIteratorFlags::AllActors); ActorItr; ++ActorItr)
+		{
+			AActor* CurrentActor = *ActorItr;
+			if (CurrentActor && (CurrentActor->GetActorLabel() == InName || CurrentActor->GetFName().ToString() == InName))
+				return CurrentActor;
+		}
+		return nullptr;
+	};
+
+	// Runs every query through the index and by iterating, and checks that the results match
+	auto RunQueries = [&](const FString& InStep)
+	{
+		FHoudiniWorldActorIndex* Index = FHoudiniWorldActorIndex::Get(World);
+		if (!TestNotNull(TEXT("Editor world is indexed"), Index))
+			return;
+
+		double StartTime = FPlatformTime::Seconds();
+		TArray<TArray<AActor*>> IndexedResults;
+		for (const FBox& CurrentBox : QueryBoxes)
+			Index->FindActorsInBounds({ CurrentBox }, AActor::StaticClass(), IndexedResults.AddDefaulted_GetRef());
+		TArray<AActor*> IndexedNameResults;
+		for (const FString& CurrentName : QueryNames)
+			IndexedNameResults.Add(Index->FindActorByLabelOrName(CurrentName, AActor::StaticClass()));
+		const double IndexedTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		TArray<TArray<AActor*>> IteratedResults;
+		for (const FBox& CurrentBox : QueryBoxes)
+			IteratedResults.Add(FindInBoundsByIterating(CurrentBox));
+		TArray<AActor*> IteratedNameResults;
+		for (const FString& CurrentName : QueryNames)
+			IteratedNameResults.Add(FindByNameByIterating(CurrentName));
+		const double IteratedTime = FPlatformTime::Seconds() - StartTime;
+
+		AddInfo(FString::Printf(
+			TEXT("%s, %d actors, %d bound and %d name queries: iterating %.1f ms, indexed %.1f ms (x%.2f)"),
+			*InStep, Index->GetNumActors(), QueryBoxes.Num(), QueryNames.Num(),
+			IteratedTime * 1000.0, IndexedTime * 1000.0, IndexedTime > 0.0 ? IteratedTime / IndexedTime : 0.0));
+
+		TestTrue(InStep + TEXT(": bound queries match"), IndexedResults == IteratedResults);
+		TestTrue(InStep + TEXT(": name queries match"), IndexedNameResults == IteratedNameResults);
+	};
+
+	// The first run includes building the index
+	RunQueries(TEXT("Build and query"));
+	RunQueries(TEXT("Query"));
+
+	// Move and relabel some actors, the index is updated from the editor notifications
+	for (int32 ActorIdx = 0; ActorIdx < GridActors.Num(); ActorIdx += 97)
+	{
+		AActor* CurrentActor = GridActors[ActorIdx];
+		CurrentActor->SetActorLocation(CurrentActor->GetActorLocation() + FVector(Spacing * 3.5, -Spacing * 2.5, 0.0));
+		CurrentActor->PostEditMove(true);
+		CurrentActor->SetActorLabel(FString::Printf(TEXT("Label_%d_%d"), ActorIdx % GridSize, (ActorIdx / GridSize + 7) % GridSize));
+	}
+	RunQueries(TEXT("Query after moves"));
+
+	// Delete some actors
+	for (int32 ActorIdx = 13; ActorIdx < GridActors.Num(); ActorIdx += 101)
+		World->EditorDestroyActor(GridActors[ActorIdx], false);
+	RunQueries(TEXT("Query after deletes"));
+
+	World->DestroyWorld(false);
+
+	return true;
+}
+
 #endif
 
@@ -28,6 +28,8 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "HoudiniEditorTestUtils.h"
+#include "HoudiniMeshTranslator.h"
+#include "HoudiniStaticMesh.h"
 
 #include "Misc/AutomationTest.h"
 
@@ -103,6 +105,99 @@ bool HoudiniEditorMeshTest_LODs_Common::RunTest(const FString & Parameters)
 	return true;
 }
 
+// Does not need a Houdini session: fills proxy meshes from a synthetic grid part, single threaded then in parallel.
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorMeshTest_ProxyTransferBenchmark, "Houdini.Editor.Mesh.ProxyTransferBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniEditorMeshTest_ProxyTransferBenchmark::RunTest(const FString & Parameters)
+{
+	// 1024 x 1024 quads: ~1M vertices, ~2M triangles
+	const int32 GridSize = 1024;
+	const int32 NumVertices = (GridSize + 1) * (GridSize + 1);
+	const int32 NumTriangles = GridSize * GridSize * 2;
+	const int32 NumVertexInstances = NumTriangles * 3;
+
+	TArray<int32> NeededVertices;
+	TArray<float> Positions;
+	NeededVertices.SetNumUninitialized(NumVertices);
+	Positions.SetNumUninitialized(NumVertices * 3);
+	for (int32 VertexIdx = 0; VertexIdx < NumVertices; VertexIdx++)
+	{
+		NeededVertices[VertexIdx] = VertexIdx;
+		Positions[VertexIdx * 3 + 0] = (float)(VertexIdx % (GridSize + 1));
+		Positions[VertexIdx * 3 + 1] = FMath::Sin(VertexIdx * 0.01f);
+		Positions[VertexIdx * 3 + 2] = (float)(VertexIdx / (GridSize + 1));
+	}
+
+	TArray<int32> TriangleIndices;
+	TriangleIndices.SetNumUninitialized(NumVertexInstances);
+	for (int32 QuadIdx = 0; QuadIdx < GridSize * GridSize; QuadIdx++)
+	{
+		const int32 V0 = (QuadIdx / GridSize) * (GridSize + 1) + QuadIdx % GridSize;
+		const int32 V1 = V0 + 1;
+		const int32 V2 = V0 + GridSize + 1;
+		const int32 V3 = V2 + 1;
+		const int32 Quad[6] = { V0, V2, V1, V1, V2, V3 };
+		FMemory::Memcpy(&TriangleIndices[QuadIdx * 6], Quad, sizeof(Quad));
+	}
+
+	// Per vertex instance normals, colors and one UV set
+	TArray<float> Normals;
+	TArray<float> Colors;
+	TArray<TArray<float>> UVSets;
+	Normals.SetNumUninitialized(NumVertexInstances * 3);
+	Colors.SetNumUninitialized(NumVertexInstances * 3);
+	UVSets.SetNum(1);
+	UVSets[0].SetNumUninitialized(NumVertexInstances * 2);
+	for (int32 InstanceIdx = 0; InstanceIdx < NumVertexInstances; InstanceIdx++)
+	{
+		Normals[InstanceIdx * 3 + 0] = 0.0f;
+		Normals[InstanceIdx * 3 + 1] = 1.0f;
+		Normals[InstanceIdx * 3 + 2] = 0.0f;
+		Colors[InstanceIdx * 3 + 0] = (InstanceIdx % 7) / 7.0f;
+		Colors[InstanceIdx * 3 + 1] = (InstanceIdx % 11) / 11.0f;
+		Colors[InstanceIdx * 3 + 2] = (InstanceIdx % 13) / 13.0f;
+		UVSets[0][InstanceIdx * 2 + 0] = (InstanceIdx % 101) / 100.0f;
+		UVSets[0][InstanceIdx * 2 + 1] = (InstanceIdx % 103) / 102.0f;
+	}
+
+	const TArray<float> Empty;
+	auto FillMesh = [&](UHoudiniStaticMesh* InMesh, bool bInParallel)
+	{
+		InMesh->Initialize(NumVertices, NumTriangles, 1, 0, true, true, true, false);
+
+		const double StartTime = FPlatformTime::Seconds();
+		const bool bValid = FHoudiniMeshTranslator::SetHoudiniStaticMeshVertexPositions(InMesh, NeededVertices, Positions, bInParallel);
+		FHoudiniMeshTranslator::SetHoudiniStaticMeshTriangles(
+			InMesh, TriangleIndices, Normals, NumVertexInstances, Empty, Empty, false, true,
+			Colors, 3, true, Empty, false, UVSets, 1, bInParallel);
+		const double Duration = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(TEXT("Synthetic positions are valid"), bValid);
+		return Duration;
+	};
+
+	UHoudiniStaticMesh* SerialMesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage());
+	UHoudiniStaticMesh* ParallelMesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage());
+
+	const double SerialTime = FillMesh(SerialMesh, false);
+	const double ParallelTime = FillMesh(ParallelMesh, true);
+
+	AddInfo(FString::Printf(
+		TEXT("Proxy mesh transfer, %d vertices / %d triangles: single threaded %.1f ms, parallel %.1f ms (x%.2f)"),
+		NumVertices, NumTriangles, SerialTime * 1000.0, ParallelTime * 1000.0, ParallelTime > 0.0 ? SerialTime / ParallelTime : 0.0));
+
+	TestTrue(TEXT("Positions match"), SerialMesh->GetVertexPositions() == ParallelMesh->GetVertexPositions());
+	TestTrue(TEXT("Triangle indices match"), SerialMesh->GetTriangleIndices() == ParallelMesh->GetTriangleIndices());
+	TestTrue(TEXT("Normals match"), SerialMesh->GetVertexInstanceNormals() == ParallelMesh->GetVertexInstanceNormals());
+	TestTrue(TEXT("U tangents match"), SerialMesh->GetVertexInstanceUTangents() == ParallelMesh->GetVertexInstanceUTangents());
+	TestTrue(TEXT("V tangents match"), SerialMesh->GetVertexInstanceVTangents() == ParallelMesh->GetVertexInstanceVTangents());
+	TestTrue(TEXT("Colors match"), SerialMesh->GetVertexInstanceColors() == ParallelMesh->GetVertexInstanceColors());
+	TestTrue(TEXT("UVs match"), SerialMesh->GetVertexInstanceUVs() == ParallelMesh->GetVertexInstanceUVs());
+	TestTrue(TEXT("Mesh is valid"), ParallelMesh->IsValid());
+
+	return true;
+}
+
 
 #endif
 
@@ -0,0 +1,123 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniEditorTestCookCache.h"
+
+#include "HoudiniAssetComponent.h"
+#include "HoudiniCookCache.h"
+#include "HoudiniParameterToggle.h"
+#include "HoudiniRuntimeSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+
+#include "Misc/AutomationTest.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestCookCacheKey, "Houdini.UnitTests.CookCache.CookKey", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestCookCacheKey::RunTest(const FString & Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// This test checks that the cook key of an HDA matches its last cook (a cook cache hit) until one of its parameters,
+	/// its mesh generation settings or the project settings affecting its outputs change (a miss), and matches again once
+	/// they are restored.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/Game/TestHDAs/Outputs/Test_Outputs"), FTransform::Identity, false));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Firstly: Cook the HDA with a single static mesh output.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		SET_HDA_PARAMETER(Context->HAC, UHoudiniParameterToggle, "cube", true, 0);
+		SET_HDA_PARAMETER(Context->HAC, UHoudiniParameterToggle, "heightfield", false, 0);
+		SET_HDA_PARAMETER(Context->HAC, UHoudiniParameterToggle, "instances", false, 0);
+		Context->StartCookingHDA();
+		return true;
+	}));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Next: Compare the cook keys of the cooked state and of the modified states.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		UHoudiniAssetComponent* HAC = Context->HAC;
+
+		FString CookedKey;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniCookCache::ComputeCookKey(HAC, CookedKey), true, return true);
+		HOUDINI_TEST_EQUAL(CookedKey.IsEmpty(), false);
+
+		// The unchanged state hits
+		FString Key;
+		FHoudiniCookCache::ComputeCookKey(HAC, Key);
+		HOUDINI_TEST_EQUAL(Key, CookedKey);
+
+		// A parameter change misses, reverting it hits again
+		SET_HDA_PARAMETER(HAC, UHoudiniParameterToggle, "cube", false, 0);
+		FHoudiniCookCache::ComputeCookKey(HAC, Key);
+		HOUDINI_TEST_NOT_EQUAL(Key, CookedKey);
+
+		SET_HDA_PARAMETER(HAC, UHoudiniParameterToggle, "cube", true, 0);
+		FHoudiniCookCache::ComputeCookKey(HAC, Key);
+		HOUDINI_TEST_EQUAL(Key, CookedKey);
+
+		// A change of the HAC's mesh build settings misses
+		HAC->StaticMeshBuildSettings.bRemoveDegenerates = !HAC->StaticMeshBuildSettings.bRemoveDegenerates;
+		FHoudiniCookCache::ComputeCookKey(HAC, Key);
+		HOUDINI_TEST_NOT_EQUAL(Key, CookedKey);
+
+		HAC->StaticMeshBuildSettings.bRemoveDegenerates = !HAC->StaticMeshBuildSettings.bRemoveDegenerates;
+		FHoudiniCookCache::ComputeCookKey(HAC, Key);
+		HOUDINI_TEST_EQUAL(Key, CookedKey);
+
+		// A change of the project settings affecting the outputs misses
+		UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetMutableDefault<UHoudiniRuntimeSettings>();
+		const float PreviousSplineResolution = HoudiniRuntimeSettings->MarshallingSplineResolution;
+		HoudiniRuntimeSettings->MarshallingSplineResolution = PreviousSplineResolution + 1.0f;
+		FHoudiniCookCache::ComputeCookKey(HAC, Key);
+		HoudiniRuntimeSettings->MarshallingSplineResolution = PreviousSplineResolution;
+		HOUDINI_TEST_NOT_EQUAL(Key, CookedKey);
+
+		FHoudiniCookCache::ComputeCookKey(HAC, Key);
+		HOUDINI_TEST_EQUAL(Key, CookedKey);
+
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
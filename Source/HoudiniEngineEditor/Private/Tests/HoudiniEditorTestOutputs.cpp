@@ -47,6 +47,11 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "HoudiniEditorUnitTestUtils.h"
 #include "FoliageType_InstancedStaticMesh.h"
+#include "HoudiniApiTrace.h"
+#include "HoudiniOutputTranslator.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestOutput, "Houdini.UnitTests.OutputTests", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 
@@ -295,5 +300,87 @@ bool FHoudiniEditorTestOutput::RunTest(const FString & Parameters)
 }
 
 
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestOutputApiTraceReplay, "Houdini.UnitTests.OutputTests.ApiTraceReplay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestOutputApiTraceReplay::RunTest(const FString & Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// This test records the HAPI calls of a cook, then translates the outputs again from the trace only, and checks that
+	/// the replay served every call and produced the same outputs.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/Game/TestHDAs/Outputs/Test_Outputs"), FTransform::Identity, false));
+	Context->HAC->bOverrideGlobalProxyStaticMeshSettings = true;
+	Context->HAC->bEnableProxyStaticMeshOverride = false;
+
+	const FString TracePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("HoudiniApiTraceReplay.hapitrace"));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Firstly: Record a cook producing a single static mesh.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, TracePath]()
+	{
+		SET_HDA_PARAMETER(Context->HAC, UHoudiniParameterToggle, "cube", true, 0);
+		SET_HDA_PARAMETER(Context->HAC, UHoudiniParameterToggle, "heightfield", false, 0);
+		SET_HDA_PARAMETER(Context->HAC, UHoudiniParameterToggle, "instances", false, 0);
+		HOUDINI_TEST_EQUAL(FHoudiniApiTrace::StartRecording(TracePath), true);
+		Context->StartCookingHDA();
+		return true;
+	}));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Next: Translate the outputs again from the trace, and compare them with the recorded cook's.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, TracePath]()
+	{
+		FHoudiniApiTrace::Stop();
+
+		TArray<UHoudiniOutput*> Outputs;
+		Context->HAC->GetOutputs(Outputs);
+		HOUDINI_TEST_EQUAL_ON_FAIL(Outputs.Num(), 1, return true);
+
+		TArray<UStaticMeshComponent*> StaticMeshOutputs = FHoudiniEditorUnitTestUtils::GetOutputsWithComponent<UStaticMeshComponent>(Outputs);
+		HOUDINI_TEST_EQUAL_ON_FAIL(StaticMeshOutputs.Num(), 1, return true);
+		HOUDINI_TEST_NOT_NULL(StaticMeshOutputs[0]->GetStaticMesh());
+		const int32 RecordedNumVertices = StaticMeshOutputs[0]->GetStaticMesh() ? StaticMeshOutputs[0]->GetStaticMesh()->GetNumVertices(0) : 0;
+
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiTrace::StartReplay(TracePath), true, return true);
+
+		bool bHasHoudiniStaticMeshOutput = false;
+		const bool bSuccess = FHoudiniOutputTranslator::UpdateOutputs(Context->HAC, true, bHasHoudiniStaticMeshOutput);
+
+		int32 NumMisses = 0;
+		for (const FHoudiniApiTraceTiming& Timing : FHoudiniApiTrace::GetTimings())
+			NumMisses += Timing.MissCount;
+
+		FHoudiniApiTrace::Stop();
+		IFileManager::Get().Delete(*TracePath);
+
+		HOUDINI_TEST_EQUAL(bSuccess, true);
+		HOUDINI_TEST_EQUAL(NumMisses, 0);
+
+		Outputs.Empty();
+		Context->HAC->GetOutputs(Outputs);
+		HOUDINI_TEST_EQUAL_ON_FAIL(Outputs.Num(), 1, return true);
+
+		StaticMeshOutputs = FHoudiniEditorUnitTestUtils::GetOutputsWithComponent<UStaticMeshComponent>(Outputs);
+		HOUDINI_TEST_EQUAL_ON_FAIL(StaticMeshOutputs.Num(), 1, return true);
+		HOUDINI_TEST_NOT_NULL(StaticMeshOutputs[0]->GetStaticMesh());
+		if (StaticMeshOutputs[0]->GetStaticMesh())
+			HOUDINI_TEST_EQUAL(StaticMeshOutputs[0]->GetStaticMesh()->GetNumVertices(0), RecordedNumVertices);
+
+		return true;
+	}));
+
+	return true;
+}
+
 #endif
 
@@ -924,6 +924,17 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
 	bool SetParameterTuples(const TMap<FName, FHoudiniParameterTuple>& InParameterTuples);
 
+	/**
+	 * Applies a whole set of parameter tuple values (matched by name and compatible type) on this instantiated
+	 * asset. All the values are set before the asset component is next ticked, so the changed parameters are
+	 * uploaded to Houdini and cooked together.
+	 * @param InParameterTuples The parameter tuples to set.
+	 * @param bInForceCook If true, the asset is also marked as needing a cook.
+	 * @return false if any entry in InParameterTuples could not be found on the asset or had an incompatible type/size.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	bool ApplyParameterTuples(const TMap<FName, FHoudiniParameterTuple>& InParameterTuples, bool bInForceCook=false);
+
 	// Inputs
 
 	/**
@@ -0,0 +1,467 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/SoftObjectPtr.h"
+
+#include "HoudiniPublicAPIObjectBase.h"
+#include "HoudiniPublicAPIAssetWrapper.h"
+
+#include "HoudiniPublicAPIBatchProcessor.generated.h"
+
+
+class UHoudiniAsset;
+class UHoudiniPublicAPIBatchProcessor;
+class UHoudiniPublicAPIInput;
+class ULevel;
+
+/** Objects to set on a geometry input of a batch job, used by jobs loaded from a job file. */
+USTRUCT(BlueprintType, Category="Houdini Engine | Public API")
+struct HOUDINIENGINEEDITOR_API FHoudiniPublicAPIBatchInputObjects
+{
+	GENERATED_BODY();
+
+public:
+	/** The assets (static meshes, skeletal meshes, ...) to set as the input objects. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TArray<FSoftObjectPath> Objects;
+};
+
+/** A batch job: an HDA variant to cook, and optionally bake, with the given parameters and inputs. */
+USTRUCT(BlueprintType, Category="Houdini Engine | Public API")
+struct HOUDINIENGINEEDITOR_API FHoudiniPublicAPIBatchJob
+{
+	GENERATED_BODY();
+
+public:
+	FHoudiniPublicAPIBatchJob();
+
+	/** The name of the job in the report. Defaults to the HDA name followed by the job index. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	FString JobName;
+
+	/** The HDA to cook. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TSoftObjectPtr<UHoudiniAsset> HoudiniAsset;
+
+	/** The transform to instantiate the HDA with. Not applied when an instance is reused. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	FTransform InstantiateAt;
+
+	/** The parameter values to set before cooking. Parameters set by a previous job are reverted to their defaults. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<FName, FHoudiniParameterTuple> Parameters;
+
+	/** The node inputs to set before cooking. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<int32, UHoudiniPublicAPIInput*> NodeInputs;
+
+	/** The parameter-based inputs to set before cooking. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<FName, UHoudiniPublicAPIInput*> ParameterInputs;
+
+	/** Objects to set as geometry node inputs. Ignored for indices that are also in #NodeInputs. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<int32, FHoudiniPublicAPIBatchInputObjects> NodeInputObjects;
+
+	/** Objects to set as geometry parameter inputs. Ignored for names that are also in #ParameterInputs. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<FName, FHoudiniPublicAPIBatchInputObjects> ParameterInputObjects;
+
+	/** If true, the outputs are baked after the cook. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	bool bBake;
+
+	/** The directory to bake to if the bake path is not set via attributes on the HDA output. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	FString BakeDirectoryPath;
+
+	/** The bake target (to actor vs blueprint). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	EHoudiniEngineBakeOption BakeMethod;
+
+	/** If true, the temporary outputs are removed after the bake. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	bool bRemoveOutputAfterBake;
+
+	/** Recenter the baked actors to their bounding box center. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	bool bRecenterBakedActors;
+
+	/** If true, the bake replaces the output of previous bakes of this job (never the output of other jobs). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	bool bReplacePreviousBake;
+};
+
+/** The outcome and timings of a batch job. */
+USTRUCT(BlueprintType, Category="Houdini Engine | Public API")
+struct HOUDINIENGINEEDITOR_API FHoudiniPublicAPIBatchJobResult
+{
+	GENERATED_BODY();
+
+public:
+	FHoudiniPublicAPIBatchJobResult();
+
+	/** The index of the job in the batch. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	int32 JobIndex;
+
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	FString JobName;
+
+	/** The object path of the job's HDA. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	FString HoudiniAssetPath;
+
+	/** True if the job cooked, and baked if requested, successfully. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	bool bSuccess;
+
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	bool bCookSuccess;
+
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	bool bBakeSuccess;
+
+	/** True if the job was cooked on an instance left by a previous job with the same HDA. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	bool bReusedInstance;
+
+	/** The reason the job failed, empty on success. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	FString ErrorMessage;
+
+	/** Time spent in the queue, from the start of the batch to the start of the job. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	float QueuedSeconds;
+
+	/** Time spent instantiating the HDA, 0 when an instance was reused. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	float InstantiateSeconds;
+
+	/** Time spent cooking the HDA and creating its outputs. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	float CookSeconds;
+
+	/** Time spent baking the outputs. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	float BakeSeconds;
+
+	/** Time from the start of the job to its completion. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	float TotalSeconds;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHoudiniBatchJobCompleted, UHoudiniPublicAPIBatchProcessor*, InProcessor, const FHoudiniPublicAPIBatchJobResult&, InResult);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHoudiniBatchCompleted, UHoudiniPublicAPIBatchProcessor*, InProcessor);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHoudiniBatchCompletedNative, UHoudiniPublicAPIBatchProcessor*);
+
+/**
+ * Runs a list of HDA jobs (HDA, parameters, inputs and bake settings) with bounded concurrency.
+ *
+ * Jobs are queued and started as instances become available, at most #GetMaxConcurrentJobs() at a time. Each
+ * concurrent slot keeps its instantiated HDA once its job completes: the next job for the same HDA (with the same
+ * set of inputs) reuses it by reverting the previous job's parameters, applying its own and recooking, instead of
+ * instantiating the HDA again. The result and timings of each job are appended to the report file as a JSON line
+ * as soon as the job completes, followed by a summary line when the batch completes.
+ *
+ * The asset components are cooked by the FHoudiniEngineManager tick. Only the instances without inputs are spread over
+ * the session pool: instances with inputs (and PDG or session sync instances) are pinned to the main session, where
+ * their cooks are serialized. The default concurrency is therefore the number of jobs that can cook on different
+ * sessions, see #Start().
+ *
+ * Can be run from the HoudiniEngine commandlet, see UHoudiniEngineCommandlet.
+ */
+UCLASS(BlueprintType, Category="Houdini Engine|Public API")
+class HOUDINIENGINEEDITOR_API UHoudiniPublicAPIBatchProcessor : public UHoudiniPublicAPIObjectBase
+{
+	GENERATED_BODY()
+
+public:
+	UHoudiniPublicAPIBatchProcessor();
+
+	/** Creates a new batch processor, with InOuter as outer (the transient package if null). */
+	UFUNCTION(BlueprintCallable, Category="Houdini|Public API")
+	static UHoudiniPublicAPIBatchProcessor* CreateBatchProcessor(UObject* InOuter=nullptr);
+
+	/**
+	 * Loads the jobs of a job file, runs the batch and returns immediately. Used by the HoudiniEngine commandlet.
+	 * @param InJobFilePath The JSON job file, see LoadJobsFromFile().
+	 * @param InReportFilePath The report file, see Start().
+	 * @param InMaxConcurrentJobs The maximum number of jobs running at the same time, see Start() if <= 0.
+	 * @param InJobTimeoutSeconds Fails jobs that have not completed after this many seconds, disabled if <= 0.
+	 * @param InOnCompleted Called with the processor when the batch completes.
+	 * @return The running processor, null if the jobs could not be loaded or the batch could not be started.
+	 */
+	static UHoudiniPublicAPIBatchProcessor* RunBatchFromFile(
+		const FString& InJobFilePath,
+		const FString& InReportFilePath,
+		const int32 InMaxConcurrentJobs,
+		const float InJobTimeoutSeconds,
+		const FOnHoudiniBatchCompletedNative::FDelegate& InOnCompleted);
+
+	/**
+	 * Queues a job. Jobs cannot be added while the batch is running.
+	 * @return The index of the job in the batch, INDEX_NONE if it could not be added.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	int32 AddJob(const FHoudiniPublicAPIBatchJob& InJob);
+
+	/** Queues jobs. Returns false if the jobs could not be added (the batch is running). */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	bool AddJobs(const TArray<FHoudiniPublicAPIBatchJob>& InJobs);
+
+	/**
+	 * Queues the jobs of a JSON job file. The file contains a "jobs" array, each job an object with:
+	 *	- "name": the job name (optional)
+	 *	- "hda": the object path of the HDA
+	 *	- "location", "rotation", "scale": arrays of 3 numbers (optional)
+	 *	- "parameters": an object mapping parameter names to typed values, for example
+	 *	  { "seed": { "int": [3] }, "size": { "float": [1, 2, 1] }, "label": { "string": ["a"] }, "flip": { "bool": [true] } }
+	 *	- "node_inputs": an object mapping node input indices to arrays of object paths
+	 *	- "parameter_inputs": an object mapping parameter names to arrays of object paths
+	 *	- "bake", "bake_directory", "bake_method" ("ToActor", "ToBlueprint", ...), "remove_output_after_bake",
+	 *	  "recenter_baked_actors", "replace_previous_bake"
+	 * Top-level "defaults" apply to every job that does not set the entry.
+	 * @param InJobFilePath The JSON file to load.
+	 * @param OutNumJobs The number of jobs that were queued.
+	 * @return false if the file could not be read or parsed.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	bool LoadJobsFromFile(const FString& InJobFilePath, int32& OutNumJobs);
+
+	/**
+	 * Starts the batch and returns immediately, #OnJobCompleted and #OnBatchCompleted are broadcast as the jobs
+	 * complete.
+	 * @param InReportFilePath The file to stream the per-job results and timings to (JSON lines). No report if empty.
+	 * @param InMaxConcurrentJobs The maximum number of jobs running at the same time. If <= 0: the number of jobs
+	 * without inputs, plus one for all the jobs with inputs (which all cook on the main session), capped to the
+	 * session pool size. 1 without a session pool.
+	 * @param InJobTimeoutSeconds Fails jobs that have not completed after this many seconds, disabled if <= 0.
+	 * @param InWorldContextObject A world context object for identifying the world to spawn in, if
+	 * InSpawnInLevelOverride is null.
+	 * @param InSpawnInLevelOverride If not nullptr, then the instances are spawned in that level. If both
+	 * InSpawnInLevelOverride and InWorldContextObject are null, the instances are spawned in the current editor
+	 * context world's current level.
+	 * @param bInDeleteInstancesOnCompletion If true (the default), deletes the instantiated HDAs when the batch completes.
+	 * @return false if the batch is already running, or there are no jobs to run.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	bool Start(
+		const FString& InReportFilePath,
+		const int32 InMaxConcurrentJobs=0,
+		const float InJobTimeoutSeconds=0.0f,
+		UObject* InWorldContextObject=nullptr,
+		ULevel* InSpawnInLevelOverride=nullptr,
+		const bool bInDeleteInstancesOnCompletion=true);
+
+	/** Fails the running and queued jobs, and completes the batch. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	void Cancel();
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	bool IsRunning() const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	int32 GetNumJobs() const;
+
+	/** Returns the number of jobs that have completed, successfully or not. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	int32 GetNumCompletedJobs() const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	int32 GetNumFailedJobs() const;
+
+	/** Returns the maximum number of jobs running at the same time in the current / last run. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	int32 GetMaxConcurrentJobs() const;
+
+	/** Gets the results of the completed jobs, in completion order. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	void GetResults(TArray<FHoudiniPublicAPIBatchJobResult>& OutResults) const;
+
+	/** Delegate that is broadcast when a job completes, successfully or not. */
+	UPROPERTY(BlueprintAssignable, Category="Houdini|Public API")
+	FOnHoudiniBatchJobCompleted OnJobCompleted;
+
+	/** Delegate that is broadcast when all the jobs have completed. */
+	UPROPERTY(BlueprintAssignable, Category="Houdini|Public API")
+	FOnHoudiniBatchCompleted OnBatchCompleted;
+
+	/** Native version of #OnBatchCompleted. */
+	FOnHoudiniBatchCompletedNative& GetOnBatchCompletedNativeDelegate() { return OnBatchCompletedNative; }
+
+	virtual void BeginDestroy() override;
+
+protected:
+
+	// The phase of the job running on a slot
+	enum class EHoudiniBatchSlotPhase : uint8
+	{
+		Idle,
+		Instantiating,
+		Cooking,
+		Baking
+	};
+
+	// A concurrent slot: the instance it keeps (in #SlotWrappers) and the job it is running
+	struct FHoudiniBatchSlot
+	{
+		EHoudiniBatchSlotPhase Phase = EHoudiniBatchSlotPhase::Idle;
+
+		// Index of the running job in #Jobs, INDEX_NONE when idle
+		int32 JobIndex = INDEX_NONE;
+
+		// The HDA of the instance kept by the slot
+		FSoftObjectPath HoudiniAssetPath;
+
+		// Parameters and input keys set by the last job, to revert / check them before reusing the instance
+		TSet<FName> SetParameterNames;
+		TSet<int32> SetNodeInputIndices;
+		TSet<FName> SetParameterInputNames;
+
+		// The instance cannot be reused (failed or timed out job)
+		bool bRetireInstance = false;
+
+		double JobStartTime = 0.0;
+		double PhaseStartTime = 0.0;
+	};
+
+	// The queued jobs of an HDA, in queue order
+	struct FHoudiniBatchAssetQueue
+	{
+		TArray<int32> JobIndices;
+		int32 NextIndex = 0;
+	};
+
+	bool Tick(float InDeltaTime);
+
+	// Returns the number of jobs that can cook on different sessions of the pool
+	int32 GetDefaultMaxConcurrentJobs() const;
+
+	// Starts queued jobs on the idle slots
+	void DispatchJobs();
+
+	// Pops the next queued job, preferring jobs for InPreferredAsset. Returns INDEX_NONE if the queue is empty.
+	int32 PopNextJob(const FSoftObjectPath& InPreferredAsset);
+
+	// Starts the job on the slot, reusing the slot's instance if possible
+	void StartJob(const int32 InSlotIndex, const int32 InJobIndex);
+
+	// Applies the job's inputs on the slot's instance
+	bool SetJobInputs(const int32 InSlotIndex, const FHoudiniPublicAPIBatchJob& InJob, FString& OutErrorMessage);
+
+	// Records the result of the slot's job and marks the slot idle
+	void CompleteJob(const int32 InSlotIndex, const bool bInSuccess, const FString& InErrorMessage=FString());
+
+	// Records the result of a job that never started
+	void FailQueuedJob(const int32 InJobIndex, const FString& InErrorMessage);
+
+	void AddResult(const FHoudiniPublicAPIBatchJobResult& InResult);
+
+	void CompleteBatch();
+
+	void WriteReportLine(const FString& InLine);
+
+	// Deletes the slot's instance and its wrapper
+	void RetireInstance(const int32 InSlotIndex);
+
+	// Returns the index of the slot using InAssetWrapper, INDEX_NONE if none
+	int32 FindSlotIndex(const UHoudiniPublicAPIAssetWrapper* InAssetWrapper) const;
+
+	void BindWrapperDelegates(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+	void UnbindWrapperDelegates(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+
+	UFUNCTION()
+	void HandlePreInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+
+	UFUNCTION()
+	void HandlePostInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+
+	UFUNCTION()
+	void HandlePostCook(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const bool bInCookSuccess);
+
+	UFUNCTION()
+	void HandlePostProcessing(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+
+	UFUNCTION()
+	void HandlePostBake(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const bool bInBakeSuccess);
+
+	/** The jobs of the batch. */
+	UPROPERTY()
+	TArray<FHoudiniPublicAPIBatchJob> Jobs;
+
+	/** The results of the completed jobs, in completion order. */
+	UPROPERTY()
+	TArray<FHoudiniPublicAPIBatchJobResult> Results;
+
+	/** The wrapper of the instance kept by each slot, null when the slot has no instance. */
+	UPROPERTY()
+	TArray<UHoudiniPublicAPIAssetWrapper*> SlotWrappers;
+
+	/** The world context object: spawn in this world if #SpawnInLevelOverride is not set. */
+	UPROPERTY()
+	UObject* WorldContextObject;
+
+	/** The level to spawn in. If both this and #WorldContextObject is not set, spawn in the editor context's level. */
+	UPROPERTY()
+	ULevel* SpawnInLevelOverride;
+
+	// Slot states, parallel to SlotWrappers
+	TArray<FHoudiniBatchSlot> Slots;
+
+	// The queued jobs per HDA
+	TMap<FSoftObjectPath, FHoudiniBatchAssetQueue> QueuedJobsByAsset;
+
+	// The queued jobs in queue order. Jobs already popped via QueuedJobsByAsset are skipped.
+	TArray<int32> QueuedJobs;
+	int32 NextQueuedJob;
+	int32 NumQueuedJobs;
+	TBitArray<> JobStarted;
+
+	// Result in progress for each running job, indexed by job index
+	TMap<int32, FHoudiniPublicAPIBatchJobResult> RunningResults;
+
+	int32 NumFailedJobs;
+	int32 NumReusedInstances;
+
+	int32 MaxConcurrentJobs;
+	float JobTimeoutSeconds;
+	bool bDeleteInstancesOnCompletion;
+	bool bIsRunning;
+	double BatchStartTime;
+
+	// The report file the results are streamed to
+	TUniquePtr<FArchive> ReportFile;
+	FString ReportFilePath;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	FOnHoudiniBatchCompletedNative OnBatchCompletedNative;
+};
@@ -772,6 +772,9 @@ UHoudiniAssetBlueprintComponent::CopyDetailsFromComponent(
 		
 			StaleInput->ConditionalBeginDestroy();
 		}
+
+		// Inputs have been replaced in place, the lookup indices are out of date
+		InvalidateInputIndices();
 	}
 
 
@@ -832,6 +835,9 @@ UHoudiniAssetBlueprintComponent::CopyDetailsFromComponent(
 		}
 	}
 
+	// Parameters have been replaced in place, the lookup indices are out of date
+	InvalidateParameterIndices();
+
 	// Apply remappings on the new parameters
 	for (UHoudiniParameter* ToParameter : Parameters)
 	{
@@ -1600,6 +1606,7 @@ UHoudiniAssetBlueprintComponent::ApplyComponentInstanceData(FHoudiniAssetBluepri
 
 			Inputs[i] = ToInput;
 		}
+		InvalidateInputIndices();
 
 		// We need to update FHoudiniOutputObject SceneComponent references to
 		// the newly created components. Since we cached a map of Output Object IDs to
@@ -2046,7 +2053,7 @@ UHoudiniAssetBlueprintComponent::InvalidateData()
 			Input->InvalidateData();
 		}
 
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true, FMath::Max(SessionIndex, 0));
 		AssetId = -1;
 	}
 }
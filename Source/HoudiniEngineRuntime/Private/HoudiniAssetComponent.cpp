@@ -158,6 +158,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 	bCookOnAssetInputCook = true;
 
 	AssetId = -1;
+	SessionIndex = -1;
 	AssetState = EHoudiniAssetState::NewHDA;
 	AssetStateResult = EHoudiniAssetStateResult::None;
 	AssetCookCount = 0;
@@ -186,6 +187,11 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 	bBlueprintStructureModified = false;
 	bBlueprintModified = false;
 
+	NumIndexedParameters = 0;
+	NumIndexedInputs = 0;
+	bParameterIndicesDirty = true;
+	bInputIndicesDirty = true;
+
 	//bEditorPropertiesNeedFullUpdate = true;
 
 	// Folder used for cooking, the value is initialized by Output Translator
@@ -1117,6 +1123,9 @@ UHoudiniAssetComponent::PostLoad()
 	// Mark as need instantiation
 	MarkAsNeedInstantiation();
 
+	InvalidateParameterIndices();
+	InvalidateInputIndices();
+
 	// Component has been loaded, not duplicated
 	bHasBeenDuplicated = false;
 
@@ -1185,6 +1194,9 @@ UHoudiniAssetComponent::PostEditImport()
 
 	MarkAsNeedInstantiation();
 
+	InvalidateParameterIndices();
+	InvalidateInputIndices();
+
 	// Component has been duplicated, not loaded
 	// We do need the loaded flag to reapply parameters, inputs
 	// and properly update some of the output objects
@@ -1571,16 +1583,143 @@ UHoudiniAssetComponent::FindMatchingHandle(UHoudiniHandleComponent* InOtherHandl
 	return nullptr;
 }
 
+void
+UHoudiniAssetComponent::RebuildParameterIndices()
+{
+	ParameterIndicesByName.Empty(Parameters.Num());
+	ParameterIndicesByParmId.Empty(Parameters.Num());
+	for (int32 ParamIdx = 0; ParamIdx < Parameters.Num(); ++ParamIdx)
+	{
+		const UHoudiniParameter* CurrentParam = Parameters[ParamIdx];
+		if (!IsValid(CurrentParam))
+			continue;
+
+		// Keep the first parameter found for a name / parm id, like a linear search would
+		const FName ParamName(*CurrentParam->GetParameterName());
+		if (!ParameterIndicesByName.Contains(ParamName))
+			ParameterIndicesByName.Add(ParamName, ParamIdx);
+
+		if (!ParameterIndicesByParmId.Contains(CurrentParam->GetParmId()))
+			ParameterIndicesByParmId.Add(CurrentParam->GetParmId(), ParamIdx);
+	}
+
+	NumIndexedParameters = Parameters.Num();
+	bParameterIndicesDirty = false;
+}
+
+void
+UHoudiniAssetComponent::RebuildInputIndices()
+{
+	InputParameterIndicesByName.Empty(Inputs.Num());
+	for (int32 InputIdx = 0; InputIdx < Inputs.Num(); ++InputIdx)
+	{
+		const UHoudiniInput* CurrentInput = Inputs[InputIdx];
+		if (!IsValid(CurrentInput) || !CurrentInput->IsObjectPathParameter())
+			continue;
+
+		const FName InputName(*CurrentInput->GetInputName());
+		if (!InputParameterIndicesByName.Contains(InputName))
+			InputParameterIndicesByName.Add(InputName, InputIdx);
+	}
+
+	NumIndexedInputs = Inputs.Num();
+	bInputIndicesDirty = false;
+}
+
 UHoudiniParameter*
 UHoudiniAssetComponent::FindParameterByName(const FString& InParamName)
 {
+	if (bParameterIndicesDirty || NumIndexedParameters != Parameters.Num())
+		RebuildParameterIndices();
+
+	// Entries of the arrays can be replaced in place without the indices being invalidated,
+	// so a miss or a mismatch in the index isn't trusted: we then fall back to a linear search.
+	bool bIndexIsStale = true;
+	const FName ParamName(*InParamName, FNAME_Find);
+	const int32* FoundIdx = ParamName.IsNone() ? nullptr : ParameterIndicesByName.Find(ParamName);
+	if (FoundIdx && Parameters.IsValidIndex(*FoundIdx) && IsValid(Parameters[*FoundIdx]))
+	{
+		UHoudiniParameter* FoundParam = Parameters[*FoundIdx];
+		if (FoundParam->GetParameterName().Equals(InParamName))
+			return FoundParam;
+
+		// Parameter names are case sensitive but FNames aren't, another parameter might only differ by case
+		bIndexIsStale = !FoundParam->GetParameterName().Equals(InParamName, ESearchCase::IgnoreCase);
+	}
+
 	for (auto CurrentParam : Parameters)
 	{
 		if (!IsValid(CurrentParam))
 			continue;
 
-		if (CurrentParam->GetParameterName().Equals(InParamName))
-			return CurrentParam;
+		if (!CurrentParam->GetParameterName().Equals(InParamName))
+			continue;
+
+		if (bIndexIsStale)
+			RebuildParameterIndices();
+
+		return CurrentParam;
+	}
+
+	return nullptr;
+}
+
+UHoudiniParameter*
+UHoudiniAssetComponent::FindParameterByParmId(const int32& InParmId)
+{
+	if (bParameterIndicesDirty || NumIndexedParameters != Parameters.Num())
+		RebuildParameterIndices();
+
+	const int32* FoundIdx = ParameterIndicesByParmId.Find(InParmId);
+	if (FoundIdx && Parameters.IsValidIndex(*FoundIdx))
+	{
+		UHoudiniParameter* FoundParam = Parameters[*FoundIdx];
+		if (IsValid(FoundParam) && FoundParam->GetParmId() == InParmId)
+			return FoundParam;
+	}
+
+	// The index missed or is out of date, fall back to a linear search
+	for (auto CurrentParam : Parameters)
+	{
+		if (!IsValid(CurrentParam))
+			continue;
+
+		if (CurrentParam->GetParmId() != InParmId)
+			continue;
+
+		RebuildParameterIndices();
+		return CurrentParam;
+	}
+
+	return nullptr;
+}
+
+UHoudiniInput*
+UHoudiniAssetComponent::FindInputParameterByName(const FString& InInputName)
+{
+	if (bInputIndicesDirty || NumIndexedInputs != Inputs.Num())
+		RebuildInputIndices();
+
+	const FName InputName(*InInputName, FNAME_Find);
+	const int32* FoundIdx = InputName.IsNone() ? nullptr : InputParameterIndicesByName.Find(InputName);
+	if (FoundIdx && Inputs.IsValidIndex(*FoundIdx))
+	{
+		UHoudiniInput* FoundInput = Inputs[*FoundIdx];
+		if (IsValid(FoundInput) && FoundInput->IsObjectPathParameter() && FoundInput->GetInputName() == InInputName)
+			return FoundInput;
+	}
+
+	// The index missed or is out of date, fall back to a linear search
+	for (auto CurrentInput : Inputs)
+	{
+		if (!IsValid(CurrentInput))
+			continue;
+
+		if (!CurrentInput->IsObjectPathParameter() || CurrentInput->GetInputName() != InInputName)
+			continue;
+
+		RebuildInputIndices();
+		return CurrentInput;
 	}
 
 	return nullptr;
@@ -1955,6 +2094,10 @@ UHoudiniAssetComponent::PostEditUndo()
 {
 	Super::PostEditUndo();
 
+	// The transaction may have restored other parameters / inputs
+	InvalidateParameterIndices();
+	InvalidateInputIndices();
+
 	if (IsValid(this))
 	{
 		// Make sure we are registered with the HER singleton
@@ -92,6 +92,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetComponent : public UPrimitiveCompone
 	friend struct FHoudiniParameterTranslator;
 	friend struct FHoudiniPDGManager;
 	friend struct FHoudiniHandleTranslator;
+	friend struct FHoudiniCookCache;
 
 #if WITH_EDITORONLY_DATA
 	friend class FHoudiniAssetComponentDetails;
@@ -148,6 +149,17 @@ public:
 	// Finds a parameter by name
 	UHoudiniParameter* FindParameterByName(const FString& InParamName);
 
+	// Finds a parameter by its HAPI parm id
+	UHoudiniParameter* FindParameterByParmId(const int32& InParmId);
+
+	// Finds an object path parameter input by name
+	UHoudiniInput* FindInputParameterByName(const FString& InInputName);
+
+	// Marks the parameter / input lookup indices for rebuild.
+	// Should be called when the Parameters or Inputs arrays are replaced.
+	void InvalidateParameterIndices() { bParameterIndicesDirty = true; };
+	void InvalidateInputIndices() { bInputIndicesDirty = true; };
+
 	// Returns True if the component has at least one mesh output of class U
 	template <class U>
 	bool HasMeshOutputObjectOfClass() const;
@@ -172,6 +184,9 @@ public:
 	//------------------------------------------------------------------------------------------------
 	UHoudiniAsset * GetHoudiniAsset() const;
 	int32 GetAssetId() const { return AssetId; };
+	// Index of the Houdini Engine session the asset's nodes live in (0 is the main session)
+	// -1 indicates that no session has been assigned yet.
+	int32 GetSessionIndex() const { return SessionIndex; };
 	EHoudiniAssetState GetAssetState() const { return AssetState; };
 //	FString GetAssetStateAsString() const { return FHoudiniEngineRuntimeUtils::EnumToString(TEXT("EHoudiniAssetState"), GetAssetState()); };
 
@@ -257,6 +272,9 @@ public:
 	// Returns true if the last cook of the HDA was successful
 	bool WasLastCookSuccessful() const { return bLastCookSuccess; }
 
+	// Returns the key of the HDA, parameters and inputs that produced the current outputs, empty if unknown.
+	const FString& GetCookCacheKey() const { return CookCacheKey; }
+
 	// Returns true if a parameter definition update (excluding values) is needed.
 	bool IsParameterDefinitionUpdateNeeded() const { return bParameterDefinitionUpdateNeeded; }
 
@@ -346,6 +364,12 @@ public:
 	bool NotifyCookedToDownstreamAssets();
 	//
 	bool NeedsToWaitForInputHoudiniAssets();
+	//
+	bool HasDownstreamHoudiniAssets() const { return DownstreamHoudiniAssets.Num() > 0; };
+
+	// Assigns the Houdini Engine session used by this component's nodes.
+	// Only valid while the component has no instantiated node.
+	void SetSessionIndex(const int32 InSessionIndex) { SessionIndex = InSessionIndex; };
 
 	// Clear/disable the RefineMeshesTimer.
 	void ClearRefineMeshesTimer();
@@ -642,6 +666,10 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	int32 AssetId;
 
+	// Index of the Houdini Engine session (in the session pool) that AssetId belongs to.
+	UPROPERTY(Transient, DuplicateTransient)
+	int32 SessionIndex;
+
 	// Ids of the nodes that should be cook for this HAC
 	// This is for additional output and templated nodes if they are used.
 	UPROPERTY(Transient, DuplicateTransient)
@@ -722,6 +750,15 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	bool bLastCookSuccess;
 
+	// Key of the HDA, parameters and inputs of the last successful cook (see FHoudiniCookCache).
+	// Saved with the outputs it produced so that an identical cook can be skipped after loading.
+	UPROPERTY(DuplicateTransient)
+	FString CookCacheKey;
+
+	// Key of the cook in progress, stored in CookCacheKey once its outputs have been processed.
+	UPROPERTY(Transient, DuplicateTransient)
+	FString PendingCookCacheKey;
+
 	// Indicates that the parameter state (excluding values) on the HAC and the instantiated node needs to be synced.
 	// The most common use for this would be a newly instantiated HDA that has only a default parameter interface
 	// from its asset definition, and needs to sync pre-cook.
@@ -746,6 +783,19 @@ protected:
 	UPROPERTY(Instanced)
 	TArray<UHoudiniOutput*> Outputs;
 
+	// Lookup indices of the parameters (by name and parm id) and of the object path parameter inputs (by name).
+	// They aren't serialized, and are rebuilt on the next lookup after the arrays have changed.
+	TMap<FName, int32> ParameterIndicesByName;
+	TMap<int32, int32> ParameterIndicesByParmId;
+	TMap<FName, int32> InputParameterIndicesByName;
+	int32 NumIndexedParameters;
+	int32 NumIndexedInputs;
+	bool bParameterIndicesDirty;
+	bool bInputIndicesDirty;
+
+	void RebuildParameterIndices();
+	void RebuildInputIndices();
+
 	// The baked outputs from the last bake.
 	UPROPERTY()
 	TArray<FHoudiniBakedOutput> BakedOutputs;
@@ -29,8 +29,11 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniGenericAttribute.h"
+#include "HoudiniWorldActorIndex.h"
 
 #include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
@@ -65,6 +68,12 @@ void FHoudiniEngineRuntime::StartupModule()
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 	// Store the instance.
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = this;
+
+	// Properties resolved for generic attributes are invalidated when classes are reloaded or reinstanced
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+		[](EReloadCompleteReason) { FHoudiniGenericAttribute::ResetPropertyPathCache(); });
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda(
+		[](const TMap<UObject*, UObject*>&) { FHoudiniGenericAttribute::ResetPropertyPathCache(); });
 }
 
 
@@ -73,6 +82,12 @@ void FHoudiniEngineRuntime::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
+
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FHoudiniGenericAttribute::ResetPropertyPathCache();
+
+	FHoudiniWorldActorIndex::ReleaseAll();
 }
 
 
@@ -179,17 +194,31 @@ FHoudiniEngineRuntime::RegisterHoudiniComponent(UHoudiniAssetComponent* HAC, boo
 
 
 void 
-FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent)
+FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent, const int32 InSessionIndex)
 {
 	if (InNodeId >= 0) 
 	{
 		// FDebug::DumpStackTraceToLog();
 
-		NodeIdsPendingDelete.AddUnique(InNodeId);
+		bool bAlreadyPending = false;
+		for (int32 Idx = 0; Idx < NodeIdsPendingDelete.Num(); Idx++)
+		{
+			if (NodeIdsPendingDelete[Idx] == InNodeId && NodeSessionIndicesPendingDelete[Idx] == InSessionIndex)
+			{
+				bAlreadyPending = true;
+				break;
+			}
+		}
+
+		if (!bAlreadyPending)
+		{
+			NodeIdsPendingDelete.Add(InNodeId);
+			NodeSessionIndicesPendingDelete.Add(InSessionIndex);
+		}
 
 		if (bDeleteParent)
 		{
-			NodeIdsParentPendingDelete.AddUnique(InNodeId);
+			NodeIdsParentPendingDelete.AddUnique(TPair<int32, int32>(InNodeId, InSessionIndex));
 		}
 	}
 }
@@ -232,7 +261,7 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 		UHoudiniAssetComponent* HAC = Ptr.Get();
 		if (HAC && HAC->CanDeleteHoudiniNodes())
 		{
-			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true);
+			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true, FMath::Max(HAC->GetSessionIndex(), 0));
 		}
 	}
 	
@@ -267,6 +296,21 @@ FHoudiniEngineRuntime::GetNodeIdsPendingDeleteAt(const int32& Index)
 }
 
 
+int32
+FHoudiniEngineRuntime::GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index)
+{
+	if (!IsInitialized())
+		return 0;
+
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (!NodeSessionIndicesPendingDelete.IsValidIndex(Index))
+		return 0;
+
+	return NodeSessionIndicesPendingDelete[Index];
+}
+
+
 void
 FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 {
@@ -278,21 +322,21 @@ FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 		return;
 
 	NodeIdsPendingDelete.RemoveAt(Index);
+	NodeSessionIndicesPendingDelete.RemoveAt(Index);
 }
 
 
 bool 
-FHoudiniEngineRuntime::IsParentNodePendingDelete(const int32& NodeId) 
+FHoudiniEngineRuntime::IsParentNodePendingDelete(const int32& NodeId, const int32 InSessionIndex) 
 {
-	return NodeIdsParentPendingDelete.Contains(NodeId);
+	return NodeIdsParentPendingDelete.Contains(TPair<int32, int32>(NodeId, InSessionIndex));
 }
 
 
 void 
-FHoudiniEngineRuntime::RemoveParentNodePendingDelete(const int32& NodeId) 
+FHoudiniEngineRuntime::RemoveParentNodePendingDelete(const int32& NodeId, const int32 InSessionIndex) 
 {
-	if (NodeIdsParentPendingDelete.Contains(NodeId))
-		NodeIdsParentPendingDelete.Remove(NodeId);
+	NodeIdsParentPendingDelete.Remove(TPair<int32, int32>(NodeId, InSessionIndex));
 }
 
 
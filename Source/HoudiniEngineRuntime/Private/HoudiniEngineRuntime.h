@@ -72,15 +72,17 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		//
 		// Node deletion
 		//
-		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false);
+		// InSessionIndex is the index of the session (in the session pool) the node belongs to
+		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false, const int32 InSessionIndex = 0);
 
 		int32 GetNodeIdsPendingDeleteCount();
 		int32 GetNodeIdsPendingDeleteAt(const int32& Index);
+		int32 GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index);
 		void RemoveNodeIdPendingDeleteAt(const int32& Index);
 
-		bool IsParentNodePendingDelete(const int32& NodeId);
+		bool IsParentNodePendingDelete(const int32& NodeId, const int32 InSessionIndex = 0);
 
-		void RemoveParentNodePendingDelete(const int32& NodeId);
+		void RemoveParentNodePendingDelete(const int32& NodeId, const int32 InSessionIndex = 0);
 
 		//
 		//
@@ -109,7 +111,15 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 
 		TArray<int32> NodeIdsPendingDelete;
 
-		TArray<int32> NodeIdsParentPendingDelete;
+		// Session index of each node in NodeIdsPendingDelete
+		TArray<int32> NodeSessionIndicesPendingDelete;
+
+		// Node Id / Session index pairs
+		TArray<TPair<int32, int32>> NodeIdsParentPendingDelete;
 
 		FOnToolOrPackageChanged OnToolOrPackageChanged;
+
+		// Handles used to reset the generic attribute property cache
+		FDelegateHandle ReloadCompleteHandle;
+		FDelegateHandle ObjectsReplacedHandle;
 };
\ No newline at end of file
@@ -62,6 +62,8 @@ HOUDINIENGINEEDITOR_API DECLARE_LOG_CATEGORY_EXTERN(LogHoudiniEngineEditor, Log,
 #else
 	#define HAPI_UNREAL_SESSION_SERVER_PIPENAME                 TEXT( "hapi" )
 #endif
+#define HAPI_UNREAL_SESSION_POOL_SIZE                       1
+#define HAPI_UNREAL_SESSION_POOL_MAX_SIZE                   32
 
 
 
@@ -28,6 +28,7 @@
 
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniWorldActorIndex.h"
 
 #include "EngineUtils.h"
 #include "Engine/EngineTypes.h"
@@ -113,9 +114,22 @@ FHoudiniEngineRuntimeUtils::FindActorsOfClassInBounds(UWorld* World, TSubclassOf
 		return false;
 	
 	OutActors.Empty();
-	for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+
+	// Only consider the actors intersecting the boxes when the world is indexed
+	TArray<AActor*> CandidateActors;
+	FHoudiniWorldActorIndex* WorldActorIndex = FHoudiniWorldActorIndex::Get(World);
+	if (WorldActorIndex)
+	{
+		WorldActorIndex->FindActorsInBounds(BBoxes, ActorType.Get(), CandidateActors);
+	}
+	else
+	{
+		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+			CandidateActors.Add(*ActorItr);
+	}
+
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor* CurrentActor = *ActorItr;
 		if (!IsValid(CurrentActor))
 			continue;
 		
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include "HoudiniWorldActorIndex.h"
+
 #include "EngineUtils.h"
 #include "LandscapeInfo.h"
 #include "UObject/ObjectMacros.h"
@@ -345,6 +347,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineRuntimeUtils
 	template<class T>
 	static T* FindActorInWorldByLabelOrName(UWorld* InWorld, FString ActorLabelOrName, EActorIteratorFlags Flags = EActorIteratorFlags::AllActors)
 	{
+		if (FHoudiniWorldActorIndex* WorldActorIndex = FHoudiniWorldActorIndex::Get(InWorld))
+			return Cast<T>(WorldActorIndex->FindActorByLabelOrName(ActorLabelOrName, T::StaticClass(), Flags));
+
 		T* OutActor = nullptr;
 		for (TActorIterator<T> ActorIt(InWorld, T::StaticClass(), Flags); ActorIt; ++ActorIt)
 		{
@@ -38,6 +38,16 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "EditorFramework/AssetImportData.h"
 #include "AI/Navigation/NavCollisionBase.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+	// Property paths resolved by FHoudiniGenericAttribute::FindPropertyPathOnClass(), per class and property name.
+	// Property names are compared ignoring case, as when walking the class properties.
+	FCriticalSection PropertyPathCacheLock;
+	TMap<TPair<TObjectKey<UClass>, FString>, FHoudiniGenericAttributePropertyPath> PropertyPathCache;
+}
 
 FHoudiniGenericAttributeChangedProperty::FHoudiniGenericAttributeChangedProperty()
 	: Object()
@@ -667,6 +677,59 @@ FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(
 }
 
 
+int32
+FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(
+	const TArray<UObject*>& InObjects,
+	const FHoudiniGenericAttribute& InPropertyAttribute,
+	const TArray<int32>& InAtIndices,
+	const bool bInDeferPostPropertyChangedEvents,
+	TArray<FHoudiniGenericAttributeChangedProperty>* OutChangedProperties)
+{
+	if (InAtIndices.Num() > 0 && InAtIndices.Num() != InObjects.Num())
+		return 0;
+
+	// Keep the path resolved for the last class, consecutive objects usually share their class
+	UClass* ResolvedClass = nullptr;
+	FHoudiniGenericAttributePropertyPath ResolvedPath;
+
+	const FFindPropertyFunctionType FindResolvedProperty = [&](
+		UObject* const InObject, const FString& InPropertyName, bool& bOutSkipDefaultIfPropertyNotFound, FEditPropertyChain& InPropertyChain,
+		FProperty*& OutFoundProperty, UObject*& OutFoundPropertyObject, void*& OutContainer) -> bool
+	{
+		if (InObject->GetClass() != ResolvedClass)
+		{
+			ResolvedClass = InObject->GetClass();
+			FindPropertyPathOnClass(InObject, InPropertyName, ResolvedPath);
+		}
+
+		// Let FindPropertyOnObject() look into nested objects and components
+		if (!ResolvedPath.Property)
+			return false;
+
+		for (FProperty* ChainProperty : ResolvedPath.PropertyChain)
+			InPropertyChain.AddTail(ChainProperty);
+
+		OutFoundProperty = ResolvedPath.Property;
+		OutFoundPropertyObject = InObject;
+		OutContainer = ResolvedPath.ContainerOffset != INDEX_NONE ? reinterpret_cast<uint8*>(InObject) + ResolvedPath.ContainerOffset : nullptr;
+		return true;
+	};
+
+	int32 NumUpdated = 0;
+	for (int32 ObjectIdx = 0; ObjectIdx < InObjects.Num(); ObjectIdx++)
+	{
+		const int32 AtIndex = InAtIndices.Num() > 0 ? InAtIndices[ObjectIdx] : 0;
+		if (UpdatePropertyAttributeOnObject(
+			InObjects[ObjectIdx], InPropertyAttribute, AtIndex, bInDeferPostPropertyChangedEvents, OutChangedProperties, FindResolvedProperty))
+		{
+			NumUpdated++;
+		}
+	}
+
+	return NumUpdated;
+}
+
+
 bool
 FHoudiniGenericAttribute::FindPropertyOnObject(
 	UObject* InObject,
@@ -692,15 +755,16 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 	OutFoundProperty = nullptr;
 	OutFoundPropertyObject = InObject;
 
-	bool bPropertyHasBeenFound = false;
-	FHoudiniGenericAttribute::TryToFindProperty(
-		InObject,
-		ObjectClass,
-		InPropertyName,
-		InPropertyChain,
-		OutFoundProperty,
-		bPropertyHasBeenFound,
-		OutContainer);
+	FHoudiniGenericAttributePropertyPath PropertyPath;
+	if (FHoudiniGenericAttribute::FindPropertyPathOnClass(InObject, InPropertyName, PropertyPath))
+	{
+		for (FProperty* ChainProperty : PropertyPath.PropertyChain)
+			InPropertyChain.AddTail(ChainProperty);
+
+		OutFoundProperty = PropertyPath.Property;
+		if (PropertyPath.ContainerOffset != INDEX_NONE)
+			OutContainer = reinterpret_cast<uint8*>(InObject) + PropertyPath.ContainerOffset;
+	}
 
 	/*
 	// TODO: Parsing needs to be made recursively!
@@ -777,14 +841,6 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 		return true;
 	*/
 
-	// Try with FindField??
-	if (!OutFoundProperty)
-		OutFoundProperty = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
-
-	// Try with FindPropertyByName ??
-	if (!OutFoundProperty)
-		OutFoundProperty = ObjectClass->FindPropertyByName(*InPropertyName);
-
 	// We found the Property we were looking for
 	if (OutFoundProperty)
 		return true;
@@ -843,6 +899,87 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 }
 
 
+bool
+FHoudiniGenericAttribute::FindPropertyPathOnClass(
+	UObject* InObject,
+	const FString& InPropertyName,
+	FHoudiniGenericAttributePropertyPath& OutPropertyPath)
+{
+#if WITH_EDITOR
+	OutPropertyPath = FHoudiniGenericAttributePropertyPath();
+
+	if (!IsValid(InObject))
+		return false;
+
+	if (InPropertyName.IsEmpty())
+		return false;
+
+	UClass* ObjectClass = InObject->GetClass();
+	if (!IsValid(ObjectClass))
+		return false;
+
+	const TPair<TObjectKey<UClass>, FString> CacheKey(ObjectClass, InPropertyName);
+	{
+		FScopeLock ScopeLock(&PropertyPathCacheLock);
+		if (const FHoudiniGenericAttributePropertyPath* CachedPath = PropertyPathCache.Find(CacheKey))
+		{
+			OutPropertyPath = *CachedPath;
+			return OutPropertyPath.Property != nullptr;
+		}
+	}
+
+	// Walk the class and its nested structs
+	FEditPropertyChain PropertyChain;
+	void* Container = nullptr;
+	bool bPropertyHasBeenFound = false;
+	FHoudiniGenericAttribute::TryToFindProperty(
+		InObject,
+		ObjectClass,
+		InPropertyName,
+		PropertyChain,
+		OutPropertyPath.Property,
+		bPropertyHasBeenFound,
+		Container);
+
+	if (OutPropertyPath.Property)
+	{
+		for (FProperty* ChainProperty : PropertyChain)
+			OutPropertyPath.PropertyChain.Add(ChainProperty);
+
+		// Nested struct values are stored inline, so the container is always at the same offset in the object
+		if (Container)
+			OutPropertyPath.ContainerOffset = static_cast<int32>(static_cast<uint8*>(Container) - reinterpret_cast<uint8*>(InObject));
+	}
+
+	// Try with FindField??
+	if (!OutPropertyPath.Property)
+		OutPropertyPath.Property = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
+
+	// Try with FindPropertyByName ??
+	if (!OutPropertyPath.Property)
+		OutPropertyPath.Property = ObjectClass->FindPropertyByName(*InPropertyName);
+
+	// Cache failed lookups as well, Actors will look into their components next
+	{
+		FScopeLock ScopeLock(&PropertyPathCacheLock);
+		PropertyPathCache.Add(CacheKey, OutPropertyPath);
+	}
+
+	return OutPropertyPath.Property != nullptr;
+#else
+	return false;
+#endif
+}
+
+
+void
+FHoudiniGenericAttribute::ResetPropertyPathCache()
+{
+	FScopeLock ScopeLock(&PropertyPathCacheLock);
+	PropertyPathCache.Empty();
+}
+
+
 bool
 FHoudiniGenericAttribute::TryToFindProperty(
 	void* InContainer,
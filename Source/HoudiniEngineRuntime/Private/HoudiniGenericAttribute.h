@@ -75,6 +75,19 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttributeChangedProperty
 	FProperty* Property;
 };
 
+// A property found by name on a class, as resolved by FHoudiniGenericAttribute::FindPropertyPathOnClass()
+struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttributePropertyPath
+{
+	// The found property, null if the class has no matching property
+	FProperty* Property = nullptr;
+
+	// The struct properties leading to Property, and Property itself, for exact name matches
+	TArray<FProperty*> PropertyChain;
+
+	// Offset of the property's container from the object, INDEX_NONE if there is no container
+	int32 ContainerOffset = INDEX_NONE;
+};
+
 USTRUCT()
 struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 {
@@ -139,6 +152,17 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 		TArray<FHoudiniGenericAttributeChangedProperty>* OutChangedProperties=nullptr,
 		const FFindPropertyFunctionType& InFindPropertyFunction=nullptr);
 
+	// Tries to find/update a single property on multiple objects.
+	// The property is resolved once per class, then written to all the objects of that class.
+	// InAtIndices contains the attribute index to use for each object, if empty index 0 is used for all.
+	// Returns the number of objects that were updated.
+	static int32 UpdatePropertyAttributeOnObjects(
+		const TArray<UObject*>& InObjects,
+		const FHoudiniGenericAttribute& InPropertyAttribute,
+		const TArray<int32>& InAtIndices,
+		const bool bInDeferPostPropertyChangedEvents=false,
+		TArray<FHoudiniGenericAttributeChangedProperty>* OutChangedProperties=nullptr);
+
 	// Tries to find a Uproperty by name/label on an object
 	// FoundPropertyObject will be the object that actually contains the property
 	// and can be different from InObject if the property is nested.
@@ -150,6 +174,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 		UObject*& OutFoundPropertyObject,
 		void*& OutContainer);
 
+	// Finds a Uproperty by name/label on the class of an object, without looking into nested objects.
+	// Results are cached per class and property name, so only the first lookup walks the class properties.
+	static bool FindPropertyPathOnClass(
+		UObject* InObject,
+		const FString& InPropertyName,
+		FHoudiniGenericAttributePropertyPath& OutPropertyPath);
+
+	// Empties the cache used by FindPropertyPathOnClass(), needed when classes are reloaded or reinstanced.
+	static void ResetPropertyPathCache();
+
 	// Modifies the value of a found Property
 	static bool ModifyPropertyValueOnObject(
 		UObject* InObject,
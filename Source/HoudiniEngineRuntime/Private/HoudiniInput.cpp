@@ -38,6 +38,7 @@
 #include "UnrealObjectInputRuntimeTypes.h"
 #include "UnrealObjectInputManager.h"
 #include "UnrealObjectInputRuntimeUtils.h"
+#include "HoudiniWorldActorIndex.h"
 #include "LandscapeSplineActor.h"
 
 #include "EngineUtils.h"
@@ -2653,10 +2654,23 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 
 	//UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
 	UWorld* MyWorld = GetWorld();
+
+	// Only consider the actors intersecting the bound selectors when the world is indexed
+	TArray<AActor*> CandidateActors;
+	FHoudiniWorldActorIndex* WorldActorIndex = FHoudiniWorldActorIndex::Get(MyWorld);
+	if (WorldActorIndex)
+	{
+		WorldActorIndex->FindActorsInBounds(AllBBox, AActor::StaticClass(), CandidateActors);
+	}
+	else
+	{
+		for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+			CandidateActors.Add(*ActorItr);
+	}
+
 	TArray<AActor*> NewSelectedActors;
-	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor *CurrentActor = *ActorItr;
 		if (!IsValid(CurrentActor))
 			continue;
 
@@ -63,6 +63,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
 	bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
 	AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+	SessionPoolSize = HAPI_UNREAL_SESSION_POOL_SIZE;
 
 	bSyncWithHoudiniCook = true;
 	bCookUsingHoudiniTime = true;
@@ -147,6 +148,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	DistanceFieldResolutionScale = 2.0f; // ue default is 1.0
 
 	bPDGAsyncCommandletImportEnabled = false;
+	PDGAsyncCommandletWorkerCount = 1;
 
 	// Curve inputs and editable output curves
 	bAddRotAndScaleAttributesOnCurves = false;
@@ -356,6 +358,7 @@ UHoudiniRuntimeSettings::UpdateSessionUI()
 	SetPropertyReadOnly(TEXT("ServerPipeName"), true);
 	SetPropertyReadOnly(TEXT("bStartAutomaticServer"), true);
 	SetPropertyReadOnly(TEXT("AutomaticServerTimeout"), true);
+	SetPropertyReadOnly(TEXT("SessionPoolSize"), true);
 
 	bool bServerType = false;
 
@@ -384,6 +387,7 @@ UHoudiniRuntimeSettings::UpdateSessionUI()
 	{
 		SetPropertyReadOnly(TEXT("bStartAutomaticServer"), false);
 		SetPropertyReadOnly(TEXT("AutomaticServerTimeout"), false);
+		SetPropertyReadOnly(TEXT("SessionPoolSize"), false);
 	}
 }
 
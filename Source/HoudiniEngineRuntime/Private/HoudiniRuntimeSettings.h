@@ -197,6 +197,12 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session)
 		float AutomaticServerTimeout;
 
+		// Number of Houdini Engine sessions used to cook HDAs concurrently (Socket and Named Pipe sessions only).
+		// Additional sessions start their own HARS process, on "ServerPipeName_N" or "ServerPort + N".
+		// HDAs using inputs, PDG or Session Sync always use the main session.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session, meta = (ClampMin = "1", ClampMax = "32", UIMin = "1", UIMax = "32"))
+		int32 SessionPoolSize;
+
 		// If enabled, changes made in Houdini, when connected to Houdini running in Session Sync mode will be automatically be pushed to Unreal.
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session)
 		bool bSyncWithHoudiniCook;
@@ -476,6 +482,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Enabled"))
 		bool bPDGAsyncCommandletImportEnabled;
 
+		// Number of commandlet processes used by the async importer to import work results in parallel.
+		// Each commandlet runs its own Houdini Engine session.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Workers", ClampMin = "1", ClampMax = "16", UIMin = "1", UIMax = "16", EditCondition = "bPDGAsyncCommandletImportEnabled"))
+		int32 PDGAsyncCommandletWorkerCount;
+
 
 		//-------------------------------------------------------------------------------------------------------------
 		// Houdini Tools Paths
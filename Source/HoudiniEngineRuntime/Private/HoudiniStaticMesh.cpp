@@ -162,17 +162,17 @@ void UHoudiniStaticMesh::SetNumStaticMaterials(uint32 InNumMaterials)
 
 void UHoudiniStaticMesh::SetVertexPosition(uint32 InVertexIndex, const FVector3f& InPosition)
 {
-	check(VertexPositions.IsValidIndex(InVertexIndex));
+	checkSlow(VertexPositions.IsValidIndex(InVertexIndex));
 
 	VertexPositions[InVertexIndex] = InPosition;
 }
 
 void UHoudiniStaticMesh::SetTriangleVertexIndices(uint32 InTriangleIndex, const FIntVector& InTriangleVertexIndices)
 {
-	check(TriangleIndices.IsValidIndex(InTriangleIndex));
-	check(VertexPositions.IsValidIndex(InTriangleVertexIndices[0]));
-	check(VertexPositions.IsValidIndex(InTriangleVertexIndices[1]));
-	check(VertexPositions.IsValidIndex(InTriangleVertexIndices[2]));
+	checkSlow(TriangleIndices.IsValidIndex(InTriangleIndex));
+	checkSlow(VertexPositions.IsValidIndex(InTriangleVertexIndices[0]));
+	checkSlow(VertexPositions.IsValidIndex(InTriangleVertexIndices[1]));
+	checkSlow(VertexPositions.IsValidIndex(InTriangleVertexIndices[2]));
 
 	TriangleIndices[InTriangleIndex] = InTriangleVertexIndices;
 }
@@ -184,9 +184,9 @@ void UHoudiniStaticMesh::SetTriangleVertexNormal(uint32 InTriangleIndex, uint8 I
 		return;
 	}
 
-	check(TriangleIndices.IsValidIndex(InTriangleIndex));
+	checkSlow(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
-	check(VertexInstanceNormals.IsValidIndex(VertexInstanceIndex));
+	checkSlow(VertexInstanceNormals.IsValidIndex(VertexInstanceIndex));
 
 	VertexInstanceNormals[VertexInstanceIndex] = InNormal;
 }
@@ -198,9 +198,9 @@ void UHoudiniStaticMesh::SetTriangleVertexUTangent(uint32 InTriangleIndex, uint8
 		return;
 	}
 
-	check(TriangleIndices.IsValidIndex(InTriangleIndex));
+	checkSlow(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
-	check(VertexInstanceUTangents.IsValidIndex(VertexInstanceIndex));
+	checkSlow(VertexInstanceUTangents.IsValidIndex(VertexInstanceIndex));
 
 	VertexInstanceUTangents[VertexInstanceIndex] = InUTangent;
 }
@@ -212,9 +212,9 @@ void UHoudiniStaticMesh::SetTriangleVertexVTangent(uint32 InTriangleIndex, uint8
 		return;
 	}
 
-	check(TriangleIndices.IsValidIndex(InTriangleIndex));
+	checkSlow(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
-	check(VertexInstanceVTangents.IsValidIndex(VertexInstanceIndex));
+	checkSlow(VertexInstanceVTangents.IsValidIndex(VertexInstanceIndex));
 
 	VertexInstanceVTangents[VertexInstanceIndex] = InVTangent;
 }
@@ -226,9 +226,9 @@ void UHoudiniStaticMesh::SetTriangleVertexColor(uint32 InTriangleIndex, uint8 In
 		return;
 	}
 
-	check(TriangleIndices.IsValidIndex(InTriangleIndex));
+	checkSlow(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
-	check(VertexInstanceColors.IsValidIndex(VertexInstanceIndex));
+	checkSlow(VertexInstanceColors.IsValidIndex(VertexInstanceIndex));
 
 	VertexInstanceColors[VertexInstanceIndex] = InColor;
 }
@@ -240,9 +240,9 @@ void UHoudiniStaticMesh::SetTriangleVertexUV(uint32 InTriangleIndex, uint8 InTri
 		return;
 	}
 
-	check(TriangleIndices.IsValidIndex(InTriangleIndex));
+	checkSlow(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceUVIndex = InUVLayer * GetNumVertexInstances() + InTriangleIndex * 3 + InTriangleVertexIndex;
-	check(VertexInstanceUVs.IsValidIndex(VertexInstanceUVIndex));
+	checkSlow(VertexInstanceUVs.IsValidIndex(VertexInstanceUVIndex));
 
 	VertexInstanceUVs[VertexInstanceUVIndex] = InUV;
 }
@@ -254,8 +254,8 @@ void UHoudiniStaticMesh::SetTriangleMaterialID(uint32 InTriangleIndex, int32 InM
 		return;
 	}
 
-	check(TriangleIndices.IsValidIndex(InTriangleIndex));
-	check(MaterialIDsPerTriangle.IsValidIndex(InTriangleIndex));
+	checkSlow(TriangleIndices.IsValidIndex(InTriangleIndex));
+	checkSlow(MaterialIDsPerTriangle.IsValidIndex(InTriangleIndex));
 
 	MaterialIDsPerTriangle[InTriangleIndex] = InMaterialID;
 }
@@ -96,6 +96,9 @@ public:
 	UFUNCTION()
 	uint32 GetNumVertexInstances() const { return TriangleIndices.Num() * 3; }
 
+	// The per vertex / per triangle setters below never resize the arrays allocated by Initialize(), and only
+	// validate their indices in debug builds: they can be called concurrently as long as the threads write
+	// to different vertices / triangles.
 	UFUNCTION()
 	void SetVertexPosition(uint32 InVertexIndex, const FVector3f& InPosition);
 
@@ -27,6 +27,7 @@
 #include "HoudiniStaticMeshSceneProxy.h"
 
 #include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 #include "Materials/Material.h"
 #include "PrimitiveViewRelevance.h"
 #include "Engine/Engine.h"
@@ -44,12 +45,29 @@
 
 // Based on: Plugins\Experimental\MeshModelingToolset\Source\ModelingComponents\Private\BaseDynamicMeshSceneProxy.h
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineProxyMeshStaticDrawPath(
+	TEXT("HoudiniEngine.ProxyMeshStaticDrawPath"),
+	1,
+	TEXT("When enabled, Houdini proxy meshes are rendered with cached static mesh draw commands instead of being collected every frame.\n")
+	TEXT("Wireframe, rich views and bounds display still use the dynamic path.\n")
+	TEXT("Takes effect when the proxy meshes' render state is recreated.\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineProxyMeshWeldVertices(
+	TEXT("HoudiniEngine.ProxyMeshWeldVertices"),
+	1,
+	TEXT("When enabled, the vertex instances of Houdini proxy meshes with identical attributes are welded into an indexed vertex buffer.\n")
+	TEXT("When disabled, every triangle gets its own three vertices.\n")
+	TEXT("Takes effect when the proxy meshes' render state is recreated.\n")
+);
+
 //
 // FHoudiniStaticMeshRenderBufferSet
 //
 
 FHoudiniStaticMeshRenderBufferSet::FHoudiniStaticMeshRenderBufferSet(ERHIFeatureLevel::Type InFeatureLevel)
 	: NumTriangles(0)
+	, NumVertices(0)
 	, LocalVertexFactory(InFeatureLevel, "FHoudiniStaticMeshRenderBufferSet")
 {
 }
@@ -154,6 +172,8 @@ FHoudiniStaticMeshSceneProxy::FHoudiniStaticMeshSceneProxy(UHoudiniStaticMeshCom
 	, FeatureLevel(InFeatureLevel)
 	, Component(InComponent)
 	, MaterialRelevance(InComponent ? InComponent->GetMaterialRelevance(InFeatureLevel) : FMaterialRelevance())
+	, bUseStaticDrawPath(CVarHoudiniEngineProxyMeshStaticDrawPath.GetValueOnAnyThread() != 0)
+	, bWeldVertices(CVarHoudiniEngineProxyMeshWeldVertices.GetValueOnAnyThread() != 0)
 #if STATICMESH_ENABLE_DEBUG_RENDERING
 	, Owner(InComponent ? InComponent->GetOwner() : nullptr)
 #endif
@@ -248,6 +268,43 @@ void FHoudiniStaticMeshSceneProxy::Build()
 	}
 }
 
+void FHoudiniStaticMeshSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PDI)
+{
+	if (!bUseStaticDrawPath)
+		return;
+
+	for (const FHoudiniStaticMeshRenderBufferSet* BufferSet : BufferSets)
+	{
+		if (!BufferSet || BufferSet->NumTriangles == 0 || BufferSet->TriangleIndexBuffer.Indices.Num() <= 0)
+			continue;
+
+		UMaterialInterface* Material = BufferSet->Material ? BufferSet->Material : UMaterial::GetDefaultMaterial(MD_Surface);
+
+		// The primitive uniform buffer is assigned by the scene when the draw commands are cached
+		FMeshBatch MeshBatch;
+		InitMeshBatch(MeshBatch, *BufferSet, Material->GetRenderProxy(), false, SDPG_World);
+		MeshBatch.LODIndex = 0;
+		MeshBatch.CastShadow = true;
+		MeshBatch.bUseAsOccluder = ShouldUseAsOccluder();
+		MeshBatch.bUseForDepthPass = true;
+		MeshBatch.bUseForMaterial = true;
+
+		PDI->DrawMesh(MeshBatch, FLT_MAX);
+	}
+}
+
+bool FHoudiniStaticMeshSceneProxy::RequiresDynamicPath(const FSceneView* View) const
+{
+	if (!bUseStaticDrawPath || !View || !View->Family)
+		return true;
+
+	const FEngineShowFlags& EngineShowFlags = View->Family->EngineShowFlags;
+	if (IsRichView(*View->Family) || EngineShowFlags.Wireframe || EngineShowFlags.Bounds)
+		return true;
+
+	return false;
+}
+
 void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
 	const FEngineShowFlags EngineShowFlags = ViewFamily.EngineShowFlags;
@@ -337,6 +394,21 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	ESceneDepthPriorityGroup DepthPriority,
 	int ViewIndex,
 	FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer) const
+{
+	InitMeshBatch(InMeshBatch, Buffers, Material, bRenderAsWireframe, DepthPriority);
+
+	FMeshBatchElement& BatchElement = InMeshBatch.Elements[0];
+	BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
+	
+	return true;
+}
+
+void FHoudiniStaticMeshSceneProxy::InitMeshBatch(
+	FMeshBatch& InMeshBatch,
+	const FHoudiniStaticMeshRenderBufferSet& Buffers,
+	FMaterialRenderProxy* Material,
+	bool bRenderAsWireframe,
+	ESceneDepthPriorityGroup DepthPriority) const
 {
 	FMeshBatchElement& BatchElement = InMeshBatch.Elements[0];
 	BatchElement.IndexBuffer = &Buffers.TriangleIndexBuffer;
@@ -344,8 +416,6 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	InMeshBatch.VertexFactory = &Buffers.LocalVertexFactory;
 	InMeshBatch.MaterialRenderProxy = Material;
 
-	BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
-
 	BatchElement.FirstIndex = 0;
 	BatchElement.NumPrimitives = Buffers.NumTriangles;
 	BatchElement.MinVertexIndex = 0;
@@ -354,8 +424,6 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	InMeshBatch.Type = PT_TriangleList;
 	InMeshBatch.DepthPriorityGroup = DepthPriority;
 	InMeshBatch.bCanApplyViewModeOverrides = false;
-	
-	return true;
 }
 
 
@@ -364,7 +432,10 @@ FPrimitiveViewRelevance FHoudiniStaticMeshSceneProxy::GetViewRelevance(const FSc
 	FPrimitiveViewRelevance Result;
 
 	Result.bDrawRelevance = IsShown(View);
-	Result.bDynamicRelevance = true;
+	if (RequiresDynamicPath(View))
+		Result.bDynamicRelevance = true;
+	else
+		Result.bStaticRelevance = true;
 	Result.bRenderCustomDepth = ShouldRenderCustomDepth();
 	Result.bRenderInMainPass = ShouldRenderInMainPass();
 	Result.bShadowRelevance = IsShadowCast(View);
@@ -381,6 +452,141 @@ bool FHoudiniStaticMeshSceneProxy::CanBeOccluded() const
 	return !MaterialRelevance.bDisableDepthTest;
 }
 
+void FHoudiniStaticMeshSceneProxy::WeldVertexInstances(
+	const UHoudiniStaticMesh* InMesh,
+	const TArray<uint32>* InTriangleIDs,
+	uint32 InTriangleGroupStartIdx,
+	uint32 InNumTriangles,
+	TArray<uint32>& OutCornerToVertex,
+	TArray<uint32>& OutVertexInstances) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniStaticMeshSceneProxy::WeldVertexInstances"));
+
+	const uint32 NumCorners = InNumTriangles * 3;
+	const uint32 NumMeshVertices = InMesh->GetNumVertices();
+	const uint32 NumMeshVertexInstances = InMesh->GetNumVertexInstances();
+	const uint32 NumUVLayers = InMesh->GetNumUVLayers();
+
+	const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
+	const TArray<FColor>& VertexInstanceColors = InMesh->GetVertexInstanceColors();
+	const TArray<FVector3f>& VertexInstanceNormals = InMesh->GetVertexInstanceNormals();
+	const TArray<FVector3f>& VertexInstanceUTangents = InMesh->GetVertexInstanceUTangents();
+	const TArray<FVector3f>& VertexInstanceVTangents = InMesh->GetVertexInstanceVTangents();
+	const TArray<FVector2f>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
+
+	const bool bHasColors = InMesh->HasColors();
+	const bool bHasNormals = InMesh->HasNormals();
+	const bool bHasTangents = InMesh->HasTangents();
+
+	// The mesh vertex instance and vertex used by a corner of the group's triangles
+	auto GetCornerInstance = [&](uint32 InCorner)
+	{
+		const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + InCorner / 3] : InCorner / 3;
+		return TriangleID * 3 + InCorner % 3;
+	};
+
+	auto AreInstancesEqual = [&](uint32 InInstanceA, uint32 InInstanceB)
+	{
+		if (bHasNormals && VertexInstanceNormals[InInstanceA] != VertexInstanceNormals[InInstanceB])
+			return false;
+		if (bHasTangents && (VertexInstanceUTangents[InInstanceA] != VertexInstanceUTangents[InInstanceB]
+			|| VertexInstanceVTangents[InInstanceA] != VertexInstanceVTangents[InInstanceB]))
+			return false;
+		if (bHasColors && VertexInstanceColors[InInstanceA] != VertexInstanceColors[InInstanceB])
+			return false;
+		for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+		{
+			const uint32 LayerOffset = UVLayerIdx * NumMeshVertexInstances;
+			if (VertexInstanceUVs[LayerOffset + InInstanceA] != VertexInstanceUVs[LayerOffset + InInstanceB])
+				return false;
+		}
+		return true;
+	};
+
+	// Gather the corners by mesh vertex: only corners sharing a vertex can be welded,
+	// so each vertex's corners can then be processed independently.
+	TArray<uint32> CornerInstances;
+	CornerInstances.SetNumUninitialized(NumCorners);
+	TArray<uint32> CornerVertices;
+	CornerVertices.SetNumUninitialized(NumCorners);
+	ParallelFor(NumCorners, [&](uint32 Corner)
+	{
+		const uint32 Instance = GetCornerInstance(Corner);
+		CornerInstances[Corner] = Instance;
+		CornerVertices[Corner] = TriangleIndices[Instance / 3][Instance % 3];
+	});
+
+	TArray<uint32> CornerOffsetPerVertex;
+	CornerOffsetPerVertex.SetNumZeroed(NumMeshVertices + 1);
+	for (uint32 Corner = 0; Corner < NumCorners; ++Corner)
+		CornerOffsetPerVertex[CornerVertices[Corner] + 1]++;
+	for (uint32 VertexIdx = 0; VertexIdx < NumMeshVertices; ++VertexIdx)
+		CornerOffsetPerVertex[VertexIdx + 1] += CornerOffsetPerVertex[VertexIdx];
+
+	TArray<uint32> CornersByVertex;
+	CornersByVertex.SetNumUninitialized(NumCorners);
+	{
+		TArray<uint32> WriteOffsets(CornerOffsetPerVertex.GetData(), NumMeshVertices);
+		for (uint32 Corner = 0; Corner < NumCorners; ++Corner)
+			CornersByVertex[WriteOffsets[CornerVertices[Corner]]++] = Corner;
+	}
+
+	// Weld each vertex's corners with identical attributes. The first corner of each set of
+	// identical corners is kept in UniqueCorners, at the start of the vertex's range.
+	TArray<uint32> UniqueCorners;
+	UniqueCorners.SetNumUninitialized(NumCorners);
+	TArray<uint32> CornerToLocalVertex;
+	CornerToLocalVertex.SetNumUninitialized(NumCorners);
+	TArray<uint32> VertexOffsets;
+	VertexOffsets.SetNumZeroed(NumMeshVertices + 1);
+	ParallelFor(NumMeshVertices, [&](uint32 VertexIdx)
+	{
+		const uint32 RangeStart = CornerOffsetPerVertex[VertexIdx];
+		const uint32 RangeEnd = CornerOffsetPerVertex[VertexIdx + 1];
+		uint32 NumUnique = 0;
+		for (uint32 SortedIdx = RangeStart; SortedIdx < RangeEnd; ++SortedIdx)
+		{
+			const uint32 Corner = CornersByVertex[SortedIdx];
+			const uint32 Instance = CornerInstances[Corner];
+
+			uint32 LocalVertex = NumUnique;
+			for (uint32 UniqueIdx = 0; UniqueIdx < NumUnique; ++UniqueIdx)
+			{
+				if (AreInstancesEqual(CornerInstances[UniqueCorners[RangeStart + UniqueIdx]], Instance))
+				{
+					LocalVertex = UniqueIdx;
+					break;
+				}
+			}
+
+			if (LocalVertex == NumUnique)
+				UniqueCorners[RangeStart + NumUnique++] = Corner;
+
+			CornerToLocalVertex[Corner] = LocalVertex;
+		}
+		VertexOffsets[VertexIdx + 1] = NumUnique;
+	});
+
+	for (uint32 VertexIdx = 0; VertexIdx < NumMeshVertices; ++VertexIdx)
+		VertexOffsets[VertexIdx + 1] += VertexOffsets[VertexIdx];
+
+	const uint32 NumVertices = VertexOffsets[NumMeshVertices];
+	OutVertexInstances.SetNumUninitialized(NumVertices);
+	ParallelFor(NumMeshVertices, [&](uint32 VertexIdx)
+	{
+		const uint32 RangeStart = CornerOffsetPerVertex[VertexIdx];
+		const uint32 NumUnique = VertexOffsets[VertexIdx + 1] - VertexOffsets[VertexIdx];
+		for (uint32 UniqueIdx = 0; UniqueIdx < NumUnique; ++UniqueIdx)
+			OutVertexInstances[VertexOffsets[VertexIdx] + UniqueIdx] = CornerInstances[UniqueCorners[RangeStart + UniqueIdx]];
+	});
+
+	OutCornerToVertex.SetNumUninitialized(NumCorners);
+	ParallelFor(NumCorners, [&](uint32 Corner)
+	{
+		OutCornerToVertex[Corner] = VertexOffsets[CornerVertices[Corner]] + CornerToLocalVertex[Corner];
+	});
+}
+
 void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs, uint32 InTriangleGroupStartIdx, uint32 InNumTrianglesInGroup)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniStaticMeshSceneProxy::PopulateBuffers"));
@@ -394,15 +600,38 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 	if (NumTriangles == 0)
 		return;
 
-	const uint32 NumVertices = NumTriangles * 3;
+	const uint32 NumCorners = NumTriangles * 3;
 	const uint32 NumUVLayers = InMesh->GetNumUVLayers();
+	const uint32 NumMeshVertexInstances = InMesh->GetNumVertexInstances();
+
+	// Map the triangle corners to the vertices of the buffers, and each vertex to the mesh vertex instance
+	// it's built from. Without welding, every corner gets its own vertex.
+	TArray<uint32> CornerToVertex;
+	TArray<uint32> VertexInstances;
+	if (bWeldVertices)
+	{
+		WeldVertexInstances(InMesh, InTriangleIDs, InTriangleGroupStartIdx, NumTriangles, CornerToVertex, VertexInstances);
+	}
+	else
+	{
+		VertexInstances.SetNumUninitialized(NumCorners);
+		ParallelFor(NumTriangles, [&](uint32 TriangleIDIdx)
+		{
+			const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
+			for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+				VertexInstances[TriangleIDIdx * 3 + TriVertIdx] = TriangleID * 3 + TriVertIdx;
+		});
+	}
+
+	const uint32 NumVertices = VertexInstances.Num();
+	InBuffers->NumVertices = NumVertices;
 
 	InBuffers->PositionVertexBuffer.Init(NumVertices);
 	// There must be at least one UV layer
 	// TODO: Would it be possible to have no UV layers and bind to a dummy 0/black SRV?
 	InBuffers->StaticMeshVertexBuffer.Init(NumVertices, NumUVLayers > 0 ? NumUVLayers : 1);
 	InBuffers->ColorVertexBuffer.Init(NumVertices);
-	InBuffers->TriangleIndexBuffer.Indices.AddUninitialized(NumTriangles * 3);
+	InBuffers->TriangleIndexBuffer.Indices.SetNumUninitialized(NumCorners);
 
 	const TArray<FVector3f>& VertexPositions = InMesh->GetVertexPositions();
 	const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
@@ -416,53 +645,55 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 	const bool bHasNormals = InMesh->HasNormals();
 	const bool bHasTangents = InMesh->HasTangents();
 
-	FThreadSafeCounter VertCounter(0);
-	//for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
-	ParallelFor(NumTriangles, [&](uint32 TriangleIDIdx)
+	ParallelFor(NumVertices, [&](uint32 VertIdx)
 	{
-		const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
-		const FIntVector &TriIndices = TriangleIndices[TriangleID];
+		const uint32 MeshVtxInstanceIdx = VertexInstances[VertIdx];
+		const uint32 MeshVtxIdx = TriangleIndices[MeshVtxInstanceIdx / 3][MeshVtxInstanceIdx % 3];
+
+		InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[MeshVtxIdx];
 
 		FVector3f TangentU;
 		FVector3f TangentV;
-		uint32 VertIdx = VertCounter.Add(3);
-		for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+		FVector3f Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector3f(0, 0, 1);
+		if (bHasTangents)
 		{
-			const uint32 MeshVtxIdx = TriIndices[TriVertIdx];
-			const uint32 MeshVtxInstanceIdx = TriangleID * 3 + TriVertIdx;
-
-			InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[TriIndices[TriVertIdx]];
-
-			FVector3f Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector3f(0, 0, 1);
-			if (bHasTangents)
-			{
-				TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
-				TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
-			}
-			else
-			{
-				Normal.FindBestAxisVectors(TangentU, TangentV);
-			}
-			InBuffers->StaticMeshVertexBuffer.SetVertexTangents(VertIdx, TangentU, TangentV, Normal);
+			TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
+			TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
+		}
+		else
+		{
+			Normal.FindBestAxisVectors(TangentU, TangentV);
+		}
+		InBuffers->StaticMeshVertexBuffer.SetVertexTangents(VertIdx, TangentU, TangentV, Normal);
 
-			if (NumUVLayers > 0)
-			{
-				for (uint8 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
-				{
-					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[MeshVtxInstanceIdx]);
-				}
-			}
-			else
+		if (NumUVLayers > 0)
+		{
+			for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
 			{
-				InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, 0, FVector2f::ZeroVector);
+				InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[UVLayerIdx * NumMeshVertexInstances + MeshVtxInstanceIdx]);
 			}
-
-			InBuffers->ColorVertexBuffer.VertexColor(VertIdx) = bHasColors ? VertexInstanceColors[MeshVtxInstanceIdx] : DefaultVertexColor;
-
-			InBuffers->TriangleIndexBuffer.Indices[VertIdx] = VertIdx;
-			VertIdx++;
 		}
+		else
+		{
+			InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, 0, FVector2f::ZeroVector);
+		}
+
+		InBuffers->ColorVertexBuffer.VertexColor(VertIdx) = bHasColors ? VertexInstanceColors[MeshVtxInstanceIdx] : DefaultVertexColor;
 	});
+
+	TArray<uint32>& Indices = InBuffers->TriangleIndexBuffer.Indices;
+	if (CornerToVertex.Num() == (int32)NumCorners)
+	{
+		ParallelFor(NumCorners, [&](uint32 Corner)
+		{
+			Indices[Corner] = CornerToVertex[Corner];
+		});
+	}
+	else
+	{
+		for (uint32 Corner = 0; Corner < NumCorners; ++Corner)
+			Indices[Corner] = Corner;
+	}
 }
 
 void FHoudiniStaticMeshSceneProxy::BuildSingleBufferSet()
@@ -50,6 +50,9 @@ public:
 	/** The number of triangles in the buffer set. */
 	int NumTriangles;
 
+	/** The number of vertices in the buffer set, after welding identical vertex instances. */
+	int NumVertices;
+
 	/** The static mesh data buffer. */
 	FStaticMeshVertexBuffer StaticMeshVertexBuffer;
 
@@ -110,6 +113,8 @@ public:
 	virtual void Build();
 
 	// FPrimitiveSceneProxy
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
+
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 
 	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
@@ -139,6 +144,17 @@ protected:
 	// different instantiation requirements.
 	virtual FHoudiniStaticMeshRenderBufferSet* MakeNewBufferSet() { return new FHoudiniStaticMeshRenderBufferSet(FeatureLevel);	}
 
+	// Welds the vertex instances of the given triangles that share the same vertex and attributes.
+	// OutCornerToVertex: the output vertex of each corner of the triangles
+	// OutVertexInstances: the mesh vertex instance each output vertex is built from
+	void WeldVertexInstances(
+		const UHoudiniStaticMesh* InMesh,
+		const TArray<uint32>* InTriangleIDs,
+		uint32 InTriangleGroupStartIdx,
+		uint32 InNumTriangles,
+		TArray<uint32>& OutCornerToVertex,
+		TArray<uint32>& OutVertexInstances) const;
+
 	// Build a single buffer set for the entire mesh (one material for the entire mesh).
 	void BuildSingleBufferSet();
 
@@ -147,6 +163,18 @@ protected:
 	// Get the number of materials from the parent mesh/component
 	uint32 GetNumMaterials() const { return Component ? Component->GetNumMaterials() : 0; }
 
+	// Set up the mesh batch to render a buffer set, used by both the static and dynamic paths.
+	void InitMeshBatch(
+		FMeshBatch& InMeshBatch,
+		const FHoudiniStaticMeshRenderBufferSet& Buffers,
+		FMaterialRenderProxy* Material,
+		bool bRenderAsWireframe,
+		ESceneDepthPriorityGroup DepthPriority) const;
+
+	// Returns true if the given view must be rendered with GetDynamicMeshElements instead
+	// of the cached static mesh draw commands.
+	bool RequiresDynamicPath(const FSceneView* View) const;
+
 	virtual bool PopulateMeshElement(
 		FMeshBatch &InMeshBatch,
 		const FHoudiniStaticMeshRenderBufferSet& Buffers,
@@ -166,6 +194,13 @@ protected:
 
 	FMaterialRelevance MaterialRelevance;
 
+	// Render through cached static mesh draw commands when the view allows it.
+	// The proxy is recreated whenever the mesh or its materials change, so its buffers never change.
+	bool bUseStaticDrawPath;
+
+	// Weld identical vertex instances into an indexed vertex buffer when building the buffer sets.
+	bool bWeldVertices;
+
 private:
 #if STATICMESH_ENABLE_DEBUG_RENDERING
 	AActor* Owner;
@@ -0,0 +1,675 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniWorldActorIndex.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "Components/ActorComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	// Maximum number of entries in a BVH leaf
+	constexpr int32 MaxLeafEntries = 8;
+
+	// The BVH is rebuilt when more than this many entries, or an eighth of the entries, are pending
+	constexpr int32 MinPendingEntriesForRebuild = 256;
+
+	TMap<TObjectKey<UWorld>, TUniquePtr<FHoudiniWorldActorIndex>> WorldActorIndices;
+
+	bool bDelegatesBound = false;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+#if WITH_EDITOR
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorsMovedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
+
+	FString
+	GetIndexedActorLabel(AActor* InActor)
+	{
+#if WITH_EDITOR
+		return InActor->GetActorLabel();
+#else
+		return FString();
+#endif
+	}
+}
+
+
+FHoudiniWorldActorIndex::FHoudiniWorldActorIndex(UWorld* InWorld)
+	: World(InWorld)
+{
+}
+
+
+FHoudiniWorldActorIndex*
+FHoudiniWorldActorIndex::Get(UWorld* InWorld)
+{
+#if WITH_EDITOR
+	// Actors in game worlds move without notification
+	if (!IsValid(InWorld) || InWorld->IsGameWorld() || !GEngine)
+		return nullptr;
+
+	check(IsInGameThread());
+
+	BindDelegates();
+
+	TUniquePtr<FHoudiniWorldActorIndex>& Index = WorldActorIndices.FindOrAdd(TObjectKey<UWorld>(InWorld));
+	if (!Index.IsValid())
+		Index = MakeUnique<FHoudiniWorldActorIndex>(InWorld);
+
+	return Index.Get();
+#else
+	return nullptr;
+#endif
+}
+
+
+FHoudiniWorldActorIndex*
+FHoudiniWorldActorIndex::Find(UWorld* InWorld)
+{
+	if (!InWorld)
+		return nullptr;
+
+	TUniquePtr<FHoudiniWorldActorIndex>* Index = WorldActorIndices.Find(TObjectKey<UWorld>(InWorld));
+	return Index ? Index->Get() : nullptr;
+}
+
+
+void
+FHoudiniWorldActorIndex::BindDelegates()
+{
+	if (bDelegatesBound)
+		return;
+
+	bDelegatesBound = true;
+
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda(
+		[](UWorld* InWorld, bool, bool) { WorldActorIndices.Remove(TObjectKey<UWorld>(InWorld)); });
+
+	auto OnLevelChanged = [](ULevel*, UWorld* InWorld)
+	{
+		if (FHoudiniWorldActorIndex* Index = Find(InWorld))
+			Index->MarkDirty();
+	};
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddLambda(OnLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddLambda(OnLevelChanged);
+
+#if WITH_EDITOR
+	auto OnActorChanged = [](AActor* InActor)
+	{
+		if (!IsValid(InActor))
+			return;
+
+		FHoudiniWorldActorIndex* Index = Find(InActor->GetWorld());
+		if (!Index)
+			return;
+
+		Index->bReceivedNotifications = true;
+		Index->AddOrUpdateActor(InActor);
+	};
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddLambda(OnActorChanged);
+	ActorMovedHandle = GEngine->OnActorMoved().AddLambda(OnActorChanged);
+	ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddLambda(OnActorChanged);
+
+	ActorsMovedHandle = GEngine->OnActorsMoved().AddLambda([OnActorChanged](TArray<AActor*>& InActors)
+	{
+		for (AActor* CurrentActor : InActors)
+			OnActorChanged(CurrentActor);
+	});
+
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddLambda([](AActor* InActor)
+	{
+		if (!InActor)
+			return;
+
+		FHoudiniWorldActorIndex* Index = Find(InActor->GetWorld());
+		if (!Index)
+			return;
+
+		Index->bReceivedNotifications = true;
+		Index->RemoveActor(InActor);
+	});
+
+	ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddLambda([]()
+	{
+		for (auto& CurrentPair : WorldActorIndices)
+		{
+			if (CurrentPair.Value.IsValid())
+				CurrentPair.Value->MarkDirty();
+		}
+	});
+
+	// Catches transform edits in the details panel, mesh changes etc.
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
+		[OnActorChanged](UObject* InObject, FPropertyChangedEvent&)
+	{
+		if (!InObject || InObject->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+			return;
+
+		AActor* Actor = Cast<AActor>(InObject);
+		if (!Actor)
+		{
+			UActorComponent* Component = Cast<UActorComponent>(InObject);
+			Actor = Component ? Component->GetOwner() : nullptr;
+		}
+
+		OnActorChanged(Actor);
+	});
+#endif
+}
+
+
+void
+FHoudiniWorldActorIndex::ReleaseAll()
+{
+	WorldActorIndices.Empty();
+
+	if (!bDelegatesBound)
+		return;
+
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+		GEngine->OnActorsMoved().Remove(ActorsMovedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+#endif
+
+	bDelegatesBound = false;
+}
+
+
+void
+FHoudiniWorldActorIndex::NotifyActorChanged(AActor* InActor)
+{
+	if (!IsValid(InActor))
+		return;
+
+	FHoudiniWorldActorIndex* Index = Find(InActor->GetWorld());
+	if (!Index)
+		return;
+
+	Index->bReceivedNotifications = true;
+	Index->AddOrUpdateActor(InActor);
+}
+
+
+void
+FHoudiniWorldActorIndex::Sync()
+{
+	UWorld* MyWorld = World.Get();
+	if (!IsValid(MyWorld))
+	{
+		Entries.Empty();
+		EntryIndices.Empty();
+		EntriesByName.Empty();
+		EntriesByLabel.Empty();
+		Nodes.Empty();
+		TreeEntries.Empty();
+		PendingEntries.Empty();
+		NumRemovedEntries = 0;
+		bDirty = true;
+		return;
+	}
+
+	// Actors can be added or removed without notification (loaded world partition cells, undo...):
+	// rebuild if the world's actor count changed while we weren't notified of anything.
+	const int32 ActorCount = MyWorld->GetActorCount();
+	if (!bReceivedNotifications && ActorCount != LastActorCount)
+		bDirty = true;
+
+	LastActorCount = ActorCount;
+	bReceivedNotifications = false;
+
+	if (bDirty)
+	{
+		RebuildFromWorld();
+	}
+	else if (PendingEntries.Num() > FMath::Max(MinPendingEntriesForRebuild, Entries.Num() / 8)
+		|| NumRemovedEntries > FMath::Max(MinPendingEntriesForRebuild, Entries.Num() / 4))
+	{
+		RebuildTree();
+	}
+}
+
+
+void
+FHoudiniWorldActorIndex::RebuildFromWorld()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniWorldActorIndex::RebuildFromWorld);
+
+	Entries.Reset();
+	EntryIndices.Reset();
+	EntriesByName.Reset();
+	EntriesByLabel.Reset();
+	PendingEntries.Reset();
+	NumRemovedEntries = 0;
+	NextSequence = 0;
+
+	UWorld* MyWorld = World.Get();
+	if (IsValid(MyWorld))
+	{
+		Entries.Reserve(MyWorld->GetActorCount());
+		for (TActorIterator<AActor> ActorIt(MyWorld, AActor::StaticClass(), EActorIteratorFlags::AllActors); ActorIt; ++ActorIt)
+			AddOrUpdateActor(*ActorIt);
+	}
+
+	bDirty = false;
+	RebuildTree();
+}
+
+
+void
+FHoudiniWorldActorIndex::RebuildTree()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniWorldActorIndex::RebuildTree);
+
+	// Compact the entries
+	if (NumRemovedEntries > 0)
+	{
+		TArray<FActorEntry> LiveEntries;
+		LiveEntries.Reserve(Entries.Num() - NumRemovedEntries);
+		for (FActorEntry& CurrentEntry : Entries)
+		{
+			if (!CurrentEntry.bRemoved)
+				LiveEntries.Add(MoveTemp(CurrentEntry));
+		}
+		Entries = MoveTemp(LiveEntries);
+		NumRemovedEntries = 0;
+
+		EntryIndices.Reset();
+		EntriesByName.Reset();
+		EntriesByLabel.Reset();
+		for (int32 EntryIdx = 0; EntryIdx < Entries.Num(); EntryIdx++)
+		{
+			const FActorEntry& CurrentEntry = Entries[EntryIdx];
+			EntryIndices.Add(CurrentEntry.Key, EntryIdx);
+			EntriesByName.Add(CurrentEntry.Name, EntryIdx);
+			if (!CurrentEntry.Label.IsEmpty())
+				EntriesByLabel.Add(CurrentEntry.Label, EntryIdx);
+		}
+	}
+
+	PendingEntries.Reset();
+	Nodes.Reset();
+	TreeEntries.SetNumUninitialized(Entries.Num());
+
+	TArray<FVector> Centers;
+	Centers.SetNumUninitialized(Entries.Num());
+	for (int32 EntryIdx = 0; EntryIdx < Entries.Num(); EntryIdx++)
+	{
+		FActorEntry& CurrentEntry = Entries[EntryIdx];
+		CurrentEntry.bInTree = true;
+		CurrentEntry.bPending = false;
+		TreeEntries[EntryIdx] = EntryIdx;
+		Centers[EntryIdx] = CurrentEntry.Bounds.GetCenter();
+	}
+
+	if (Entries.Num() <= 0)
+		return;
+
+	// Top-down build, splitting each node at the middle of the largest axis of its entries' centers
+	struct FBuildTask
+	{
+		int32 NodeIdx;
+		int32 First;
+		int32 Count;
+	};
+
+	TArray<FBuildTask> Tasks;
+	Nodes.AddDefaulted();
+	Tasks.Add({ 0, 0, Entries.Num() });
+	while (Tasks.Num() > 0)
+	{
+		const FBuildTask Task = Tasks.Pop();
+
+		FBox NodeBounds(ForceInit);
+		FBox CenterBounds(ForceInit);
+		for (int32 Idx = Task.First; Idx < Task.First + Task.Count; Idx++)
+		{
+			NodeBounds += Entries[TreeEntries[Idx]].Bounds;
+			CenterBounds += Centers[TreeEntries[Idx]];
+		}
+		Nodes[Task.NodeIdx].Bounds = NodeBounds;
+
+		if (Task.Count <= MaxLeafEntries)
+		{
+			Nodes[Task.NodeIdx].First = Task.First;
+			Nodes[Task.NodeIdx].Count = Task.Count;
+			continue;
+		}
+
+		const FVector CenterExtent = CenterBounds.GetExtent();
+		int32 Axis = 0;
+		if (CenterExtent.Y > CenterExtent[Axis])
+			Axis = 1;
+		if (CenterExtent.Z > CenterExtent[Axis])
+			Axis = 2;
+
+		const double SplitValue = CenterBounds.GetCenter()[Axis];
+		int32 Left = Task.First;
+		int32 Right = Task.First + Task.Count - 1;
+		while (Left <= Right)
+		{
+			if (Centers[TreeEntries[Left]][Axis] < SplitValue)
+				Left++;
+			else
+				Swap(TreeEntries[Left], TreeEntries[Right--]);
+		}
+
+		// All the centers are identical, split the node in two halves
+		int32 NumLeft = Left - Task.First;
+		if (NumLeft == 0 || NumLeft == Task.Count)
+			NumLeft = Task.Count / 2;
+
+		const int32 ChildIdx = Nodes.AddDefaulted(2);
+		Nodes[Task.NodeIdx].First = ChildIdx;
+		Nodes[Task.NodeIdx].Count = 0;
+
+		Tasks.Add({ ChildIdx, Task.First, NumLeft });
+		Tasks.Add({ ChildIdx + 1, Task.First + NumLeft, Task.Count - NumLeft });
+	}
+}
+
+
+void
+FHoudiniWorldActorIndex::AddOrUpdateActor(AActor* InActor)
+{
+	if (!InActor)
+		return;
+
+	const TObjectKey<AActor> Key(InActor);
+	if (const int32* FoundIdx = EntryIndices.Find(Key))
+	{
+		UpdateEntry(*FoundIdx, InActor);
+		return;
+	}
+
+	const int32 EntryIdx = Entries.AddDefaulted();
+	FActorEntry& NewEntry = Entries[EntryIdx];
+	NewEntry.Actor = InActor;
+	NewEntry.Key = Key;
+	NewEntry.Sequence = NextSequence++;
+	EntryIndices.Add(Key, EntryIdx);
+
+	UpdateEntry(EntryIdx, InActor);
+}
+
+
+void
+FHoudiniWorldActorIndex::RemoveActor(AActor* InActor)
+{
+	int32 EntryIdx = INDEX_NONE;
+	if (!InActor || !EntryIndices.RemoveAndCopyValue(TObjectKey<AActor>(InActor), EntryIdx))
+		return;
+
+	FActorEntry& Entry = Entries[EntryIdx];
+	EntriesByName.RemoveSingle(Entry.Name, EntryIdx);
+	if (!Entry.Label.IsEmpty())
+		EntriesByLabel.RemoveSingle(Entry.Label, EntryIdx);
+
+	Entry.Actor.Reset();
+	Entry.bRemoved = true;
+	Entry.bInTree = false;
+	Entry.bPending = false;
+	NumRemovedEntries++;
+}
+
+
+void
+FHoudiniWorldActorIndex::UpdateEntry(const int32& InEntryIdx, AActor* InActor)
+{
+	FActorEntry& Entry = Entries[InEntryIdx];
+
+	const FName Name = InActor->GetFName();
+	if (Entry.Name != Name)
+	{
+		EntriesByName.RemoveSingle(Entry.Name, InEntryIdx);
+		EntriesByName.Add(Name, InEntryIdx);
+		Entry.Name = Name;
+	}
+
+	const FString Label = GetIndexedActorLabel(InActor);
+	if (!Entry.Label.Equals(Label, ESearchCase::CaseSensitive))
+	{
+		if (!Entry.Label.IsEmpty())
+			EntriesByLabel.RemoveSingle(Entry.Label, InEntryIdx);
+		if (!Label.IsEmpty())
+			EntriesByLabel.Add(Label, InEntryIdx);
+		Entry.Label = Label;
+	}
+
+	// FBox::Intersect ignores IsValid, so actors without bounds intersect the boxes containing the origin
+	// when iterating over the world: keep them as a valid empty box to match that.
+	const FBox ActorBounds = InActor->GetComponentsBoundingBox(true);
+	const FBox Bounds(ActorBounds.Min, ActorBounds.Max);
+	if (Entry.bInTree && Entry.Bounds == Bounds)
+		return;
+
+	// The entry's bounds in the BVH are stale, test it linearly until the next rebuild
+	Entry.Bounds = Bounds;
+	Entry.bInTree = false;
+	if (!Entry.bPending)
+	{
+		Entry.bPending = true;
+		PendingEntries.Add(InEntryIdx);
+	}
+}
+
+
+AActor*
+FHoudiniWorldActorIndex::GetFilteredActor(const FActorEntry& InEntry, UClass* InClass, EActorIteratorFlags InFlags) const
+{
+	if (InEntry.bRemoved)
+		return nullptr;
+
+	AActor* Actor = InEntry.Actor.Get(true);
+	if (!Actor)
+		return nullptr;
+
+	if (InClass && !Actor->IsA(InClass))
+		return nullptr;
+
+	if (EnumHasAnyFlags(InFlags, EActorIteratorFlags::SkipPendingKill) && !IsValid(Actor))
+		return nullptr;
+
+	if (EnumHasAnyFlags(InFlags, EActorIteratorFlags::OnlyActiveLevels))
+	{
+		ULevel* Level = Actor->GetLevel();
+		if (!Level || !Level->bIsVisible)
+			return nullptr;
+	}
+
+	if (EnumHasAnyFlags(InFlags, EActorIteratorFlags::OnlySelectedActors) && !Actor->IsSelected())
+		return nullptr;
+
+	return Actor;
+}
+
+
+void
+FHoudiniWorldActorIndex::FindActorsInBounds(
+	const TArray<FBox>& InBounds,
+	UClass* InClass,
+	TArray<AActor*>& OutActors,
+	EActorIteratorFlags InFlags)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniWorldActorIndex::FindActorsInBounds);
+
+	Sync();
+
+	TArray<int32> FoundEntries;
+	TBitArray<> SeenEntries(false, Entries.Num());
+	auto AddFoundEntry = [&FoundEntries, &SeenEntries](const int32& InEntryIdx)
+	{
+		if (SeenEntries[InEntryIdx])
+			return;
+
+		SeenEntries[InEntryIdx] = true;
+		FoundEntries.Add(InEntryIdx);
+	};
+
+	TArray<int32, TInlineAllocator<64>> NodeStack;
+	for (const FBox& CurrentBounds : InBounds)
+	{
+		if (Nodes.Num() > 0)
+			NodeStack.Add(0);
+
+		while (NodeStack.Num() > 0)
+		{
+			const FNode& Node = Nodes[NodeStack.Pop()];
+			if (!Node.Bounds.Intersect(CurrentBounds))
+				continue;
+
+			if (Node.Count == 0)
+			{
+				NodeStack.Add(Node.First);
+				NodeStack.Add(Node.First + 1);
+				continue;
+			}
+
+			for (int32 Idx = Node.First; Idx < Node.First + Node.Count; Idx++)
+			{
+				const int32 EntryIdx = TreeEntries[Idx];
+				const FActorEntry& Entry = Entries[EntryIdx];
+				if (Entry.bInTree && Entry.Bounds.Intersect(CurrentBounds))
+					AddFoundEntry(EntryIdx);
+			}
+		}
+
+		for (const int32& EntryIdx : PendingEntries)
+		{
+			const FActorEntry& Entry = Entries[EntryIdx];
+			if (Entry.bPending && !Entry.bRemoved && Entry.Bounds.Intersect(CurrentBounds))
+				AddFoundEntry(EntryIdx);
+		}
+	}
+
+	// Return the actors in a stable order
+	FoundEntries.Sort([this](const int32& A, const int32& B) { return Entries[A].Sequence < Entries[B].Sequence; });
+
+	for (const int32& EntryIdx : FoundEntries)
+	{
+		if (AActor* Actor = GetFilteredActor(Entries[EntryIdx], InClass, InFlags))
+			OutActors.Add(Actor);
+	}
+}
+
+
+AActor*
+FHoudiniWorldActorIndex::FindFirstActor(
+	TArray<int32>& InCandidates,
+	UClass* InClass,
+	EActorIteratorFlags InFlags,
+	TFunctionRef<bool(AActor*)> InMatches) const
+{
+	InCandidates.Sort([this](const int32& A, const int32& B) { return Entries[A].Sequence < Entries[B].Sequence; });
+
+	for (const int32& EntryIdx : InCandidates)
+	{
+		// The actor may have been renamed without notification
+		AActor* Actor = GetFilteredActor(Entries[EntryIdx], InClass, InFlags);
+		if (Actor && InMatches(Actor))
+			return Actor;
+	}
+
+	return nullptr;
+}
+
+
+AActor*
+FHoudiniWorldActorIndex::FindActorByName(const FName& InName, UClass* InClass, EActorIteratorFlags InFlags)
+{
+	Sync();
+
+	TArray<int32> Candidates;
+	EntriesByName.MultiFind(InName, Candidates);
+
+	return FindFirstActor(Candidates, InClass, InFlags,
+		[&InName](AActor* InActor) { return InActor->GetFName() == InName; });
+}
+
+
+AActor*
+FHoudiniWorldActorIndex::FindActorByLabel(const FString& InLabel, UClass* InClass, EActorIteratorFlags InFlags)
+{
+	Sync();
+
+	TArray<int32> Candidates;
+	EntriesByLabel.MultiFind(InLabel, Candidates);
+
+	return FindFirstActor(Candidates, InClass, InFlags,
+		[&InLabel](AActor* InActor) { return GetIndexedActorLabel(InActor) == InLabel; });
+}
+
+
+AActor*
+FHoudiniWorldActorIndex::FindActorByLabelOrName(const FString& InLabelOrName, UClass* InClass, EActorIteratorFlags InFlags)
+{
+	Sync();
+
+	TArray<int32> Candidates;
+	EntriesByLabel.MultiFind(InLabelOrName, Candidates);
+
+	// Don't add the string to the name table if no object uses it
+	const FName Name(*InLabelOrName, FNAME_Find);
+	if (Name != NAME_None)
+	{
+		TArray<int32> NameCandidates;
+		EntriesByName.MultiFind(Name, NameCandidates);
+		for (const int32& EntryIdx : NameCandidates)
+			Candidates.AddUnique(EntryIdx);
+	}
+
+	return FindFirstActor(Candidates, InClass, InFlags, [&InLabelOrName](AActor* InActor)
+	{
+		return GetIndexedActorLabel(InActor) == InLabelOrName || InActor->GetFName().ToString() == InLabelOrName;
+	});
+}
@@ -0,0 +1,163 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EngineUtils.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class UWorld;
+
+// Spatial and name index over the actors of an editor world.
+//
+// Actors are indexed by their components bounding box in a BVH, and by name and label in hash maps,
+// so that the bound selectors of world inputs and the actor lookups by name / label don't have to
+// iterate over every actor in the world.
+// The index is built on first use, then kept up to date from the editor's actor added, deleted,
+// moved and label changed notifications. Actors added or moved since the BVH was built are kept in
+// a small pending list that is tested linearly, the BVH is rebuilt once that list grows too large.
+// Level changes, or actors added or removed without notification, cause a full rebuild on the next query.
+// Actors whose bounds change without notification (e.g. HDA outputs) must be refreshed with NotifyActorChanged().
+//
+// Indices are only kept for editor worlds, Get() returns null for game worlds and in non-editor builds,
+// callers then have to iterate over the world's actors.
+class HOUDINIENGINERUNTIME_API FHoudiniWorldActorIndex
+{
+public:
+
+	FHoudiniWorldActorIndex(UWorld* InWorld);
+
+	// Returns the index of the given world, creating it if needed. Must be called on the game thread.
+	static FHoudiniWorldActorIndex* Get(UWorld* InWorld);
+
+	// Releases all the indices and the engine delegates keeping them up to date.
+	static void ReleaseAll();
+
+	// Updates the actor's entry after it was moved, resized, renamed or relabeled outside of the editor's notifications.
+	static void NotifyActorChanged(AActor* InActor);
+
+	// Finds the actors of the given class whose components bounds intersect any of the given boxes.
+	// The actors are returned in the order they were indexed.
+	void FindActorsInBounds(
+		const TArray<FBox>& InBounds,
+		UClass* InClass,
+		TArray<AActor*>& OutActors,
+		EActorIteratorFlags InFlags = EActorIteratorFlags::OnlyActiveLevels | EActorIteratorFlags::SkipPendingKill);
+
+	// Finds the first indexed actor of the given class with the given name.
+	AActor* FindActorByName(const FName& InName, UClass* InClass, EActorIteratorFlags InFlags = EActorIteratorFlags::AllActors);
+
+	// Finds the first indexed actor of the given class with the given label.
+	AActor* FindActorByLabel(const FString& InLabel, UClass* InClass, EActorIteratorFlags InFlags = EActorIteratorFlags::AllActors);
+
+	// Finds the first indexed actor of the given class whose label or name matches the given string.
+	AActor* FindActorByLabelOrName(const FString& InLabelOrName, UClass* InClass, EActorIteratorFlags InFlags = EActorIteratorFlags::AllActors);
+
+	// Forces the index to be rebuilt from the world's actors on the next query.
+	void MarkDirty() { bDirty = true; };
+
+	// Returns the number of indexed actors. Only valid after a query.
+	int32 GetNumActors() const { return EntryIndices.Num(); };
+
+protected:
+
+	struct FActorEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> Key;
+		// Components bounding box, always flagged as valid (see UpdateEntry).
+		FBox Bounds = FBox(ForceInit);
+		FName Name;
+		FString Label;
+		// Order in which the actor was indexed, results are sorted on it.
+		uint64 Sequence = 0;
+		bool bRemoved = false;
+		bool bInTree = false;
+		bool bPending = false;
+	};
+
+	// BVH node: leaves reference Count entries in TreeEntries from First,
+	// inner nodes (Count == 0) have their two children at First and First + 1.
+	struct FNode
+	{
+		FBox Bounds = FBox(ForceInit);
+		int32 First = 0;
+		int32 Count = 0;
+	};
+
+	// Applies pending rebuilds before a query.
+	void Sync();
+
+	// Rebuilds the entries and the BVH from the world's actors.
+	void RebuildFromWorld();
+
+	// Rebuilds the BVH, dropping removed entries.
+	void RebuildTree();
+
+	void AddOrUpdateActor(AActor* InActor);
+	void RemoveActor(AActor* InActor);
+	void UpdateEntry(const int32& InEntryIdx, AActor* InActor);
+
+	// Returns the actor of the entry if it passes the class and iterator flags filters.
+	AActor* GetFilteredActor(const FActorEntry& InEntry, UClass* InClass, EActorIteratorFlags InFlags) const;
+
+	// Returns the actor with the lowest sequence among the given candidate entries that passes the filters and still matches.
+	AActor* FindFirstActor(
+		TArray<int32>& InCandidates,
+		UClass* InClass,
+		EActorIteratorFlags InFlags,
+		TFunctionRef<bool(AActor*)> InMatches) const;
+
+	// Binds the engine delegates used to keep the indices up to date.
+	static void BindDelegates();
+
+	// Returns the index of the given world if it has been created.
+	static FHoudiniWorldActorIndex* Find(UWorld* InWorld);
+
+	TWeakObjectPtr<UWorld> World;
+
+	TArray<FActorEntry> Entries;
+	TMap<TObjectKey<AActor>, int32> EntryIndices;
+	TMultiMap<FName, int32> EntriesByName;
+	TMultiMap<FString, int32> EntriesByLabel;
+
+	TArray<FNode> Nodes;
+	TArray<int32> TreeEntries;
+
+	// Entries added or moved since the BVH was built
+	TArray<int32> PendingEntries;
+	int32 NumRemovedEntries = 0;
+
+	uint64 NextSequence = 0;
+
+	// World actor count at the last query, used to detect changes made without notification
+	int32 LastActorCount = INDEX_NONE;
+	bool bReceivedNotifications = false;
+	bool bDirty = true;
+};
@@ -578,6 +578,15 @@ public:
 	/** Clears the dirty flag on the node. See IsDirty(). */
 	virtual void ClearDirtyFlag() { bIsDirty = false; }
 
+	/**
+	 * Returns the hash of the content that was last sent to Houdini for this node. Empty if the node's content is
+	 * not hashed. Dirty nodes with an unchanged content hash do not need to be resent.
+	 */
+	const FString& GetContentHash() const { return ContentHash; }
+
+	/** Sets the hash of the content that was last sent to Houdini for this node. See GetContentHash(). */
+	void SetContentHash(const FString& InContentHash) { ContentHash = InContentHash; }
+
 	/** Returns true if this node is ref counted by the manager. */
 	virtual bool IsRefCounted() const { return false; }
 
@@ -738,6 +747,9 @@ private:
 	/** Indicates if the node is dirty or not. Dirty nodes should have their data resent to Houdini. */
 	bool bIsDirty;
 
+	/** Hash of the content that was last sent to Houdini for this node, empty if unknown. */
+	FString ContentHash;
+
 	/** The reference count of this node. */
 	mutable int32 ReferenceCount;
 